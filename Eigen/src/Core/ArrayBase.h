@@ -152,6 +152,8 @@ template<typename Derived> class ArrayBase
     template<typename OtherDerived>
     Derived& operator/=(const ArrayBase<OtherDerived>& other);
 
+    NoAlias<Derived,Eigen::ArrayBase > noalias();
+
   public:
     ArrayBase<Derived>& array() { return *this; }
     const ArrayBase<Derived>& array() const { return *this; }
@@ -236,4 +238,18 @@ ArrayBase<Derived>::operator/=(const ArrayBase<OtherDerived>& other)
   return derived();
 }
 
+/** \returns a pseudo expression of \c *this with an operator= assuming
+  * no aliasing between \c *this and the source expression.
+  *
+  * With arrays, noalias() is only useful to let large coefficient-wise
+  * assignments be evaluated by several threads when OpenMP is enabled.
+  *
+  * \sa MatrixBase::noalias(), class NoAlias
+  */
+template<typename Derived>
+NoAlias<Derived,ArrayBase> ArrayBase<Derived>::noalias()
+{
+  return derived();
+}
+
 #endif // EIGEN_ARRAYBASE_H
@@ -486,10 +486,213 @@ struct assign_impl<Derived1, Derived2, SliceVectorizedTraversal, NoUnrolling, Ve
   }
 };
 
+/***************************************************************************
+* Part 4 : parallel evaluation
+***************************************************************************/
+
+// Evaluates the range [start,end) of the outer vectors of the destination,
+// this is used for the default, inner vectorized and slice vectorized traversals.
+template<typename Derived1, typename Derived2, int Traversal = assign_traits<Derived1, Derived2>::Traversal>
+struct assign_range_impl
+{
+  typedef typename Derived1::Index Index;
+  static inline void run(Derived1 &dst, const Derived2 &src, Index start, Index end)
+  {
+    const Index innerSize = dst.innerSize();
+    for(Index outer = start; outer < end; ++outer)
+      for(Index inner = 0; inner < innerSize; ++inner)
+        dst.copyCoeffByOuterInner(outer, inner, src);
+  }
+};
+
+template<typename Derived1, typename Derived2>
+struct assign_range_impl<Derived1, Derived2, InnerVectorizedTraversal>
+{
+  typedef typename Derived1::Index Index;
+  static inline void run(Derived1 &dst, const Derived2 &src, Index start, Index end)
+  {
+    const Index innerSize = dst.innerSize();
+    const Index packetSize = packet_traits<typename Derived1::Scalar>::size;
+    for(Index outer = start; outer < end; ++outer)
+      for(Index inner = 0; inner < innerSize; inner+=packetSize)
+        dst.template copyPacketByOuterInner<Derived2, Aligned, Aligned>(outer, inner, src);
+  }
+};
+
+template<typename Derived1, typename Derived2>
+struct assign_range_impl<Derived1, Derived2, SliceVectorizedTraversal>
+{
+  typedef typename Derived1::Index Index;
+  static inline void run(Derived1 &dst, const Derived2 &src, Index start, Index end)
+  {
+    typedef packet_traits<typename Derived1::Scalar> PacketTraits;
+    enum {
+      packetSize = PacketTraits::size,
+      alignable = PacketTraits::AlignedOnScalar,
+      dstAlignment = alignable ? Aligned : int(assign_traits<Derived1,Derived2>::DstIsAligned)
+    };
+    const Index packetAlignedMask = packetSize - 1;
+    const Index innerSize = dst.innerSize();
+
+    for(Index outer = start; outer < end; ++outer)
+    {
+      // only the first outer vector is aligned when DstIsAligned is set
+      const Index alignedStart = (!alignable) ? 0
+                               : internal::first_aligned(Derived1::IsRowMajor ? &dst.coeffRef(outer,0) : &dst.coeffRef(0,outer), innerSize);
+      const Index alignedEnd = alignedStart + ((innerSize-alignedStart) & ~packetAlignedMask);
+
+      for(Index inner = 0; inner<alignedStart ; ++inner)
+        dst.copyCoeffByOuterInner(outer, inner, src);
+
+      for(Index inner = alignedStart; inner<alignedEnd; inner+=packetSize)
+        dst.template copyPacketByOuterInner<Derived2, dstAlignment, Unaligned>(outer, inner, src);
+
+      for(Index inner = alignedEnd; inner<innerSize ; ++inner)
+        dst.copyCoeffByOuterInner(outer, inner, src);
+    }
+  }
+};
+
+// Evaluates the range [start,end) of the coefficients of the destination,
+// start must be a multiple of the packet size.
+template<typename Derived1, typename Derived2>
+struct assign_range_impl<Derived1, Derived2, LinearTraversal>
+{
+  typedef typename Derived1::Index Index;
+  static inline void run(Derived1 &dst, const Derived2 &src, Index start, Index end)
+  {
+    for(Index index = start; index < end; ++index)
+      dst.copyCoeff(index, src);
+  }
+};
+
+template<typename Derived1, typename Derived2>
+struct assign_range_impl<Derived1, Derived2, LinearVectorizedTraversal>
+{
+  typedef typename Derived1::Index Index;
+  static inline void run(Derived1 &dst, const Derived2 &src, Index start, Index end)
+  {
+    typedef packet_traits<typename Derived1::Scalar> PacketTraits;
+    enum {
+      packetSize = PacketTraits::size,
+      dstAlignment = PacketTraits::AlignedOnScalar ? Aligned : int(assign_traits<Derived1,Derived2>::DstIsAligned) ,
+      srcAlignment = assign_traits<Derived1,Derived2>::JointAlignment
+    };
+    const Index alignedStart = assign_traits<Derived1,Derived2>::DstIsAligned ? start
+                             : start + internal::first_aligned(&dst.coeffRef(start), end-start);
+    const Index alignedEnd = alignedStart + ((end-alignedStart)/packetSize)*packetSize;
+
+    for(Index index = start; index < alignedStart; ++index)
+      dst.copyCoeff(index, src);
+
+    for(Index index = alignedStart; index < alignedEnd; index += packetSize)
+      dst.template copyPacket<Derived2, dstAlignment, srcAlignment>(index, src);
+
+    for(Index index = alignedEnd; index < end; ++index)
+      dst.copyCoeff(index, src);
+  }
+};
+
+// The nullary functors, like the one of Random(), may have a state and are only called by a single thread.
+// The non repeatable ones are evaluated before being nested into another expression.
+template<typename Derived> struct assign_parallel_safe { enum { ret = 1 }; };
+template<typename NullaryOp, typename PlainObjectType> struct assign_parallel_safe<CwiseNullaryOp<NullaryOp,PlainObjectType> > { enum { ret = 0 }; };
+
+// Splits the evaluation of a large assignment over several threads.
+// The destination must not alias the source, and run() returns false,
+// without doing anything, when the assignment is better done sequentially.
+template<typename Derived1, typename Derived2,
+         bool MayRunInParallel = int(Derived1::MaxSizeAtCompileTime) == Dynamic
+                              && assign_parallel_safe<Derived2>::ret
+                              && int(assign_traits<Derived1, Derived2>::Unrolling) != int(CompleteUnrolling)
+                              && int(assign_traits<Derived1, Derived2>::Traversal) != int(InvalidTraversal)
+                              && !(int(Derived2::Flags) & EvalBeforeAssigningBit)
+                              && is_same<typename Derived1::Scalar,typename Derived2::Scalar>::value>
+struct assign_parallel
+{
+  static inline bool run(Derived1 &, const Derived2 &) { return false; }
+};
+
+template<typename Derived1, typename Derived2>
+struct assign_parallel<Derived1, Derived2, true>
+{
+  typedef typename Derived1::Index Index;
+  enum {
+    Traversal = assign_traits<Derived1, Derived2>::Traversal,
+    Linear = int(Traversal) == int(LinearTraversal) || int(Traversal) == int(LinearVectorizedTraversal),
+    PacketSize = packet_traits<typename Derived1::Scalar>::size,
+    Cost = int(Derived2::CoeffReadCost) == Dynamic ? 100 : int(Derived2::CoeffReadCost) > 1 ? int(Derived2::CoeffReadCost) : 1
+  };
+
+  static inline bool run(Derived1 &dst, const Derived2 &src)
+  {
+    // let the sequential path deal with resizing
+    if(dst.rows() != src.rows() || dst.cols() != src.cols())
+      return false;
+    const Index range = Linear ? dst.size() : dst.outerSize();
+    int threads = parallel_eval_threads(dst.size() * Cost);
+    if(threads > range)
+      threads = int(range);
+    if(threads <= 1)
+      return false;
+#ifdef EIGEN_HAS_OPENMP
+    // the chunks of a linear traversal start on a packet boundary
+    const Index chunk = Linear ? ((range + threads*PacketSize - 1) / (threads*PacketSize)) * PacketSize
+                               : (range + threads - 1) / threads;
+    #pragma omp parallel for schedule(static) num_threads(threads)
+    for(int i = 0; i < threads; ++i)
+    {
+      const Index start = i * chunk;
+      const Index end = (std::min)(range, start + chunk);
+      if(start < end)
+        assign_range_impl<Derived1, Derived2>::run(dst, src, start, end);
+    }
+    return true;
+#else
+    return false;
+#endif
+  }
+};
+
+// the pseudo expressions reimplementing copyCoeff cannot be written through their data
+template<typename Derived> struct assign_writes_data { enum { ret = 1 }; };
+template<typename ExpressionType> struct assign_writes_data<SwapWrapper<ExpressionType> > { enum { ret = 0 }; };
+template<typename BinOp, typename Lhs, typename Rhs> struct assign_writes_data<SelfCwiseBinaryOp<BinOp,Lhs,Rhs> > { enum { ret = 0 }; };
+
+// Copies between objects with direct access and opposite storage orders, like dst = src.transpose(),
+// with the tiled transposition kernel rather than reading one of the sides with a large stride.
+// run() returns false, without doing anything, when the assignment is not of that kind.
+template<typename Derived1, typename Derived2,
+         bool MayTranspose = int(Derived1::MaxSizeAtCompileTime) == Dynamic
+                          && assign_writes_data<Derived1>::ret
+                          && (int(Derived1::Flags) & int(Derived2::Flags) & DirectAccessBit)
+                          && ((int(Derived1::Flags) ^ int(Derived2::Flags)) & RowMajorBit)
+                          && !Derived1::IsVectorAtCompileTime && !Derived2::IsVectorAtCompileTime
+                          && is_same<typename Derived1::Scalar,typename Derived2::Scalar>::value>
+struct assign_transposed
+{
+  static inline bool run(Derived1 &, const Derived2 &) { return false; }
+};
+
+template<typename Derived1, typename Derived2>
+struct assign_transposed<Derived1, Derived2, true>
+{
+  static inline bool run(Derived1 &dst, const Derived2 &src)
+  {
+    if(dst.rows() != src.rows() || dst.cols() != src.cols() || dst.size() == 0
+       || dst.innerStride() != 1 || src.innerStride() != 1)
+      return false;
+    // the inner vectors of the source are the outer vectors of the destination
+    blocked_transpose<typename Derived1::Scalar>::copy(dst.data(), dst.outerStride(), src.data(), src.outerStride(),
+                                                       src.innerSize(), src.outerSize());
+    return true;
+  }
+};
+
 } // end namespace internal
 
 /***************************************************************************
-* Part 4 : implementation of DenseBase methods
+* Part 5 : implementation of DenseBase methods
 ***************************************************************************/
 
 template<typename Derived>
@@ -509,8 +712,9 @@ EIGEN_STRONG_INLINE Derived& DenseBase<Derived>
   internal::assign_traits<Derived, OtherDerived>::debug();
 #endif
   eigen_assert(rows() == other.rows() && cols() == other.cols());
-  internal::assign_impl<Derived, OtherDerived, int(SameType) ? int(internal::assign_traits<Derived, OtherDerived>::Traversal)
-                                                       : int(InvalidTraversal)>::run(derived(),other.derived());
+  if(!internal::assign_transposed<Derived, OtherDerived>::run(derived(), other.derived()))
+    internal::assign_impl<Derived, OtherDerived, int(SameType) ? int(internal::assign_traits<Derived, OtherDerived>::Traversal)
+                                                         : int(InvalidTraversal)>::run(derived(),other.derived());
 #ifndef EIGEN_NO_DEBUG
   checkTransposeAliasing(other.derived());
 #endif
@@ -547,6 +751,16 @@ struct assign_selector<Derived,OtherDerived,true,true> {
   static EIGEN_STRONG_INLINE Derived& run(Derived& dst, const OtherDerived& other) { return dst.lazyAssign(other.transpose().eval()); }
 };
 
+/** \internal Performs dst = other assuming no aliasing between dst and other.
+  * Large coefficient-wise assignments are evaluated by several threads. */
+template<typename Derived, typename OtherDerived>
+EIGEN_STRONG_INLINE Derived& noalias_assign(Derived& dst, const OtherDerived& other)
+{
+  if(assign_transposed<Derived, OtherDerived>::run(dst, other) || assign_parallel<Derived, OtherDerived>::run(dst, other))
+    return dst;
+  return assign_selector<Derived,OtherDerived,false>::run(dst, other);
+}
+
 } // end namespace internal
 
 template<typename Derived>
@@ -0,0 +1,171 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef EIGEN_BLOCKED_TRANSPOSE_H
+#define EIGEN_BLOCKED_TRANSPOSE_H
+
+namespace internal {
+
+/** \internal
+  * \brief Transposition kernels working on raw column-major data
+  *
+  * A matrix X is given by a pointer x and an outer stride, such that X(i,j) = x[i + j*stride].
+  * The matrices are processed by tiles small enough to stay in the L1 cache, such that
+  * each cache line of the strided operand is fetched only once, and the tiles are
+  * made of square blocks of the size of a packet which are transposed in registers.
+  */
+template<typename Scalar, bool Vectorize = packet_traits<Scalar>::Vectorizable && !NumTraits<Scalar>::IsComplex>
+struct blocked_transpose
+{
+  typedef DenseIndex Index;
+  typedef typename conditional<Vectorize, typename packet_traits<Scalar>::type, Scalar>::type Packet;
+  enum {
+    PacketSize = Vectorize ? int(packet_traits<Scalar>::size) : 1,
+    TileSize = 64
+  };
+
+  static EIGEN_STRONG_INLINE void load(Packet* kernel, const Scalar* x, Index stride)
+  {
+    for(int k=0; k<PacketSize; ++k)
+      kernel[k] = ploadu<Packet>(x + k*stride);
+  }
+
+  static EIGEN_STRONG_INLINE void store(Scalar* x, Index stride, const Packet* kernel)
+  {
+    for(int k=0; k<PacketSize; ++k)
+      pstoreu(x + k*stride, kernel[k]);
+  }
+
+  // copies the transpose of the rows x cols matrix src into dst
+  static void copy(Scalar* dst, Index dstStride, const Scalar* src, Index srcStride, Index rows, Index cols)
+  {
+    const Index rowsP = (rows/PacketSize)*PacketSize;
+    const Index colsP = (cols/PacketSize)*PacketSize;
+    const Index tiles = (colsP + TileSize - 1) / TileSize;
+#ifdef EIGEN_HAS_OPENMP
+    const int threads = parallel_eval_threads(rows*cols);
+    #pragma omp parallel for schedule(static) num_threads(threads) if(threads>1)
+#endif
+    for(Index t = 0; t < tiles; ++t)
+    {
+      const Index j0 = t*TileSize, j1 = (std::min)(colsP, j0+TileSize);
+      for(Index i0 = 0; i0 < rowsP; i0 += TileSize)
+      {
+        const Index i1 = (std::min)(rowsP, i0+TileSize);
+        for(Index j = j0; j < j1; j += PacketSize)
+          for(Index i = i0; i < i1; i += PacketSize)
+          {
+            Packet kernel[PacketSize];
+            load(kernel, src + i + j*srcStride, srcStride);
+            ptranspose(kernel);
+            store(dst + j + i*dstStride, dstStride, kernel);
+          }
+      }
+      for(Index j = j0; j < j1; ++j)
+        for(Index i = rowsP; i < rows; ++i)
+          dst[j + i*dstStride] = src[i + j*srcStride];
+    }
+    for(Index j = colsP; j < cols; ++j)
+      for(Index i = 0; i < rows; ++i)
+        dst[j + i*dstStride] = src[i + j*srcStride];
+  }
+
+  // transposes the n x n matrix x in place
+  static void square_in_place(Scalar* x, Index stride, Index n)
+  {
+    const Index nP = (n/PacketSize)*PacketSize;
+    const Index tiles = (nP + TileSize - 1) / TileSize;
+#ifdef EIGEN_HAS_OPENMP
+    const int threads = parallel_eval_threads(n*n);
+    #pragma omp parallel for schedule(static,1) num_threads(threads) if(threads>1)
+#endif
+    for(Index t = 0; t < tiles; ++t)
+    {
+      const Index j0 = t*TileSize, j1 = (std::min)(nP, j0+TileSize);
+      // the tiles of the strictly upper part of the tile column are swapped with their transposed counterparts
+      for(Index i0 = 0; i0 <= j0; i0 += TileSize)
+      {
+        const Index i1 = (std::min)(nP, i0+TileSize);
+        for(Index j = j0; j < j1; j += PacketSize)
+          for(Index i = i0; i < (std::min)(i1, j+1); i += PacketSize)
+          {
+            Packet a[PacketSize];
+            load(a, x + i + j*stride, stride);
+            ptranspose(a);
+            if(i == j)
+            {
+              store(x + i + j*stride, stride, a);
+              continue;
+            }
+            Packet b[PacketSize];
+            load(b, x + j + i*stride, stride);
+            ptranspose(b);
+            store(x + j + i*stride, stride, a);
+            store(x + i + j*stride, stride, b);
+          }
+      }
+    }
+    for(Index j = nP; j < n; ++j)
+      for(Index i = 0; i < j; ++i)
+        std::swap(x[i + j*stride], x[j + i*stride]);
+  }
+};
+
+/** \internal
+  * Transposes the contiguous rows x cols matrix x in place, such that it becomes the cols x rows
+  * column-major matrix of its transpose, by following the cycles of the permutation of the coefficients.
+  * A bit per coefficient records which ones have already been moved.
+  */
+template<typename Scalar>
+void rectangular_transpose_in_place(Scalar* x, DenseIndex rows, DenseIndex cols)
+{
+  typedef DenseIndex Index;
+  const Index size = rows*cols;
+  if(rows <= 1 || cols <= 1)
+    return;
+  const Index bytes = (size + 7) / 8;
+  ei_declare_aligned_stack_constructed_variable(unsigned char, moved, bytes, 0);
+  std::memset(moved, 0, bytes);
+  // the first and last coefficients do not move
+  for(Index start = 1; start < size-1; ++start)
+  {
+    if(moved[start/8] & (1<<(start%8)))
+      continue;
+    // the coefficient ending up at position p = a + b*cols of the transpose is at b + a*rows
+    const Scalar first = x[start];
+    Index p = start;
+    for(;;)
+    {
+      const Index from = (p % cols) * rows + p / cols;
+      moved[p/8] |= (unsigned char)(1<<(p%8));
+      if(from == start)
+        break;
+      x[p] = x[from];
+      p = from;
+    }
+    x[p] = first;
+  }
+}
+
+} // end namespace internal
+
+#endif // EIGEN_BLOCKED_TRANSPOSE_H
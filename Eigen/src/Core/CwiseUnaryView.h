@@ -119,7 +119,7 @@ class CwiseUnaryViewImpl<ViewOp,MatrixType,Dense>
 
     inline Index outerStride() const
     {
-      return derived().nestedExpression().outerStride();
+      return derived().nestedExpression().outerStride() * sizeof(typename internal::traits<MatrixType>::Scalar) / sizeof(Scalar);
     }
 
     EIGEN_STRONG_INLINE CoeffReturnType coeff(Index row, Index col) const
@@ -141,6 +141,16 @@ class CwiseUnaryViewImpl<ViewOp,MatrixType,Dense>
     {
       return derived().functor()(const_cast_derived().nestedExpression().coeffRef(index));
     }
+
+    EIGEN_STRONG_INLINE const Scalar& coeffRef(Index row, Index col) const
+    {
+      return derived().functor()(derived().nestedExpression().coeffRef(row, col));
+    }
+
+    EIGEN_STRONG_INLINE const Scalar& coeffRef(Index index) const
+    {
+      return derived().functor()(derived().nestedExpression().coeffRef(index));
+    }
 };
 
 
@@ -273,6 +273,9 @@ template<typename Derived> class DenseBase
     /** Copies \a other into *this without evaluating other. \returns a reference to *this. */
     template<typename OtherDerived>
     Derived& lazyAssign(const DenseBase<OtherDerived>& other);
+
+    template<typename MatrixType, typename MemberOp, int Direction>
+    Derived& lazyAssign(const PartialReduxExpr<MatrixType, MemberOp, Direction>& other);
 #endif // not EIGEN_PARSED_BY_DOXYGEN
 
     CommaInitializer<Derived> operator<< (const Scalar& s);
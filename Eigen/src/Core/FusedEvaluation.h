@@ -0,0 +1,344 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef EIGEN_FUSED_EVALUATION_H
+#define EIGEN_FUSED_EVALUATION_H
+
+namespace internal {
+
+/** \internal
+  * Base class of the statements recorded by a FusedEvaluation.
+  *
+  * The statements are evaluated on ranges [start,end) of the linear index of the coefficients,
+  * in the storage order of the context. Those without linear access are only given ranges
+  * made of whole outer vectors.
+  */
+class fused_statement
+{
+  public:
+    typedef DenseIndex Index;
+
+    fused_statement(Index rows, Index cols, bool isRowMajor, bool linear, Index bytesPerCoeff)
+      : m_next(0), m_rows(rows), m_cols(cols), m_isRowMajor(isRowMajor), m_linear(linear), m_bytesPerCoeff(bytesPerCoeff)
+    {}
+    virtual ~fused_statement() {}
+
+    // called before the first range, and after the last one
+    virtual void begin() {}
+    virtual void end() {}
+    virtual void run(Index start, Index end) = 0;
+
+    Index innerSize() const { return m_isRowMajor ? m_cols : m_rows; }
+
+    fused_statement* m_next;
+    const Index m_rows, m_cols;
+    const bool m_isRowMajor, m_linear;
+    const Index m_bytesPerCoeff;
+};
+
+template<typename Dest, typename Src,
+         int Traversal = assign_traits<Dest, typename remove_all<typename Src::Nested>::type>::Traversal,
+         bool Linear = int(Traversal)==int(LinearTraversal) || int(Traversal)==int(LinearVectorizedTraversal)>
+class fused_assignment : public fused_statement
+{
+    typedef typename remove_all<typename Src::Nested>::type NestedSrc;
+  public:
+    fused_assignment(Dest& dst, const Src& src)
+      : fused_statement(dst.rows(), dst.cols(), Dest::IsRowMajor, Linear, sizeof(typename Dest::Scalar)),
+        m_dst(dst), m_src(src)
+    {}
+
+    void run(Index start, Index end)
+    {
+      if(Linear)
+        assign_range_impl<Dest, NestedSrc>::run(m_dst, m_src, start, end);
+      else
+        assign_range_impl<Dest, NestedSrc>::run(m_dst, m_src, start / innerSize(), end / innerSize());
+    }
+
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  protected:
+    // expressions like blocks are usually temporaries, and are kept by value
+    typename conditional<bool(traits<Dest>::Flags & NestByRefBit), Dest&, Dest>::type m_dst;
+    typename Src::Nested m_src;
+};
+
+template<typename Func, typename Xpr,
+         int Traversal = redux_traits<Func, Xpr>::Traversal,
+         bool Linear = (int(Xpr::Flags) & LinearAccessBit) != 0>
+struct fused_redux_range
+{
+  typedef typename Xpr::Scalar Scalar;
+  typedef typename Xpr::Index Index;
+  static Scalar run(const Xpr& xpr, const Func& func, Index start, Index end, Index)
+  {
+    Scalar res = xpr.coeff(start);
+    for(Index index = start+1; index < end; ++index)
+      res = func(res, xpr.coeff(index));
+    return res;
+  }
+};
+
+template<typename Func, typename Xpr>
+struct fused_redux_range<Func, Xpr, LinearVectorizedTraversal, true>
+{
+  typedef typename Xpr::Scalar Scalar;
+  typedef typename Xpr::Index Index;
+  static Scalar run(const Xpr& xpr, const Func& func, Index start, Index end, Index)
+  {
+    return redux_impl<Func, Xpr, LinearVectorizedTraversal, NoUnrolling>::run(xpr, func, start, end);
+  }
+};
+
+template<typename Func, typename Xpr, int Traversal>
+struct fused_redux_range<Func, Xpr, Traversal, false>
+{
+  typedef typename Xpr::Scalar Scalar;
+  typedef typename Xpr::Index Index;
+  static Scalar run(const Xpr& xpr, const Func& func, Index start, Index end, Index innerSize)
+  {
+    Scalar res = xpr.coeffByOuterInner(start / innerSize, 0);
+    for(Index inner = 1; inner < innerSize; ++inner)
+      res = func(res, xpr.coeffByOuterInner(start / innerSize, inner));
+    for(Index outer = start / innerSize + 1; outer < end / innerSize; ++outer)
+      for(Index inner = 0; inner < innerSize; ++inner)
+        res = func(res, xpr.coeffByOuterInner(outer, inner));
+    return res;
+  }
+};
+
+template<typename Func, typename Xpr>
+class fused_redux : public fused_statement
+{
+    typedef typename Xpr::Scalar Scalar;
+    typedef typename remove_all<typename Xpr::Nested>::type NestedXpr;
+  public:
+    fused_redux(const Xpr& xpr, const Func& func, Scalar& result)
+      : fused_statement(xpr.rows(), xpr.cols(), Xpr::IsRowMajor, (int(NestedXpr::Flags) & LinearAccessBit) != 0, 0),
+        m_xpr(xpr), m_func(func), m_result(result), m_first(true)
+    {}
+
+    void begin() { m_first = true; }
+    void end() { m_result = m_res; }
+
+    void run(Index start, Index end)
+    {
+      const Scalar partial = fused_redux_range<Func, NestedXpr>::run(m_xpr, m_func, start, end, innerSize());
+      m_res = m_first ? partial : m_func(m_res, partial);
+      m_first = false;
+    }
+
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  protected:
+    typename Xpr::Nested m_xpr;
+    const Func m_func;
+    Scalar& m_result;
+    Scalar m_res;
+    bool m_first;
+};
+
+} // end namespace internal
+
+/** \class FusedEvaluation
+  * \ingroup Core_Module
+  *
+  * \brief Evaluates several coefficient-wise assignments and reductions in a single pass
+  *
+  * Each assignment statement makes its own pass over the memory, so that in a sequence like
+  * \code
+  * a = b + c;
+  * d = a.cwiseProduct(e);
+  * s = d.sum();
+  * \endcode
+  * \c a and \c d are written to memory and read back later. A FusedEvaluation records such statements,
+  * and evaluate() runs all of them on a first tile of the coefficients, then all of them on the next tile,
+  * and so on, so that the coefficients produced by a statement are still in cache when the next ones read them:
+  * \code
+  * FusedEvaluation fused;
+  * fused.assign(a, b + c);
+  * fused.assign(d, a.cwiseProduct(e));
+  * fused.sum(d, s);
+  * fused.evaluate();
+  * \endcode
+  * The tiles are sized such that the coefficients written by the statements fit in half of the L1 cache,
+  * see setCpuCacheSizes().
+  *
+  * All the recorded objects must have the same sizes, and the same storage order for those which are not vectors.
+  * The statements are not evaluated when they are recorded, and their expressions are nested as in
+  * any other expression, so the objects they refer to must not be destroyed before evaluate() is called.
+  * Since the tiles are evaluated one after the other, a statement must only read the coefficients of
+  * the destinations of the other statements at the position it assigns: expressions like \c a.reverse()
+  * or products involving one of these destinations are not allowed. Finally, as with MatrixBase::noalias(),
+  * the statements are assumed not to alias except through these coefficient-wise dependencies.
+  *
+  * The recorded statements are kept, so that evaluate() may be called again once the inputs changed.
+  *
+  * The destinations remain full-size objects: the intermediate results are still written to memory,
+  * only the accesses to them get a better locality. Statements whose destinations would only hold
+  * the coefficients of the current tile are not supported.
+  */
+class FusedEvaluation
+{
+  public:
+    typedef DenseIndex Index;
+
+    FusedEvaluation() : m_first(0), m_last(0), m_rows(0), m_cols(0), m_isRowMajor(false), m_isVector(true) {}
+    ~FusedEvaluation() { clear(); }
+
+    /** Records the assignment of \a other to \a dst.
+      *
+      * If \a dst is a plain matrix or array, it is resized to the size of \a other now,
+      * otherwise they must have the same size. */
+    template<typename Dest, typename OtherDerived>
+    FusedEvaluation& assign(const DenseBase<Dest>& dst, const DenseBase<OtherDerived>& other)
+    {
+      EIGEN_STATIC_ASSERT_LVALUE(Dest)
+      EIGEN_STATIC_ASSERT_SAME_MATRIX_SIZE(Dest,OtherDerived)
+      EIGEN_STATIC_ASSERT((internal::is_same<typename Dest::Scalar,typename OtherDerived::Scalar>::value),
+        YOU_MIXED_DIFFERENT_NUMERIC_TYPES__YOU_NEED_TO_USE_THE_CAST_METHOD_OF_MATRIXBASE_TO_CAST_NUMERIC_TYPES_EXPLICITLY)
+      dst.const_cast_derived().resize(other.rows(), other.cols());
+      record(new internal::fused_assignment<Dest, OtherDerived>(dst.const_cast_derived(), other.derived()));
+      return *this;
+    }
+
+    /** Records the assignment to \a result of the reduction of \a xpr by \a func.
+      * \sa DenseBase::redux() */
+    template<typename Derived, typename Func>
+    FusedEvaluation& redux(const DenseBase<Derived>& xpr, const Func& func, typename Derived::Scalar& result)
+    {
+      record(new internal::fused_redux<Func, Derived>(xpr.derived(), func, result));
+      return *this;
+    }
+
+    /** Records the assignment to \a result of the sum of the coefficients of \a xpr.
+      * \sa DenseBase::sum() */
+    template<typename Derived>
+    FusedEvaluation& sum(const DenseBase<Derived>& xpr, typename Derived::Scalar& result)
+    {
+      return redux(xpr, internal::scalar_sum_op<typename Derived::Scalar>(), result);
+    }
+
+    /** Evaluates the recorded statements, in the order they have been recorded. */
+    void evaluate()
+    {
+      if(!m_first || m_rows * m_cols == 0)
+        return;
+      const Index size = m_rows * m_cols;
+
+      // The statements without linear access are evaluated on whole outer vectors, which requires
+      // them to have the shape and storage order of the context, otherwise a single tile is used.
+      Index granularity = 1;
+      Index bytesPerCoeff = 0;
+      for(internal::fused_statement* s = m_first; s; s = s->m_next)
+      {
+        if(!s->m_linear && granularity != size)
+        {
+          if(s->m_rows == m_rows && s->m_cols == m_cols && s->m_isRowMajor == m_isRowMajor)
+            granularity = s->innerSize();
+          else
+            granularity = size;
+        }
+        bytesPerCoeff += s->m_bytesPerCoeff;
+        s->begin();
+      }
+
+      std::ptrdiff_t l1, l2;
+      internal::manage_caching_sizes(GetAction, &l1, &l2);
+      // the tiles are multiples of any packet size, so that the linear ones start on a packet boundary,
+      // and of the granularity
+      Index step = 64;
+      if(granularity > 1)
+      {
+        Index common = 64;
+        while(granularity % common)
+          common /= 2;
+        step = granularity * (64 / common);
+      }
+      const Index tileCoeffs = l1 / (2*(std::max)(bytesPerCoeff,Index(1)));
+      const Index tileSize = (std::max)(Index(1), tileCoeffs / step) * step;
+
+      for(Index start = 0; start < size; start += tileSize)
+      {
+        const Index end = (std::min)(size, start + tileSize);
+        for(internal::fused_statement* s = m_first; s; s = s->m_next)
+          s->run(start, end);
+      }
+
+      for(internal::fused_statement* s = m_first; s; s = s->m_next)
+        s->end();
+    }
+
+    /** Removes all the recorded statements. */
+    void clear()
+    {
+      while(m_first)
+      {
+        internal::fused_statement* next = m_first->m_next;
+        delete m_first;
+        m_first = next;
+      }
+      m_last = 0;
+      m_rows = m_cols = 0;
+      m_isRowMajor = false;
+      m_isVector = true;
+    }
+
+  protected:
+    // The context takes the shape and storage order of the first statement which is not a vector,
+    // or of the first statement if there are only vectors.
+    void record(internal::fused_statement* statement)
+    {
+      const bool isVector = statement->m_rows == 1 || statement->m_cols == 1;
+      if(m_first)
+      {
+        eigen_assert(statement->m_rows * statement->m_cols == m_rows * m_cols
+                     && "all the statements of a FusedEvaluation must have the same size");
+        eigen_assert((isVector || m_isVector || (statement->m_rows == m_rows && statement->m_cols == m_cols
+                                                 && statement->m_isRowMajor == m_isRowMajor))
+                     && "all the matrices of a FusedEvaluation must have the same sizes and storage order");
+        m_last->m_next = statement;
+        m_last = statement;
+      }
+      else
+        m_first = m_last = statement;
+      if(!m_first->m_next || (m_isVector && !isVector))
+      {
+        m_rows = statement->m_rows;
+        m_cols = statement->m_cols;
+        m_isRowMajor = statement->m_isRowMajor;
+        m_isVector = isVector;
+      }
+    }
+
+    internal::fused_statement* m_first;
+    internal::fused_statement* m_last;
+    Index m_rows, m_cols;
+    bool m_isRowMajor, m_isVector;
+
+  private:
+    FusedEvaluation(const FusedEvaluation&);
+    FusedEvaluation& operator=(const FusedEvaluation&);
+};
+
+#endif // EIGEN_FUSED_EVALUATION_H
@@ -278,6 +278,25 @@ inline void pstore1(typename unpacket_traits<Packet>::type* to, const typename u
   pstore(to, pset1<Packet>(a));
 }
 
+/** \internal transposes the square block made of the N packets of \a kernel, N being the packet size,
+  * such that kernel[i] gets the i-th coefficients of the original packets */
+template<typename Packet>
+inline void ptranspose(Packet* kernel)
+{
+  typedef typename unpacket_traits<Packet>::type Scalar;
+  enum { PacketSize = unpacket_traits<Packet>::size };
+  if(PacketSize==1)
+    return;
+  Scalar block[PacketSize*PacketSize], transposed[PacketSize*PacketSize];
+  for(int i=0; i<PacketSize; ++i)
+    pstoreu(block+i*PacketSize, kernel[i]);
+  for(int i=0; i<PacketSize; ++i)
+    for(int j=0; j<PacketSize; ++j)
+      transposed[i*PacketSize+j] = block[j*PacketSize+i];
+  for(int i=0; i<PacketSize; ++i)
+    kernel[i] = ploadu<Packet>(transposed+i*PacketSize);
+}
+
 /** \internal \returns a * b + c (coeff-wise) */
 template<typename Packet> inline Packet
 pmadd(const Packet&  a,
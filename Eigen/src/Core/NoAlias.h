@@ -35,10 +35,10 @@
   * This class represents an expression with special assignment operators
   * assuming no aliasing between the target expression and the source expression.
   * More precisely it alloas to bypass the EvalBeforeAssignBit flag of the source expression.
-  * It is the return type of MatrixBase::noalias()
+  * It is the return type of MatrixBase::noalias() and ArrayBase::noalias()
   * and most of the time this is the only way it is used.
   *
-  * \sa MatrixBase::noalias()
+  * \sa MatrixBase::noalias(), ArrayBase::noalias()
   */
 template<typename ExpressionType, template <typename> class StorageBase>
 class NoAlias
@@ -51,7 +51,7 @@ class NoAlias
       * \sa MatrixBase::lazyAssign() */
     template<typename OtherDerived>
     EIGEN_STRONG_INLINE ExpressionType& operator=(const StorageBase<OtherDerived>& other)
-    { return internal::assign_selector<ExpressionType,OtherDerived,false>::run(m_expression,other.derived()); }
+    { return internal::noalias_assign(m_expression,other.derived()); }
 
     /** \sa MatrixBase::operator+= */
     template<typename OtherDerived>
@@ -60,8 +60,8 @@ class NoAlias
       typedef SelfCwiseBinaryOp<internal::scalar_sum_op<Scalar>, ExpressionType, OtherDerived> SelfAdder;
       SelfAdder tmp(m_expression);
       typedef typename internal::nested<OtherDerived>::type OtherDerivedNested;
-      typedef typename internal::remove_all<OtherDerivedNested>::type _OtherDerivedNested;
-      internal::assign_selector<SelfAdder,_OtherDerivedNested,false>::run(tmp,OtherDerivedNested(other.derived()));
+      OtherDerivedNested otherNested(other.derived());
+      internal::noalias_assign(tmp,otherNested);
       return m_expression;
     }
 
@@ -72,8 +72,8 @@ class NoAlias
       typedef SelfCwiseBinaryOp<internal::scalar_difference_op<Scalar>, ExpressionType, OtherDerived> SelfAdder;
       SelfAdder tmp(m_expression);
       typedef typename internal::nested<OtherDerived>::type OtherDerivedNested;
-      typedef typename internal::remove_all<OtherDerivedNested>::type _OtherDerivedNested;
-      internal::assign_selector<SelfAdder,_OtherDerivedNested,false>::run(tmp,OtherDerivedNested(other.derived()));
+      OtherDerivedNested otherNested(other.derived());
+      internal::noalias_assign(tmp,otherNested);
       return m_expression;
     }
 
@@ -125,6 +125,13 @@ class NoAlias
   * A = A * B;
   * \endcode
   *
+  * Since it guarantees that the destination does not overlap the source, noalias() also
+  * allows large coefficient-wise assignments to be split over several threads when
+  * OpenMP is enabled:
+  * \code
+  * y.noalias() = a * x + b;
+  * \endcode
+  *
   * \sa class NoAlias
   */
 template<typename Derived>
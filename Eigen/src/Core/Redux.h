@@ -202,6 +202,24 @@ struct redux_impl<Func,Derived, DefaultTraversal, CompleteUnrolling>
   : public redux_novec_unroller<Func,Derived, 0, Derived::SizeAtCompileTime>
 {};
 
+// \returns the offset from start of the first aligned coefficient of the range [start,end) of mat
+template<typename Derived, bool JustReturnZero = (Derived::Flags & AlignedBit) || !(Derived::Flags & DirectAccessBit)>
+struct redux_first_aligned
+{
+  typedef typename Derived::Index Index;
+  static inline Index run(const Derived&, Index, Index) { return 0; }
+};
+
+template<typename Derived>
+struct redux_first_aligned<Derived, false>
+{
+  typedef typename Derived::Index Index;
+  static inline Index run(const Derived& mat, Index start, Index end)
+  {
+    return internal::first_aligned(&mat.const_cast_derived().coeffRef(start), end-start);
+  }
+};
+
 template<typename Func, typename Derived>
 struct redux_impl<Func, Derived, LinearVectorizedTraversal, NoUnrolling>
 {
@@ -211,10 +229,16 @@ struct redux_impl<Func, Derived, LinearVectorizedTraversal, NoUnrolling>
 
   static Scalar run(const Derived& mat, const Func& func)
   {
-    const Index size = mat.size();
-    eigen_assert(size && "you are using an empty matrix");
+    return run(mat, func, 0, mat.size());
+  }
+
+  // reduces the coefficients of the linear range [start,size),
+  // start must be a multiple of the packet size
+  static Scalar run(const Derived& mat, const Func& func, Index start, Index size)
+  {
+    eigen_assert(size>start && "you are using an empty matrix");
     const Index packetSize = packet_traits<Scalar>::size;
-    const Index alignedStart = internal::first_aligned(mat);
+    const Index alignedStart = start + redux_first_aligned<Derived>::run(mat, start, size);
     enum {
       alignment = bool(Derived::Flags & DirectAccessBit) || bool(Derived::Flags & AlignedBit)
                 ? Aligned : Unaligned
@@ -242,7 +266,7 @@ struct redux_impl<Func, Derived, LinearVectorizedTraversal, NoUnrolling>
       }
       res = func.predux(packet_res0);
 
-      for(Index index = 0; index < alignedStart; ++index)
+      for(Index index = start; index < alignedStart; ++index)
         res = func(res,mat.coeff(index));
 
       for(Index index = alignedEnd; index < size; ++index)
@@ -251,8 +275,8 @@ struct redux_impl<Func, Derived, LinearVectorizedTraversal, NoUnrolling>
     else // too small to vectorize anything.
          // since this is dynamic-size hence inefficient anyway for such small sizes, don't try to optimize.
     {
-      res = mat.coeff(0);
-      for(Index index = 1; index < size; ++index)
+      res = mat.coeff(start);
+      for(Index index = start+1; index < size; ++index)
         res = func(res,mat.coeff(index));
     }
 
@@ -319,6 +343,274 @@ struct redux_impl<Func, Derived, LinearVectorizedTraversal, CompleteUnrolling>
   }
 };
 
+/***************************************************************************
+* Reproducible summation
+***************************************************************************/
+
+#ifdef EIGEN_REPRODUCIBLE_REDUX_COMPENSATED
+#ifndef EIGEN_REPRODUCIBLE_REDUX
+#define EIGEN_REPRODUCIBLE_REDUX
+#endif
+#endif
+
+/** \internal
+  * The number of partial sums of a reproducible summation. It must be a multiple
+  * of the packet sizes of all the architectures whose results have to agree.
+  */
+#ifndef EIGEN_REPRODUCIBLE_REDUX_LANES
+#define EIGEN_REPRODUCIBLE_REDUX_LANES 16
+#endif
+
+template<typename Func> struct redux_is_reproducible { enum { value = 0 }; };
+
+#ifdef EIGEN_REPRODUCIBLE_REDUX
+template<typename Scalar> struct redux_is_reproducible<scalar_sum_op<Scalar> > { enum { value = 1 }; };
+#endif
+
+// adds x to the partial sum s, c being the running compensation of the compensated summation
+template<typename Packet>
+EIGEN_STRONG_INLINE void reproducible_accumulate(Packet& s, Packet& c, const Packet& x)
+{
+#ifdef EIGEN_REPRODUCIBLE_REDUX_COMPENSATED
+  const Packet y = psub(x, c);
+  const Packet t = padd(s, y);
+  c = psub(psub(t, s), y);
+  s = t;
+#else
+  EIGEN_UNUSED_VARIABLE(c);
+  s = padd(s, x);
+#endif
+}
+
+// Accumulates the first alignedInnerSize coefficients of each inner vector of mat,
+// the coefficient (outer,inner) going to the partial sum inner % EIGEN_REPRODUCIBLE_REDUX_LANES.
+template<typename Derived, bool Vectorize>
+struct redux_reproducible_lanes
+{
+  typedef typename Derived::Scalar Scalar;
+  typedef typename Derived::Index Index;
+  enum { Lanes = EIGEN_REPRODUCIBLE_REDUX_LANES };
+
+  static void run(const Derived& mat, Index alignedInnerSize, Scalar* sum, Scalar* comp)
+  {
+    const Index outerSize = mat.outerSize();
+    for(Index outer = 0; outer < outerSize; ++outer)
+      for(Index inner = 0; inner < alignedInnerSize; inner += Lanes)
+        for(Index l = 0; l < Lanes; ++l)
+          reproducible_accumulate(sum[l], comp[l], mat.coeffByOuterInner(outer, inner + l));
+  }
+};
+
+template<typename Derived>
+struct redux_reproducible_lanes<Derived, true>
+{
+  typedef typename Derived::Scalar Scalar;
+  typedef typename Derived::Index Index;
+  typedef typename packet_traits<Scalar>::type Packet;
+  enum {
+    Lanes = EIGEN_REPRODUCIBLE_REDUX_LANES,
+    PacketSize = packet_traits<Scalar>::size,
+    Packets = Lanes / PacketSize
+  };
+
+  static void run(const Derived& mat, Index alignedInnerSize, Scalar* sum, Scalar* comp)
+  {
+    const Index outerSize = mat.outerSize();
+    Packet s[Packets], c[Packets];
+    for(Index j = 0; j < Packets; ++j)
+    {
+      s[j] = ploadu<Packet>(sum + j*PacketSize);
+      c[j] = ploadu<Packet>(comp + j*PacketSize);
+    }
+    for(Index outer = 0; outer < outerSize; ++outer)
+      for(Index inner = 0; inner < alignedInnerSize; inner += Lanes)
+        for(Index j = 0; j < Packets; ++j)
+          reproducible_accumulate(s[j], c[j], mat.template packetByOuterInner<Unaligned>(outer, inner + j*PacketSize));
+    for(Index j = 0; j < Packets; ++j)
+    {
+      pstoreu(sum + j*PacketSize, s[j]);
+      pstoreu(comp + j*PacketSize, c[j]);
+    }
+  }
+};
+
+// Sums the coefficients in an order which only depends on the sizes of mat: the coefficients
+// of each inner vector are distributed over EIGEN_REPRODUCIBLE_REDUX_LANES partial sums
+// according to their inner index, and the partial sums are combined pairwise. Vectorization
+// only evaluates several partial sums at once, so that the result neither depends on the
+// packet size nor on the alignment of the data.
+template<typename Func, typename Derived>
+struct redux_reproducible_impl
+{
+  typedef typename Derived::Scalar Scalar;
+  typedef typename Derived::Index Index;
+  enum {
+    Lanes = EIGEN_REPRODUCIBLE_REDUX_LANES,
+    Vectorize = (int(Derived::Flags) & ActualPacketAccessBit) && functor_traits<Func>::PacketAccess
+             && (int(Lanes) % int(packet_traits<Scalar>::size)) == 0
+  };
+
+  static Scalar run(const Derived& mat, const Func& func)
+  {
+    eigen_assert(mat.rows()>0 && mat.cols()>0 && "you are using an empty matrix");
+    const Index innerSize = mat.innerSize();
+    const Index outerSize = mat.outerSize();
+    const Index alignedInnerSize = (innerSize / Lanes) * Lanes;
+
+    Scalar sum[Lanes], comp[Lanes];
+    for(Index l = 0; l < Lanes; ++l)
+      sum[l] = comp[l] = Scalar(0);
+
+    redux_reproducible_lanes<Derived, Vectorize>::run(mat, alignedInnerSize, sum, comp);
+    for(Index outer = 0; outer < outerSize; ++outer)
+      for(Index inner = alignedInnerSize; inner < innerSize; ++inner)
+        reproducible_accumulate(sum[inner-alignedInnerSize], comp[inner-alignedInnerSize], mat.coeffByOuterInner(outer, inner));
+
+#ifdef EIGEN_REPRODUCIBLE_REDUX_COMPENSATED
+    for(Index l = 0; l < Lanes; ++l)
+      sum[l] -= comp[l];
+#endif
+    for(Index step = 1; step < Lanes; step *= 2)
+      for(Index l = 0; l + step < Lanes; l += 2*step)
+        sum[l] = func(sum[l], sum[l+step]);
+    return sum[0];
+  }
+};
+
+// the reduction of a whole object, or of one of the blocks of a large reduction
+template<typename Func, typename Derived, bool Reproducible = redux_is_reproducible<Func>::value>
+struct redux_block_impl : redux_impl<Func, Derived> {};
+
+template<typename Func, typename Derived>
+struct redux_block_impl<Func, Derived, true> : redux_reproducible_impl<Func, Derived> {};
+
+/** \internal
+  * The number of coefficients of the blocks a large reduction is split into.
+  */
+#ifndef EIGEN_REDUX_BLOCK_SIZE
+#define EIGEN_REDUX_BLOCK_SIZE 16384
+#endif
+
+// Splits a large reduction into blocks of about EIGEN_REDUX_BLOCK_SIZE coefficients,
+// which are either parts of an inner vector or sets of whole inner vectors.
+template<typename Func, typename Derived,
+         bool Linear = int(redux_traits<Func, Derived>::Traversal) == int(LinearVectorizedTraversal)
+                    && !redux_is_reproducible<Func>::value>
+struct redux_blocks
+{
+  typedef typename Derived::Scalar Scalar;
+  typedef typename Derived::Index Index;
+  enum { IsRowMajor = Derived::IsRowMajor };
+  typedef Block<const Derived, IsRowMajor ? 1 : Dynamic, IsRowMajor ? Dynamic : 1> SegmentType;
+  typedef Block<const Derived, IsRowMajor ? Dynamic : int(Derived::RowsAtCompileTime),
+                               IsRowMajor ? int(Derived::ColsAtCompileTime) : Dynamic, true> PanelType;
+
+  redux_blocks(const Derived& mat)
+    : m_mat(mat), m_innerSize(mat.innerSize()), m_outerSize(mat.outerSize()),
+      m_segments(m_innerSize >= EIGEN_REDUX_BLOCK_SIZE),
+      m_innerStep(m_segments ? EIGEN_REDUX_BLOCK_SIZE : m_innerSize),
+      m_outerStep(m_segments ? 1 : EIGEN_REDUX_BLOCK_SIZE / m_innerSize),
+      m_innerBlocks((m_innerSize + m_innerStep - 1) / m_innerStep)
+  {}
+
+  Index count() const { return m_innerBlocks * ((m_outerSize + m_outerStep - 1) / m_outerStep); }
+
+  Scalar run(Index k, const Func& func) const
+  {
+    const Index outer = (k / m_innerBlocks) * m_outerStep;
+    if(m_segments)
+    {
+      const Index inner = (k % m_innerBlocks) * m_innerStep;
+      const Index innerLength = (std::min)(m_innerStep, m_innerSize - inner);
+      SegmentType segment(m_mat, IsRowMajor ? outer : inner, IsRowMajor ? inner : outer,
+                                 IsRowMajor ? 1 : innerLength, IsRowMajor ? innerLength : 1);
+      return redux_block_impl<Func, SegmentType>::run(segment, func);
+    }
+    const Index outerLength = (std::min)(m_outerStep, m_outerSize - outer);
+    PanelType panel(m_mat, IsRowMajor ? outer : 0, IsRowMajor ? 0 : outer,
+                           IsRowMajor ? outerLength : m_innerSize, IsRowMajor ? m_innerSize : outerLength);
+    return redux_block_impl<Func, PanelType>::run(panel, func);
+  }
+
+  const Derived& m_mat;
+  const Index m_innerSize, m_outerSize;
+  const bool m_segments;
+  const Index m_innerStep, m_outerStep, m_innerBlocks;
+};
+
+// With linear access, the blocks are ranges of the linear index.
+template<typename Func, typename Derived>
+struct redux_blocks<Func, Derived, true>
+{
+  typedef typename Derived::Scalar Scalar;
+  typedef typename Derived::Index Index;
+
+  redux_blocks(const Derived& mat) : m_mat(mat), m_size(mat.size()) {}
+
+  Index count() const { return (m_size + EIGEN_REDUX_BLOCK_SIZE - 1) / EIGEN_REDUX_BLOCK_SIZE; }
+
+  Scalar run(Index k, const Func& func) const
+  {
+    const Index start = k * EIGEN_REDUX_BLOCK_SIZE;
+    return redux_impl<Func, Derived>::run(m_mat, func, start, (std::min)(m_size, start + EIGEN_REDUX_BLOCK_SIZE));
+  }
+
+  const Derived& m_mat;
+  const Index m_size;
+};
+
+// The large reductions evaluated by several threads are split into blocks whose partial results
+// are combined pairwise. The blocks only depend on the sizes of the expression, so that the result
+// does not depend on the number of threads. The sequential reductions are left unchanged, unless
+// EIGEN_REPRODUCIBLE_REDUX asks for the same result with and without threads.
+template<typename Func, typename Derived, bool MayBlock = int(Derived::MaxSizeAtCompileTime)==Dynamic>
+struct redux_blocked_impl
+{
+  typedef typename Derived::Scalar Scalar;
+  static EIGEN_STRONG_INLINE Scalar run(const Derived& mat, const Func& func)
+  {
+    return redux_block_impl<Func, Derived>::run(mat, func);
+  }
+};
+
+template<typename Func, typename Derived>
+struct redux_blocked_impl<Func, Derived, true>
+{
+  typedef typename Derived::Scalar Scalar;
+  typedef typename Derived::Index Index;
+  enum {
+    Cost = int(Derived::CoeffReadCost)==Dynamic ? 100 : int(Derived::CoeffReadCost) > 1 ? int(Derived::CoeffReadCost) : 1
+  };
+
+  static Scalar run(const Derived& mat, const Func& func)
+  {
+    const Index size = mat.size();
+    if(size < 2*EIGEN_REDUX_BLOCK_SIZE)
+      return redux_block_impl<Func, Derived>::run(mat, func);
+    const int threads = parallel_eval_threads(size * Cost);
+    if(threads<=1 && !redux_is_reproducible<Func>::value)
+      return redux_block_impl<Func, Derived>::run(mat, func);
+
+    const redux_blocks<Func, Derived> blocks(mat);
+    const Index count = blocks.count();
+    eigen_assert(count>1);
+    ei_declare_aligned_stack_constructed_variable(Scalar, partial, count, 0);
+
+#ifdef EIGEN_HAS_OPENMP
+    #pragma omp parallel for schedule(static) num_threads(threads) if(threads>1)
+#endif
+    for(Index k = 0; k < count; ++k)
+      partial[k] = blocks.run(k, func);
+
+    // the last step combines the first half of the blocks with the second one
+    Index step = 1;
+    for(; 2*step < count; step *= 2)
+      for(Index k = 0; k + step < count; k += 2*step)
+        partial[k] = func(partial[k], partial[k+step]);
+    return func(partial[0], partial[step]);
+  }
+};
+
 } // end namespace internal
 
 /***************************************************************************
@@ -339,7 +631,7 @@ EIGEN_STRONG_INLINE typename internal::result_of<Func(typename internal::traits<
 DenseBase<Derived>::redux(const Func& func) const
 {
   typedef typename internal::remove_all<typename Derived::Nested>::type ThisNested;
-  return internal::redux_impl<Func, ThisNested>
+  return internal::redux_blocked_impl<Func, ThisNested>
             ::run(derived(), func);
 }
 
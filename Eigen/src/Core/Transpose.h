@@ -269,12 +269,58 @@ struct inplace_transpose_selector<MatrixType,true> { // square matrix
   }
 };
 
+/** \internal
+  * The size in bytes above which resizable matrices of rectangular shape are transposed in place
+  * without making a temporary copy of them, which is slower.
+  */
+#ifndef EIGEN_INPLACE_TRANSPOSE_COPY_LIMIT
+#define EIGEN_INPLACE_TRANSPOSE_COPY_LIMIT (32*1024*1024)
+#endif
+
+// Transposes dynamic matrices with direct access using the tiled kernels, and large resizable matrices
+// of rectangular shape by following the cycles of the permutation of their coefficients,
+// such that no copy of the matrix is needed. The run functions return false when they cannot be used.
+template<typename MatrixType,
+  bool HasDirectAccess = (int(MatrixType::Flags)&DirectAccessBit) && (int(MatrixType::Flags)&LvalueBit),
+  bool IsResizable = int(MatrixType::Flags)&NestByRefBit
+                  && MatrixType::RowsAtCompileTime==Dynamic && MatrixType::ColsAtCompileTime==Dynamic
+                  && MatrixType::MaxRowsAtCompileTime==Dynamic && MatrixType::MaxColsAtCompileTime==Dynamic>
+struct inplace_transpose_blocked
+{
+  static bool run_square(MatrixType&) { return false; }
+  static bool run_rectangular(MatrixType&) { return false; }
+};
+
+template<typename MatrixType, bool IsResizable>
+struct inplace_transpose_blocked<MatrixType,true,IsResizable>
+{
+  static bool run_square(MatrixType& m)
+  {
+    if(m.innerStride()!=1)
+      return false;
+    blocked_transpose<typename MatrixType::Scalar>::square_in_place(m.data(), m.outerStride(), m.rows());
+    return true;
+  }
+
+  static bool run_rectangular(MatrixType& m)
+  {
+    if(!IsResizable || m.size()*std::ptrdiff_t(sizeof(typename MatrixType::Scalar)) <= EIGEN_INPLACE_TRANSPOSE_COPY_LIMIT)
+      return false;
+    rectangular_transpose_in_place(m.data(), m.innerSize(), m.outerSize());
+    m.resize(m.cols(), m.rows());
+    return true;
+  }
+};
+
 template<typename MatrixType>
 struct inplace_transpose_selector<MatrixType,false> { // non square matrix
   static void run(MatrixType& m) {
     if (m.rows()==m.cols())
-      m.template triangularView<StrictlyUpper>().swap(m.transpose());
-    else
+    {
+      if(!inplace_transpose_blocked<MatrixType>::run_square(m))
+        m.template triangularView<StrictlyUpper>().swap(m.transpose());
+    }
+    else if(!inplace_transpose_blocked<MatrixType>::run_rectangular(m))
       m = m.transpose().eval();
   }
 };
@@ -297,6 +343,8 @@ struct inplace_transpose_selector<MatrixType,false> { // non square matrix
   * If you just need the transpose of a matrix, use transpose().
   *
   * \note if the matrix is not square, then \c *this must be a resizable matrix.
+  * Resizable matrices of rectangular shape larger than EIGEN_INPLACE_TRANSPOSE_COPY_LIMIT bytes are
+  * transposed without making a copy of them, at the cost of a temporary bit per coefficient.
   *
   * \sa transpose(), adjoint(), adjointInPlace() */
 template<typename Derived>
@@ -109,6 +109,9 @@ class PartialReduxExpr : internal::no_assignment_operator,
         return m_functor(m_matrix.row(index));
     }
 
+    const _MatrixTypeNested& nestedExpression() const { return m_matrix; }
+    const MemberOp& functor() const { return m_functor; }
+
   protected:
     MatrixTypeNested m_matrix;
     const MemberOp m_functor;
@@ -158,6 +161,245 @@ struct member_redux {
 };
 }
 
+namespace internal {
+
+/***************************************************************************
+* Evaluation of the partial reductions across the outer vectors
+***************************************************************************/
+
+// Describes the partial reductions which can be evaluated by combining whole outer vectors
+// with BinaryOp, after applying abs2() to the coefficients if Abs2 is true.
+template<typename MemberOp, typename Scalar>
+struct partial_redux_outer_traits
+{
+  enum { Supported = 0 };
+};
+
+template<typename MemberOp, typename Scalar, typename _BinaryOp, bool _Abs2 = false>
+struct partial_redux_outer_traits_base
+{
+  enum { Supported = 1, Abs2 = _Abs2 };
+  typedef _BinaryOp BinaryOp;
+  static BinaryOp func(const MemberOp&) { return BinaryOp(); }
+  template<typename Index>
+  static Scalar finalize(const Scalar& x, Index) { return x; }
+};
+
+template<typename ResultType, typename Scalar>
+struct partial_redux_outer_traits<member_sum<ResultType>, Scalar>
+  : partial_redux_outer_traits_base<member_sum<ResultType>, Scalar, scalar_sum_op<Scalar> > {};
+
+template<typename ResultType, typename Scalar>
+struct partial_redux_outer_traits<member_prod<ResultType>, Scalar>
+  : partial_redux_outer_traits_base<member_prod<ResultType>, Scalar, scalar_product_op<Scalar> > {};
+
+template<typename ResultType, typename Scalar>
+struct partial_redux_outer_traits<member_minCoeff<ResultType>, Scalar>
+  : partial_redux_outer_traits_base<member_minCoeff<ResultType>, Scalar, scalar_min_op<Scalar> > {};
+
+template<typename ResultType, typename Scalar>
+struct partial_redux_outer_traits<member_maxCoeff<ResultType>, Scalar>
+  : partial_redux_outer_traits_base<member_maxCoeff<ResultType>, Scalar, scalar_max_op<Scalar> > {};
+
+template<typename ResultType, typename Scalar>
+struct partial_redux_outer_traits<member_mean<ResultType>, Scalar>
+  : partial_redux_outer_traits_base<member_mean<ResultType>, Scalar, scalar_sum_op<Scalar> >
+{
+  template<typename Index>
+  static Scalar finalize(const Scalar& x, Index size) { return x / Scalar(size); }
+};
+
+template<typename ResultType, typename Scalar>
+struct partial_redux_outer_traits<member_squaredNorm<ResultType>, Scalar>
+  : partial_redux_outer_traits_base<member_squaredNorm<ResultType>, ResultType, scalar_sum_op<ResultType>, true> {};
+
+template<typename ResultType, typename Scalar>
+struct partial_redux_outer_traits<member_norm<ResultType>, Scalar>
+  : partial_redux_outer_traits_base<member_norm<ResultType>, ResultType, scalar_sum_op<ResultType>, true>
+{
+  template<typename Index>
+  static ResultType finalize(const ResultType& x, Index) { return internal::sqrt(x); }
+};
+
+template<typename BinaryOp, typename Scalar>
+struct partial_redux_outer_traits<member_redux<BinaryOp, Scalar>, Scalar>
+  : partial_redux_outer_traits_base<member_redux<BinaryOp, Scalar>, Scalar, BinaryOp>
+{
+  static BinaryOp func(const member_redux<BinaryOp, Scalar>& op) { return op.m_functor; }
+};
+
+/** \internal
+  * The number of coefficients of the destination computed at once by a partial reduction across
+  * the outer vectors. The partial results of such a chunk stay in the L1 cache while the outer
+  * vectors are streamed through.
+  */
+#ifndef EIGEN_PARTIAL_REDUX_CHUNK_SIZE
+#define EIGEN_PARTIAL_REDUX_CHUNK_SIZE 512
+#endif
+
+// Combines the inner range [start,start+length) of all the outer vectors of mat into acc.
+// The outer vectors are combined in order, so that each coefficient of the result
+// is the same as the one of the reduction of the corresponding inner slice.
+template<typename Input, typename BinaryOp, bool Vectorize>
+struct partial_redux_outer_chunk
+{
+  typedef typename Input::Scalar Scalar;
+  typedef typename Input::Index Index;
+  static void run(const Input& mat, const BinaryOp& func, Index start, Index length, Scalar* acc)
+  {
+    const Index outerSize = mat.outerSize();
+    for(Index k = 0; k < length; ++k)
+      acc[k] = mat.coeffByOuterInner(0, start+k);
+    for(Index j = 1; j < outerSize; ++j)
+      for(Index k = 0; k < length; ++k)
+        acc[k] = func(acc[k], mat.coeffByOuterInner(j, start+k));
+  }
+};
+
+template<typename Input, typename BinaryOp>
+struct partial_redux_outer_chunk<Input, BinaryOp, true>
+{
+  typedef typename Input::Scalar Scalar;
+  typedef typename Input::Index Index;
+  typedef typename packet_traits<Scalar>::type Packet;
+  enum { PacketSize = packet_traits<Scalar>::size };
+
+  static void run(const Input& mat, const BinaryOp& func, Index start, Index length, Scalar* acc)
+  {
+    const Index outerSize = mat.outerSize();
+    const Index alignedLength = (length/PacketSize)*PacketSize;
+    const Index alignedLength4 = (length/(4*PacketSize))*(4*PacketSize);
+    // four packets of the result are accumulated at once to hide the latency of packetOp
+    for(Index k = 0; k < alignedLength4; k += 4*PacketSize)
+    {
+      Packet p0 = mat.template packetByOuterInner<Unaligned>(0, start+k);
+      Packet p1 = mat.template packetByOuterInner<Unaligned>(0, start+k+PacketSize);
+      Packet p2 = mat.template packetByOuterInner<Unaligned>(0, start+k+2*PacketSize);
+      Packet p3 = mat.template packetByOuterInner<Unaligned>(0, start+k+3*PacketSize);
+      for(Index j = 1; j < outerSize; ++j)
+      {
+        p0 = func.packetOp(p0, mat.template packetByOuterInner<Unaligned>(j, start+k));
+        p1 = func.packetOp(p1, mat.template packetByOuterInner<Unaligned>(j, start+k+PacketSize));
+        p2 = func.packetOp(p2, mat.template packetByOuterInner<Unaligned>(j, start+k+2*PacketSize));
+        p3 = func.packetOp(p3, mat.template packetByOuterInner<Unaligned>(j, start+k+3*PacketSize));
+      }
+      pstore(acc+k, p0);
+      pstore(acc+k+PacketSize, p1);
+      pstore(acc+k+2*PacketSize, p2);
+      pstore(acc+k+3*PacketSize, p3);
+    }
+    for(Index k = alignedLength4; k < alignedLength; k += PacketSize)
+    {
+      Packet p = mat.template packetByOuterInner<Unaligned>(0, start+k);
+      for(Index j = 1; j < outerSize; ++j)
+        p = func.packetOp(p, mat.template packetByOuterInner<Unaligned>(j, start+k));
+      pstore(acc+k, p);
+    }
+    for(Index k = alignedLength; k < length; ++k)
+    {
+      acc[k] = mat.coeffByOuterInner(0, start+k);
+      for(Index j = 1; j < outerSize; ++j)
+        acc[k] = func(acc[k], mat.coeffByOuterInner(j, start+k));
+    }
+  }
+};
+
+// Evaluates dst = xpr, where xpr is a partial reduction. It returns false, without doing
+// anything, when the default coefficient-wise evaluation is the way to go.
+template<typename Dest, typename Xpr,
+         bool MayOptimize = int(Xpr::_MatrixTypeNested::MaxSizeAtCompileTime) == Dynamic
+                         && is_same<typename Dest::Scalar, typename Xpr::Scalar>::value>
+struct partial_redux_impl
+{
+  static inline bool run(Dest&, const Xpr&) { return false; }
+};
+
+template<typename Dest, typename MatrixType, typename MemberOp, int Direction>
+struct partial_redux_impl<Dest, PartialReduxExpr<MatrixType, MemberOp, Direction>, true>
+{
+  typedef PartialReduxExpr<MatrixType, MemberOp, Direction> Xpr;
+  typedef typename Xpr::_MatrixTypeNested Nested;
+  typedef typename Xpr::Scalar Scalar;
+  typedef typename Xpr::Index Index;
+  typedef partial_redux_outer_traits<MemberOp, typename Nested::Scalar> OuterTraits;
+  enum {
+    // the coefficients of the result correspond to the inner index of the nested expression
+    AcrossOuter = (Direction==Horizontal) == (int(Nested::IsRowMajor)==0),
+    Supported = AcrossOuter && OuterTraits::Supported,
+    Cost = int(Nested::CoeffReadCost)==Dynamic ? 100 : int(Nested::CoeffReadCost) > 1 ? int(Nested::CoeffReadCost) : 1
+  };
+
+  // the destination, e.g. a block, may have no linear access
+  static inline Scalar& coeffRef(Dest& dst, Index i)
+  {
+    return Direction==Vertical ? dst.coeffRef(0, i) : dst.coeffRef(i, 0);
+  }
+
+  static bool run(Dest& dst, const Xpr& xpr)
+  {
+    if(xpr.size()==0 || (Direction==Vertical ? xpr.nestedExpression().rows() : xpr.nestedExpression().cols())==0)
+      return false;
+    return run(dst, xpr, typename conditional<bool(Supported), true_type, false_type>::type());
+  }
+
+  // reduction across the outer vectors: the outer vectors are streamed through once per chunk of the result
+  static bool run(Dest& dst, const Xpr& xpr, true_type)
+  {
+    typedef typename OuterTraits::BinaryOp BinaryOp;
+    typedef typename conditional<bool(OuterTraits::Abs2),
+                                 CwiseUnaryOp<scalar_abs2_op<typename Nested::Scalar>, const Nested>,
+                                 const Nested&>::type InputNested;
+    typedef typename remove_all<InputNested>::type Input;
+    enum {
+      Vectorize = (int(Input::Flags) & ActualPacketAccessBit) && functor_traits<BinaryOp>::PacketAccess
+    };
+    typedef partial_redux_outer_chunk<Input, BinaryOp, bool(Vectorize)> Chunk;
+
+    InputNested input(xpr.nestedExpression());
+    const BinaryOp func = OuterTraits::func(xpr.functor());
+    const Index innerSize = input.innerSize();
+    const Index outerSize = input.outerSize();
+    const Index chunkSize = EIGEN_PARTIAL_REDUX_CHUNK_SIZE;
+    const Index chunks = (innerSize + chunkSize - 1) / chunkSize;
+
+#ifdef EIGEN_HAS_OPENMP
+    const int threads = parallel_eval_threads(input.size() * Cost);
+    #pragma omp parallel for schedule(static) num_threads(threads) if(threads>1)
+#endif
+    for(Index c = 0; c < chunks; ++c)
+    {
+      EIGEN_ALIGN16 Scalar acc[EIGEN_PARTIAL_REDUX_CHUNK_SIZE];
+      const Index start = c * chunkSize;
+      const Index length = (std::min)(chunkSize, innerSize - start);
+      Chunk::run(input, func, start, length, acc);
+      for(Index k = 0; k < length; ++k)
+        coeffRef(dst, start+k) = OuterTraits::finalize(acc[k], outerSize);
+    }
+    return true;
+  }
+
+  // reduction of the inner vectors: only splits the coefficients of the result over several threads
+  static bool run(Dest& dst, const Xpr& xpr, false_type)
+  {
+#ifdef EIGEN_HAS_OPENMP
+    const Index size = xpr.size();
+    const int threads = parallel_eval_threads(xpr.nestedExpression().size() * Cost);
+    if(threads<=1)
+      return false;
+    #pragma omp parallel for schedule(static) num_threads(threads)
+    for(Index i = 0; i < size; ++i)
+      coeffRef(dst, i) = xpr.coeff(i);
+    return true;
+#else
+    EIGEN_UNUSED_VARIABLE(dst);
+    EIGEN_UNUSED_VARIABLE(xpr);
+    return false;
+#endif
+  }
+};
+
+} // end namespace internal
+
 /** \class VectorwiseOp
   * \ingroup Core_Module
   *
@@ -606,4 +848,21 @@ DenseBase<Derived>::rowwise()
   return derived();
 }
 
+#ifndef EIGEN_PARSED_BY_DOXYGEN
+/** \internal Evaluates the partial reduction \a other into \c *this.
+  * The reductions across the outer vectors of the nested expression, like rowwise().sum() of a column-major
+  * matrix, stream through the outer vectors while keeping a chunk of the result in cache, and large partial
+  * reductions are evaluated by several threads. */
+template<typename Derived>
+template<typename MatrixType, typename MemberOp, int Direction>
+EIGEN_STRONG_INLINE Derived& DenseBase<Derived>::lazyAssign(const PartialReduxExpr<MatrixType, MemberOp, Direction>& other)
+{
+  typedef PartialReduxExpr<MatrixType, MemberOp, Direction> OtherDerived;
+  eigen_assert(rows() == other.rows() && cols() == other.cols());
+  if(internal::partial_redux_impl<Derived, OtherDerived>::run(derived(), other))
+    return derived();
+  return lazyAssign(static_cast<const DenseBase<OtherDerived>&>(other));
+}
+#endif
+
 #endif // EIGEN_PARTIAL_REDUX_H
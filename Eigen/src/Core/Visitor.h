@@ -68,37 +68,6 @@ struct visitor_impl<Visitor, Derived, Dynamic>
 
 } // end namespace internal
 
-/** Applies the visitor \a visitor to the whole coefficients of the matrix or vector.
-  *
-  * The template parameter \a Visitor is the type of the visitor and provides the following interface:
-  * \code
-  * struct MyVisitor {
-  *   // called for the first coefficient
-  *   void init(const Scalar& value, Index i, Index j);
-  *   // called for all other coefficients
-  *   void operator() (const Scalar& value, Index i, Index j);
-  * };
-  * \endcode
-  *
-  * \note compared to one or two \em for \em loops, visitors offer automatic
-  * unrolling for small fixed size matrix.
-  *
-  * \sa minCoeff(Index*,Index*), maxCoeff(Index*,Index*), DenseBase::redux()
-  */
-template<typename Derived>
-template<typename Visitor>
-void DenseBase<Derived>::visit(Visitor& visitor) const
-{
-  enum { unroll = SizeAtCompileTime != Dynamic
-                   && CoeffReadCost != Dynamic
-                   && (SizeAtCompileTime == 1 || internal::functor_traits<Visitor>::Cost != Dynamic)
-                   && SizeAtCompileTime * CoeffReadCost + (SizeAtCompileTime-1) * internal::functor_traits<Visitor>::Cost
-                      <= EIGEN_UNROLLING_LIMIT };
-  return internal::visitor_impl<Visitor, Derived,
-      unroll ? int(SizeAtCompileTime) : Dynamic
-    >::run(derived(), visitor);
-}
-
 namespace internal {
 
 /** \internal
@@ -175,8 +144,170 @@ struct functor_traits<max_coeff_visitor<Scalar> > {
   };
 };
 
+/** \internal
+  * \brief Reduction functor and comparison matching a visitor which can be vectorized
+  *
+  * This is only specialized for the min and max visitors.
+  */
+template<typename Visitor> struct visitor_redux_op { enum { Supported = 0 }; };
+
+template<typename Derived>
+struct visitor_redux_op<min_coeff_visitor<Derived> >
+{
+  typedef typename Derived::Scalar Scalar;
+  typedef scalar_min_op<Scalar> type;
+  enum { Supported = 1 };
+  static inline bool better(const Scalar& a, const Scalar& b) { return a < b; }
+};
+
+template<typename Derived>
+struct visitor_redux_op<max_coeff_visitor<Derived> >
+{
+  typedef typename Derived::Scalar Scalar;
+  typedef scalar_max_op<Scalar> type;
+  enum { Supported = 1 };
+  static inline bool better(const Scalar& a, const Scalar& b) { return a > b; }
+};
+
+/** \internal
+  * Vectorized evaluation of the min and max visitors on large expressions with linear vectorized access.
+  *
+  * The linear range is split into blocks which are reduced with packets. The first block holding
+  * the best value is then visited coefficient by coefficient to find its location, so that the
+  * position reported is the same as the one of the scalar visitor, namely the first one in
+  * column-major order. Large inputs have their blocks reduced in parallel, and the per-thread
+  * results are combined in order.
+  *
+  * \returns false if the expression cannot be handled this way, in which case \a visitor is untouched.
+  */
+template<typename Visitor, typename Derived,
+         bool Vectorize = int(visitor_redux_op<Visitor>::Supported)
+                       && int(Derived::MaxSizeAtCompileTime) == Dynamic
+                       && int(redux_traits<typename visitor_redux_op<Visitor>::type, Derived>::Traversal)
+                          == int(LinearVectorizedTraversal)>
+struct visitor_vectorized_impl
+{
+  template<typename Xpr>
+  static inline bool run(const Xpr&, Visitor&) { return false; }
+};
+
+template<typename Visitor, typename Derived>
+struct visitor_vectorized_impl<Visitor, Derived, true>
+{
+  typedef typename Derived::Scalar Scalar;
+  typedef typename Derived::Index Index;
+  typedef visitor_redux_op<Visitor> ReduxOp;
+  typedef typename ReduxOp::type Func;
+  typedef redux_impl<Func, Derived, LinearVectorizedTraversal, NoUnrolling> Impl;
+  enum {
+    BlockSize = 4096,
+    Cost = int(Derived::CoeffReadCost)==Dynamic ? 100 : int(Derived::CoeffReadCost) > 1 ? int(Derived::CoeffReadCost) : 1
+  };
+
+  // reduces the blocks [begin,end) and returns the best value in \a best
+  // and the index of the first block reaching it in \a bestBlock
+  static void reduce_blocks(const Derived& mat, Index begin, Index end, Scalar& best, Index& bestBlock)
+  {
+    const Func func;
+    const Index size = mat.size();
+    best = Impl::run(mat, func, begin*BlockSize, (std::min)(size, (begin+1)*BlockSize));
+    bestBlock = begin;
+    for(Index k = begin+1; k < end; ++k)
+    {
+      const Scalar value = Impl::run(mat, func, k*BlockSize, (std::min)(size, (k+1)*BlockSize));
+      if(ReduxOp::better(value, best))
+      {
+        best = value;
+        bestBlock = k;
+      }
+    }
+  }
+
+  static bool run(const Derived& mat, Visitor& visitor)
+  {
+    const Index rows = mat.rows(), size = mat.size();
+    // the visitors go through the coefficients in column-major order
+    if(size < BlockSize || (Derived::IsRowMajor && rows != 1 && mat.cols() != 1))
+      return false;
+
+    const Index count = (size + BlockSize - 1) / BlockSize;
+    Scalar best;
+    Index bestBlock;
+#ifdef EIGEN_HAS_OPENMP
+    const int threads = (std::min)(Index(parallel_eval_threads(size * Cost)), count);
+    if(threads > 1)
+    {
+      ei_declare_aligned_stack_constructed_variable(Scalar, bests, threads, 0);
+      ei_declare_aligned_stack_constructed_variable(Index, bestBlocks, threads, 0);
+      #pragma omp parallel for schedule(static,1) num_threads(threads)
+      for(int t = 0; t < threads; ++t)
+        reduce_blocks(mat, (count*t)/threads, (count*(t+1))/threads, bests[t], bestBlocks[t]);
+      best = bests[0];
+      bestBlock = bestBlocks[0];
+      for(int t = 1; t < threads; ++t)
+        if(ReduxOp::better(bests[t], best))
+        {
+          best = bests[t];
+          bestBlock = bestBlocks[t];
+        }
+    }
+    else
+#endif
+    reduce_blocks(mat, 0, count, best, bestBlock);
+
+    const Index start = bestBlock*BlockSize;
+    const Index end = (std::min)(size, start+BlockSize);
+    Visitor blockVisitor;
+    blockVisitor.init(mat.coeff(start), start % rows, start / rows);
+    for(Index i = start+1; i < end; ++i)
+      blockVisitor(mat.coeff(i), i % rows, i / rows);
+    // NaN coefficients make the packet and scalar comparisons disagree
+    if(!(blockVisitor.res == best))
+      return false;
+    visitor = blockVisitor;
+    return true;
+  }
+};
+
 } // end namespace internal
 
+/** Applies the visitor \a visitor to the whole coefficients of the matrix or vector.
+  *
+  * The template parameter \a Visitor is the type of the visitor and provides the following interface:
+  * \code
+  * struct MyVisitor {
+  *   // called for the first coefficient
+  *   void init(const Scalar& value, Index i, Index j);
+  *   // called for all other coefficients
+  *   void operator() (const Scalar& value, Index i, Index j);
+  * };
+  * \endcode
+  *
+  * \note compared to one or two \em for \em loops, visitors offer automatic
+  * unrolling for small fixed size matrix.
+  *
+  * \note the visitors used by minCoeff(Index*,Index*) and maxCoeff(Index*,Index*) are vectorized,
+  * and evaluated in parallel when OpenMP is enabled, for large expressions with linear vectorized access.
+  *
+  * \sa minCoeff(Index*,Index*), maxCoeff(Index*,Index*), DenseBase::redux()
+  */
+template<typename Derived>
+template<typename Visitor>
+void DenseBase<Derived>::visit(Visitor& visitor) const
+{
+  enum { unroll = SizeAtCompileTime != Dynamic
+                   && CoeffReadCost != Dynamic
+                   && (SizeAtCompileTime == 1 || internal::functor_traits<Visitor>::Cost != Dynamic)
+                   && SizeAtCompileTime * CoeffReadCost + (SizeAtCompileTime-1) * internal::functor_traits<Visitor>::Cost
+                      <= EIGEN_UNROLLING_LIMIT };
+  typedef typename internal::remove_all<typename Derived::Nested>::type ThisNested;
+  if(internal::visitor_vectorized_impl<Visitor, ThisNested>::run(derived(), visitor))
+    return;
+  return internal::visitor_impl<Visitor, Derived,
+      unroll ? int(SizeAtCompileTime) : Dynamic
+    >::run(derived(), visitor);
+}
+
 /** \returns the minimum of all coefficients of *this
   * and puts in *row and *col its location.
   *
@@ -638,6 +638,30 @@ struct palign_impl<Offset,Packet2d>
 };
 #endif
 
+template<> EIGEN_STRONG_INLINE void ptranspose<Packet4f>(Packet4f* kernel)
+{
+  _MM_TRANSPOSE4_PS(kernel[0], kernel[1], kernel[2], kernel[3]);
+}
+
+template<> EIGEN_STRONG_INLINE void ptranspose<Packet2d>(Packet2d* kernel)
+{
+  Packet2d tmp = _mm_unpackhi_pd(kernel[0], kernel[1]);
+  kernel[0] = _mm_unpacklo_pd(kernel[0], kernel[1]);
+  kernel[1] = tmp;
+}
+
+template<> EIGEN_STRONG_INLINE void ptranspose<Packet4i>(Packet4i* kernel)
+{
+  Packet4i tmp0 = _mm_unpacklo_epi32(kernel[0], kernel[1]);
+  Packet4i tmp1 = _mm_unpacklo_epi32(kernel[2], kernel[3]);
+  Packet4i tmp2 = _mm_unpackhi_epi32(kernel[0], kernel[1]);
+  Packet4i tmp3 = _mm_unpackhi_epi32(kernel[2], kernel[3]);
+  kernel[0] = _mm_unpacklo_epi64(tmp0, tmp1);
+  kernel[1] = _mm_unpackhi_epi64(tmp0, tmp1);
+  kernel[2] = _mm_unpacklo_epi64(tmp2, tmp3);
+  kernel[3] = _mm_unpackhi_epi64(tmp2, tmp3);
+}
+
 } // end namespace internal
 
 #endif // EIGEN_PACKET_MATH_SSE_H
@@ -94,8 +94,10 @@ static void run(Index rows, Index cols, Index depth,
     
     std::size_t sizeA = kc*mc;
     std::size_t sizeW = kc*Traits::WorkSpaceFactor;
-    ei_declare_aligned_stack_constructed_variable(LhsScalar, blockA, sizeA, 0);
-    ei_declare_aligned_stack_constructed_variable(RhsScalar, w, sizeW, 0);
+    product_workspace_buffer<LhsScalar> workspaceA(ProductWorkspaceA, sizeA);
+    product_workspace_buffer<RhsScalar> workspaceW(ProductWorkspaceW, sizeW);
+    ei_declare_aligned_stack_constructed_variable(LhsScalar, blockA, sizeA, workspaceA.data());
+    ei_declare_aligned_stack_constructed_variable(RhsScalar, w, sizeW, workspaceW.data());
     
     RhsScalar* blockB = blocking.blockB();
     eigen_internal_assert(blockB!=0);
@@ -166,9 +168,13 @@ static void run(Index rows, Index cols, Index depth,
     std::size_t sizeB = kc*cols;
     std::size_t sizeW = kc*Traits::WorkSpaceFactor;
 
-    ei_declare_aligned_stack_constructed_variable(LhsScalar, blockA, sizeA, blocking.blockA());
-    ei_declare_aligned_stack_constructed_variable(RhsScalar, blockB, sizeB, blocking.blockB());
-    ei_declare_aligned_stack_constructed_variable(RhsScalar, blockW, sizeW, blocking.blockW());
+    // the packing buffers are taken from the blocking object if it provides them, or from the workspace of the thread
+    product_workspace_buffer<LhsScalar> workspaceA(ProductWorkspaceA, sizeA, blocking.blockA());
+    product_workspace_buffer<RhsScalar> workspaceB(ProductWorkspaceB, sizeB, blocking.blockB());
+    product_workspace_buffer<RhsScalar> workspaceW(ProductWorkspaceW, sizeW, blocking.blockW());
+    ei_declare_aligned_stack_constructed_variable(LhsScalar, blockA, sizeA, workspaceA.data());
+    ei_declare_aligned_stack_constructed_variable(RhsScalar, blockB, sizeB, workspaceB.data());
+    ei_declare_aligned_stack_constructed_variable(RhsScalar, blockW, sizeW, workspaceW.data());
 
     // For each horizontal panel of the rhs, and corresponding panel of the lhs...
     // (==GEMM_VAR1)
@@ -338,10 +344,14 @@ class gemm_blocking_space<StorageOrder,_LhsScalar,_RhsScalar,MaxRows, MaxCols, M
     DenseIndex m_sizeA;
     DenseIndex m_sizeB;
     DenseIndex m_sizeW;
+    bool m_workspaceA;
+    bool m_workspaceB;
+    bool m_workspaceW;
 
   public:
 
     gemm_blocking_space(DenseIndex rows, DenseIndex cols, DenseIndex depth)
+      : m_workspaceA(false), m_workspaceB(false), m_workspaceW(false)
     {
       this->m_mc = Transpose ? cols : rows;
       this->m_nc = Transpose ? rows : cols;
@@ -356,19 +366,34 @@ class gemm_blocking_space<StorageOrder,_LhsScalar,_RhsScalar,MaxRows, MaxCols, M
     void allocateA()
     {
       if(this->m_blockA==0)
-        this->m_blockA = aligned_new<LhsScalar>(m_sizeA);
+      {
+        this->m_blockA = product_workspace_new<LhsScalar>(ProductWorkspaceA, m_sizeA);
+        m_workspaceA = this->m_blockA!=0;
+        if(!m_workspaceA)
+          this->m_blockA = aligned_new<LhsScalar>(m_sizeA);
+      }
     }
 
     void allocateB()
     {
       if(this->m_blockB==0)
-        this->m_blockB = aligned_new<RhsScalar>(m_sizeB);
+      {
+        this->m_blockB = product_workspace_new<RhsScalar>(ProductWorkspaceB, m_sizeB);
+        m_workspaceB = this->m_blockB!=0;
+        if(!m_workspaceB)
+          this->m_blockB = aligned_new<RhsScalar>(m_sizeB);
+      }
     }
 
     void allocateW()
     {
       if(this->m_blockW==0)
-        this->m_blockW = aligned_new<RhsScalar>(m_sizeW);
+      {
+        this->m_blockW = product_workspace_new<RhsScalar>(ProductWorkspaceW, m_sizeW);
+        m_workspaceW = this->m_blockW!=0;
+        if(!m_workspaceW)
+          this->m_blockW = aligned_new<RhsScalar>(m_sizeW);
+      }
     }
 
     void allocateAll()
@@ -380,9 +405,12 @@ class gemm_blocking_space<StorageOrder,_LhsScalar,_RhsScalar,MaxRows, MaxCols, M
 
     ~gemm_blocking_space()
     {
-      aligned_delete(this->m_blockA, m_sizeA);
-      aligned_delete(this->m_blockB, m_sizeB);
-      aligned_delete(this->m_blockW, m_sizeW);
+      if(m_workspaceA) product_workspace_delete(ProductWorkspaceA, this->m_blockA, m_sizeA);
+      else             aligned_delete(this->m_blockA, m_sizeA);
+      if(m_workspaceB) product_workspace_delete(ProductWorkspaceB, this->m_blockB, m_sizeB);
+      else             aligned_delete(this->m_blockB, m_sizeB);
+      if(m_workspaceW) product_workspace_delete(ProductWorkspaceW, this->m_blockW, m_sizeW);
+      else             aligned_delete(this->m_blockW, m_sizeW);
     }
 };
 
@@ -85,8 +85,10 @@ struct general_matrix_matrix_triangular_product<Index,LhsScalar,LhsStorageOrder,
 
     std::size_t sizeW = kc*Traits::WorkSpaceFactor;
     std::size_t sizeB = sizeW + kc*size;
-    ei_declare_aligned_stack_constructed_variable(LhsScalar, blockA, kc*mc, 0);
-    ei_declare_aligned_stack_constructed_variable(RhsScalar, allocatedBlockB, sizeB, 0);
+    product_workspace_buffer<LhsScalar> workspaceA(ProductWorkspaceA, kc*mc);
+    product_workspace_buffer<RhsScalar> workspaceB(ProductWorkspaceB, sizeB);
+    ei_declare_aligned_stack_constructed_variable(LhsScalar, blockA, kc*mc, workspaceA.data());
+    ei_declare_aligned_stack_constructed_variable(RhsScalar, allocatedBlockB, sizeB, workspaceB.data());
     RhsScalar* blockB = allocatedBlockB + sizeW;
     
     gemm_pack_lhs<LhsScalar, Index, Traits::mr, Traits::LhsProgress, LhsStorageOrder> pack_lhs;
@@ -71,6 +71,30 @@ inline void setNbThreads(int v)
   manage_multi_threading(SetAction, &v);
 }
 
+/** \internal
+  * The minimal amount of work, roughly measured in number of coefficient reads, which is worth giving
+  * to a thread when evaluating a large coefficient-wise expression or reduction.
+  */
+#ifndef EIGEN_PARALLEL_EVAL_THRESHOLD
+#define EIGEN_PARALLEL_EVAL_THRESHOLD 65536
+#endif
+
+/** \internal
+  * \returns the number of threads to use to evaluate an expression involving \a work coefficient reads.
+  * It is one if OpenMP is not enabled, if we are already in a parallel session,
+  * or if \a work is too small. */
+inline int parallel_eval_threads(std::ptrdiff_t work)
+{
+#ifdef EIGEN_HAS_OPENMP
+  if(omp_get_num_threads()>1 || work < 2*EIGEN_PARALLEL_EVAL_THRESHOLD)
+    return 1;
+  return int((std::min)(std::ptrdiff_t(nbThreads()), work / EIGEN_PARALLEL_EVAL_THRESHOLD));
+#else
+  EIGEN_UNUSED_VARIABLE(work);
+  return 1;
+#endif
+}
+
 template<typename Index> struct GemmParallelInfo
 {
   GemmParallelInfo() : sync(-1), users(0), rhs_start(0), rhs_length(0) {}
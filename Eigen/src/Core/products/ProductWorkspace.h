@@ -0,0 +1,247 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef EIGEN_PRODUCT_WORKSPACE_H
+#define EIGEN_PRODUCT_WORKSPACE_H
+
+// The workspace is attached to the calling thread, and it is therefore disabled when the
+// compiler does not provide thread local storage.
+#if defined(EIGEN_NO_THREAD_LOCAL) && !defined(EIGEN_NO_PRODUCT_WORKSPACE)
+#define EIGEN_NO_PRODUCT_WORKSPACE
+#endif
+
+/** \internal Alignment (in bytes) of the product workspace buffers. */
+#ifndef EIGEN_PRODUCT_WORKSPACE_ALIGNMENT
+#define EIGEN_PRODUCT_WORKSPACE_ALIGNMENT 4096
+#endif
+
+/** \internal Workspace buffers larger than this size (in bytes) are aligned on a multiple of it,
+  * such that the operating system can back them with huge pages. */
+#ifndef EIGEN_PRODUCT_WORKSPACE_HUGE_PAGE_SIZE
+#define EIGEN_PRODUCT_WORKSPACE_HUGE_PAGE_SIZE (2*1024*1024)
+#endif
+
+namespace internal {
+
+/** \internal The packing buffers of the level 3 kernels: the packed lhs panel (A), the packed rhs panel (B)
+  * and the extra workspace of gebp (W). */
+enum {
+  ProductWorkspaceA = 0,
+  ProductWorkspaceB = 1,
+  ProductWorkspaceW = 2,
+  ProductWorkspaceSlots = 3
+};
+
+struct product_workspace_slot
+{
+  void* data;
+  void* original;
+  std::size_t capacity;
+  bool busy;
+};
+
+/** \internal \returns the workspace slots of the calling thread */
+inline product_workspace_slot* product_workspace()
+{
+  static EIGEN_THREAD_LOCAL product_workspace_slot slots[ProductWorkspaceSlots];
+  return slots;
+}
+
+/** \internal \returns whether the calling thread uses a product workspace, i.e., whether it called
+  * reserveProductWorkspace() since its last call to releaseProductWorkspace() */
+inline bool& product_workspace_enabled()
+{
+  static EIGEN_THREAD_LOCAL bool enabled = false;
+  return enabled;
+}
+
+inline void product_workspace_free(product_workspace_slot& slot)
+{
+  eigen_assert(!slot.busy && "a product workspace buffer cannot be released while it is in use");
+  std::free(slot.original);
+  slot.data = 0;
+  slot.original = 0;
+  slot.capacity = 0;
+}
+
+/** \internal Grows the buffer of \a slot such that it can hold at least \a size bytes.
+  * The previous content of the buffer is not preserved. */
+inline void product_workspace_grow(product_workspace_slot& slot, std::size_t size)
+{
+  if(slot.capacity>=size)
+    return;
+  product_workspace_free(slot);
+  check_that_malloc_is_allowed();
+
+  std::size_t alignment = size>=std::size_t(EIGEN_PRODUCT_WORKSPACE_HUGE_PAGE_SIZE) ? std::size_t(EIGEN_PRODUCT_WORKSPACE_HUGE_PAGE_SIZE)
+                                                                                    : std::size_t(EIGEN_PRODUCT_WORKSPACE_ALIGNMENT);
+  std::size_t capacity = (size + alignment - 1) & ~(alignment - 1);
+  void* original = std::malloc(capacity + alignment);
+  if(original==0)
+    throw_std_bad_alloc();
+  slot.original = original;
+  slot.data = reinterpret_cast<void*>((reinterpret_cast<std::size_t>(original) + alignment - 1) & ~(alignment - 1));
+  slot.capacity = capacity;
+}
+
+/** \internal \returns a buffer of at least \a size bytes taken from the slot \a id of the workspace of the calling thread,
+  * or a null pointer if the slot is already in use. The workspace is not grown if the calling thread does not use it,
+  * or if the request can be served on the stack or by an active MemoryArena. The buffer must be given back by
+  * product_workspace_release(). */
+inline void* product_workspace_acquire(int id, std::size_t size)
+{
+#ifdef EIGEN_NO_PRODUCT_WORKSPACE
+  EIGEN_UNUSED_VARIABLE(id);
+  EIGEN_UNUSED_VARIABLE(size);
+  return 0;
+#else
+  product_workspace_slot& slot = product_workspace()[id];
+  if(slot.busy)
+    return 0;
+  if(slot.capacity<size)
+  {
+    if(!product_workspace_enabled() || size<=EIGEN_STACK_ALLOCATION_LIMIT || current_memory_arena()!=0)
+      return 0;
+    product_workspace_grow(slot, size);
+  }
+  slot.busy = true;
+  return slot.data;
+#endif
+}
+
+inline void product_workspace_release(int id)
+{
+  product_workspace()[id].busy = false;
+}
+
+/** \internal Same as product_workspace_acquire() but for an array of \a size objects of type T,
+  * which are constructed if required. */
+template<typename T> inline T* product_workspace_new(int id, std::size_t size)
+{
+  check_size_for_overflow<T>(size);
+  T* result = static_cast<T*>(product_workspace_acquire(id, sizeof(T)*size));
+  if(NumTraits<T>::RequireInitialization && result)
+    construct_elements_of_array(result, size);
+  return result;
+}
+
+/** \internal Destructs the \a size objects of the buffer \a ptr given by product_workspace_new() and releases it. */
+template<typename T> inline void product_workspace_delete(int id, T* ptr, std::size_t size)
+{
+  if(NumTraits<T>::RequireInitialization)
+    destruct_elements_of_array(ptr, size);
+  product_workspace_release(id);
+}
+
+/** \internal Scoped access to a buffer of the product workspace.
+  * If \a buffer is not null, then it is used as is. Otherwise, data() is a buffer of the workspace,
+  * or a null pointer if the workspace cannot serve the request, in which case the caller falls back
+  * to ei_declare_aligned_stack_constructed_variable. */
+template<typename T> class product_workspace_buffer
+{
+  public:
+    product_workspace_buffer(int id, std::size_t size, T* buffer = 0)
+      : m_id(id), m_size(size), m_data(buffer), m_owned(false)
+    {
+      if(m_data==0)
+      {
+        m_data = product_workspace_new<T>(id, size);
+        m_owned = m_data!=0;
+      }
+    }
+
+    ~product_workspace_buffer()
+    {
+      if(m_owned)
+        product_workspace_delete(m_id, m_data, m_size);
+    }
+
+    inline T* data() const { return m_data; }
+
+  protected:
+    int m_id;
+    std::size_t m_size;
+    T* m_data;
+    bool m_owned;
+
+  private:
+    product_workspace_buffer(const product_workspace_buffer&);
+    product_workspace_buffer& operator=(const product_workspace_buffer&);
+};
+
+} // end namespace internal
+
+/** Enables the product workspace of the calling thread, and pre-allocates it such that the products of a \a rows x
+  * \a depth matrix by a \a depth x \a cols matrix of scalar type \a Scalar, as well as the selfadjoint and triangular
+  * products and solvers of the same sizes, do not perform any heap allocation for their packing buffers.
+  *
+  * Once enabled, the level 3 kernels (matrix-matrix products, selfadjoint and triangular matrix products, and triangular
+  * solvers with multiple right hand sides) of the calling thread pack their operands into buffers taken from this workspace.
+  * The workspace then grows on demand and is kept between the calls, so that products performed in a loop only pay for the
+  * allocation, and for the page faults of freshly mapped memory, once. The threads which did not call this function keep
+  * allocating their packing buffers for each product, and do not retain any memory.
+  *
+  * \sa releaseProductWorkspace(), productWorkspaceSize() */
+template<typename Scalar>
+void reserveProductWorkspace(std::ptrdiff_t rows, std::ptrdiff_t cols, std::ptrdiff_t depth)
+{
+#ifndef EIGEN_NO_PRODUCT_WORKSPACE
+  typedef internal::gebp_traits<Scalar,Scalar> Traits;
+  std::ptrdiff_t kc = depth, mc = rows, nc = cols;
+  internal::computeProductBlockingSizes<Scalar,Scalar>(kc, mc, nc);
+  internal::product_workspace_slot* slots = internal::product_workspace();
+  internal::product_workspace_enabled() = true;
+  internal::product_workspace_grow(slots[internal::ProductWorkspaceA], sizeof(Scalar) * kc * mc);
+  internal::product_workspace_grow(slots[internal::ProductWorkspaceB], sizeof(Scalar) * kc * (cols + Traits::WorkSpaceFactor));
+  internal::product_workspace_grow(slots[internal::ProductWorkspaceW], sizeof(Scalar) * kc * Traits::WorkSpaceFactor);
+#else
+  EIGEN_UNUSED_VARIABLE(rows);
+  EIGEN_UNUSED_VARIABLE(cols);
+  EIGEN_UNUSED_VARIABLE(depth);
+#endif
+}
+
+/** Frees and disables the product workspace of the calling thread. Threads which called reserveProductWorkspace()
+  * should call it before exiting, since the workspace is not freed automatically.
+  *
+  * \sa reserveProductWorkspace(), productWorkspaceSize() */
+inline void releaseProductWorkspace()
+{
+  internal::product_workspace_slot* slots = internal::product_workspace();
+  for(int i=0; i<internal::ProductWorkspaceSlots; ++i)
+    internal::product_workspace_free(slots[i]);
+  internal::product_workspace_enabled() = false;
+}
+
+/** \returns the number of bytes currently held by the product workspace of the calling thread
+  *
+  * \sa reserveProductWorkspace(), releaseProductWorkspace() */
+inline std::size_t productWorkspaceSize()
+{
+  internal::product_workspace_slot* slots = internal::product_workspace();
+  std::size_t size = 0;
+  for(int i=0; i<internal::ProductWorkspaceSlots; ++i)
+    size += slots[i].capacity;
+  return size;
+}
+
+#endif // EIGEN_PRODUCT_WORKSPACE_H
@@ -265,8 +265,10 @@ struct product_selfadjoint_matrix<Scalar,Index,LhsStorageOrder,true,ConjugateLhs
 
     std::size_t sizeW = kc*Traits::WorkSpaceFactor;
     std::size_t sizeB = sizeW + kc*cols;
-    ei_declare_aligned_stack_constructed_variable(Scalar, blockA, kc*mc, 0);
-    ei_declare_aligned_stack_constructed_variable(Scalar, allocatedBlockB, sizeB, 0);
+    product_workspace_buffer<Scalar> workspaceA(ProductWorkspaceA, kc*mc);
+    product_workspace_buffer<Scalar> workspaceB(ProductWorkspaceB, sizeB);
+    ei_declare_aligned_stack_constructed_variable(Scalar, blockA, kc*mc, workspaceA.data());
+    ei_declare_aligned_stack_constructed_variable(Scalar, allocatedBlockB, sizeB, workspaceB.data());
     Scalar* blockB = allocatedBlockB + sizeW;
 
     gebp_kernel<Scalar, Scalar, Index, Traits::mr, Traits::nr, ConjugateLhs, ConjugateRhs> gebp_kernel;
@@ -342,8 +344,10 @@ struct product_selfadjoint_matrix<Scalar,Index,LhsStorageOrder,false,ConjugateLh
     computeProductBlockingSizes<Scalar,Scalar>(kc, mc, nc);
     std::size_t sizeW = kc*Traits::WorkSpaceFactor;
     std::size_t sizeB = sizeW + kc*cols;
-    ei_declare_aligned_stack_constructed_variable(Scalar, blockA, kc*mc, 0);
-    ei_declare_aligned_stack_constructed_variable(Scalar, allocatedBlockB, sizeB, 0);
+    product_workspace_buffer<Scalar> workspaceA(ProductWorkspaceA, kc*mc);
+    product_workspace_buffer<Scalar> workspaceB(ProductWorkspaceB, sizeB);
+    ei_declare_aligned_stack_constructed_variable(Scalar, blockA, kc*mc, workspaceA.data());
+    ei_declare_aligned_stack_constructed_variable(Scalar, allocatedBlockB, sizeB, workspaceB.data());
     Scalar* blockB = allocatedBlockB + sizeW;
 
     gebp_kernel<Scalar, Scalar, Index, Traits::mr, Traits::nr, ConjugateLhs, ConjugateRhs> gebp_kernel;
@@ -126,8 +126,10 @@ struct product_triangular_matrix_matrix<Scalar,Index,Mode,true,
     computeProductBlockingSizes<Scalar,Scalar,4>(kc, mc, nc);
     std::size_t sizeW = kc*Traits::WorkSpaceFactor;
     std::size_t sizeB = sizeW + kc*cols;
-    ei_declare_aligned_stack_constructed_variable(Scalar, blockA, kc*mc, 0);
-    ei_declare_aligned_stack_constructed_variable(Scalar, allocatedBlockB, sizeB, 0);    
+    product_workspace_buffer<Scalar> workspaceA(ProductWorkspaceA, kc*mc);
+    product_workspace_buffer<Scalar> workspaceB(ProductWorkspaceB, sizeB);
+    ei_declare_aligned_stack_constructed_variable(Scalar, blockA, kc*mc, workspaceA.data());
+    ei_declare_aligned_stack_constructed_variable(Scalar, allocatedBlockB, sizeB, workspaceB.data());
     Scalar* blockB = allocatedBlockB + sizeW;
 
     Matrix<Scalar,SmallPanelWidth,SmallPanelWidth,LhsStorageOrder> triangularBuffer;
@@ -255,8 +257,10 @@ struct product_triangular_matrix_matrix<Scalar,Index,Mode,false,
 
     std::size_t sizeW = kc*Traits::WorkSpaceFactor;
     std::size_t sizeB = sizeW + kc*cols;
-    ei_declare_aligned_stack_constructed_variable(Scalar, blockA, kc*mc, 0);
-    ei_declare_aligned_stack_constructed_variable(Scalar, allocatedBlockB, sizeB, 0);
+    product_workspace_buffer<Scalar> workspaceA(ProductWorkspaceA, kc*mc);
+    product_workspace_buffer<Scalar> workspaceB(ProductWorkspaceB, sizeB);
+    ei_declare_aligned_stack_constructed_variable(Scalar, blockA, kc*mc, workspaceA.data());
+    ei_declare_aligned_stack_constructed_variable(Scalar, allocatedBlockB, sizeB, workspaceB.data());
     Scalar* blockB = allocatedBlockB + sizeW;
 
     Matrix<Scalar,SmallPanelWidth,SmallPanelWidth,RhsStorageOrder> triangularBuffer;
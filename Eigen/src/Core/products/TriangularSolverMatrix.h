@@ -72,8 +72,10 @@ struct triangular_solve_matrix<Scalar,Index,OnTheLeft,Mode,Conjugate,TriStorageO
 
     std::size_t sizeW = kc*Traits::WorkSpaceFactor;
     std::size_t sizeB = sizeW + kc*cols;
-    ei_declare_aligned_stack_constructed_variable(Scalar, blockA, kc*mc, 0);
-    ei_declare_aligned_stack_constructed_variable(Scalar, allocatedBlockB, sizeB, 0);
+    product_workspace_buffer<Scalar> workspaceA(ProductWorkspaceA, kc*mc);
+    product_workspace_buffer<Scalar> workspaceB(ProductWorkspaceB, sizeB);
+    ei_declare_aligned_stack_constructed_variable(Scalar, blockA, kc*mc, workspaceA.data());
+    ei_declare_aligned_stack_constructed_variable(Scalar, allocatedBlockB, sizeB, workspaceB.data());
     Scalar* blockB = allocatedBlockB + sizeW;
     Scalar* blockW = allocatedBlockB;
 
@@ -218,8 +220,10 @@ struct triangular_solve_matrix<Scalar,Index,OnTheRight,Mode,Conjugate,TriStorage
 
     std::size_t sizeW = kc*Traits::WorkSpaceFactor;
     std::size_t sizeB = sizeW + kc*size;
-    ei_declare_aligned_stack_constructed_variable(Scalar, blockA, kc*mc, 0);
-    ei_declare_aligned_stack_constructed_variable(Scalar, allocatedBlockB, sizeB, 0);
+    product_workspace_buffer<Scalar> workspaceA(ProductWorkspaceA, kc*mc);
+    product_workspace_buffer<Scalar> workspaceB(ProductWorkspaceB, sizeB);
+    ei_declare_aligned_stack_constructed_variable(Scalar, blockA, kc*mc, workspaceA.data());
+    ei_declare_aligned_stack_constructed_variable(Scalar, allocatedBlockB, sizeB, workspaceB.data());
     Scalar* blockB = allocatedBlockB + sizeW;
 
     conj_if<Conjugate> conj;
@@ -67,8 +67,8 @@
   #define EIGEN_MALLOC_ALREADY_ALIGNED 0
 #endif
 
-#if ((defined __QNXNTO__) || (defined _GNU_SOURCE) || ((defined _XOPEN_SOURCE) && (_XOPEN_SOURCE >= 600))) \
- && (defined _POSIX_ADVISORY_INFO) && (_POSIX_ADVISORY_INFO > 0)
+#if (((defined __QNXNTO__) || (defined _GNU_SOURCE) || ((defined _XOPEN_SOURCE) && (_XOPEN_SOURCE >= 600))) \
+ && (defined _POSIX_ADVISORY_INFO) && (_POSIX_ADVISORY_INFO > 0)) || (defined __GLIBC__)
   #define EIGEN_HAS_POSIX_MEMALIGN 1
 #else
   #define EIGEN_HAS_POSIX_MEMALIGN 0
@@ -80,6 +80,33 @@
   #define EIGEN_HAS_MM_MALLOC 0
 #endif
 
+// Alignment policy of aligned_malloc. The heap blocks are aligned on EIGEN_MALLOC_ALIGNMENT bytes, i.e., on a cache
+// line by default, and the blocks of at least EIGEN_HUGE_PAGE_THRESHOLD bytes are aligned on EIGEN_HUGE_PAGE_SIZE
+// bytes and, on Linux, advised to be backed by transparent huge pages. A threshold of 0 disables the latter.
+// Note that the correctness of the vectorized code only requires the 16 bytes alignment of the packets.
+#ifndef EIGEN_MALLOC_ALIGNMENT
+  #define EIGEN_MALLOC_ALIGNMENT 64
+#endif
+
+#ifndef EIGEN_HUGE_PAGE_SIZE
+  #define EIGEN_HUGE_PAGE_SIZE (2*1024*1024)
+#endif
+
+#ifndef EIGEN_HUGE_PAGE_THRESHOLD
+  #define EIGEN_HUGE_PAGE_THRESHOLD (4*1024*1024)
+#endif
+
+#if EIGEN_ALIGN && (EIGEN_MALLOC_ALIGNMENT<16 || (EIGEN_MALLOC_ALIGNMENT & (EIGEN_MALLOC_ALIGNMENT-1)))
+  #error EIGEN_MALLOC_ALIGNMENT must be a power of two, and at least 16
+#endif
+
+// whether std::malloc alone fulfills the alignment policy
+#if EIGEN_MALLOC_ALREADY_ALIGNED && EIGEN_MALLOC_ALIGNMENT==16 && EIGEN_HUGE_PAGE_THRESHOLD==0
+  #define EIGEN_MALLOC_FULFILLS_ALIGNMENT_POLICY 1
+#else
+  #define EIGEN_MALLOC_FULFILLS_ALIGNMENT_POLICY 0
+#endif
+
 namespace internal {
 
 inline void throw_std_bad_alloc()
@@ -98,14 +125,15 @@ inline void throw_std_bad_alloc()
 
 /* ----- Hand made implementations of aligned malloc/free and realloc ----- */
 
-/** \internal Like malloc, but the returned pointer is guaranteed to be 16-byte aligned.
-  * Fast, but wastes 16 additional bytes of memory. Does not throw any exception.
+/** \internal Like malloc, but the returned pointer is guaranteed to be aligned on \a alignment bytes,
+  * which must be a power of two at least as large as a pointer.
+  * Fast, but wastes \a alignment additional bytes of memory. Does not throw any exception.
   */
-inline void* handmade_aligned_malloc(size_t size)
+inline void* handmade_aligned_malloc(size_t size, size_t alignment = 16)
 {
-  void *original = std::malloc(size+16);
+  void *original = std::malloc(size+alignment);
   if (original == 0) return 0;
-  void *aligned = reinterpret_cast<void*>((reinterpret_cast<size_t>(original) & ~(size_t(15))) + 16);
+  void *aligned = reinterpret_cast<void*>((reinterpret_cast<size_t>(original) & ~(alignment-1)) + alignment);
   *(reinterpret_cast<void**>(aligned) - 1) = original;
   return aligned;
 }
@@ -120,18 +148,52 @@ inline void handmade_aligned_free(void *ptr)
   * \brief Reallocates aligned memory.
   * Since we know that our handmade version is based on std::realloc
   * we can use std::realloc to implement efficient reallocation.
+  * The data are moved if the offset of the aligned block within the reallocated one changed.
+  * A non zero \a old_size bounds the number of copied bytes when the block cannot be reallocated in place.
   */
-inline void* handmade_aligned_realloc(void* ptr, size_t size, size_t = 0)
+inline void* handmade_aligned_realloc(void* ptr, size_t size, size_t old_size = 0, size_t alignment = 16)
 {
-  if (ptr == 0) return handmade_aligned_malloc(size);
+  if (ptr == 0) return handmade_aligned_malloc(size, alignment);
   void *original = *(reinterpret_cast<void**>(ptr) - 1);
-  original = std::realloc(original,size+16);
+  size_t previous_offset = static_cast<char*>(ptr) - static_cast<char*>(original);
+  if (previous_offset > alignment)
+  {
+    // the block was aligned on a larger boundary, and its data might not fit in the reallocated block
+    void *result = handmade_aligned_malloc(size, alignment);
+    if (result == 0) return 0;
+    std::memcpy(result, ptr, old_size ? (std::min)(size,old_size) : size);
+    std::free(original);
+    return result;
+  }
+  original = std::realloc(original,size+alignment);
   if (original == 0) return 0;
-  void *aligned = reinterpret_cast<void*>((reinterpret_cast<size_t>(original) & ~(size_t(15))) + 16);
+  void *aligned = reinterpret_cast<void*>((reinterpret_cast<size_t>(original) & ~(alignment-1)) + alignment);
+  if (static_cast<size_t>(static_cast<char*>(aligned) - static_cast<char*>(original)) != previous_offset)
+    std::memmove(aligned, static_cast<char*>(original) + previous_offset, size);
   *(reinterpret_cast<void**>(aligned) - 1) = original;
   return aligned;
 }
 
+/** \internal \returns the alignment in bytes of a heap block of \a size bytes according to the alignment policy,
+  * see EIGEN_MALLOC_ALIGNMENT and EIGEN_HUGE_PAGE_THRESHOLD */
+inline size_t malloc_alignment(size_t size)
+{
+  return (EIGEN_HUGE_PAGE_THRESHOLD!=0 && size>=size_t(EIGEN_HUGE_PAGE_THRESHOLD)) ? size_t(EIGEN_HUGE_PAGE_SIZE)
+                                                                                  : size_t(EIGEN_MALLOC_ALIGNMENT);
+}
+
+/** \internal Advises the system to back the heap block \a ptr of \a size bytes with huge pages if it is large enough */
+inline void advise_huge_pages(void* ptr, size_t size)
+{
+#if defined(MADV_HUGEPAGE) && EIGEN_ALIGN
+  if(ptr && EIGEN_HUGE_PAGE_THRESHOLD!=0 && size>=size_t(EIGEN_HUGE_PAGE_THRESHOLD))
+    madvise(ptr, size, MADV_HUGEPAGE);
+#else
+  EIGEN_UNUSED_VARIABLE(ptr);
+  EIGEN_UNUSED_VARIABLE(size);
+#endif
+}
+
 /*****************************************************************************
 *** Implementation of generic aligned realloc (when no realloc can be used)***
 *****************************************************************************/
@@ -201,40 +263,289 @@ inline void check_that_malloc_is_allowed()
 {}
 #endif
 
-/** \internal Allocates \a size bytes. The returned pointer is guaranteed to have 16 bytes alignment.
+} // end namespace internal
+
+/*****************************************************************************
+*** Implementation of scoped memory arenas                                 ***
+*****************************************************************************/
+
+// The active arenas are attached to the calling thread. Without thread local storage,
+// the arenas can only be used by single threaded applications.
+#ifndef EIGEN_THREAD_LOCAL
+  #if defined(__GNUC__)
+    #define EIGEN_THREAD_LOCAL __thread
+  #elif defined(_MSC_VER)
+    #define EIGEN_THREAD_LOCAL __declspec(thread)
+  #else
+    #define EIGEN_THREAD_LOCAL
+    #define EIGEN_NO_THREAD_LOCAL
+  #endif
+#endif
+
+class MemoryArena;
+
+namespace internal {
+/** \internal \returns a reference to the innermost arena made active by the calling thread, or 0 */
+inline MemoryArena*& current_memory_arena()
+{
+  static EIGEN_THREAD_LOCAL MemoryArena* arena = 0;
+  return arena;
+}
+}
+
+/** \class MemoryArena
+  * \ingroup Core_Module
+  *
+  * \brief A stack allocator serving the dynamic allocations of Eigen within a scope
+  *
+  * A MemoryArena owns a single 16 bytes aligned buffer of fixed capacity. While the arena is made active on the
+  * calling thread by a MemoryArenaScope, all the heap allocations performed by Eigen on this thread, i.e., the
+  * dynamic size matrices and arrays, the blocking buffers of the products, and the buffers declared with
+  * ei_declare_aligned_stack_constructed_variable, are carved out of this buffer instead of going to malloc.
+  * The allocations are simply stacked, and the memory is reused as soon as the blocks at the top of the stack are
+  * freed. When the arena is full, the allocations fall back to the heap.
+  *
+  * The arena only serves the calling thread: the worker threads of multithreaded products allocate their own
+  * buffers as usual. A computation can thus only run entirely from an arena when Eigen uses a single thread,
+  * e.g., after setNbThreads(1).
+  *
+  * The arena records the number of allocations and the number of bytes it served, the number of allocations which
+  * went to the heap instead, and its peak usage. They are meant to help sizing the arena.
+  *
+  * Example:
+  * \code
+  * MemoryArena arena(1<<20);
+  * {
+  *   MemoryArenaScope scope(arena);
+  *   y = (A * B + C) * x;           // the temporaries live in the arena
+  * }
+  * std::cout << arena.allocations() << " allocations, " << arena.peak() << " bytes at most\n";
+  * \endcode
+  *
+  * \warning The memory allocated while the scope is active must be freed before the scope ends, i.e., the matrices
+  * created or resized within the scope must not outlive it. A MemoryArena must not be shared between threads.
+  *
+  * \sa MemoryArenaScope
+  */
+class MemoryArena
+{
+  public:
+    /** Creates an arena of \a capacity bytes. */
+    explicit MemoryArena(size_t capacity)
+      : m_capacity((capacity+15) & ~size_t(15)), m_offset(0), m_top(NoBlock), m_live(0), m_previous(0), m_active(false)
+    {
+      m_data = static_cast<char*>(internal::handmade_aligned_malloc(m_capacity));
+      if(!m_data && m_capacity)
+        internal::throw_std_bad_alloc();
+      resetStats();
+    }
+
+    ~MemoryArena()
+    {
+      eigen_assert(!m_active && m_live==0 && "a MemoryArena is destroyed while it is still in use");
+      internal::handmade_aligned_free(m_data);
+    }
+
+    /** \returns the size of the buffer in bytes */
+    size_t capacity() const { return m_capacity; }
+    /** \returns the number of bytes currently reserved, including the headers of the blocks */
+    size_t used() const { return m_offset; }
+    /** \returns the largest value of used() since the last call to resetStats() */
+    size_t peak() const { return m_peak; }
+    /** \returns the number of allocations served by the arena since the last call to resetStats() */
+    size_t allocations() const { return m_allocations; }
+    /** \returns the number of bytes requested by the allocations served by the arena */
+    size_t bytesAllocated() const { return m_bytes; }
+    /** \returns the number of allocations which did not fit into the arena and went to the heap */
+    size_t heapAllocations() const { return m_heapAllocations; }
+    /** \returns the number of bytes requested by the allocations which went to the heap */
+    size_t heapBytesAllocated() const { return m_heapBytes; }
+
+    /** Resets the statistics. */
+    void resetStats()
+    {
+      m_peak = m_offset;
+      m_allocations = m_bytes = m_heapAllocations = m_heapBytes = 0;
+    }
+
+    /** \internal \returns a 16 bytes aligned block of \a size bytes, or 0 if the arena is full */
+    void* allocate(size_t size)
+    {
+      size_t blockSize = ((size+15) & ~size_t(15)) + HeaderSize;
+      if(blockSize < size || blockSize > m_capacity - m_offset)
+      {
+        ++m_heapAllocations;
+        m_heapBytes += size;
+        return 0;
+      }
+      // the header links the block to the previous top of the stack, the lowest bit marks freed blocks
+      size_t* header = reinterpret_cast<size_t*>(m_data + m_offset);
+      header[0] = m_top;
+      header[1] = 0;
+      m_top = m_offset;
+      m_offset += blockSize;
+      m_peak = (std::max)(m_peak, m_offset);
+      ++m_live;
+      ++m_allocations;
+      m_bytes += size;
+      return m_data + m_top + HeaderSize;
+    }
+
+    /** \internal Frees the block \a ptr, and pops all the freed blocks from the top of the stack */
+    void deallocate(void* ptr)
+    {
+      reinterpret_cast<size_t*>(static_cast<char*>(ptr) - HeaderSize)[1] = 1;
+      --m_live;
+      while(m_top!=NoBlock && reinterpret_cast<size_t*>(m_data + m_top)[1]==1)
+      {
+        m_offset = m_top;
+        m_top = reinterpret_cast<size_t*>(m_data + m_top)[0];
+      }
+    }
+
+    /** \internal \returns whether \a ptr has been allocated by this arena */
+    bool owns(const void* ptr) const
+    {
+      return static_cast<const char*>(ptr) >= m_data && static_cast<const char*>(ptr) < m_data + m_capacity;
+    }
+
+    /** \internal \returns the arena which was active when \c *this has been made active */
+    MemoryArena* previous() const { return m_previous; }
+
+  protected:
+    friend class MemoryArenaScope;
+    enum { HeaderSize = 16 };
+    static const size_t NoBlock = ~size_t(0);
+
+    char* m_data;
+    size_t m_capacity;
+    size_t m_offset;
+    size_t m_top;
+    size_t m_live;
+    size_t m_peak;
+    size_t m_allocations;
+    size_t m_bytes;
+    size_t m_heapAllocations;
+    size_t m_heapBytes;
+    MemoryArena* m_previous;
+    bool m_active;
+
+  private:
+    MemoryArena(const MemoryArena&);
+    MemoryArena& operator=(const MemoryArena&);
+};
+
+/** \class MemoryArenaScope
+  * \ingroup Core_Module
+  *
+  * \brief Makes a MemoryArena active on the calling thread for the lifetime of the scope object
+  *
+  * Scopes can be nested, the innermost one serves the allocations. They must be destroyed in the reverse order
+  * of their creation, which is always the case for local variables.
+  *
+  * \sa MemoryArena
+  */
+class MemoryArenaScope
+{
+  public:
+    explicit MemoryArenaScope(MemoryArena& arena)
+      : m_arena(arena), m_live(arena.m_live)
+    {
+      eigen_assert(!arena.m_active && "this MemoryArena is already active");
+      arena.m_active = true;
+      arena.m_previous = internal::current_memory_arena();
+      internal::current_memory_arena() = &arena;
+    }
+
+    ~MemoryArenaScope()
+    {
+      eigen_assert(internal::current_memory_arena()==&m_arena && "MemoryArenaScope objects must be destroyed in the reverse order of their creation");
+      eigen_assert(m_arena.m_live==m_live && "some memory allocated within a MemoryArenaScope outlives it");
+      internal::current_memory_arena() = m_arena.m_previous;
+      m_arena.m_previous = 0;
+      m_arena.m_active = false;
+    }
+
+  protected:
+    MemoryArena& m_arena;
+    size_t m_live;
+
+  private:
+    MemoryArenaScope(const MemoryArenaScope&);
+    MemoryArenaScope& operator=(const MemoryArenaScope&);
+};
+
+namespace internal {
+
+/** \internal \returns a block of \a size bytes from the active arena, or 0 if there is no active arena or if it is full */
+inline void* memory_arena_allocate(size_t size)
+{
+  MemoryArena* arena = current_memory_arena();
+  return arena ? arena->allocate(size) : 0;
+}
+
+/** \internal \returns the active arena owning \a ptr, or 0 if \a ptr has been allocated on the heap */
+inline MemoryArena* memory_arena_owning(const void* ptr)
+{
+  for(MemoryArena* arena = current_memory_arena(); arena; arena = arena->previous())
+    if(arena->owns(ptr))
+      return arena;
+  return 0;
+}
+
+/** \internal Frees \a ptr if it has been allocated by an active arena, and \returns whether this was the case */
+inline bool memory_arena_deallocate(void* ptr)
+{
+  if(current_memory_arena()==0 || ptr==0)
+    return false;
+  MemoryArena* arena = memory_arena_owning(ptr);
+  if(arena)
+    arena->deallocate(ptr);
+  return arena!=0;
+}
+
+/** \internal Allocates \a size bytes. The returned pointer is guaranteed to have at least 16 bytes alignment,
+  * and it follows the alignment policy when it does not come from a MemoryArena, see malloc_alignment().
   * On allocation error, the returned pointer is null, and std::bad_alloc is thrown.
   */
 inline void* aligned_malloc(size_t size)
 {
+  void *result = memory_arena_allocate(size);
+  if(result)
+    return result;
+
   check_that_malloc_is_allowed();
 
-  void *result;
   #if !EIGEN_ALIGN
     result = std::malloc(size);
-  #elif EIGEN_MALLOC_ALREADY_ALIGNED
+  #elif EIGEN_MALLOC_FULFILLS_ALIGNMENT_POLICY
     result = std::malloc(size);
   #elif EIGEN_HAS_POSIX_MEMALIGN
-    if(posix_memalign(&result, 16, size)) result = 0;
+    if(posix_memalign(&result, malloc_alignment(size), size)) result = 0;
   #elif EIGEN_HAS_MM_MALLOC
-    result = _mm_malloc(size, 16);
+    result = _mm_malloc(size, malloc_alignment(size));
   #elif (defined _MSC_VER)
-    result = _aligned_malloc(size, 16);
+    result = _aligned_malloc(size, malloc_alignment(size));
   #else
-    result = handmade_aligned_malloc(size);
+    result = handmade_aligned_malloc(size, malloc_alignment(size));
   #endif
 
   if(!result && size)
     throw_std_bad_alloc();
 
+  advise_huge_pages(result, size);
   return result;
 }
 
 /** \internal Frees memory allocated with aligned_malloc. */
 inline void aligned_free(void *ptr)
 {
+  if(memory_arena_deallocate(ptr))
+    return;
+
   #if !EIGEN_ALIGN
     std::free(ptr);
-  #elif EIGEN_MALLOC_ALREADY_ALIGNED
+  #elif EIGEN_MALLOC_FULFILLS_ALIGNMENT_POLICY
     std::free(ptr);
   #elif EIGEN_HAS_POSIX_MEMALIGN
     std::free(ptr);
@@ -256,31 +567,51 @@ inline void* aligned_realloc(void *ptr, size_t new_size, size_t old_size)
 {
   EIGEN_UNUSED_VARIABLE(old_size);
 
+  // a block cannot move between the arena and the heap in place
+  if(current_memory_arena())
+    return generic_aligned_realloc(ptr,new_size,old_size);
+
   void *result;
 #if !EIGEN_ALIGN
   result = std::realloc(ptr,new_size);
-#elif EIGEN_MALLOC_ALREADY_ALIGNED
+#elif EIGEN_MALLOC_FULFILLS_ALIGNMENT_POLICY
   result = std::realloc(ptr,new_size);
 #elif EIGEN_HAS_POSIX_MEMALIGN
-  result = generic_aligned_realloc(ptr,new_size,old_size);
+  // std::realloc keeps the block in place whenever possible, but a moved block only has the alignment of std::malloc
+  if(ptr==0 || new_size==0)
+    result = generic_aligned_realloc(ptr,new_size,old_size);
+  else
+  {
+    result = std::realloc(ptr,new_size);
+    if(result && (reinterpret_cast<size_t>(result) & (malloc_alignment(new_size)-1)))
+      result = generic_aligned_realloc(result,new_size,new_size);
+  }
 #elif EIGEN_HAS_MM_MALLOC
   // The defined(_mm_free) is just here to verify that this MSVC version
   // implements _mm_malloc/_mm_free based on the corresponding _aligned_
   // functions. This may not always be the case and we just try to be safe.
+  // _aligned_realloc cannot change the alignment of the block.
   #if defined(_MSC_VER) && defined(_mm_free)
-    result = _aligned_realloc(ptr,new_size,16);
+    if(ptr==0 || malloc_alignment(old_size)==malloc_alignment(new_size))
+      result = _aligned_realloc(ptr,new_size,malloc_alignment(new_size));
+    else
+      result = generic_aligned_realloc(ptr,new_size,old_size);
   #else
     result = generic_aligned_realloc(ptr,new_size,old_size);
   #endif
 #elif defined(_MSC_VER)
-  result = _aligned_realloc(ptr,new_size,16);
+  if(ptr==0 || malloc_alignment(old_size)==malloc_alignment(new_size))
+    result = _aligned_realloc(ptr,new_size,malloc_alignment(new_size));
+  else
+    result = generic_aligned_realloc(ptr,new_size,old_size);
 #else
-  result = handmade_aligned_realloc(ptr,new_size,old_size);
+  result = handmade_aligned_realloc(ptr,new_size,old_size,malloc_alignment(new_size));
 #endif
 
   if (!result && new_size)
     throw_std_bad_alloc();
 
+  advise_huge_pages(result, new_size);
   return result;
 }
 
@@ -288,7 +619,7 @@ inline void* aligned_realloc(void *ptr, size_t new_size, size_t old_size)
 *** Implementation of conditionally aligned functions                      ***
 *****************************************************************************/
 
-/** \internal Allocates \a size bytes. If Align is true, then the returned ptr is 16-byte-aligned.
+/** \internal Allocates \a size bytes. If Align is true, then the returned ptr is aligned as by aligned_malloc().
   * On allocation error, the returned pointer is null, and a std::bad_alloc is thrown.
   */
 template<bool Align> inline void* conditional_aligned_malloc(size_t size)
@@ -298,9 +629,13 @@ template<bool Align> inline void* conditional_aligned_malloc(size_t size)
 
 template<> inline void* conditional_aligned_malloc<false>(size_t size)
 {
+  void *result = memory_arena_allocate(size);
+  if(result)
+    return result;
+
   check_that_malloc_is_allowed();
 
-  void *result = std::malloc(size);
+  result = std::malloc(size);
   if(!result && size)
     throw_std_bad_alloc();
   return result;
@@ -314,7 +649,8 @@ template<bool Align> inline void conditional_aligned_free(void *ptr)
 
 template<> inline void conditional_aligned_free<false>(void *ptr)
 {
-  std::free(ptr);
+  if(!memory_arena_deallocate(ptr))
+    std::free(ptr);
 }
 
 template<bool Align> inline void* conditional_aligned_realloc(void* ptr, size_t new_size, size_t old_size)
@@ -322,8 +658,18 @@ template<bool Align> inline void* conditional_aligned_realloc(void* ptr, size_t
   return aligned_realloc(ptr, new_size, old_size);
 }
 
-template<> inline void* conditional_aligned_realloc<false>(void* ptr, size_t new_size, size_t)
+template<> inline void* conditional_aligned_realloc<false>(void* ptr, size_t new_size, size_t old_size)
 {
+  if(current_memory_arena())
+  {
+    void* result = conditional_aligned_malloc<false>(new_size);
+    if(ptr)
+    {
+      std::memcpy(result, ptr, (std::min)(new_size,old_size));
+      conditional_aligned_free<false>(ptr);
+    }
+    return result;
+  }
   return std::realloc(ptr, new_size);
 }
 
@@ -28,6 +28,50 @@
 
 namespace internal {
 
+/** \internal Computes (t,s) and (t,t) in a single pass */
+template<typename VectorType>
+struct bicgstab_stabilization
+{
+  typedef typename VectorType::Scalar Scalar;
+  typedef typename VectorType::Index Index;
+
+  bicgstab_stabilization(const VectorType& t, const VectorType& s) : t(t), s(s) {}
+
+  void operator()(Index start, Index size, Scalar* sums) const
+  {
+    sums[0] = t.segment(start,size).dot(s.segment(start,size));
+    sums[1] = t.segment(start,size).squaredNorm();
+  }
+
+  const VectorType &t, &s;
+};
+
+/** \internal Updates x and r, and computes (r0,r) and (r,r) in the same pass */
+template<typename VectorType, typename Dest>
+struct bicgstab_update
+{
+  typedef typename VectorType::Scalar Scalar;
+  typedef typename VectorType::Index Index;
+
+  bicgstab_update(Scalar alpha, Scalar w, Dest& x, VectorType& r, const VectorType& y, const VectorType& z,
+                  const VectorType& s, const VectorType& t, const VectorType& r0)
+    : alpha(alpha), w(w), x(x), r(r), y(y), z(z), s(s), t(t), r0(r0)
+  {}
+
+  void operator()(Index start, Index size, Scalar* sums) const
+  {
+    x.segment(start,size) += alpha * y.segment(start,size) + w * z.segment(start,size);
+    r.segment(start,size) = s.segment(start,size) - w * t.segment(start,size);
+    sums[0] = r0.segment(start,size).dot(r.segment(start,size));
+    sums[1] = r.segment(start,size).squaredNorm();
+  }
+
+  Scalar alpha, w;
+  Dest& x;
+  VectorType& r;
+  const VectorType &y, &z, &s, &t, &r0;
+};
+
 /** \internal Low-level bi conjugate gradient stabilized algorithm
   * \param mat The matrix A
   * \param rhs The right hand side vector b
@@ -67,13 +111,16 @@ bool bicgstab(const MatrixType& mat, const Rhs& rhs, Dest& x,
   VectorType s(n), t(n);
 
   RealScalar tol2 = tol*tol;
+  RealScalar r_sqnorm = r0_sqnorm;
+  Scalar r0r = r0_sqnorm;
+  Scalar sums[2];
   int i = 0;
 
-  while ( r.squaredNorm()/r0_sqnorm > tol2 && i<maxIters )
+  while ( r_sqnorm/r0_sqnorm > tol2 && i<maxIters )
   {
     Scalar rho_old = rho;
 
-    rho = r0.dot(r);
+    rho = r0r;
     if (rho == Scalar(0)) return false; /* New search directions cannot be found */
     Scalar beta = (rho/rho_old) * (alpha / w);
     p = r + beta * (p - w * v);
@@ -88,12 +135,14 @@ bool bicgstab(const MatrixType& mat, const Rhs& rhs, Dest& x,
     z = precond.solve(s);
     t.noalias() = mat * z;
 
-    w = t.dot(s) / t.squaredNorm();
-    x += alpha * y + w * z;
-    r = s - w * t;
+    fused_vector_sweep<2>(n, bicgstab_stabilization<VectorType>(t, s), sums);
+    w = sums[0] / internal::real(sums[1]);
+    fused_vector_sweep<2>(n, bicgstab_update<VectorType,Dest>(alpha, w, x, r, y, z, s, t, r0), sums);
+    r0r = sums[0];
+    r_sqnorm = internal::real(sums[1]);
     ++i;
   }
-  tol_error = sqrt(r.squaredNorm()/r0_sqnorm);
+  tol_error = sqrt(r_sqnorm/r0_sqnorm);
   iters = i;
   return true; 
 }
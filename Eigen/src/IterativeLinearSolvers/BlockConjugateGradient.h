@@ -0,0 +1,321 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef EIGEN_BLOCK_CONJUGATE_GRADIENT_H
+#define EIGEN_BLOCK_CONJUGATE_GRADIENT_H
+
+namespace internal {
+
+/** \internal Low-level block conjugate gradient algorithm
+  *
+  * This is the block preconditioned conjugate gradient of O'Leary: all the right hand sides share
+  * the search space spanned by the columns of the block of residuals, and the sparse matrix is applied
+  * to the whole block of search directions at once. Converged columns are removed from the block,
+  * and the iterations restart on the remaining ones. If the residuals become linearly dependent,
+  * the remaining columns are solved one by one using the standard conjugate gradient.
+  *
+  * \param mat The matrix A
+  * \param rhs The right hand side vectors B
+  * \param x On input and initial solution, on output the computed solution.
+  * \param precond A preconditioner being able to efficiently solve for an
+  *                approximation of Ax=b (regardless of b)
+  * \param iters On input the max number of iteration, on output the number of performed iterations.
+  * \param tol_error On input the tolerance error, on output an estimation of the largest relative error of the columns.
+  */
+template<typename MatrixType, typename Rhs, typename Dest, typename Preconditioner>
+EIGEN_DONT_INLINE
+void block_conjugate_gradient(const MatrixType& mat, const Rhs& rhs, Dest& x,
+                              const Preconditioner& precond, int& iters,
+                              typename Dest::RealScalar& tol_error)
+{
+  using std::sqrt;
+  using std::abs;
+  typedef typename Dest::RealScalar RealScalar;
+  typedef typename Dest::Scalar Scalar;
+  typedef Matrix<Scalar,Dynamic,Dynamic> DenseMatrix;
+  typedef Matrix<RealScalar,Dynamic,1> RealVectorType;
+
+  RealScalar tol = tol_error;
+  int maxIters = iters;
+
+  int n = mat.cols();
+  int m = rhs.cols();
+  DenseMatrix R = rhs - mat * x;     // the residuals
+  DenseMatrix Z(n,m);
+  for(int j=0; j<m; ++j)
+    Z.col(j) = precond.solve(R.col(j));
+
+  RealVectorType absInit(m), error = RealVectorType::Zero(m);
+  std::vector<int> active;
+  for(int j=0; j<m; ++j)
+  {
+    absInit(j) = internal::real(R.col(j).dot(Z.col(j)));
+    if(absInit(j) > RealScalar(0))
+    {
+      error(j) = RealScalar(1);
+      active.push_back(j);
+    }
+  }
+
+  int i = 0;
+  bool breakdown = false;
+  while(!active.empty() && i < maxIters && !breakdown)
+  {
+    int k = int(active.size());
+    DenseMatrix Xa(n,k), Ra(n,k), Za(n,k);
+    for(int c=0; c<k; ++c)
+    {
+      Xa.col(c) = x.col(active[c]);
+      Ra.col(c) = R.col(active[c]);
+      Za.col(c) = Z.col(active[c]);
+    }
+
+    DenseMatrix P = Za, Q(n,k), PQ(k,k), alpha(k,k), beta(k,k), rhoNew(k,k);
+    DenseMatrix rho = Ra.adjoint() * Za;
+    RealVectorType s(k);
+    bool deflate = false;
+    while(i < maxIters)
+    {
+      Q = mat * P;                        // the bottleneck of the algorithm
+      PQ.noalias() = P.adjoint() * Q;
+
+      // P^H A P is factorized with a unit diagonal, such that linearly dependent search directions
+      // are detected independently of the scaling of the columns.
+      s = PQ.diagonal().real();
+      if(s.minCoeff() <= RealScalar(0))
+      {
+        breakdown = true;
+        break;
+      }
+      s = s.cwiseSqrt().cwiseInverse();
+      LDLT<DenseMatrix> ldlt(s.asDiagonal() * PQ * s.asDiagonal());
+      if(ldlt.vectorD().real().minCoeff() <= RealScalar(k) * NumTraits<RealScalar>::epsilon())
+      {
+        breakdown = true;
+        break;
+      }
+      alpha = s.asDiagonal() * ldlt.solve(s.asDiagonal() * rho);
+
+      Xa.noalias() += P * alpha;
+      Ra.noalias() -= Q * alpha;
+      for(int c=0; c<k; ++c)
+        Za.col(c) = precond.solve(Ra.col(c));
+      rhoNew.noalias() = Ra.adjoint() * Za;
+      ++i;
+
+      for(int c=0; c<k; ++c)
+      {
+        error(active[c]) = sqrt(abs(internal::real(rhoNew(c,c)) / absInit(active[c])));
+        deflate = deflate || error(active[c]) <= tol;
+      }
+      if(deflate)
+        break;
+
+      beta = rho.ldlt().solve(rhoNew);
+      P = Za + P * beta;
+      rho = rhoNew;
+    }
+
+    std::vector<int> remaining;
+    for(int c=0; c<k; ++c)
+    {
+      x.col(active[c]) = Xa.col(c);
+      R.col(active[c]) = Ra.col(c);
+      Z.col(active[c]) = Za.col(c);
+      if(error(active[c]) > tol)
+        remaining.push_back(active[c]);
+    }
+    active.swap(remaining);
+  }
+
+  int fallbackIters = 0;
+  if(breakdown)
+  {
+    for(std::size_t c=0; c<active.size(); ++c)
+    {
+      int j = active[c];
+      RealScalar absNew = internal::real(R.col(j).dot(Z.col(j)));
+      RealScalar scale = sqrt(absNew / absInit(j));
+      int colIters = maxIters - i;
+      RealScalar colError = tol / scale;
+      typename Dest::ColXpr xj(x,j);
+      conjugate_gradient(mat, rhs.col(j), xj, precond, colIters, colError);
+      error(j) = colError * scale;
+      fallbackIters = (std::max)(fallbackIters, colIters);
+    }
+  }
+
+  tol_error = m>0 ? error.maxCoeff() : RealScalar(0);
+  iters = i + fallbackIters;
+}
+
+}
+
+template< typename _MatrixType, int _UpLo=Lower,
+          typename _Preconditioner = DiagonalPreconditioner<typename _MatrixType::Scalar> >
+class BlockConjugateGradient;
+
+namespace internal {
+
+template< typename _MatrixType, int _UpLo, typename _Preconditioner>
+struct traits<BlockConjugateGradient<_MatrixType,_UpLo,_Preconditioner> >
+{
+  typedef _MatrixType MatrixType;
+  typedef _Preconditioner Preconditioner;
+};
+
+}
+
+/** \ingroup IterativeLinearSolvers_Module
+  * \brief A block conjugate gradient solver for sparse self-adjoint problems with multiple right hand sides
+  *
+  * This class allows to solve for A.X = B sparse linear problems using the block conjugate gradient
+  * algorithm of O'Leary. The sparse matrix A must be selfadjoint positive definite. All the columns of B
+  * are solved together: each iteration applies A to a dense block of search directions, which is much
+  * more efficient than as many sparse matrix-vector products, and the columns share a larger search space,
+  * such that fewer iterations are needed than with ConjugateGradient. The vectors x and b can be either
+  * dense or sparse, but sparse right hand sides are solved one column at a time.
+  *
+  * \tparam _MatrixType the type of the sparse matrix A, can be a dense or a sparse matrix.
+  * \tparam _UpLo the triangular part that will be used for the computations. It can be Lower
+  *               or Upper. Default is Lower.
+  * \tparam _Preconditioner the type of the preconditioner. Default is DiagonalPreconditioner
+  *
+  * The maximal number of iterations and tolerance value can be controlled via the setMaxIterations()
+  * and setTolerance() methods. The defaults are the size of the problem for the maximal number of iterations
+  * and NumTraits<Scalar>::epsilon() for the tolerance. The iterations are counted per block, and the error
+  * is the largest of the errors of the columns, measured as in ConjugateGradient.
+  *
+  * This class can be used as the direct solver classes. Here is a typical usage example:
+  * \code
+  * int n = 10000;
+  * MatrixXd X(n,16), B(n,16);
+  * SparseMatrix<double> A(n,n);
+  * // fill A and B
+  * BlockConjugateGradient<SparseMatrix<double> > cg(A);
+  * X = cg.solve(B);
+  * std::cout << "#iterations:     " << cg.iterations() << std::endl;
+  * std::cout << "estimated error: " << cg.error()      << std::endl;
+  * \endcode
+  *
+  * \sa class ConjugateGradient, DiagonalPreconditioner
+  */
+template< typename _MatrixType, int _UpLo, typename _Preconditioner>
+class BlockConjugateGradient : public IterativeSolverBase<BlockConjugateGradient<_MatrixType,_UpLo,_Preconditioner> >
+{
+  typedef IterativeSolverBase<BlockConjugateGradient> Base;
+  using Base::mp_matrix;
+  using Base::m_error;
+  using Base::m_iterations;
+  using Base::m_info;
+  using Base::m_isInitialized;
+public:
+  typedef _MatrixType MatrixType;
+  typedef typename MatrixType::Scalar Scalar;
+  typedef typename MatrixType::Index Index;
+  typedef typename MatrixType::RealScalar RealScalar;
+  typedef _Preconditioner Preconditioner;
+
+  enum {
+    UpLo = _UpLo
+  };
+
+public:
+
+  /** Default constructor. */
+  BlockConjugateGradient() : Base() {}
+
+  /** Initialize the solver with matrix \a A for further \c Ax=b solving.
+    *
+    * This constructor is a shortcut for the default constructor followed
+    * by a call to compute().
+    *
+    * \warning this class stores a reference to the matrix A as well as some
+    * precomputed values that depend on it. Therefore, if \a A is changed
+    * this class becomes invalid. Call compute() to update it with the new
+    * matrix A, or modify a copy of A.
+    */
+  BlockConjugateGradient(const MatrixType& A) : Base(A) {}
+
+  ~BlockConjugateGradient() {}
+
+  /** \returns the solution x of \f$ A x = b \f$ using the current decomposition of A
+    * \a x0 as an initial solution.
+    *
+    * \sa compute()
+    */
+  template<typename Rhs,typename Guess>
+  inline const internal::solve_retval_with_guess<BlockConjugateGradient, Rhs, Guess>
+  solveWithGuess(const MatrixBase<Rhs>& b, const Guess& x0) const
+  {
+    eigen_assert(m_isInitialized && "BlockConjugateGradient is not initialized.");
+    eigen_assert(Base::rows()==b.rows()
+              && "BlockConjugateGradient::solve(): invalid number of rows of the right hand side matrix b");
+    return internal::solve_retval_with_guess
+            <BlockConjugateGradient, Rhs, Guess>(*this, b.derived(), x0);
+  }
+
+  /** \internal */
+  template<typename Rhs,typename Dest>
+  void _solveWithGuess(const Rhs& b, Dest& x) const
+  {
+    m_iterations = Base::maxIterations();
+    m_error = Base::m_tolerance;
+
+    internal::block_conjugate_gradient(mp_matrix->template selfadjointView<UpLo>(), b, x,
+                                       Base::m_preconditioner, m_iterations, m_error);
+
+    m_isInitialized = true;
+    m_info = m_error <= Base::m_tolerance ? Success : NoConvergence;
+  }
+
+  /** \internal */
+  template<typename Rhs,typename Dest>
+  void _solve(const Rhs& b, Dest& x) const
+  {
+    x.setZero();
+    _solveWithGuess(b,x);
+  }
+
+protected:
+
+};
+
+
+namespace internal {
+
+template<typename _MatrixType, int _UpLo, typename _Preconditioner, typename Rhs>
+struct solve_retval<BlockConjugateGradient<_MatrixType,_UpLo,_Preconditioner>, Rhs>
+  : solve_retval_base<BlockConjugateGradient<_MatrixType,_UpLo,_Preconditioner>, Rhs>
+{
+  typedef BlockConjugateGradient<_MatrixType,_UpLo,_Preconditioner> Dec;
+  EIGEN_MAKE_SOLVE_HELPERS(Dec,Rhs)
+
+  template<typename Dest> void evalTo(Dest& dst) const
+  {
+    dec()._solve(rhs(),dst);
+  }
+};
+
+}
+
+#endif // EIGEN_BLOCK_CONJUGATE_GRADIENT_H
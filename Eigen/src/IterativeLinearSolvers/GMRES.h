@@ -0,0 +1,286 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef EIGEN_GMRES_H
+#define EIGEN_GMRES_H
+
+namespace internal {
+
+/** \internal Low-level restarted generalized minimal residual algorithm
+  *
+  * The Krylov basis is built with the right preconditioned operator A M^-1, and is orthogonalized by a
+  * classical Gram-Schmidt process applied twice, such that the orthogonalization against the whole
+  * basis is performed with two dense matrix-vector products, while being as accurate as a modified
+  * Gram-Schmidt process. The Hessenberg matrix is triangularized with Givens rotations.
+  *
+  * \param mat The matrix A
+  * \param rhs The right hand side vector b
+  * \param x On input and initial solution, on output the computed solution.
+  * \param precond A preconditioner being able to efficiently solve for an
+  *                approximation of Ax=b (regardless of b)
+  * \param iters On input the max number of iteration, on output the number of performed iterations.
+  * \param restart The size of the Krylov basis after which the iterations are restarted.
+  * \param tol_error On input the tolerance error, on output an estimation of the relative error ||Ax-b||/||b||.
+  */
+template<typename MatrixType, typename Rhs, typename Dest, typename Preconditioner>
+void gmres(const MatrixType& mat, const Rhs& rhs, Dest& x, const Preconditioner& precond,
+           int& iters, int restart, typename Dest::RealScalar& tol_error)
+{
+  using std::abs;
+  typedef typename Dest::RealScalar RealScalar;
+  typedef typename Dest::Scalar Scalar;
+  typedef Matrix<Scalar,Dynamic,1> VectorType;
+  typedef Matrix<Scalar,Dynamic,Dynamic> DenseMatrix;
+
+  RealScalar tol = tol_error;
+  int maxIters = iters;
+
+  int n = mat.cols();
+  RealScalar bnorm = rhs.norm();
+  if(bnorm == RealScalar(0))
+  {
+    x.setZero();
+    iters = 0;
+    tol_error = 0;
+    return;
+  }
+  restart = (std::max)(1, (std::min)(restart, n));
+
+  VectorType r = rhs - mat * x;
+  RealScalar rnorm = r.norm();
+
+  DenseMatrix V(n, restart+1);                                // the Krylov basis
+  DenseMatrix H = DenseMatrix::Zero(restart+1, restart);      // the triangularized Hessenberg matrix
+  VectorType g(restart+1), h(restart+1), w(n), tmp(n);
+  std::vector<JacobiRotation<Scalar> > rotations(restart);
+
+  int i = 0;
+  while(rnorm > tol*bnorm && i < maxIters)
+  {
+    V.col(0) = r / rnorm;
+    g.setZero();
+    g(0) = rnorm;
+
+    int k = 0;
+    while(k < restart && i < maxIters)
+    {
+      tmp = precond.solve(V.col(k));
+      w.noalias() = mat * tmp;
+
+      // orthogonalization against the current basis
+      H.col(k).head(k+1).noalias() = V.leftCols(k+1).adjoint() * w;
+      w.noalias() -= V.leftCols(k+1) * H.col(k).head(k+1);
+      h.head(k+1).noalias() = V.leftCols(k+1).adjoint() * w;
+      w.noalias() -= V.leftCols(k+1) * h.head(k+1);
+      H.col(k).head(k+1) += h.head(k+1);
+
+      RealScalar hnext = w.norm();
+      if(hnext != RealScalar(0))
+        V.col(k+1) = w / hnext;
+
+      // triangularization of the new column
+      for(int j=0; j<k; ++j)
+        H.col(k).applyOnTheLeft(j, j+1, rotations[j].adjoint());
+      Scalar hkk = H(k,k);
+      rotations[k].makeGivens(hkk, Scalar(hnext), &H(k,k));
+      H(k+1,k) = Scalar(0);
+      g.applyOnTheLeft(k, k+1, rotations[k].adjoint());
+
+      ++k;
+      ++i;
+      if(abs(g(k)) <= tol*bnorm || hnext == RealScalar(0))
+        break;
+    }
+
+    // solve the least squares problem in the Krylov basis, and update the solution
+    h.head(k) = H.topLeftCorner(k,k).template triangularView<Upper>().solve(g.head(k));
+    tmp.noalias() = V.leftCols(k) * h.head(k);
+    x += precond.solve(tmp);
+
+    r = rhs - mat * x;
+    rnorm = r.norm();
+  }
+
+  tol_error = rnorm / bnorm;
+  iters = i;
+}
+
+}
+
+template< typename _MatrixType,
+          typename _Preconditioner = DiagonalPreconditioner<typename _MatrixType::Scalar> >
+class GMRES;
+
+namespace internal {
+
+template< typename _MatrixType, typename _Preconditioner>
+struct traits<GMRES<_MatrixType,_Preconditioner> >
+{
+  typedef _MatrixType MatrixType;
+  typedef _Preconditioner Preconditioner;
+};
+
+}
+
+/** \ingroup IterativeLinearSolvers_Module
+  * \brief A restarted GMRES solver for sparse square problems
+  *
+  * This class allows to solve for A.x = b sparse linear problems using a restarted generalized minimal
+  * residual algorithm. Unlike BiCGSTAB, the residual norm decreases monotonically, which makes GMRES
+  * robust on strongly non-symmetric problems, at the price of storing a Krylov basis of restart()+1
+  * vectors. The vectors x and b can be either dense or sparse.
+  *
+  * \tparam _MatrixType the type of the sparse matrix A, can be a dense or a sparse matrix.
+  * \tparam _Preconditioner the type of the preconditioner. Default is DiagonalPreconditioner
+  *
+  * The maximal number of iterations and tolerance value can be controlled via the setMaxIterations()
+  * and setTolerance() methods. The defaults are the size of the problem for the maximal number of iterations
+  * and NumTraits<Scalar>::epsilon() for the tolerance. The error is the relative residual ||Ax-b||/||b||.
+  * The size of the Krylov basis is controlled by setRestart(), and is 30 by default.
+  *
+  * This class can be used as the direct solver classes. Here is a typical usage example:
+  * \code
+  * int n = 10000;
+  * VectorXd x(n), b(n);
+  * SparseMatrix<double> A(n,n);
+  * // fill A and b
+  * GMRES<SparseMatrix<double>, IncompleteLUT<double> > solver(A);
+  * solver.setRestart(50);
+  * x = solver.solve(b);
+  * std::cout << "#iterations:     " << solver.iterations() << std::endl;
+  * std::cout << "estimated error: " << solver.error()      << std::endl;
+  * \endcode
+  *
+  * \sa class BiCGSTAB, IncompleteLUT
+  */
+template< typename _MatrixType, typename _Preconditioner>
+class GMRES : public IterativeSolverBase<GMRES<_MatrixType,_Preconditioner> >
+{
+  typedef IterativeSolverBase<GMRES> Base;
+  using Base::mp_matrix;
+  using Base::m_error;
+  using Base::m_iterations;
+  using Base::m_info;
+  using Base::m_isInitialized;
+public:
+  typedef _MatrixType MatrixType;
+  typedef typename MatrixType::Scalar Scalar;
+  typedef typename MatrixType::Index Index;
+  typedef typename MatrixType::RealScalar RealScalar;
+  typedef _Preconditioner Preconditioner;
+
+public:
+
+  /** Default constructor. */
+  GMRES() : Base(), m_restart(30) {}
+
+  /** Initialize the solver with matrix \a A for further \c Ax=b solving.
+    *
+    * This constructor is a shortcut for the default constructor followed
+    * by a call to compute().
+    *
+    * \warning this class stores a reference to the matrix A as well as some
+    * precomputed values that depend on it. Therefore, if \a A is changed
+    * this class becomes invalid. Call compute() to update it with the new
+    * matrix A, or modify a copy of A.
+    */
+  GMRES(const MatrixType& A) : Base(A), m_restart(30) {}
+
+  ~GMRES() {}
+
+  /** \returns the number of iterations after which the iterations are restarted */
+  int restart() const { return m_restart; }
+
+  /** Sets the number of iterations after which the iterations are restarted, i.e., the size of the Krylov basis */
+  GMRES& setRestart(int restart)
+  {
+    eigen_assert(restart>0);
+    m_restart = restart;
+    return *this;
+  }
+
+  /** \returns the solution x of \f$ A x = b \f$ using the current decomposition of A
+    * \a x0 as an initial solution.
+    *
+    * \sa compute()
+    */
+  template<typename Rhs,typename Guess>
+  inline const internal::solve_retval_with_guess<GMRES, Rhs, Guess>
+  solveWithGuess(const MatrixBase<Rhs>& b, const Guess& x0) const
+  {
+    eigen_assert(m_isInitialized && "GMRES is not initialized.");
+    eigen_assert(Base::rows()==b.rows()
+              && "GMRES::solve(): invalid number of rows of the right hand side matrix b");
+    return internal::solve_retval_with_guess
+            <GMRES, Rhs, Guess>(*this, b.derived(), x0);
+  }
+
+  /** \internal */
+  template<typename Rhs,typename Dest>
+  void _solveWithGuess(const Rhs& b, Dest& x) const
+  {
+    RealScalar error = 0;
+    for(int j=0; j<b.cols(); ++j)
+    {
+      m_iterations = Base::maxIterations();
+      m_error = Base::m_tolerance;
+
+      typename Dest::ColXpr xj(x,j);
+      internal::gmres(*mp_matrix, b.col(j), xj, Base::m_preconditioner, m_iterations, m_restart, m_error);
+      error = (std::max)(error, m_error);
+    }
+    m_error = error;
+    m_isInitialized = true;
+    m_info = m_error <= Base::m_tolerance ? Success : NoConvergence;
+  }
+
+  /** \internal */
+  template<typename Rhs,typename Dest>
+  void _solve(const Rhs& b, Dest& x) const
+  {
+    x.setZero();
+    _solveWithGuess(b,x);
+  }
+
+protected:
+  int m_restart;
+};
+
+
+namespace internal {
+
+template<typename _MatrixType, typename _Preconditioner, typename Rhs>
+struct solve_retval<GMRES<_MatrixType, _Preconditioner>, Rhs>
+  : solve_retval_base<GMRES<_MatrixType, _Preconditioner>, Rhs>
+{
+  typedef GMRES<_MatrixType, _Preconditioner> Dec;
+  EIGEN_MAKE_SOLVE_HELPERS(Dec,Rhs)
+
+  template<typename Dest> void evalTo(Dest& dst) const
+  {
+    dec()._solve(rhs(),dst);
+  }
+};
+
+}
+
+#endif // EIGEN_GMRES_H
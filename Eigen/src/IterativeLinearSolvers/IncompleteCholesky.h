@@ -0,0 +1,433 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef EIGEN_INCOMPLETE_CHOLESKY_H
+#define EIGEN_INCOMPLETE_CHOLESKY_H
+
+/** \ingroup IterativeLinearSolvers_Module
+  * \brief Incomplete Cholesky factorization with threshold dropping and diagonal shifting
+  *
+  * This class computes an incomplete factorization \f$ L L^* \approx S P A P^T S + \alpha I \f$ of a selfadjoint
+  * positive definite matrix A, to be used as a preconditioner of ConjugateGradient. Only the lower
+  * triangular factor is stored and applied, which halves the memory and the cost of the triangular
+  * solves compared to IncompleteLUT. The factorization proceeds column by column (left-looking), and
+  * two dropping rules are used:
+  *  1) any element whose magnitude is less than \p droptol times the norm of the current column of A is dropped,
+  *  2) only the \p fill largest remaining elements of each column are kept, where \p fill is computed from
+  *     the \p fillfactor parameter relatively to the average number of nonzeros per column of A.
+  *
+  * For robustness, the method of Lin and More is followed:
+  *  - the fill-reducing permutation P is the approximate minimum degree ordering of the pattern of A,
+  *  - the matrix is scaled by the diagonal matrix S made of the inverse square roots of the norms of its columns,
+  *  - if a nonpositive pivot is met, the factorization is restarted with a diagonal shift \f$ \alpha \f$
+  *    which is doubled at each attempt, starting from the initial shift (see setInitialShift()).
+  *
+  * \tparam _Scalar the type of the scalar.
+  * \tparam _UpLo the triangular part of the matrix which is referenced, Lower or Upper. Default is Lower,
+  *               as for ConjugateGradient:
+  * \code
+  * ConjugateGradient<SparseMatrix<double>, Lower, IncompleteCholesky<double> > cg(A);
+  * x = cg.solve(b);
+  * \endcode
+  *
+  * References : Chih-Jen Lin and Jorge J. More, Incomplete Cholesky factorizations with limited memory,
+  *              SIAM J. Sci. Comput., 21(1), pp 24-45, 1999.
+  *
+  * \sa class IncompleteLUT, ConjugateGradient
+  */
+template <typename _Scalar, int _UpLo = Lower>
+class IncompleteCholesky
+{
+    typedef _Scalar Scalar;
+    typedef typename NumTraits<Scalar>::Real RealScalar;
+    typedef Matrix<Scalar,Dynamic,1> Vector;
+    typedef Matrix<RealScalar,Dynamic,1> RealVector;
+    typedef SparseMatrix<Scalar,ColMajor> FactorType;
+    typedef typename FactorType::Index Index;
+
+  public:
+    typedef Matrix<Scalar,Dynamic,Dynamic> MatrixType;
+
+    enum {
+      UpLo = _UpLo
+    };
+
+    IncompleteCholesky()
+      : m_droptol(NumTraits<Scalar>::dummy_precision()), m_fillfactor(10), m_initialShift(RealScalar(1e-3)),
+        m_shift(0), m_scheduleIsOk(false), m_analysisIsOk(false), m_factorizationIsOk(false), m_isInitialized(false)
+    {}
+
+    template<typename MatrixType>
+    IncompleteCholesky(const MatrixType& mat, RealScalar droptol=NumTraits<Scalar>::dummy_precision(), int fillfactor = 10)
+      : m_droptol(droptol), m_fillfactor(fillfactor), m_initialShift(RealScalar(1e-3)),
+        m_shift(0), m_scheduleIsOk(false), m_analysisIsOk(false), m_factorizationIsOk(false), m_isInitialized(false)
+    {
+      eigen_assert(fillfactor != 0);
+      compute(mat);
+    }
+
+    Index rows() const { return m_L.rows(); }
+
+    Index cols() const { return m_L.cols(); }
+
+    /** \brief Reports whether previous computation was successful.
+      *
+      * \returns \c Success if computation was succesful,
+      *          \c NumericalIssue if no shift made the factorization succeed.
+      */
+    ComputationInfo info() const
+    {
+      eigen_assert(m_isInitialized && "IncompleteCholesky is not initialized.");
+      return m_info;
+    }
+
+    /** Computes the fill-reducing permutation of the pattern of \a amat */
+    template<typename MatrixType>
+    void analyzePattern(const MatrixType& amat);
+
+    /** Computes the incomplete factorization of \a amat, analyzePattern() must have been called on a matrix with the same pattern */
+    template<typename MatrixType>
+    void factorize(const MatrixType& amat);
+
+    /** Computes the incomplete Cholesky factorization of \a amat */
+    template<typename MatrixType>
+    IncompleteCholesky& compute(const MatrixType& amat)
+    {
+      analyzePattern(amat);
+      factorize(amat);
+      m_isInitialized = true;
+      return *this;
+    }
+
+    /** Sets the relative tolerance below which the elements of the factor are dropped */
+    void setDroptol(RealScalar droptol) { m_droptol = droptol; }
+
+    /** Sets the ratio between the number of elements kept in each column of the factor,
+      * and the average number of nonzeros per column of the lower triangular part of A */
+    void setFillfactor(int fillfactor) { m_fillfactor = fillfactor; }
+
+    /** Sets the first diagonal shift tried when the factorization breaks down (default is 1e-3) */
+    void setInitialShift(RealScalar shift) { m_initialShift = shift; }
+
+    /** \returns the diagonal shift \f$ \alpha \f$ of the last factorization */
+    RealScalar shift() const { return m_shift; }
+
+    /** \returns the lower triangular factor L */
+    const FactorType& matrixL() const { return m_L; }
+
+    /** \returns the diagonal scaling S */
+    const Vector& scalingS() const { return m_scale; }
+
+    /** \returns the fill-reducing permutation P */
+    const PermutationMatrix<Dynamic,Dynamic,Index>& permutationP() const { return m_P; }
+
+    template<typename Rhs, typename Dest>
+    void _solve(const Rhs& b, Dest& x) const
+    {
+      x = m_Pinv * b;
+      x = m_scale.asDiagonal() * x;
+      analyzeSchedules(x.cols());
+      if(m_scheduleIsOk)
+      {
+        m_scheduleL.solveInPlace(m_L, x);
+        m_scheduleLt.solveInPlace(m_L, x);
+      }
+      else
+      {
+        m_L.template triangularView<Lower>().solveInPlace(x);
+        m_L.adjoint().template triangularView<Upper>().solveInPlace(x);
+      }
+      x = m_scale.asDiagonal() * x;
+      x = m_P * x;
+    }
+
+    template<typename Rhs> inline const internal::solve_retval<IncompleteCholesky, Rhs>
+    solve(const MatrixBase<Rhs>& b) const
+    {
+      eigen_assert(m_isInitialized && "IncompleteCholesky is not initialized.");
+      eigen_assert(cols()==b.rows()
+                && "IncompleteCholesky::solve(): invalid number of rows of the right hand side matrix b");
+      return internal::solve_retval<IncompleteCholesky, Rhs>(*this, b.derived());
+    }
+
+protected:
+
+    bool factorizeShifted(const FactorType& mat, RealScalar shift);
+
+    /** computes the level schedules of the factor the first time a solve with \a rhsCols columns is multithreaded */
+    void analyzeSchedules(Index rhsCols) const
+    {
+#ifdef EIGEN_HAS_OPENMP
+      if(m_scheduleIsOk || internal::sparse_parallel_threads(std::ptrdiff_t(m_L.nonZeros() + m_L.rows()) * rhsCols)==1)
+        return;
+      m_scheduleL.template analyze<Lower>(m_L);
+      m_scheduleLt.template analyzeAdjoint<Upper>(m_L);
+      m_scheduleIsOk = true;
+#else
+      EIGEN_UNUSED_VARIABLE(rhsCols);
+#endif
+    }
+
+    /** keeps off-diagonal entries; drops diagonal entries */
+    struct keep_diag {
+      inline bool operator() (const Index& row, const Index& col, const Scalar&) const
+      {
+        return row!=col;
+      }
+    };
+
+    /** orders row indices by decreasing magnitude of the corresponding entries of a dense vector */
+    struct greater_magnitude {
+      greater_magnitude(const Vector& vec) : m_vec(vec) {}
+      inline bool operator() (const Index& i, const Index& j) const
+      {
+        return internal::abs2(m_vec(i)) > internal::abs2(m_vec(j));
+      }
+      const Vector& m_vec;
+    };
+
+protected:
+
+    FactorType m_L;
+    mutable SparseTriangularSchedule<FactorType> m_scheduleL;   // level schedules of the triangular solves,
+    mutable SparseTriangularSchedule<FactorType> m_scheduleLt;  // computed by the first multithreaded solve
+    Vector m_scale;
+    RealScalar m_droptol;
+    int m_fillfactor;
+    RealScalar m_initialShift;
+    RealScalar m_shift;
+    mutable bool m_scheduleIsOk;
+    bool m_analysisIsOk;
+    bool m_factorizationIsOk;
+    bool m_isInitialized;
+    ComputationInfo m_info;
+    PermutationMatrix<Dynamic,Dynamic,Index> m_P;     // Fill-reducing permutation
+    PermutationMatrix<Dynamic,Dynamic,Index> m_Pinv;  // Inverse permutation
+};
+
+template <typename Scalar, int _UpLo>
+template<typename _MatrixType>
+void IncompleteCholesky<Scalar,_UpLo>::analyzePattern(const _MatrixType& amat)
+{
+  eigen_assert((amat.rows() == amat.cols()) && "The factorization should be done on a square matrix");
+  // Compute the Fill-reducing permutation of the full selfadjoint pattern
+  {
+    FactorType C;
+    C = amat.template selfadjointView<UpLo>();
+    C.prune(keep_diag());
+    internal::minimum_degree_ordering<Scalar, Index>(C, m_P);
+  }
+
+  if(m_P.size()>0)
+    m_Pinv  = m_P.inverse();
+  else
+    m_Pinv.resize(0);
+
+  m_analysisIsOk = true;
+}
+
+template <typename Scalar, int _UpLo>
+template<typename _MatrixType>
+void IncompleteCholesky<Scalar,_UpLo>::factorize(const _MatrixType& amat)
+{
+  using std::sqrt;
+  eigen_assert(m_analysisIsOk && "You must first call analyzePattern()");
+  const Index n = amat.cols();
+
+  // Apply the fill-reducing permutation, keeping the lower triangular part only
+  FactorType mat(n,n);
+  mat.template selfadjointView<Lower>() = amat.template selfadjointView<UpLo>().twistedBy(m_Pinv);
+
+  // Scale by the inverse square roots of the norms of the columns of the full matrix
+  RealVector norms = RealVector::Zero(n);
+  for(Index j=0; j<n; ++j)
+    for(typename FactorType::InnerIterator it(mat,j); it; ++it)
+    {
+      RealScalar a2 = internal::abs2(it.value());
+      norms(j) += a2;
+      if(it.index()!=j)
+        norms(it.index()) += a2;
+    }
+  m_scale.resize(n);
+  RealScalar minDiag = NumTraits<RealScalar>::highest();
+  for(Index j=0; j<n; ++j)
+    m_scale(j) = Scalar(norms(j)>RealScalar(0) ? RealScalar(1)/sqrt(sqrt(norms(j))) : RealScalar(1));
+  for(Index j=0; j<n; ++j)
+    for(typename FactorType::InnerIterator it(mat,j); it; ++it)
+    {
+      it.valueRef() *= m_scale(it.index()) * m_scale(j);
+      if(it.index()==j)
+        minDiag = (std::min)(minDiag, internal::real(it.value()));
+    }
+
+  // Try a zero shift first if the diagonal is positive, and double the shift at each breakdown
+  m_shift = (n==0 || minDiag>RealScalar(0)) ? RealScalar(0) : m_initialShift - minDiag;
+  bool ok = false;
+  for(int attempt=0; attempt<64 && !ok; ++attempt)
+  {
+    ok = factorizeShifted(mat, m_shift);
+    if(!ok)
+      m_shift = (std::max)(RealScalar(2)*m_shift, m_initialShift);
+  }
+
+  m_scheduleIsOk = false;
+  m_factorizationIsOk = ok;
+  m_info = ok ? Success : NumericalIssue;
+}
+
+/** \internal Left-looking incomplete factorization of the scaled lower triangular matrix \a mat
+  * plus \a shift times the identity. \returns false if a nonpositive pivot is met. */
+template <typename Scalar, int _UpLo>
+bool IncompleteCholesky<Scalar,_UpLo>::factorizeShifted(const FactorType& mat, RealScalar shift)
+{
+  using std::sqrt;
+  const Index n = mat.cols();
+
+  // number of largest off-diagonal elements to keep in each column of L
+  Index fill_in = static_cast<Index>(mat.nonZeros()*m_fillfactor)/(std::max)(n,Index(1))+1;
+
+  // the factor is built column by column, and read back while the next columns are computed
+  std::vector<Index> colPtr(n+1), rowIdx;
+  std::vector<Scalar> values;
+  rowIdx.reserve(mat.nonZeros()*2);
+  values.reserve(mat.nonZeros()*2);
+
+  Vector w = Vector::Zero(n);        // the current column
+  VectorXi mark = VectorXi::Constant(n, -1);
+  std::vector<Index> pattern;
+  pattern.reserve(n);
+
+  // the columns k<j of L with an element in row j are chained from head[j];
+  // pos[k] is the position in column k of its next element to be used
+  std::vector<Index> head(n, -1), next(n, -1), pos(n, 0);
+
+  colPtr[0] = 0;
+  for(Index j=0; j<n; ++j)
+  {
+    pattern.clear();
+    mark(j) = j;
+    w(j) = Scalar(shift);
+    pattern.push_back(j);
+    RealScalar colNorm = 0;
+    for(typename FactorType::InnerIterator it(mat,j); it; ++it)
+    {
+      Index i = it.index();
+      if(i<j)
+        continue;
+      if(i==j)
+        w(j) += it.value();
+      else
+      {
+        mark(i) = j;
+        w(i) = it.value();
+        pattern.push_back(i);
+        colNorm += internal::abs2(it.value());
+      }
+    }
+    colNorm = sqrt(colNorm);
+
+    // w -= L(j:n,k) * L(j,k)^* for the columns k having an element in row j
+    for(Index k=head[j]; k!=-1; )
+    {
+      Index nextk = next[k];
+      Index p = pos[k];
+      Scalar ljk = internal::conj(values[p]);
+      for(Index q=p; q<colPtr[k+1]; ++q)
+      {
+        Index i = rowIdx[q];
+        if(mark(i)!=j)
+        {
+          mark(i) = j;
+          w(i) = Scalar(0);
+          pattern.push_back(i);
+        }
+        w(i) -= values[q] * ljk;
+      }
+      pos[k] = p+1;
+      if(p+1<colPtr[k+1])
+      {
+        Index r = rowIdx[p+1];
+        next[k] = head[r];
+        head[r] = k;
+      }
+      k = nextk;
+    }
+
+    RealScalar d = internal::real(w(j));
+    if(!(d>RealScalar(0)))
+      return false;
+    RealScalar ljj = sqrt(d);
+
+    // dropping: first by magnitude, then keep the fill_in largest elements
+    Index nnz = 0;
+    RealScalar tol = m_droptol * colNorm;
+    for(std::size_t k=1; k<pattern.size(); ++k)
+      if(internal::abs(w(pattern[k])) > tol)
+        pattern[++nnz] = pattern[k];
+    if(nnz>fill_in)
+    {
+      std::nth_element(pattern.begin()+1, pattern.begin()+fill_in, pattern.begin()+1+nnz, greater_magnitude(w));
+      nnz = fill_in;
+    }
+    std::sort(pattern.begin()+1, pattern.begin()+1+nnz);
+
+    rowIdx.push_back(j);
+    values.push_back(Scalar(ljj));
+    for(Index k=1; k<=nnz; ++k)
+    {
+      rowIdx.push_back(pattern[k]);
+      values.push_back(w(pattern[k]) / ljj);
+    }
+    colPtr[j+1] = Index(rowIdx.size());
+
+    pos[j] = colPtr[j]+1;
+    if(nnz>0)
+    {
+      Index r = rowIdx[pos[j]];
+      next[j] = head[r];
+      head[r] = j;
+    }
+  }
+
+  m_L = MappedSparseMatrix<Scalar,ColMajor,Index>(n, n, colPtr[n], &colPtr[0], rowIdx.empty() ? 0 : &rowIdx[0],
+                                                  values.empty() ? 0 : &values[0]);
+  return true;
+}
+
+namespace internal {
+
+template<typename _Scalar, int _UpLo, typename Rhs>
+struct solve_retval<IncompleteCholesky<_Scalar,_UpLo>, Rhs>
+  : solve_retval_base<IncompleteCholesky<_Scalar,_UpLo>, Rhs>
+{
+  typedef IncompleteCholesky<_Scalar,_UpLo> Dec;
+  EIGEN_MAKE_SOLVE_HELPERS(Dec,Rhs)
+
+  template<typename Dest> void evalTo(Dest& dst) const
+  {
+    dec()._solve(rhs(),dst);
+  }
+};
+
+}
+
+#endif // EIGEN_INCOMPLETE_CHOLESKY_H
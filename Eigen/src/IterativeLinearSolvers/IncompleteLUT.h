@@ -63,13 +63,13 @@ class IncompleteLUT
     
     IncompleteLUT()
       : m_droptol(NumTraits<Scalar>::dummy_precision()), m_fillfactor(10),
-        m_analysisIsOk(false), m_factorizationIsOk(false), m_isInitialized(false)
+        m_scheduleIsOk(false), m_analysisIsOk(false), m_factorizationIsOk(false), m_isInitialized(false)
     {}
     
     template<typename MatrixType>
     IncompleteLUT(const MatrixType& mat, RealScalar droptol=NumTraits<Scalar>::dummy_precision(), int fillfactor = 10)
       : m_droptol(droptol),m_fillfactor(fillfactor),
-        m_analysisIsOk(false),m_factorizationIsOk(false),m_isInitialized(false)
+        m_scheduleIsOk(false), m_analysisIsOk(false),m_factorizationIsOk(false),m_isInitialized(false)
     {
       eigen_assert(fillfactor != 0);
       compute(mat); 
@@ -118,8 +118,17 @@ class IncompleteLUT
     void _solve(const Rhs& b, Dest& x) const
     {
       x = m_Pinv * b;  
-      x = m_lu.template triangularView<UnitLower>().solve(x);
-      x = m_lu.template triangularView<Upper>().solve(x);
+      analyzeSchedules(x.cols());
+      if(m_scheduleIsOk)
+      {
+        m_scheduleL.solveInPlace(m_lu, x);
+        m_scheduleU.solveInPlace(m_lu, x);
+      }
+      else
+      {
+        x = m_lu.template triangularView<UnitLower>().solve(x);
+        x = m_lu.template triangularView<Upper>().solve(x);
+      }
       x = m_P * x; 
     }
 
@@ -137,6 +146,20 @@ protected:
     template <typename VectorV, typename VectorI>
     int QuickSplit(VectorV &row, VectorI &ind, int ncut);
 
+    /** computes the level schedules of the factors the first time a solve with \a rhsCols columns is multithreaded */
+    void analyzeSchedules(Index rhsCols) const
+    {
+#ifdef EIGEN_HAS_OPENMP
+      if(m_scheduleIsOk || internal::sparse_parallel_threads(std::ptrdiff_t(m_lu.nonZeros() + m_lu.rows()) * rhsCols)==1)
+        return;
+      m_scheduleL.template analyze<UnitLower>(m_lu);
+      m_scheduleU.template analyze<Upper>(m_lu);
+      m_scheduleIsOk = true;
+#else
+      EIGEN_UNUSED_VARIABLE(rhsCols);
+#endif
+    }
+
 
     /** keeps off-diagonal entries; drops diagonal entries */
     struct keep_diag {
@@ -149,8 +172,11 @@ protected:
 protected:
 
     FactorType m_lu;
+    mutable SparseTriangularSchedule<FactorType> m_scheduleL;   // level schedules of the triangular solves,
+    mutable SparseTriangularSchedule<FactorType> m_scheduleU;   // computed by the first multithreaded solve
     RealScalar m_droptol;
     int m_fillfactor;
+    mutable bool m_scheduleIsOk;
     bool m_analysisIsOk;
     bool m_factorizationIsOk;
     bool m_isInitialized;
@@ -447,6 +473,7 @@ void IncompleteLUT<Scalar>::factorize(const _MatrixType& amat)
   m_lu.finalize();
   m_lu.makeCompressed();
 
+  m_scheduleIsOk = false;
   m_factorizationIsOk = true;
   m_info = Success;
 }
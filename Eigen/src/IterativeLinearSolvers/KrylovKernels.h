@@ -0,0 +1,65 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef EIGEN_KRYLOV_KERNELS_H
+#define EIGEN_KRYLOV_KERNELS_H
+
+namespace internal {
+
+/** \internal
+  * Runs the fused vector kernel \a op on consecutive chunks of [0,\a n), and accumulates the \c NbSums
+  * reductions it computes on each chunk into \a sums.
+  *
+  * \a op is called as \c op(start,size,partial), and must process the entries [start,start+size) of
+  * its vectors, and write its \c NbSums partial reductions into \c partial. A chunk is small enough
+  * for the vectors it updates to remain in cache until the reductions read them, such that all
+  * the updates and reductions of a kernel only require a single sweep over the memory.
+  *
+  * The chunks are processed in parallel for large vectors. The partial reductions are added in the
+  * order of the chunks, hence the result does not depend on the number of threads.
+  */
+template<int NbSums, typename Index, typename Op, typename Scalar>
+void fused_vector_sweep(Index n, const Op& op, Scalar* sums)
+{
+  const Index chunkSize = 1024;
+  const Index chunks = (n+chunkSize-1)/chunkSize;
+  Matrix<Scalar,NbSums,Dynamic> partial;
+  partial.resize(NbSums, chunks);
+  int threads = sparse_parallel_threads(n);
+  EIGEN_UNUSED_VARIABLE(threads);
+
+#ifdef EIGEN_HAS_OPENMP
+  #pragma omp parallel for schedule(static) num_threads(threads)
+#endif
+  for(Index c=0; c<chunks; ++c)
+  {
+    const Index start = c*chunkSize;
+    op(start, (std::min)(chunkSize, n-start), partial.col(c).data());
+  }
+
+  for(int k=0; k<NbSums; ++k)
+    sums[k] = chunks>0 ? partial.row(k).sum() : Scalar(0);
+}
+
+} // end namespace internal
+
+#endif // EIGEN_KRYLOV_KERNELS_H
@@ -0,0 +1,273 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef EIGEN_MINRES_H
+#define EIGEN_MINRES_H
+
+namespace internal {
+
+/** \internal Low-level preconditioned minimal residual algorithm
+  *
+  * This is the algorithm of Paige and Saunders: a Lanczos process builds a tridiagonal matrix which is
+  * triangularized on the fly by Givens rotations, such that the solution can be updated with short recurrences.
+  *
+  * \param mat The selfadjoint matrix A
+  * \param rhs The right hand side vector b
+  * \param x On input and initial solution, on output the computed solution.
+  * \param precond A selfadjoint positive definite preconditioner being able to efficiently solve for an
+  *                approximation of Ax=b (regardless of b)
+  * \param iters On input the max number of iteration, on output the number of performed iterations.
+  * \param tol_error On input the tolerance error, on output an estimation of the relative error.
+  */
+template<typename MatrixType, typename Rhs, typename Dest, typename Preconditioner>
+EIGEN_DONT_INLINE
+void minres(const MatrixType& mat, const Rhs& rhs, Dest& x,
+            const Preconditioner& precond, int& iters,
+            typename Dest::RealScalar& tol_error)
+{
+  using std::sqrt;
+  using std::abs;
+  typedef typename Dest::RealScalar RealScalar;
+  typedef typename Dest::Scalar Scalar;
+  typedef Matrix<Scalar,Dynamic,1> VectorType;
+
+  RealScalar tol = tol_error;
+  int maxIters = iters;
+
+  int n = mat.cols();
+  VectorType r1 = rhs - mat * x;     // the last two Lanczos vectors, not yet scaled
+  VectorType r2 = r1;
+  VectorType y = precond.solve(r1);
+  VectorType v(n), w = VectorType::Zero(n), w1(n), w2 = VectorType::Zero(n);
+
+  RealScalar beta1 = sqrt(abs(internal::real(r1.dot(y))));
+  if(beta1 == RealScalar(0))
+  {
+    iters = 0;
+    tol_error = 0;
+    return;
+  }
+
+  RealScalar oldb = 0, beta = beta1;
+  RealScalar dbar = 0, epsln = 0;
+  RealScalar phibar = beta1;          // the norm of the residual, in the metric of the preconditioner
+  RealScalar cs = -1, sn = 0;
+
+  int i = 0;
+  while(i < maxIters && phibar > tol*beta1)
+  {
+    // Lanczos step
+    v = y / beta;
+    y.noalias() = mat * v;
+    if(i > 0)
+      y -= (beta/oldb) * r1;
+    RealScalar alfa = internal::real(v.dot(y));
+    y -= (alfa/beta) * r2;
+    r1.swap(r2);
+    r2 = y;
+    y = precond.solve(r2);
+    oldb = beta;
+    beta = sqrt(abs(internal::real(r2.dot(y))));
+
+    // apply the previous rotation, and compute the next one
+    RealScalar oldeps = epsln;
+    RealScalar delta = cs*dbar + sn*alfa;
+    RealScalar gbar  = sn*dbar - cs*alfa;
+    epsln = sn*beta;
+    dbar  = -cs*beta;
+    RealScalar gamma = (std::max)(internal::hypot(gbar, beta), NumTraits<RealScalar>::epsilon());
+    cs = gbar/gamma;
+    sn = beta/gamma;
+    RealScalar phi = cs*phibar;
+    phibar = sn*phibar;
+
+    // update the solution
+    w1.swap(w2);
+    w2.swap(w);
+    w = (v - oldeps*w1 - delta*w2) / gamma;
+    x += phi * w;
+    ++i;
+
+    if(beta == RealScalar(0))
+      break;
+  }
+
+  tol_error = phibar / beta1;
+  iters = i;
+}
+
+}
+
+template< typename _MatrixType, int _UpLo=Lower,
+          typename _Preconditioner = IdentityPreconditioner>
+class MINRES;
+
+namespace internal {
+
+template< typename _MatrixType, int _UpLo, typename _Preconditioner>
+struct traits<MINRES<_MatrixType,_UpLo,_Preconditioner> >
+{
+  typedef _MatrixType MatrixType;
+  typedef _Preconditioner Preconditioner;
+};
+
+}
+
+/** \ingroup IterativeLinearSolvers_Module
+  * \brief A minimal residual solver for sparse symmetric problems
+  *
+  * This class allows to solve for A.x = b sparse linear problems using the minimal residual algorithm
+  * of Paige and Saunders. The sparse matrix A must be selfadjoint, but unlike with ConjugateGradient it
+  * can be indefinite. The vectors x and b can be either dense or sparse.
+  *
+  * \tparam _MatrixType the type of the sparse matrix A, can be a dense or a sparse matrix.
+  * \tparam _UpLo the triangular part that will be used for the computations. It can be Lower
+  *               or Upper. Default is Lower.
+  * \tparam _Preconditioner the type of the preconditioner. Default is IdentityPreconditioner.
+  *                         The preconditioner must be selfadjoint positive definite, even if A is not:
+  *                         a DiagonalPreconditioner is only valid when the diagonal of A is positive.
+  *
+  * The maximal number of iterations and tolerance value can be controlled via the setMaxIterations()
+  * and setTolerance() methods. The defaults are the size of the problem for the maximal number of iterations
+  * and NumTraits<Scalar>::epsilon() for the tolerance. The error is the estimate of the relative residual
+  * provided by the recurrences, measured in the norm induced by the inverse of the preconditioner.
+  *
+  * This class can be used as the direct solver classes. Here is a typical usage example:
+  * \code
+  * int n = 10000;
+  * VectorXd x(n), b(n);
+  * SparseMatrix<double> A(n,n);
+  * // fill the lower triangular part of the symmetric indefinite matrix A, and b
+  * MINRES<SparseMatrix<double> > minres(A);
+  * x = minres.solve(b);
+  * std::cout << "#iterations:     " << minres.iterations() << std::endl;
+  * std::cout << "estimated error: " << minres.error()      << std::endl;
+  * \endcode
+  *
+  * \sa class ConjugateGradient, IdentityPreconditioner
+  */
+template< typename _MatrixType, int _UpLo, typename _Preconditioner>
+class MINRES : public IterativeSolverBase<MINRES<_MatrixType,_UpLo,_Preconditioner> >
+{
+  typedef IterativeSolverBase<MINRES> Base;
+  using Base::mp_matrix;
+  using Base::m_error;
+  using Base::m_iterations;
+  using Base::m_info;
+  using Base::m_isInitialized;
+public:
+  typedef _MatrixType MatrixType;
+  typedef typename MatrixType::Scalar Scalar;
+  typedef typename MatrixType::Index Index;
+  typedef typename MatrixType::RealScalar RealScalar;
+  typedef _Preconditioner Preconditioner;
+
+  enum {
+    UpLo = _UpLo
+  };
+
+public:
+
+  /** Default constructor. */
+  MINRES() : Base() {}
+
+  /** Initialize the solver with matrix \a A for further \c Ax=b solving.
+    *
+    * This constructor is a shortcut for the default constructor followed
+    * by a call to compute().
+    *
+    * \warning this class stores a reference to the matrix A as well as some
+    * precomputed values that depend on it. Therefore, if \a A is changed
+    * this class becomes invalid. Call compute() to update it with the new
+    * matrix A, or modify a copy of A.
+    */
+  MINRES(const MatrixType& A) : Base(A) {}
+
+  ~MINRES() {}
+
+  /** \returns the solution x of \f$ A x = b \f$ using the current decomposition of A
+    * \a x0 as an initial solution.
+    *
+    * \sa compute()
+    */
+  template<typename Rhs,typename Guess>
+  inline const internal::solve_retval_with_guess<MINRES, Rhs, Guess>
+  solveWithGuess(const MatrixBase<Rhs>& b, const Guess& x0) const
+  {
+    eigen_assert(m_isInitialized && "MINRES is not initialized.");
+    eigen_assert(Base::rows()==b.rows()
+              && "MINRES::solve(): invalid number of rows of the right hand side matrix b");
+    return internal::solve_retval_with_guess
+            <MINRES, Rhs, Guess>(*this, b.derived(), x0);
+  }
+
+  /** \internal */
+  template<typename Rhs,typename Dest>
+  void _solveWithGuess(const Rhs& b, Dest& x) const
+  {
+    RealScalar error = 0;
+    for(int j=0; j<b.cols(); ++j)
+    {
+      m_iterations = Base::maxIterations();
+      m_error = Base::m_tolerance;
+
+      typename Dest::ColXpr xj(x,j);
+      internal::minres(mp_matrix->template selfadjointView<UpLo>(), b.col(j), xj,
+                       Base::m_preconditioner, m_iterations, m_error);
+      error = (std::max)(error, m_error);
+    }
+    m_error = error;
+    m_isInitialized = true;
+    m_info = m_error <= Base::m_tolerance ? Success : NoConvergence;
+  }
+
+  /** \internal */
+  template<typename Rhs,typename Dest>
+  void _solve(const Rhs& b, Dest& x) const
+  {
+    x.setZero();
+    _solveWithGuess(b,x);
+  }
+
+protected:
+
+};
+
+
+namespace internal {
+
+template<typename _MatrixType, int _UpLo, typename _Preconditioner, typename Rhs>
+struct solve_retval<MINRES<_MatrixType,_UpLo,_Preconditioner>, Rhs>
+  : solve_retval_base<MINRES<_MatrixType,_UpLo,_Preconditioner>, Rhs>
+{
+  typedef MINRES<_MatrixType,_UpLo,_Preconditioner> Dec;
+  EIGEN_MAKE_SOLVE_HELPERS(Dec,Rhs)
+
+  template<typename Dest> void evalTo(Dest& dst) const
+  {
+    dec()._solve(rhs(),dst);
+  }
+};
+
+}
+
+#endif // EIGEN_MINRES_H
@@ -0,0 +1,326 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef EIGEN_PIPELINED_BICGSTAB_H
+#define EIGEN_PIPELINED_BICGSTAB_H
+
+namespace internal {
+
+/** \internal First fused update of the pipelined BiCGSTAB, which also computes (q,y) and (y,y) */
+template<typename VectorType>
+struct pipelined_bicgstab_update1
+{
+  typedef typename VectorType::Scalar Scalar;
+  typedef typename VectorType::Index Index;
+
+  pipelined_bicgstab_update1(Scalar alpha, Scalar beta, Scalar omega,
+                             VectorType& p, VectorType& s, VectorType& z, VectorType& q, VectorType& y,
+                             const VectorType& r, const VectorType& w, const VectorType& t, const VectorType& v)
+    : alpha(alpha), beta(beta), omega(omega), p(p), s(s), z(z), q(q), y(y), r(r), w(w), t(t), v(v)
+  {}
+
+  void operator()(Index start, Index size, Scalar* sums) const
+  {
+    p.segment(start,size) = r.segment(start,size) + beta * (p.segment(start,size) - omega * s.segment(start,size));
+    s.segment(start,size) = w.segment(start,size) + beta * (s.segment(start,size) - omega * z.segment(start,size));
+    z.segment(start,size) = t.segment(start,size) + beta * (z.segment(start,size) - omega * v.segment(start,size));
+    q.segment(start,size) = r.segment(start,size) - alpha * s.segment(start,size);
+    y.segment(start,size) = w.segment(start,size) - alpha * z.segment(start,size);
+    sums[0] = y.segment(start,size).dot(q.segment(start,size));
+    sums[1] = y.segment(start,size).squaredNorm();
+  }
+
+  Scalar alpha, beta, omega;
+  VectorType &p, &s, &z, &q, &y;
+  const VectorType &r, &w, &t, &v;
+};
+
+/** \internal Second fused update of the pipelined BiCGSTAB, which also computes (r0,r), (r0,w), (r0,s), (r0,z) and (r,r) */
+template<typename VectorType>
+struct pipelined_bicgstab_update2
+{
+  typedef typename VectorType::Scalar Scalar;
+  typedef typename VectorType::Index Index;
+
+  pipelined_bicgstab_update2(Scalar alpha, Scalar omega, VectorType& dy, VectorType& r, VectorType& w,
+                             const VectorType& p, const VectorType& q, const VectorType& y, const VectorType& t,
+                             const VectorType& v, const VectorType& s, const VectorType& z, const VectorType& r0)
+    : alpha(alpha), omega(omega), dy(dy), r(r), w(w), p(p), q(q), y(y), t(t), v(v), s(s), z(z), r0(r0)
+  {}
+
+  void operator()(Index start, Index size, Scalar* sums) const
+  {
+    dy.segment(start,size) += alpha * p.segment(start,size) + omega * q.segment(start,size);
+    r.segment(start,size) = q.segment(start,size) - omega * y.segment(start,size);
+    w.segment(start,size) = y.segment(start,size) - omega * (t.segment(start,size) - alpha * v.segment(start,size));
+    sums[0] = r0.segment(start,size).dot(r.segment(start,size));
+    sums[1] = r0.segment(start,size).dot(w.segment(start,size));
+    sums[2] = r0.segment(start,size).dot(s.segment(start,size));
+    sums[3] = r0.segment(start,size).dot(z.segment(start,size));
+    sums[4] = r.segment(start,size).squaredNorm();
+  }
+
+  Scalar alpha, omega;
+  VectorType &dy, &r, &w;
+  const VectorType &p, &q, &y, &t, &v, &s, &z, &r0;
+};
+
+/** \internal Low-level pipelined bi conjugate gradient stabilized algorithm
+  *
+  * This is the pipelined BiCGSTAB of S. Cools and W. Vanroose, "The communication-hiding pipelined BiCGStab
+  * method for the parallel solution of large unsymmetric linear systems", Parallel Computing, 2017, applied
+  * to the right preconditioned system A M^-1 y = b. Each iteration performs two matrix-vector products,
+  * two preconditioner solves, and two fused passes over the vectors, each followed by a single reduction.
+  * The correction of the solution is accumulated in the preconditioned space, and the preconditioner is
+  * applied to it once at the end. The iterations are restarted from the true residual each time the
+  * residual decreases by a factor sqrt(epsilon), which bounds the drift of the recursively updated residual.
+  *
+  * \param mat The matrix A
+  * \param rhs The right hand side vector b
+  * \param x On input and initial solution, on output the computed solution.
+  * \param precond A preconditioner being able to efficiently solve for an
+  *                approximation of Ax=b (regardless of b)
+  * \param iters On input the max number of iteration, on output the number of performed iterations.
+  * \param tol_error On input the tolerance error, on output an estimation of the relative error.
+  * \return false in the case of numerical issue, for example a break down of BiCGSTAB.
+  */
+template<typename MatrixType, typename Rhs, typename Dest, typename Preconditioner>
+bool pipelined_bicgstab(const MatrixType& mat, const Rhs& rhs, Dest& x,
+                        const Preconditioner& precond, int& iters,
+                        typename Dest::RealScalar& tol_error)
+{
+  using std::sqrt;
+  typedef typename Dest::RealScalar RealScalar;
+  typedef typename Dest::Scalar Scalar;
+  typedef Matrix<Scalar,Dynamic,1> VectorType;
+  RealScalar tol = tol_error;
+  int maxIters = iters;
+
+  int n = mat.cols();
+  VectorType r  = rhs - mat * x;
+  VectorType r0 = r;
+  RealScalar r0_sqnorm = r0.squaredNorm();
+  RealScalar r_sqnorm = r0_sqnorm;
+
+  // w = A M^-1 r, t = A M^-1 w
+  VectorType tmp = precond.solve(r);
+  VectorType w(n), t(n), v(n);
+  w.noalias() = mat * tmp;
+  tmp = precond.solve(w);
+  t.noalias() = mat * tmp;
+
+  VectorType p = VectorType::Zero(n), s = VectorType::Zero(n), z = VectorType::Zero(n);
+  VectorType q(n), y(n), dy = VectorType::Zero(n);
+  v.setZero();
+
+  Scalar rho   = r0_sqnorm;
+  Scalar alpha = rho / r0.dot(w);
+  Scalar beta  = 0;
+  Scalar omega = 0;
+
+  RealScalar tol2 = tol*tol;
+  RealScalar maxSqnorm = r_sqnorm;  // largest residual since the last residual replacement
+  bool ok = true;
+  int i = 0;
+  while ( r_sqnorm > tol2*r0_sqnorm && i<maxIters )
+  {
+    Scalar sums[5];
+    fused_vector_sweep<2>(n, pipelined_bicgstab_update1<VectorType>(alpha, beta, omega, p, s, z, q, y, r, w, t, v), sums);
+    Scalar qy = sums[0];
+    RealScalar yy = internal::real(sums[1]);
+
+    tmp = precond.solve(z);
+    v.noalias() = mat * tmp;
+
+    omega = yy==RealScalar(0) ? Scalar(0) : qy / yy;
+    fused_vector_sweep<5>(n, pipelined_bicgstab_update2<VectorType>(alpha, omega, dy, r, w, p, q, y, t, v, s, z, r0), sums);
+    r_sqnorm = internal::real(sums[4]);
+    maxSqnorm = (std::max)(maxSqnorm, r_sqnorm);
+    ++i;
+    if(r_sqnorm <= tol2*r0_sqnorm || i>=maxIters)
+      break;
+
+    Scalar rho_old = rho;
+    rho = sums[0];
+    if(r_sqnorm < NumTraits<RealScalar>::epsilon() * maxSqnorm)
+    {
+      // The recursively updated residual drifts away from the true one, and the iterations would
+      // stagnate or diverge once it reaches the rounding errors: restart from the true residual.
+      x += precond.solve(dy);
+      dy.setZero();
+      r = rhs - mat * x;
+      r_sqnorm = maxSqnorm = r.squaredNorm();
+      if(r_sqnorm <= tol2*r0_sqnorm)
+        break;
+      tmp = precond.solve(r);
+      w.noalias() = mat * tmp;
+      p.setZero(); s.setZero(); z.setZero(); v.setZero();
+      rho = r0.dot(r);
+      sums[1] = r0.dot(w);
+      beta = 0;
+    }
+    else
+      beta = (alpha / omega) * (rho / rho_old);
+
+    tmp = precond.solve(w);
+    t.noalias() = mat * tmp;
+
+    if (rho == Scalar(0)) { ok = false; break; } /* New search directions cannot be found */
+    alpha = rho / (sums[1] + beta * sums[2] - beta * omega * sums[3]);
+  }
+
+  x += precond.solve(dy);
+  tol_error = sqrt(r_sqnorm/r0_sqnorm);
+  iters = i;
+  return ok;
+}
+
+}
+
+template< typename _MatrixType,
+          typename _Preconditioner = DiagonalPreconditioner<typename _MatrixType::Scalar> >
+class PipelinedBiCGSTAB;
+
+namespace internal {
+
+template< typename _MatrixType, typename _Preconditioner>
+struct traits<PipelinedBiCGSTAB<_MatrixType,_Preconditioner> >
+{
+  typedef _MatrixType MatrixType;
+  typedef _Preconditioner Preconditioner;
+};
+
+}
+
+/** \ingroup IterativeLinearSolvers_Module
+  * \brief A pipelined bi conjugate gradient stabilized solver for sparse square problems
+  *
+  * This class solves A.x = b sparse linear problems with the same interface as BiCGSTAB, using the
+  * pipelined variant of the BiCGSTAB algorithm. The vector updates and the dot products of an iteration are
+  * fused into two multithreaded passes over the vectors with one reduction each, instead of about ten passes
+  * and six reductions. This pays off for large problems solved with several threads, at the price of
+  * eight more vectors, and of a slightly less accurate recursively updated residual.
+  *
+  * \tparam _MatrixType the type of the sparse matrix A, can be a dense or a sparse matrix.
+  * \tparam _Preconditioner the type of the preconditioner. Default is DiagonalPreconditioner
+  *
+  * \sa class BiCGSTAB
+  */
+template< typename _MatrixType, typename _Preconditioner>
+class PipelinedBiCGSTAB : public IterativeSolverBase<PipelinedBiCGSTAB<_MatrixType,_Preconditioner> >
+{
+  typedef IterativeSolverBase<PipelinedBiCGSTAB> Base;
+  using Base::mp_matrix;
+  using Base::m_error;
+  using Base::m_iterations;
+  using Base::m_info;
+  using Base::m_isInitialized;
+public:
+  typedef _MatrixType MatrixType;
+  typedef typename MatrixType::Scalar Scalar;
+  typedef typename MatrixType::Index Index;
+  typedef typename MatrixType::RealScalar RealScalar;
+  typedef _Preconditioner Preconditioner;
+
+public:
+
+  /** Default constructor. */
+  PipelinedBiCGSTAB() : Base() {}
+
+  /** Initialize the solver with matrix \a A for further \c Ax=b solving.
+    *
+    * \warning this class stores a reference to the matrix A as well as some
+    * precomputed values that depend on it. Therefore, if \a A is changed
+    * this class becomes invalid. Call compute() to update it with the new
+    * matrix A, or modify a copy of A.
+    */
+  PipelinedBiCGSTAB(const MatrixType& A) : Base(A) {}
+
+  ~PipelinedBiCGSTAB() {}
+
+  /** \returns the solution x of \f$ A x = b \f$ using the current decomposition of A
+    * \a x0 as an initial solution.
+    *
+    * \sa compute()
+    */
+  template<typename Rhs,typename Guess>
+  inline const internal::solve_retval_with_guess<PipelinedBiCGSTAB, Rhs, Guess>
+  solveWithGuess(const MatrixBase<Rhs>& b, const Guess& x0) const
+  {
+    eigen_assert(m_isInitialized && "PipelinedBiCGSTAB is not initialized.");
+    eigen_assert(Base::rows()==b.rows()
+              && "PipelinedBiCGSTAB::solve(): invalid number of rows of the right hand side matrix b");
+    return internal::solve_retval_with_guess
+            <PipelinedBiCGSTAB, Rhs, Guess>(*this, b.derived(), x0);
+  }
+
+  /** \internal */
+  template<typename Rhs,typename Dest>
+  void _solveWithGuess(const Rhs& b, Dest& x) const
+  {
+    bool failed = false;
+    for(int j=0; j<b.cols(); ++j)
+    {
+      m_iterations = Base::maxIterations();
+      m_error = Base::m_tolerance;
+
+      typename Dest::ColXpr xj(x,j);
+      if(!internal::pipelined_bicgstab(*mp_matrix, b.col(j), xj, Base::m_preconditioner, m_iterations, m_error))
+        failed = true;
+    }
+    m_info = failed ? NumericalIssue
+           : m_error <= Base::m_tolerance ? Success
+           : NoConvergence;
+    m_isInitialized = true;
+  }
+
+  /** \internal */
+  template<typename Rhs,typename Dest>
+  void _solve(const Rhs& b, Dest& x) const
+  {
+    x.setZero();
+    _solveWithGuess(b,x);
+  }
+
+protected:
+
+};
+
+
+namespace internal {
+
+template<typename _MatrixType, typename _Preconditioner, typename Rhs>
+struct solve_retval<PipelinedBiCGSTAB<_MatrixType, _Preconditioner>, Rhs>
+  : solve_retval_base<PipelinedBiCGSTAB<_MatrixType, _Preconditioner>, Rhs>
+{
+  typedef PipelinedBiCGSTAB<_MatrixType, _Preconditioner> Dec;
+  EIGEN_MAKE_SOLVE_HELPERS(Dec,Rhs)
+
+  template<typename Dest> void evalTo(Dest& dst) const
+  {
+    dec()._solve(rhs(),dst);
+  }
+};
+
+}
+
+#endif // EIGEN_PIPELINED_BICGSTAB_H
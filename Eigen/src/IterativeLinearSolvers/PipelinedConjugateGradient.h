@@ -0,0 +1,280 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef EIGEN_PIPELINED_CONJUGATE_GRADIENT_H
+#define EIGEN_PIPELINED_CONJUGATE_GRADIENT_H
+
+namespace internal {
+
+/** \internal Fused update of the pipelined conjugate gradient, which also computes (r,u) and (w,u) */
+template<typename VectorType, typename Dest>
+struct pipelined_cg_update
+{
+  typedef typename VectorType::Scalar Scalar;
+  typedef typename VectorType::RealScalar RealScalar;
+  typedef typename VectorType::Index Index;
+
+  pipelined_cg_update(RealScalar alpha, RealScalar beta, Dest& x, VectorType& r, VectorType& u, VectorType& w,
+                      VectorType& z, VectorType& q, VectorType& s, VectorType& p, const VectorType& m, const VectorType& n)
+    : alpha(alpha), beta(beta), x(x), r(r), u(u), w(w), z(z), q(q), s(s), p(p), m(m), n(n)
+  {}
+
+  void operator()(Index start, Index size, Scalar* sums) const
+  {
+    z.segment(start,size) = n.segment(start,size) + beta * z.segment(start,size);
+    q.segment(start,size) = m.segment(start,size) + beta * q.segment(start,size);
+    s.segment(start,size) = w.segment(start,size) + beta * s.segment(start,size);
+    p.segment(start,size) = u.segment(start,size) + beta * p.segment(start,size);
+    x.segment(start,size) += alpha * p.segment(start,size);
+    r.segment(start,size) -= alpha * s.segment(start,size);
+    u.segment(start,size) -= alpha * q.segment(start,size);
+    w.segment(start,size) -= alpha * z.segment(start,size);
+    sums[0] = r.segment(start,size).dot(u.segment(start,size));
+    sums[1] = w.segment(start,size).dot(u.segment(start,size));
+  }
+
+  RealScalar alpha, beta;
+  Dest& x;
+  VectorType &r, &u, &w, &z, &q, &s, &p;
+  const VectorType &m, &n;
+};
+
+/** \internal Low-level pipelined conjugate gradient algorithm
+  *
+  * This is the preconditioned pipelined conjugate gradient of P. Ghysels and W. Vanroose, "Hiding global
+  * synchronization latency in the preconditioned Conjugate Gradient algorithm", Parallel Computing, 2014.
+  * The two dot products of an iteration only depend on vectors updated by the same fused sweep, so that
+  * each iteration requires one matrix-vector product, one preconditioner solve, and a single pass
+  * over the vectors. The residual is replaced by the true one each time it decreases by a factor
+  * sqrt(epsilon), which bounds the drift of the recursively updated vectors.
+  *
+  * \param mat The matrix A
+  * \param rhs The right hand side vector b
+  * \param x On input and initial solution, on output the computed solution.
+  * \param precond A preconditioner being able to efficiently solve for an
+  *                approximation of Ax=b (regardless of b)
+  * \param iters On input the max number of iteration, on output the number of performed iterations.
+  * \param tol_error On input the tolerance error, on output an estimation of the relative error.
+  */
+template<typename MatrixType, typename Rhs, typename Dest, typename Preconditioner>
+EIGEN_DONT_INLINE
+void pipelined_conjugate_gradient(const MatrixType& mat, const Rhs& rhs, Dest& x,
+                                  const Preconditioner& precond, int& iters,
+                                  typename Dest::RealScalar& tol_error)
+{
+  using std::sqrt;
+  using std::abs;
+  typedef typename Dest::RealScalar RealScalar;
+  typedef typename Dest::Scalar Scalar;
+  typedef Matrix<Scalar,Dynamic,1> VectorType;
+
+  RealScalar tol = tol_error;
+  int maxIters = iters;
+
+  int n = mat.cols();
+  VectorType r = rhs - mat * x;       // residual
+  VectorType u = precond.solve(r);    // preconditioned residual
+  VectorType w(n);
+  w.noalias() = mat * u;
+  VectorType m(n), an(n);
+  VectorType z = VectorType::Zero(n), q = VectorType::Zero(n), s = VectorType::Zero(n), p = VectorType::Zero(n);
+
+  RealScalar gamma = internal::real(r.dot(u));  // the square of the absolute value of r scaled by invM
+  RealScalar delta = internal::real(w.dot(u));
+  RealScalar gammaInit = gamma;
+  RealScalar gammaOld = 0, alpha = 0;
+  RealScalar maxGamma = gamma;        // largest residual since the last residual replacement
+
+  int i = 0;
+  while ((i < maxIters) && (gamma > tol*tol*gammaInit))
+  {
+    m = precond.solve(w);
+    an.noalias() = mat * m;             // the bottleneck of the algorithm
+
+    RealScalar beta = i>0 ? gamma / gammaOld : RealScalar(0);
+    alpha = i>0 ? gamma / (delta - beta * gamma / alpha) : gamma / delta;
+    gammaOld = gamma;
+
+    Scalar sums[2];
+    fused_vector_sweep<2>(n, pipelined_cg_update<VectorType,Dest>(alpha, beta, x, r, u, w, z, q, s, p, m, an), sums);
+    gamma = internal::real(sums[0]);
+    delta = internal::real(sums[1]);
+    maxGamma = (std::max)(maxGamma, gamma);
+    i++;
+
+    if(gamma > tol*tol*gammaInit && gamma < NumTraits<RealScalar>::epsilon() * maxGamma)
+    {
+      // The recursively updated vectors drift away from the true ones, and the iterations would
+      // stagnate once the residual reaches the rounding errors: recompute them from x and p.
+      r = rhs - mat * x;
+      u = precond.solve(r);
+      w.noalias() = mat * u;
+      s.noalias() = mat * p;
+      q = precond.solve(s);
+      z.noalias() = mat * q;
+      gamma = maxGamma = internal::real(r.dot(u));
+      delta = internal::real(w.dot(u));
+    }
+  }
+
+  tol_error = gammaInit==RealScalar(0) ? RealScalar(0) : sqrt(abs(gamma / gammaInit));
+  iters = i;
+}
+
+}
+
+template< typename _MatrixType, int _UpLo=Lower,
+          typename _Preconditioner = DiagonalPreconditioner<typename _MatrixType::Scalar> >
+class PipelinedConjugateGradient;
+
+namespace internal {
+
+template< typename _MatrixType, int _UpLo, typename _Preconditioner>
+struct traits<PipelinedConjugateGradient<_MatrixType,_UpLo,_Preconditioner> >
+{
+  typedef _MatrixType MatrixType;
+  typedef _Preconditioner Preconditioner;
+};
+
+}
+
+/** \ingroup IterativeLinearSolvers_Module
+  * \brief A pipelined conjugate gradient solver for sparse self-adjoint problems
+  *
+  * This class solves A.x = b sparse linear problems with the same interface as ConjugateGradient, using
+  * the pipelined variant of the preconditioned conjugate gradient algorithm. The vector updates and the
+  * dot products of an iteration are fused into a single multithreaded pass over the vectors with a single
+  * reduction, instead of the five passes and two reductions of ConjugateGradient. This pays off for large
+  * problems solved with several threads, at the price of four more vectors, and of a slightly less accurate
+  * recursively updated residual.
+  *
+  * \tparam _MatrixType the type of the sparse matrix A, can be a dense or a sparse matrix.
+  * \tparam _UpLo the triangular part that will be used for the computations. It can be Lower
+  *               or Upper. Default is Lower.
+  * \tparam _Preconditioner the type of the preconditioner. Default is DiagonalPreconditioner
+  *
+  * \sa class ConjugateGradient
+  */
+template< typename _MatrixType, int _UpLo, typename _Preconditioner>
+class PipelinedConjugateGradient : public IterativeSolverBase<PipelinedConjugateGradient<_MatrixType,_UpLo,_Preconditioner> >
+{
+  typedef IterativeSolverBase<PipelinedConjugateGradient> Base;
+  using Base::mp_matrix;
+  using Base::m_error;
+  using Base::m_iterations;
+  using Base::m_info;
+  using Base::m_isInitialized;
+public:
+  typedef _MatrixType MatrixType;
+  typedef typename MatrixType::Scalar Scalar;
+  typedef typename MatrixType::Index Index;
+  typedef typename MatrixType::RealScalar RealScalar;
+  typedef _Preconditioner Preconditioner;
+
+  enum {
+    UpLo = _UpLo
+  };
+
+public:
+
+  /** Default constructor. */
+  PipelinedConjugateGradient() : Base() {}
+
+  /** Initialize the solver with matrix \a A for further \c Ax=b solving.
+    *
+    * \warning this class stores a reference to the matrix A as well as some
+    * precomputed values that depend on it. Therefore, if \a A is changed
+    * this class becomes invalid. Call compute() to update it with the new
+    * matrix A, or modify a copy of A.
+    */
+  PipelinedConjugateGradient(const MatrixType& A) : Base(A) {}
+
+  ~PipelinedConjugateGradient() {}
+
+  /** \returns the solution x of \f$ A x = b \f$ using the current decomposition of A
+    * \a x0 as an initial solution.
+    *
+    * \sa compute()
+    */
+  template<typename Rhs,typename Guess>
+  inline const internal::solve_retval_with_guess<PipelinedConjugateGradient, Rhs, Guess>
+  solveWithGuess(const MatrixBase<Rhs>& b, const Guess& x0) const
+  {
+    eigen_assert(m_isInitialized && "PipelinedConjugateGradient is not initialized.");
+    eigen_assert(Base::rows()==b.rows()
+              && "PipelinedConjugateGradient::solve(): invalid number of rows of the right hand side matrix b");
+    return internal::solve_retval_with_guess
+            <PipelinedConjugateGradient, Rhs, Guess>(*this, b.derived(), x0);
+  }
+
+  /** \internal */
+  template<typename Rhs,typename Dest>
+  void _solveWithGuess(const Rhs& b, Dest& x) const
+  {
+    m_iterations = Base::maxIterations();
+    m_error = Base::m_tolerance;
+
+    for(int j=0; j<b.cols(); ++j)
+    {
+      m_iterations = Base::maxIterations();
+      m_error = Base::m_tolerance;
+
+      typename Dest::ColXpr xj(x,j);
+      internal::pipelined_conjugate_gradient(mp_matrix->template selfadjointView<UpLo>(), b.col(j), xj,
+                                             Base::m_preconditioner, m_iterations, m_error);
+    }
+
+    m_isInitialized = true;
+    m_info = m_error <= Base::m_tolerance ? Success : NoConvergence;
+  }
+
+  /** \internal */
+  template<typename Rhs,typename Dest>
+  void _solve(const Rhs& b, Dest& x) const
+  {
+    x.setOnes();
+    _solveWithGuess(b,x);
+  }
+
+protected:
+
+};
+
+
+namespace internal {
+
+template<typename _MatrixType, int _UpLo, typename _Preconditioner, typename Rhs>
+struct solve_retval<PipelinedConjugateGradient<_MatrixType,_UpLo,_Preconditioner>, Rhs>
+  : solve_retval_base<PipelinedConjugateGradient<_MatrixType,_UpLo,_Preconditioner>, Rhs>
+{
+  typedef PipelinedConjugateGradient<_MatrixType,_UpLo,_Preconditioner> Dec;
+  EIGEN_MAKE_SOLVE_HELPERS(Dec,Rhs)
+
+  template<typename Dest> void evalTo(Dest& dst) const
+  {
+    dec()._solve(rhs(),dst);
+  }
+};
+
+}
+
+#endif // EIGEN_PIPELINED_CONJUGATE_GRADIENT_H
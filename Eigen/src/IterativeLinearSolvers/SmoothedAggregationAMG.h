@@ -0,0 +1,426 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef EIGEN_SMOOTHED_AGGREGATION_AMG_H
+#define EIGEN_SMOOTHED_AGGREGATION_AMG_H
+
+/** \ingroup IterativeLinearSolvers_Module
+  * \brief An algebraic multigrid preconditioner based on smoothed aggregation
+  *
+  * This preconditioner applies one V-cycle of an algebraic multigrid method. The hierarchy of
+  * coarse problems is built from the matrix only, following the smoothed aggregation method of
+  * Vanek, Mandel and Brezina:
+  *  - the unknowns are grouped into aggregates of strongly connected neighbors, where \c j is
+  *    strongly connected to \c i if \f$ |a_{ij}| \geq \theta \sqrt{|a_{ii} a_{jj}|} \f$,
+  *  - a tentative prolongator \c T interpolates a constant over each aggregate, and is smoothed
+  *    by one damped Jacobi step: \f$ P = (I - \frac{4}{3\rho} D^{-1} A) T \f$ where \f$ \rho \f$ is an
+  *    estimate of the spectral radius of \f$ D^{-1} A \f$,
+  *  - the coarse matrix is the Galerkin product \f$ P^* A P \f$.
+  *
+  * On each level the V-cycle uses a damped Jacobi smoother, and the coarsest level is solved by
+  * a dense LU factorization. Unlike for DiagonalPreconditioner or IncompleteLUT, the number of
+  * iterations of the Krylov solver is then nearly independent of the size of the problem
+  * for discretized elliptic operators, such as the Poisson equation.
+  *
+  * The V-cycle is selfadjoint positive definite when the matrix is, so that this preconditioner
+  * can be used with ConjugateGradient:
+  * \code
+  * ConjugateGradient<SparseMatrix<double>, Lower, SmoothedAggregationAMG<double, Lower> > cg(A);
+  * x = cg.solve(b);
+  * \endcode
+  *
+  * \tparam _Scalar the type of the scalar.
+  * \tparam _UpLo the triangular part of the matrix which is referenced. It can be Lower or Upper
+  *               for selfadjoint matrices of which only one half is stored, as with ConjugateGradient.
+  *               The default, Lower|Upper, uses the whole matrix.
+  *
+  * \sa class DiagonalPreconditioner, IncompleteLUT, ConjugateGradient
+  */
+template <typename _Scalar, int _UpLo = Lower|Upper>
+class SmoothedAggregationAMG
+{
+    typedef _Scalar Scalar;
+    typedef typename NumTraits<Scalar>::Real RealScalar;
+    typedef Matrix<Scalar,Dynamic,1> Vector;
+    typedef Matrix<Scalar,Dynamic,Dynamic> DenseMatrix;
+    typedef SparseMatrix<Scalar,ColMajor> SpMat;
+    typedef typename SpMat::Index Index;
+
+    struct Level
+    {
+      SpMat A;            // the operator of this level
+      SpMat P;            // the prolongator from the next level to this one
+      SpMat R;            // the restriction from this level to the next one, i.e., the adjoint of P
+      Vector invDiag;     // the inverse of the diagonal of A
+      RealScalar omega;   // the damping factor of the Jacobi smoother
+    };
+
+  public:
+    typedef Matrix<Scalar,Dynamic,Dynamic> MatrixType;
+
+    enum {
+      UpLo = _UpLo
+    };
+
+    SmoothedAggregationAMG()
+      : m_threshold(RealScalar(0.08)), m_coarseSize(256), m_maxLevels(10), m_sweeps(2),
+        m_isInitialized(false)
+    {}
+
+    template<typename MatrixType>
+    SmoothedAggregationAMG(const MatrixType& mat)
+      : m_threshold(RealScalar(0.08)), m_coarseSize(256), m_maxLevels(10), m_sweeps(2),
+        m_isInitialized(false)
+    {
+      compute(mat);
+    }
+
+    Index rows() const { return m_levels.empty() ? 0 : m_levels[0].A.rows(); }
+    Index cols() const { return m_levels.empty() ? 0 : m_levels[0].A.cols(); }
+
+    /** \returns the number of levels of the hierarchy, including the finest one */
+    Index levels() const { return Index(m_levels.size()); }
+
+    /** \returns the operator of the level \a l, level 0 being the input matrix */
+    const SpMat& levelMatrix(Index l) const { return m_levels[l].A; }
+
+    /** Sets the threshold \f$ \theta \f$ of the strength of connection test (default is 0.08) */
+    SmoothedAggregationAMG& setStrengthThreshold(RealScalar threshold) { m_threshold = threshold; return *this; }
+
+    /** Sets the size below which a level is not coarsened anymore, and solved by a dense LU factorization (default is 256) */
+    SmoothedAggregationAMG& setCoarseSize(Index size) { m_coarseSize = size; return *this; }
+
+    /** Sets the maximal number of levels of the hierarchy (default is 10) */
+    SmoothedAggregationAMG& setMaxLevels(Index levels) { eigen_assert(levels>0); m_maxLevels = levels; return *this; }
+
+    /** Sets the number of Jacobi sweeps before and after each coarse correction (default is 2) */
+    SmoothedAggregationAMG& setSmootherSweeps(int sweeps) { eigen_assert(sweeps>0); m_sweeps = sweeps; return *this; }
+
+    /** \brief Reports whether previous computation was successful.
+      *
+      * \returns \c Success if computation was succesful,
+      *          \c NumericalIssue if the coarsest problem is singular.
+      */
+    ComputationInfo info() const
+    {
+      eigen_assert(m_isInitialized && "SmoothedAggregationAMG is not initialized.");
+      return m_info;
+    }
+
+    template<typename MatrixType>
+    SmoothedAggregationAMG& analyzePattern(const MatrixType& )
+    {
+      return *this;
+    }
+
+    /** Builds the multigrid hierarchy of \a mat. Since the aggregates depend on the values of
+      * the matrix, the whole setup is performed here. */
+    template<typename MatrixType>
+    SmoothedAggregationAMG& factorize(const MatrixType& mat);
+
+    template<typename MatrixType>
+    SmoothedAggregationAMG& compute(const MatrixType& mat)
+    {
+      return factorize(mat);
+    }
+
+    template<typename Rhs, typename Dest>
+    void _solve(const Rhs& b, Dest& x) const
+    {
+      Vector xj(b.rows());
+      for(Index j=0; j<b.cols(); ++j)
+      {
+        vcycle(0, b.col(j), xj);
+        x.col(j) = xj;
+      }
+    }
+
+    template<typename Rhs> inline const internal::solve_retval<SmoothedAggregationAMG, Rhs>
+    solve(const MatrixBase<Rhs>& b) const
+    {
+      eigen_assert(m_isInitialized && "SmoothedAggregationAMG is not initialized.");
+      eigen_assert(cols()==b.rows()
+                && "SmoothedAggregationAMG::solve(): invalid number of rows of the right hand side matrix b");
+      return internal::solve_retval<SmoothedAggregationAMG, Rhs>(*this, b.derived());
+    }
+
+  protected:
+
+    Index aggregate(const SpMat& A, std::vector<Index>& agg) const;
+    RealScalar spectralRadius(const Level& level) const;
+    void vcycle(Index l, const Vector& b, Vector& x) const;
+
+    RealScalar m_threshold;
+    Index m_coarseSize;
+    Index m_maxLevels;
+    int m_sweeps;
+    std::vector<Level> m_levels;
+    PartialPivLU<DenseMatrix> m_coarseLU;
+    bool m_coarseDirect;
+    ComputationInfo m_info;
+    bool m_isInitialized;
+};
+
+/** \internal Groups the unknowns of \a A into aggregates of strongly connected neighbors.
+  * On output, \a agg holds the aggregate of each unknown, or -1 for the isolated unknowns
+  * which are left to the smoother. \returns the number of aggregates. */
+template<typename _Scalar, int _UpLo>
+typename SmoothedAggregationAMG<_Scalar,_UpLo>::Index
+SmoothedAggregationAMG<_Scalar,_UpLo>::aggregate(const SpMat& A, std::vector<Index>& agg) const
+{
+  using std::abs;
+  using std::sqrt;
+  const Index n = A.cols();
+  const Index Unaggregated = -1, Isolated = -2;
+
+  Matrix<RealScalar,Dynamic,1> absDiag(n);
+  for(Index j=0; j<n; ++j)
+    absDiag(j) = abs(A.coeff(j,j));
+
+  // the strong connections, stored in compressed column form
+  std::vector<Index> strongPtr(n+1), strong;
+  strong.reserve(A.nonZeros());
+  strongPtr[0] = 0;
+  for(Index j=0; j<n; ++j)
+  {
+    for(typename SpMat::InnerIterator it(A,j); it; ++it)
+      if(it.index()!=j && abs(it.value()) >= m_threshold * sqrt(absDiag(it.index())*absDiag(j)))
+        strong.push_back(it.index());
+    strongPtr[j+1] = Index(strong.size());
+  }
+
+  agg.assign(n, Unaggregated);
+  Index count = 0;
+
+  // phase 1: the unknowns whose strong neighborhood is free form a new aggregate with their neighbors
+  for(Index i=0; i<n; ++i)
+  {
+    if(agg[i]!=Unaggregated)
+      continue;
+    if(strongPtr[i]==strongPtr[i+1])
+    {
+      agg[i] = Isolated;
+      continue;
+    }
+    bool free = true;
+    for(Index k=strongPtr[i]; k<strongPtr[i+1] && free; ++k)
+      free = agg[strong[k]]==Unaggregated;
+    if(!free)
+      continue;
+    agg[i] = count;
+    for(Index k=strongPtr[i]; k<strongPtr[i+1]; ++k)
+      agg[strong[k]] = count;
+    ++count;
+  }
+
+  // phase 2: the remaining unknowns join an aggregate of phase 1 to which they are strongly connected
+  std::vector<Index> agg1(agg);
+  for(Index i=0; i<n; ++i)
+  {
+    if(agg1[i]!=Unaggregated)
+      continue;
+    for(Index k=strongPtr[i]; k<strongPtr[i+1]; ++k)
+      if(agg1[strong[k]]>=0)
+      {
+        agg[i] = agg1[strong[k]];
+        break;
+      }
+  }
+
+  // phase 3: the unknowns left form new aggregates with their free strong neighbors
+  for(Index i=0; i<n; ++i)
+  {
+    if(agg[i]!=Unaggregated)
+      continue;
+    agg[i] = count;
+    for(Index k=strongPtr[i]; k<strongPtr[i+1]; ++k)
+      if(agg[strong[k]]==Unaggregated)
+        agg[strong[k]] = count;
+    ++count;
+  }
+
+  for(Index i=0; i<n; ++i)
+    if(agg[i]==Isolated)
+      agg[i] = -1;
+  return count;
+}
+
+/** \internal \returns an estimate of the spectral radius of D^-1 A by a few power iterations */
+template<typename _Scalar, int _UpLo>
+typename SmoothedAggregationAMG<_Scalar,_UpLo>::RealScalar
+SmoothedAggregationAMG<_Scalar,_UpLo>::spectralRadius(const Level& level) const
+{
+  const Index n = level.A.cols();
+  // a deterministic start vector, such that the preconditioner does not depend on a random state
+  Vector v(n);
+  for(Index i=0; i<n; ++i)
+    v(i) = Scalar(RealScalar(1) + RealScalar((i*7919)%101)/RealScalar(101));
+  v.normalize();
+
+  RealScalar rho = 0;
+  Vector w(n);
+  for(int k=0; k<15; ++k)
+  {
+    w.noalias() = level.A * v;
+    w = level.invDiag.asDiagonal() * w;
+    rho = w.norm();
+    if(rho==RealScalar(0))
+      break;
+    v = w / rho;
+  }
+  return rho;
+}
+
+template<typename _Scalar, int _UpLo>
+template<typename _MatrixType>
+SmoothedAggregationAMG<_Scalar,_UpLo>& SmoothedAggregationAMG<_Scalar,_UpLo>::factorize(const _MatrixType& mat)
+{
+  using std::sqrt;
+  m_levels.clear();
+  m_levels.reserve(m_maxLevels);
+  m_levels.push_back(Level());
+  m_levels.back().A = mat.template selfadjointView<UpLo>();
+  m_levels.back().A.makeCompressed();
+  m_info = Success;
+
+  while(true)
+  {
+    Level& level = m_levels.back();
+    const SpMat& A = level.A;
+    const Index n = A.cols();
+
+    level.invDiag.resize(n);
+    for(Index j=0; j<n; ++j)
+    {
+      Scalar d = A.coeff(j,j);
+      level.invDiag(j) = d==Scalar(0) ? Scalar(0) : Scalar(1)/d;
+    }
+    RealScalar rho = spectralRadius(level);
+    level.omega = rho==RealScalar(0) ? RealScalar(1) : RealScalar(4)/(RealScalar(3)*rho);
+
+    if(n<=m_coarseSize || Index(m_levels.size())>=m_maxLevels)
+      break;
+
+    std::vector<Index> agg;
+    Index nbAggregates = aggregate(A, agg);
+    // stop when the coarsening stalls, e.g., on a diagonally dominant level
+    if(nbAggregates==0 || nbAggregates>=n)
+      break;
+
+    // tentative prolongator, with orthonormal columns
+    std::vector<Index> aggSize(nbAggregates, 0);
+    for(Index i=0; i<n; ++i)
+      if(agg[i]>=0)
+        ++aggSize[agg[i]];
+    std::vector<Triplet<Scalar,Index> > triplets;
+    triplets.reserve(n);
+    for(Index i=0; i<n; ++i)
+      if(agg[i]>=0)
+        triplets.push_back(Triplet<Scalar,Index>(i, agg[i], Scalar(RealScalar(1)/sqrt(RealScalar(aggSize[agg[i]])))));
+    SpMat T(n, nbAggregates);
+    T.setFromTriplets(triplets.begin(), triplets.end());
+
+    // smoothed prolongator, restriction, and Galerkin coarse operator
+    SpMat AT = A * T;
+    for(Index j=0; j<AT.outerSize(); ++j)
+      for(typename SpMat::InnerIterator it(AT,j); it; ++it)
+        it.valueRef() *= level.omega * level.invDiag(it.index());
+    level.P = T - AT;
+    level.R = level.P.adjoint();
+    SpMat AP = A * level.P;
+
+    Level coarse;
+    coarse.A = level.R * AP;
+    coarse.A.makeCompressed();
+    m_levels.push_back(coarse);
+  }
+
+  const SpMat& Ac = m_levels.back().A;
+  m_coarseDirect = Ac.cols() <= 4*m_coarseSize;
+  if(m_coarseDirect)
+  {
+    m_coarseLU.compute(DenseMatrix(Ac));
+    if(Ac.cols()>0 && m_coarseLU.matrixLU().diagonal().cwiseAbs().minCoeff()==RealScalar(0))
+      m_info = NumericalIssue;
+  }
+
+  m_isInitialized = true;
+  return *this;
+}
+
+/** \internal Applies the V-cycle of the level \a l to \a b, starting from x=0 */
+template<typename _Scalar, int _UpLo>
+void SmoothedAggregationAMG<_Scalar,_UpLo>::vcycle(Index l, const Vector& b, Vector& x) const
+{
+  const Level& level = m_levels[l];
+  const bool coarsest = l+1==Index(m_levels.size());
+
+  if(coarsest && m_coarseDirect)
+  {
+    x = m_coarseLU.solve(b);
+    return;
+  }
+
+  // pre-smoothing
+  Vector r(b.size());
+  x = level.omega * level.invDiag.cwiseProduct(b);
+  for(int k=1; k<m_sweeps; ++k)
+  {
+    r.noalias() = b - level.A * x;
+    x += level.omega * level.invDiag.cwiseProduct(r);
+  }
+
+  if(!coarsest)
+  {
+    // coarse grid correction
+    r.noalias() = b - level.A * x;
+    Vector bc = level.R * r, xc;
+    vcycle(l+1, bc, xc);
+    x.noalias() += level.P * xc;
+  }
+
+  // post-smoothing
+  for(int k=0; k<m_sweeps; ++k)
+  {
+    r.noalias() = b - level.A * x;
+    x += level.omega * level.invDiag.cwiseProduct(r);
+  }
+}
+
+namespace internal {
+
+template<typename _Scalar, int _UpLo, typename Rhs>
+struct solve_retval<SmoothedAggregationAMG<_Scalar,_UpLo>, Rhs>
+  : solve_retval_base<SmoothedAggregationAMG<_Scalar,_UpLo>, Rhs>
+{
+  typedef SmoothedAggregationAMG<_Scalar,_UpLo> Dec;
+  EIGEN_MAKE_SOLVE_HELPERS(Dec,Rhs)
+
+  template<typename Dest> void evalTo(Dest& dst) const
+  {
+    dec()._solve(rhs(),dst);
+  }
+};
+
+}
+
+#endif // EIGEN_SMOOTHED_AGGREGATION_AMG_H
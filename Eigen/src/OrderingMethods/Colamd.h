@@ -0,0 +1,169 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef EIGEN_COLAMD_H
+#define EIGEN_COLAMD_H
+
+namespace internal {
+
+/** \internal Column approximate minimum degree ordering of the rectangular matrix \a mat.
+  *
+  * The elimination of the columns is simulated on the structure of the rows, without forming \f$ A^T A \f$:
+  * eliminating a column merges all the rows having a nonzero in that column into a single new row, as the
+  * Householder reflections of a QR factorization do. The score of a column is the approximate external degree
+  * of COLAMD, i.e., the sum of the sizes of its rows minus one, which is an upper bound of its degree in
+  * \f$ A^T A \f$. Dense rows are ignored and dense columns are ordered last, as in COLAMD. Unlike the
+  * reference implementation of Davis et al., neither supercolumns nor aggressive absorption are detected.
+  */
+template<typename MatrixType, typename Index>
+void column_approximate_minimum_degree(const MatrixType& mat, PermutationMatrix<Dynamic,Dynamic,Index>& perm)
+{
+  using std::sqrt;
+  const Index m = mat.rows();
+  const Index n = mat.cols();
+  const Index denseRow = (std::max)(Index(16), Index(10*sqrt(double(n))));
+  const Index denseCol = (std::max)(Index(16), Index(10*sqrt(double(m))));
+
+  std::vector<std::vector<Index> > rowCols(m), colRows(n);
+  for(Index j=0; j<n; ++j)
+    for(typename MatrixType::InnerIterator it(mat,j); it; ++it)
+      rowCols[it.index()].push_back(j);
+
+  std::vector<char> rowAlive(m), colDone(n, 0);
+  for(Index i=0; i<m; ++i)
+  {
+    rowAlive[i] = Index(rowCols[i].size())<=denseRow;
+    if(rowAlive[i])
+      for(std::size_t k=0; k<rowCols[i].size(); ++k)
+        colRows[rowCols[i][k]].push_back(i);
+  }
+
+  std::vector<Index> order, denseCols;
+  order.reserve(n);
+  std::vector<Index> score(n), mark(n, -1);
+  typedef std::pair<Index,Index> Entry;
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry> > heap;
+  for(Index j=0; j<n; ++j)
+  {
+    if(Index(colRows[j].size())>denseCol)
+    {
+      colDone[j] = 1;
+      denseCols.push_back(j);
+      continue;
+    }
+    score[j] = 0;
+    for(std::size_t k=0; k<colRows[j].size(); ++k)
+      score[j] += Index(rowCols[colRows[j][k]].size())-1;
+    heap.push(Entry(score[j], j));
+  }
+
+  // the alive rows never contain an eliminated column, since all the rows of a column are merged when it is eliminated
+  std::vector<Index> newRow;
+  while(!heap.empty())
+  {
+    Entry top = heap.top();
+    heap.pop();
+    Index c = top.second;
+    if(colDone[c] || top.first!=score[c])
+      continue;
+    colDone[c] = 1;
+    order.push_back(c);
+
+    newRow.clear();
+    mark[c] = c;
+    for(std::size_t k=0; k<colRows[c].size(); ++k)
+    {
+      Index r = colRows[c][k];
+      if(!rowAlive[r])
+        continue;
+      rowAlive[r] = 0;
+      for(std::size_t q=0; q<rowCols[r].size(); ++q)
+      {
+        Index j = rowCols[r][q];
+        if(mark[j]!=c && !colDone[j])
+        {
+          mark[j] = c;
+          newRow.push_back(j);
+        }
+      }
+      std::vector<Index>().swap(rowCols[r]);
+    }
+    std::vector<Index>().swap(colRows[c]);
+    if(newRow.empty())
+      continue;
+
+    Index r = Index(rowCols.size());
+    rowCols.push_back(newRow);
+    rowAlive.push_back(1);
+    const Index remaining = n - Index(order.size());
+    for(std::size_t k=0; k<newRow.size(); ++k)
+    {
+      Index j = newRow[k];
+      std::vector<Index>& rows = colRows[j];
+      Index s = 0, count = 0;
+      for(std::size_t q=0; q<rows.size(); ++q)
+        if(rowAlive[rows[q]])
+        {
+          rows[count++] = rows[q];
+          s += Index(rowCols[rows[q]].size())-1;
+        }
+      rows.resize(count);
+      rows.push_back(r);
+      s += Index(newRow.size())-1;
+      score[j] = (std::min)(s, remaining);
+      heap.push(Entry(score[j], j));
+    }
+  }
+
+  order.insert(order.end(), denseCols.begin(), denseCols.end());
+  perm.resize(n);
+  for(Index k=0; k<n; ++k)
+    perm.indices()(k) = order[k];
+}
+
+}
+
+/** \ingroup OrderingMethods_Module
+  * \class COLAMDOrdering
+  * \brief Column approximate minimum degree ordering policy
+  *
+  * Computes a fill-reducing ordering of the columns of a rectangular matrix A without forming the pattern of
+  * \f$ A^T A \f$ (see internal::column_approximate_minimum_degree()). It is meant for the sparse QR and LU
+  * factorizations, e.g., SparseQR<SparseMatrix<double>, COLAMDOrdering<int> >.
+  *
+  * \sa class AMDOrdering
+  */
+template<typename Index>
+class COLAMDOrdering
+{
+  public:
+    typedef PermutationMatrix<Dynamic,Dynamic,Index> PermutationType;
+    enum { ColumnOrdering = 1 };
+
+    template<typename MatrixType>
+    void operator()(const MatrixType& mat, PermutationType& perm) const
+    {
+      internal::column_approximate_minimum_degree(mat, perm);
+    }
+};
+
+#endif // EIGEN_COLAMD_H
@@ -0,0 +1,114 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef EIGEN_ORDERING_H
+#define EIGEN_ORDERING_H
+
+/** \ingroup OrderingMethods_Module
+  * \class AMDOrdering
+  * \brief Approximate minimum degree ordering policy
+  *
+  * Computes the fill-reducing ordering of internal::minimum_degree_ordering(). The pattern of the input matrix
+  * must be symmetric, but the diagonal entries are optional. This is the default ordering of SimplicialLLT,
+  * SimplicialLDLT and SparseQR (where it is applied to the pattern of \f$ A^T A \f$).
+  *
+  * An ordering policy is a functor computing the permutation \c perm such that \c perm.indices()[k]
+  * is the index of the k-th eliminated column. Its \c ColumnOrdering enum tells whether it orders the
+  * columns of a rectangular matrix directly (as COLAMDOrdering), or whether it requires a symmetric pattern.
+  *
+  * \sa class NaturalOrdering, class NestedDissectionOrdering, class COLAMDOrdering
+  */
+template<typename Index>
+class AMDOrdering
+{
+  public:
+    typedef PermutationMatrix<Dynamic,Dynamic,Index> PermutationType;
+    enum { ColumnOrdering = 0 };
+
+    template<typename MatrixType>
+    void operator()(const MatrixType& mat, PermutationType& perm) const
+    {
+      // minimum_degree_ordering() overwrites the pattern
+      SparseMatrix<typename MatrixType::Scalar,ColMajor,Index> C = mat;
+      run(C, perm);
+    }
+
+    /** \internal Same as operator()(), but the pattern of \a mat is overwritten */
+    template<typename Scalar>
+    static void run(SparseMatrix<Scalar,ColMajor,Index>& mat, PermutationType& perm)
+    {
+      const Index n = mat.cols();
+      mat.prune(keep_off_diagonal());
+      internal::minimum_degree_ordering(mat, perm);
+      if(perm.size()!=n)
+        perm.setIdentity(n);
+    }
+
+  protected:
+    struct keep_off_diagonal {
+      template<typename Scalar>
+      inline bool operator() (const Index& row, const Index& col, const Scalar&) const
+      {
+        return row!=col;
+      }
+    };
+};
+
+namespace internal {
+
+/** \internal Computes with \a ordering the permutation \a perm of the temporary symmetric pattern \a mat,
+  * which is not used anymore afterwards. AMDOrdering thus works directly on \a mat instead of on a copy. */
+template<typename OrderingType, typename MatrixType>
+void order_temporary_pattern(const OrderingType& ordering, MatrixType& mat, typename OrderingType::PermutationType& perm)
+{
+  ordering(mat, perm);
+}
+
+template<typename Index, typename Scalar>
+void order_temporary_pattern(const AMDOrdering<Index>&, SparseMatrix<Scalar,ColMajor,Index>& mat, PermutationMatrix<Dynamic,Dynamic,Index>& perm)
+{
+  AMDOrdering<Index>::run(mat, perm);
+}
+
+} // end namespace internal
+
+/** \ingroup OrderingMethods_Module
+  * \class NaturalOrdering
+  * \brief Ordering policy keeping the natural ordering of the columns
+  *
+  * \sa class AMDOrdering
+  */
+template<typename Index>
+class NaturalOrdering
+{
+  public:
+    typedef PermutationMatrix<Dynamic,Dynamic,Index> PermutationType;
+    enum { ColumnOrdering = 1 };
+
+    template<typename MatrixType>
+    void operator()(const MatrixType& mat, PermutationType& perm) const
+    {
+      perm.setIdentity(mat.cols());
+    }
+};
+
+#endif // EIGEN_ORDERING_H
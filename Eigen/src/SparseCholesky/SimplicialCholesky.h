@@ -85,22 +85,24 @@ class SimplicialCholeskyBase
 {
   public:
     typedef typename internal::traits<Derived>::MatrixType MatrixType;
+    typedef typename internal::traits<Derived>::OrderingType OrderingType;
     enum { UpLo = internal::traits<Derived>::UpLo };
     typedef typename MatrixType::Scalar Scalar;
     typedef typename MatrixType::RealScalar RealScalar;
     typedef typename MatrixType::Index Index;
-    typedef SparseMatrix<Scalar,ColMajor,Index> CholMatrixType;
+    typedef typename MatrixType::InnerIndex InnerIndex;
+    typedef SparseMatrix<Scalar,ColMajor,Index,InnerIndex> CholMatrixType;
     typedef Matrix<Scalar,Dynamic,1> VectorType;
 
   public:
 
     /** Default constructor */
     SimplicialCholeskyBase()
-      : m_info(Success), m_isInitialized(false), m_shiftOffset(0), m_shiftScale(1)
+      : m_info(Success), m_isInitialized(false), m_scheduleIsOk(false), m_supernodesIsOk(false), m_shiftOffset(0), m_shiftScale(1)
     {}
 
     SimplicialCholeskyBase(const MatrixType& matrix)
-      : m_info(Success), m_isInitialized(false), m_shiftOffset(0), m_shiftScale(1)
+      : m_info(Success), m_isInitialized(false), m_scheduleIsOk(false), m_supernodesIsOk(false), m_shiftOffset(0), m_shiftScale(1)
     {
       compute(matrix);
     }
@@ -218,14 +220,31 @@ class SimplicialCholeskyBase
       else
         dest = b;
 
+      analyzeSupernodes(dest.cols());
+      analyzeSchedules(dest.cols());
+
       if(m_matrix.nonZeros()>0) // otherwise L==I
-        derived().matrixL().solveInPlace(dest);
+      {
+        if(dest.cols()>=EIGEN_SPARSE_SUPERNODE_MIN_RHS && m_supernodesIsOk)
+          m_supernodesL.solveInPlace(m_matrix, dest);
+        else if(m_scheduleIsOk)
+          m_scheduleL.solveInPlace(m_matrix, dest);
+        else
+          derived().matrixL().solveInPlace(dest);
+      }
 
       if(m_diag.size()>0)
         dest = m_diag.asDiagonal().inverse() * dest;
 
       if (m_matrix.nonZeros()>0) // otherwise I==I
-        derived().matrixU().solveInPlace(dest);
+      {
+        if(dest.cols()>=EIGEN_SPARSE_SUPERNODE_MIN_RHS && m_supernodesIsOk)
+          m_supernodesU.solveInPlace(m_matrix, dest);
+        else if(m_scheduleIsOk)
+          m_scheduleU.solveInPlace(m_matrix, dest);
+        else
+          derived().matrixU().solveInPlace(dest);
+      }
 
       if(m_P.size()>0)
         dest = m_P * dest;
@@ -238,8 +257,9 @@ class SimplicialCholeskyBase
       eigen_assert(m_factorizationIsOk && "The decomposition is not in a valid state for solving, you must first call either compute() or symbolic()/numeric()");
       eigen_assert(m_matrix.rows()==b.rows());
       
-      // we process the sparse rhs per block of NbColsAtOnce columns temporarily stored into a dense matrix.
-      static const int NbColsAtOnce = 4;
+      // we process the sparse rhs per block of NbColsAtOnce columns temporarily stored into a dense matrix,
+      // which are solved at once by the blocked triangular solves.
+      static const int NbColsAtOnce = 32;
       int rhsCols = b.cols();
       int size = b.rows();
       Eigen::Matrix<DestScalar,Dynamic,Dynamic> tmp(size,rhsCols);
@@ -261,13 +281,49 @@ class SimplicialCholeskyBase
 
     void analyzePattern(const MatrixType& a, bool doLDLT);
 
-    /** keeps off-diagonal entries; drops diagonal entries */
-    struct keep_diag {
-      inline bool operator() (const Index& row, const Index& col, const Scalar&) const
+    /** \internal Detects the supernodes of the triangular factors the first time a solve
+      * has enough right hand sides to use the blocked solves */
+    void analyzeSupernodes(Index rhsCols) const
+    {
+      if(m_supernodesIsOk || m_matrix.nonZeros()==0 || rhsCols<EIGEN_SPARSE_SUPERNODE_MIN_RHS)
+        return;
+      if(m_diag.size()>0)
       {
-        return row!=col;
+        m_supernodesL.template analyze<UnitLower>(m_matrix);
+        m_supernodesU.template analyzeAdjoint<UnitUpper>(m_matrix);
       }
-    };
+      else
+      {
+        m_supernodesL.template analyze<Lower>(m_matrix);
+        m_supernodesU.template analyzeAdjoint<Upper>(m_matrix);
+      }
+      m_supernodesIsOk = true;
+    }
+
+    /** \internal Computes the level schedules of the triangular factors the first time a solve
+      * with \a rhsCols right hand sides is multithreaded */
+    void analyzeSchedules(Index rhsCols) const
+    {
+#ifdef EIGEN_HAS_OPENMP
+      // the blocked solves are used for many right hand sides
+      if(m_scheduleIsOk || m_matrix.nonZeros()==0 || rhsCols>=EIGEN_SPARSE_SUPERNODE_MIN_RHS
+         || internal::sparse_parallel_threads(std::ptrdiff_t(m_matrix.nonZeros() + m_matrix.rows()) * rhsCols)==1)
+        return;
+      if(m_diag.size()>0)
+      {
+        m_scheduleL.template analyze<UnitLower>(m_matrix);
+        m_scheduleU.template analyzeAdjoint<UnitUpper>(m_matrix);
+      }
+      else
+      {
+        m_scheduleL.template analyze<Lower>(m_matrix);
+        m_scheduleU.template analyzeAdjoint<Upper>(m_matrix);
+      }
+      m_scheduleIsOk = true;
+#else
+      EIGEN_UNUSED_VARIABLE(rhsCols);
+#endif
+    }
 
     mutable ComputationInfo m_info;
     bool m_isInitialized;
@@ -276,6 +332,12 @@ class SimplicialCholeskyBase
     
     CholMatrixType m_matrix;
     VectorType m_diag;                                // the diagonal coefficients (LDLT mode)
+    mutable SparseTriangularSchedule<CholMatrixType> m_scheduleL; // level schedules of the triangular solves,
+    mutable SparseTriangularSchedule<CholMatrixType> m_scheduleU; // computed by the first multithreaded solve
+    mutable bool m_scheduleIsOk;
+    mutable SparseSupernodalTriangularSolver<CholMatrixType> m_supernodesL; // blocked triangular solves for multiple right hand sides,
+    mutable SparseSupernodalTriangularSolver<CholMatrixType> m_supernodesU; // computed by the first solve using them
+    mutable bool m_supernodesIsOk;
     VectorXi m_parent;                                // elimination tree
     VectorXi m_nonZerosPerCol;
     PermutationMatrix<Dynamic,Dynamic,Index> m_P;     // the permutation
@@ -285,41 +347,47 @@ class SimplicialCholeskyBase
     RealScalar m_shiftScale;
 };
 
-template<typename _MatrixType, int _UpLo = Lower> class SimplicialLLT;
-template<typename _MatrixType, int _UpLo = Lower> class SimplicialLDLT;
-template<typename _MatrixType, int _UpLo = Lower> class SimplicialCholesky;
+template<typename _MatrixType, int _UpLo = Lower,
+         typename _Ordering = AMDOrdering<typename _MatrixType::Index> > class SimplicialLLT;
+template<typename _MatrixType, int _UpLo = Lower,
+         typename _Ordering = AMDOrdering<typename _MatrixType::Index> > class SimplicialLDLT;
+template<typename _MatrixType, int _UpLo = Lower,
+         typename _Ordering = AMDOrdering<typename _MatrixType::Index> > class SimplicialCholesky;
 
 namespace internal {
 
-template<typename _MatrixType, int _UpLo> struct traits<SimplicialLLT<_MatrixType,_UpLo> >
+template<typename _MatrixType, int _UpLo, typename _Ordering> struct traits<SimplicialLLT<_MatrixType,_UpLo,_Ordering> >
 {
   typedef _MatrixType MatrixType;
+  typedef _Ordering OrderingType;
   enum { UpLo = _UpLo };
   typedef typename MatrixType::Scalar                         Scalar;
   typedef typename MatrixType::Index                          Index;
-  typedef SparseMatrix<Scalar, ColMajor, Index>               CholMatrixType;
+  typedef SparseMatrix<Scalar, ColMajor, Index, typename MatrixType::InnerIndex> CholMatrixType;
   typedef SparseTriangularView<CholMatrixType, Eigen::Lower>  MatrixL;
   typedef SparseTriangularView<typename CholMatrixType::AdjointReturnType, Eigen::Upper>   MatrixU;
-  static inline MatrixL getL(const MatrixType& m) { return m; }
-  static inline MatrixU getU(const MatrixType& m) { return m.adjoint(); }
+  static inline MatrixL getL(const CholMatrixType& m) { return m; }
+  static inline MatrixU getU(const CholMatrixType& m) { return m.adjoint(); }
 };
 
-template<typename _MatrixType,int _UpLo> struct traits<SimplicialLDLT<_MatrixType,_UpLo> >
+template<typename _MatrixType, int _UpLo, typename _Ordering> struct traits<SimplicialLDLT<_MatrixType,_UpLo,_Ordering> >
 {
   typedef _MatrixType MatrixType;
+  typedef _Ordering OrderingType;
   enum { UpLo = _UpLo };
   typedef typename MatrixType::Scalar                             Scalar;
   typedef typename MatrixType::Index                              Index;
-  typedef SparseMatrix<Scalar, ColMajor, Index>                   CholMatrixType;
+  typedef SparseMatrix<Scalar, ColMajor, Index, typename MatrixType::InnerIndex> CholMatrixType;
   typedef SparseTriangularView<CholMatrixType, Eigen::UnitLower>  MatrixL;
   typedef SparseTriangularView<typename CholMatrixType::AdjointReturnType, Eigen::UnitUpper> MatrixU;
-  static inline MatrixL getL(const MatrixType& m) { return m; }
-  static inline MatrixU getU(const MatrixType& m) { return m.adjoint(); }
+  static inline MatrixL getL(const CholMatrixType& m) { return m; }
+  static inline MatrixU getU(const CholMatrixType& m) { return m.adjoint(); }
 };
 
-template<typename _MatrixType, int _UpLo> struct traits<SimplicialCholesky<_MatrixType,_UpLo> >
+template<typename _MatrixType, int _UpLo, typename _Ordering> struct traits<SimplicialCholesky<_MatrixType,_UpLo,_Ordering> >
 {
   typedef _MatrixType MatrixType;
+  typedef _Ordering OrderingType;
   enum { UpLo = _UpLo };
 };
 
@@ -336,20 +404,24 @@ template<typename _MatrixType, int _UpLo> struct traits<SimplicialCholesky<_Matr
   * \tparam _MatrixType the type of the sparse matrix A, it must be a SparseMatrix<>
   * \tparam _UpLo the triangular part that will be used for the computations. It can be Lower
   *               or Upper. Default is Lower.
+  * \tparam _Ordering the fill-reducing ordering policy, e.g., AMDOrdering (default), NestedDissectionOrdering,
+  *                   or NaturalOrdering.
   *
   * \sa class SimplicialLDLT
   */
-template<typename _MatrixType, int _UpLo>
-    class SimplicialLLT : public SimplicialCholeskyBase<SimplicialLLT<_MatrixType,_UpLo> >
+template<typename _MatrixType, int _UpLo, typename _Ordering>
+    class SimplicialLLT : public SimplicialCholeskyBase<SimplicialLLT<_MatrixType,_UpLo,_Ordering> >
 {
 public:
     typedef _MatrixType MatrixType;
+    typedef _Ordering OrderingType;
     enum { UpLo = _UpLo };
     typedef SimplicialCholeskyBase<SimplicialLLT> Base;
     typedef typename MatrixType::Scalar Scalar;
     typedef typename MatrixType::RealScalar RealScalar;
     typedef typename MatrixType::Index Index;
-    typedef SparseMatrix<Scalar,ColMajor,Index> CholMatrixType;
+    typedef typename MatrixType::InnerIndex InnerIndex;
+    typedef SparseMatrix<Scalar,ColMajor,Index,InnerIndex> CholMatrixType;
     typedef Matrix<Scalar,Dynamic,1> VectorType;
     typedef internal::traits<SimplicialLLT> Traits;
     typedef typename Traits::MatrixL  MatrixL;
@@ -414,20 +486,24 @@ public:
   * \tparam _MatrixType the type of the sparse matrix A, it must be a SparseMatrix<>
   * \tparam _UpLo the triangular part that will be used for the computations. It can be Lower
   *               or Upper. Default is Lower.
+  * \tparam _Ordering the fill-reducing ordering policy, e.g., AMDOrdering (default), NestedDissectionOrdering,
+  *                   or NaturalOrdering.
   *
   * \sa class SimplicialLLT
   */
-template<typename _MatrixType, int _UpLo>
-    class SimplicialLDLT : public SimplicialCholeskyBase<SimplicialLDLT<_MatrixType,_UpLo> >
+template<typename _MatrixType, int _UpLo, typename _Ordering>
+    class SimplicialLDLT : public SimplicialCholeskyBase<SimplicialLDLT<_MatrixType,_UpLo,_Ordering> >
 {
 public:
     typedef _MatrixType MatrixType;
+    typedef _Ordering OrderingType;
     enum { UpLo = _UpLo };
     typedef SimplicialCholeskyBase<SimplicialLDLT> Base;
     typedef typename MatrixType::Scalar Scalar;
     typedef typename MatrixType::RealScalar RealScalar;
     typedef typename MatrixType::Index Index;
-    typedef SparseMatrix<Scalar,ColMajor,Index> CholMatrixType;
+    typedef typename MatrixType::InnerIndex InnerIndex;
+    typedef SparseMatrix<Scalar,ColMajor,Index,InnerIndex> CholMatrixType;
     typedef Matrix<Scalar,Dynamic,1> VectorType;
     typedef internal::traits<SimplicialLDLT> Traits;
     typedef typename Traits::MatrixL  MatrixL;
@@ -492,21 +568,23 @@ public:
   *
   * \sa class SimplicialLDLT, class SimplicialLLT
   */
-template<typename _MatrixType, int _UpLo>
-    class SimplicialCholesky : public SimplicialCholeskyBase<SimplicialCholesky<_MatrixType,_UpLo> >
+template<typename _MatrixType, int _UpLo, typename _Ordering>
+    class SimplicialCholesky : public SimplicialCholeskyBase<SimplicialCholesky<_MatrixType,_UpLo,_Ordering> >
 {
 public:
     typedef _MatrixType MatrixType;
+    typedef _Ordering OrderingType;
     enum { UpLo = _UpLo };
     typedef SimplicialCholeskyBase<SimplicialCholesky> Base;
     typedef typename MatrixType::Scalar Scalar;
     typedef typename MatrixType::RealScalar RealScalar;
     typedef typename MatrixType::Index Index;
-    typedef SparseMatrix<Scalar,ColMajor,Index> CholMatrixType;
+    typedef typename MatrixType::InnerIndex InnerIndex;
+    typedef SparseMatrix<Scalar,ColMajor,Index,InnerIndex> CholMatrixType;
     typedef Matrix<Scalar,Dynamic,1> VectorType;
     typedef internal::traits<SimplicialCholesky> Traits;
-    typedef internal::traits<SimplicialLDLT<MatrixType,UpLo> > LDLTTraits;
-    typedef internal::traits<SimplicialLLT<MatrixType,UpLo>  > LLTTraits;
+    typedef internal::traits<SimplicialLDLT<MatrixType,UpLo,OrderingType> > LDLTTraits;
+    typedef internal::traits<SimplicialLLT<MatrixType,UpLo,OrderingType>  > LLTTraits;
   public:
     SimplicialCholesky() : Base(), m_LDLT(true) {}
 
@@ -582,7 +660,14 @@ public:
       else
         dest = b;
 
-      if(Base::m_matrix.nonZeros()>0) // otherwise L==I
+      Base::analyzeSupernodes(dest.cols());
+      Base::analyzeSchedules(dest.cols());
+
+      if(Base::m_matrix.nonZeros()>0 && dest.cols()>=EIGEN_SPARSE_SUPERNODE_MIN_RHS && Base::m_supernodesIsOk)
+        Base::m_supernodesL.solveInPlace(Base::m_matrix, dest);
+      else if(Base::m_matrix.nonZeros()>0 && Base::m_scheduleIsOk)
+        Base::m_scheduleL.solveInPlace(Base::m_matrix, dest);
+      else if(Base::m_matrix.nonZeros()>0) // otherwise L==I
       {
         if(m_LDLT)
           LDLTTraits::getL(Base::m_matrix).solveInPlace(dest);
@@ -593,7 +678,11 @@ public:
       if(Base::m_diag.size()>0)
         dest = Base::m_diag.asDiagonal().inverse() * dest;
 
-      if (Base::m_matrix.nonZeros()>0) // otherwise I==I
+      if(Base::m_matrix.nonZeros()>0 && dest.cols()>=EIGEN_SPARSE_SUPERNODE_MIN_RHS && Base::m_supernodesIsOk)
+        Base::m_supernodesU.solveInPlace(Base::m_matrix, dest);
+      else if(Base::m_matrix.nonZeros()>0 && Base::m_scheduleIsOk)
+        Base::m_scheduleU.solveInPlace(Base::m_matrix, dest);
+      else if (Base::m_matrix.nonZeros()>0) // otherwise I==I
       {
         if(m_LDLT)
           LDLTTraits::getU(Base::m_matrix).solveInPlace(dest);
@@ -633,13 +722,11 @@ void SimplicialCholeskyBase<Derived>::analyzePattern(const MatrixType& a, bool d
   
   ei_declare_aligned_stack_constructed_variable(Index, tags, size, 0);
   
-  // TODO allows to configure the permutation
+  // the fill-reducing ordering of the full selfadjoint pattern
   {
     CholMatrixType C;
     C = a.template selfadjointView<UpLo>();
-    // remove diagonal entries:
-    C.prune(keep_diag());
-    internal::minimum_degree_ordering(C, m_P);
+    internal::order_temporary_pattern(OrderingType(), C, m_P);
   }
   
   if(m_P.size()>0)
@@ -647,7 +734,7 @@ void SimplicialCholeskyBase<Derived>::analyzePattern(const MatrixType& a, bool d
   else
     m_Pinv.resize(0);
   
-  SparseMatrix<Scalar,ColMajor,Index> ap(size,size);
+  CholMatrixType ap(size,size);
   ap.template selfadjointView<Upper>() = a.template selfadjointView<UpLo>().twistedBy(m_Pinv);
   
   for(Index k = 0; k < size; ++k)
@@ -700,14 +787,14 @@ void SimplicialCholeskyBase<Derived>::factorize(const MatrixType& a)
   eigen_assert(m_nonZerosPerCol.size()==size);
 
   const Index* Lp = m_matrix.outerIndexPtr();
-  Index* Li = m_matrix.innerIndexPtr();
+  InnerIndex* Li = m_matrix.innerIndexPtr();
   Scalar* Lx = m_matrix.valuePtr();
 
   ei_declare_aligned_stack_constructed_variable(Scalar, y, size, 0);
   ei_declare_aligned_stack_constructed_variable(Index,  pattern, size, 0);
   ei_declare_aligned_stack_constructed_variable(Index,  tags, size, 0);
 
-  SparseMatrix<Scalar,ColMajor,Index> ap(size,size);
+  CholMatrixType ap(size,size);
   ap.template selfadjointView<Upper>() = a.template selfadjointView<UpLo>().twistedBy(m_Pinv);
   
   bool ok = true;
@@ -720,7 +807,7 @@ void SimplicialCholeskyBase<Derived>::factorize(const MatrixType& a)
     Index top = size;               // stack for pattern is empty
     tags[k] = k;                    // mark node k as visited
     m_nonZerosPerCol[k] = 0;        // count of nonzeros in column k of L
-    for(typename MatrixType::InnerIterator it(ap,k); it; ++it)
+    for(typename CholMatrixType::InnerIterator it(ap,k); it; ++it)
     {
       Index i = it.index();
       if(i <= k)
@@ -759,7 +846,7 @@ void SimplicialCholeskyBase<Derived>::factorize(const MatrixType& a)
       for(p = Lp[i] + (DoLDLT ? 0 : 1); p < p2; ++p)
         y[Li[p]] -= internal::conj(Lx[p]) * yi;
       d -= internal::real(l_ki * internal::conj(yi));
-      Li[p] = k;                          /* store L(k,i) in column form of L */
+      Li[p] = InnerIndex(k);              /* store L(k,i) in column form of L */
       Lx[p] = l_ki;
       ++m_nonZerosPerCol[i];              /* increment count of nonzeros in col i */
     }
@@ -775,7 +862,7 @@ void SimplicialCholeskyBase<Derived>::factorize(const MatrixType& a)
     else
     {
       Index p = Lp[k] + m_nonZerosPerCol[k]++;
-      Li[p] = k ;                /* store L(k,k) = sqrt (d) in column k */
+      Li[p] = InnerIndex(k);     /* store L(k,k) = sqrt (d) in column k */
       if(d <= RealScalar(0)) {
         ok = false;              /* failure, matrix is not positive definite */
         break;
@@ -786,6 +873,10 @@ void SimplicialCholeskyBase<Derived>::factorize(const MatrixType& a)
 
   m_info = ok ? Success : NumericalIssue;
   m_factorizationIsOk = true;
+
+  // the supernodes and the level schedules are computed again by the next solves using them
+  m_supernodesIsOk = false;
+  m_scheduleIsOk = false;
 }
 
 namespace internal {
@@ -0,0 +1,522 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef EIGEN_BLOCKSPARSEMATRIX_H
+#define EIGEN_BLOCKSPARSEMATRIX_H
+
+namespace internal {
+
+template<typename _Scalar, int _BlockSize, typename _Index>
+struct traits<BlockSparseMatrix<_Scalar,_BlockSize,_Index> >
+{
+  typedef _Scalar Scalar;
+  typedef _Index Index;
+  typedef Sparse StorageKind;
+  typedef MatrixXpr XprKind;
+  enum {
+    RowsAtCompileTime = Dynamic,
+    ColsAtCompileTime = Dynamic,
+    MaxRowsAtCompileTime = Dynamic,
+    MaxColsAtCompileTime = Dynamic,
+    Flags = RowMajorBit | NestByRefBit,
+    CoeffReadCost = NumTraits<Scalar>::ReadCost,
+    SupportedAccessPatterns = InnerRandomAccessPattern
+  };
+};
+
+template<typename MatrixType, int UpLo>
+struct traits<BlockSparseSelfAdjointView<MatrixType,UpLo> > : traits<MatrixType> {};
+
+template<typename Lhs, typename Rhs, int UpLo>
+struct traits<BlockSparseTimeDenseProduct<Lhs,Rhs,UpLo> >
+ : traits<ProductBase<BlockSparseTimeDenseProduct<Lhs,Rhs,UpLo>, Lhs, Rhs> >
+{
+  typedef Dense StorageKind;
+  typedef MatrixXpr XprKind;
+};
+
+} // end namespace internal
+
+/** \ingroup SparseCore_Module
+  * \class BlockSparseMatrix
+  * \brief A sparse matrix made of dense blocks of fixed size, stored in the blocked CSR (BSR) format
+  *
+  * The matrix is partitioned into square blocks of size \a _BlockSize x \a _BlockSize. Only the nonzero blocks are
+  * stored, row of blocks per row of blocks, and each of them is stored as a dense column major block. Therefore a
+  * single index is stored per block, instead of one per nonzero as in SparseMatrix, and the products with dense
+  * vectors and matrices are computed with fixed size dense kernels. This is the natural format of the matrices
+  * arising from finite elements having several degrees of freedom per node.
+  *
+  * A BlockSparseMatrix is built from a SparseMatrix having dimensions multiple of the block size. It supports the
+  * products with dense vectors and matrices, the transposition, and the selfadjoint products of its lower or upper
+  * triangular part. It can be used as the matrix type of ConjugateGradient and BiCGSTAB, with the
+  * DiagonalPreconditioner or the IdentityPreconditioner:
+  * \code
+  * SparseMatrix<double> A = ...; // 3 unknowns per node
+  * BlockSparseMatrix<double,3> bA(A);
+  * ConjugateGradient<BlockSparseMatrix<double,3>, Lower|Upper> cg(bA);
+  * x = cg.solve(b);
+  * \endcode
+  *
+  * \tparam _Scalar the scalar type, i.e. the type of the coefficients
+  * \tparam _BlockSize the number of rows and columns of the blocks
+  * \tparam _Index the type of the indices. It has to be a \b signed type (e.g., short, int, std::ptrdiff_t). Default is \c int.
+  *
+  * \sa class SparseMatrix
+  */
+template<typename _Scalar, int _BlockSize, typename _Index>
+class BlockSparseMatrix : public EigenBase<BlockSparseMatrix<_Scalar,_BlockSize,_Index> >
+{
+  public:
+    typedef _Scalar Scalar;
+    typedef _Index Index;
+    typedef typename NumTraits<Scalar>::Real RealScalar;
+    typedef const BlockSparseMatrix& Nested;
+    typedef BlockSparseMatrix PlainObject;
+    typedef Matrix<Scalar,_BlockSize,_BlockSize> BlockType;
+    typedef Matrix<Index,Dynamic,1> IndexVector;
+    typedef Matrix<Scalar,Dynamic,1> ScalarVector;
+    enum {
+      BlockSize = _BlockSize,
+      Flags = internal::traits<BlockSparseMatrix>::Flags,
+      IsRowMajor = 1,
+      IsVectorAtCompileTime = 0,
+      RowsAtCompileTime = Dynamic,
+      ColsAtCompileTime = Dynamic,
+      MaxRowsAtCompileTime = Dynamic,
+      MaxColsAtCompileTime = Dynamic
+    };
+
+    class InnerIterator;
+
+    /** Default constructor yielding an empty \c 0 \c x \c 0 matrix */
+    BlockSparseMatrix() : m_rows(0), m_cols(0), m_outerIndex(IndexVector::Zero(1)) {}
+
+    /** Constructs a \a rows \c x \a cols matrix without any nonzero block */
+    BlockSparseMatrix(Index rows, Index cols) { resize(rows, cols); }
+
+    /** Constructs a block sparse matrix from the sparse matrix \a other */
+    template<typename OtherDerived>
+    BlockSparseMatrix(const SparseMatrixBase<OtherDerived>& other)
+    {
+      *this = other.derived();
+    }
+
+    /** Copies the nonzero coefficients of the sparse matrix \a other into the blocks covering them.
+      * The dimensions of \a other must be multiple of the block size. */
+    template<typename OtherDerived>
+    BlockSparseMatrix& operator=(const SparseMatrixBase<OtherDerived>& other);
+
+    /** Resizes to a \a rows \c x \a cols matrix without any nonzero block */
+    void resize(Index rows, Index cols)
+    {
+      eigen_assert(rows%BlockSize==0 && cols%BlockSize==0 && "the dimensions must be multiple of the block size");
+      m_rows = rows;
+      m_cols = cols;
+      m_outerIndex.setZero(rows/BlockSize+1);
+      m_innerIndex.resize(0);
+      m_values.resize(0);
+    }
+
+    inline Index rows() const { return m_rows; }
+    inline Index cols() const { return m_cols; }
+    /** \returns the number of rows, i.e., the number of inner vectors visited by InnerIterator */
+    inline Index outerSize() const { return m_rows; }
+    /** \returns the number of rows of blocks */
+    inline Index blockRows() const { return m_rows/BlockSize; }
+    /** \returns the number of columns of blocks */
+    inline Index blockCols() const { return m_cols/BlockSize; }
+    /** \returns the number of stored blocks */
+    inline Index nonZeroBlocks() const { return m_outerIndex(blockRows()); }
+    /** \returns the number of stored coefficients, including the explicit zeros of the blocks */
+    inline Index nonZeros() const { return nonZeroBlocks()*BlockSize*BlockSize; }
+
+    /** \returns a pointer to the starting positions of the rows of blocks (of size blockRows()+1) */
+    inline const Index* outerIndexPtr() const { return m_outerIndex.data(); }
+    /** \returns a pointer to the column of blocks of each stored block */
+    inline const Index* innerIndexPtr() const { return m_innerIndex.data(); }
+    /** \returns a pointer to the coefficients of the stored blocks, each of them being stored in column major order */
+    inline const Scalar* valuePtr() const { return m_values.data(); }
+    inline Scalar* valuePtr() { return m_values.data(); }
+
+    /** \returns the \a k-th stored block */
+    inline Map<const BlockType> valueBlock(Index k) const
+    { return Map<const BlockType>(m_values.data() + k*BlockSize*BlockSize); }
+    inline Map<BlockType> valueBlock(Index k)
+    { return Map<BlockType>(m_values.data() + k*BlockSize*BlockSize); }
+
+    /** \returns a copy of the transpose of \c *this */
+    BlockSparseMatrix transpose() const
+    {
+      BlockSparseMatrix res;
+      transposeTo<false>(res);
+      return res;
+    }
+
+    /** \returns a copy of the adjoint of \c *this */
+    BlockSparseMatrix adjoint() const
+    {
+      BlockSparseMatrix res;
+      transposeTo<true>(res);
+      return res;
+    }
+
+    /** \returns an expression of the selfadjoint matrix whose \a UpLo triangular part is the one of \c *this.
+      * If \a UpLo is \c Lower|Upper, then \c *this is used as a full matrix. */
+    template<unsigned int UpLo> inline BlockSparseSelfAdjointView<BlockSparseMatrix,UpLo> selfadjointView() const
+    { return BlockSparseSelfAdjointView<BlockSparseMatrix,UpLo>(*this); }
+
+    /** \returns the product of \c *this with the dense vector or matrix \a other */
+    template<typename OtherDerived>
+    inline BlockSparseTimeDenseProduct<BlockSparseMatrix,OtherDerived,Lower|Upper>
+    operator*(const MatrixBase<OtherDerived>& other) const
+    { return BlockSparseTimeDenseProduct<BlockSparseMatrix,OtherDerived,Lower|Upper>(*this, other.derived()); }
+
+    /** \internal triggered by dense_matrix = block_sparse_matrix; */
+    template<typename Dest> void evalTo(Dest& dst) const
+    {
+      dst.setZero(m_rows, m_cols);
+      for(Index i=0; i<blockRows(); ++i)
+        for(Index k=m_outerIndex(i); k<m_outerIndex(i+1); ++k)
+          dst.template block<BlockSize,BlockSize>(i*BlockSize, m_innerIndex(k)*BlockSize) = valueBlock(k);
+    }
+
+  protected:
+    template<bool Conjugate> void transposeTo(BlockSparseMatrix& dst) const;
+
+    Index m_rows;
+    Index m_cols;
+    IndexVector m_outerIndex;
+    IndexVector m_innerIndex;
+    ScalarVector m_values;
+};
+
+/** \internal
+  * Iterates over the coefficients of a row of a BlockSparseMatrix, including the explicit zeros of the blocks.
+  * This allows the preconditioners reading the diagonal entries to work on a BlockSparseMatrix. */
+template<typename Scalar, int _BlockSize, typename _Index>
+class BlockSparseMatrix<Scalar,_BlockSize,_Index>::InnerIterator
+{
+  public:
+    InnerIterator(const BlockSparseMatrix& mat, Index outer)
+      : m_values(mat.valuePtr()), m_indices(mat.innerIndexPtr()), m_outer(outer), m_r(outer%BlockSize), m_c(0),
+        m_id(mat.outerIndexPtr()[outer/BlockSize]), m_end(mat.outerIndexPtr()[outer/BlockSize+1])
+    {}
+
+    inline InnerIterator& operator++()
+    {
+      if(++m_c==BlockSize)
+      {
+        m_c = 0;
+        ++m_id;
+      }
+      return *this;
+    }
+
+    inline const Scalar& value() const { return m_values[(m_id*BlockSize + m_c)*BlockSize + m_r]; }
+    inline Index index() const { return m_indices[m_id]*BlockSize + m_c; }
+    inline Index outer() const { return m_outer; }
+    inline Index row() const { return m_outer; }
+    inline Index col() const { return index(); }
+
+    inline operator bool() const { return m_id < m_end; }
+
+  protected:
+    const Scalar* m_values;
+    const Index* m_indices;
+    const Index m_outer;
+    const Index m_r;
+    Index m_c;
+    Index m_id;
+    const Index m_end;
+};
+
+template<typename Scalar, int _BlockSize, typename _Index>
+template<typename OtherDerived>
+BlockSparseMatrix<Scalar,_BlockSize,_Index>&
+BlockSparseMatrix<Scalar,_BlockSize,_Index>::operator=(const SparseMatrixBase<OtherDerived>& other)
+{
+  typedef SparseMatrix<Scalar,RowMajor,Index> RowMajorMatrix;
+  const RowMajorMatrix mat(other.derived());
+  resize(mat.rows(), mat.cols());
+  const Index nbr = blockRows();
+
+  // mark(j) is the position of the block of the current row of blocks in column j, if any
+  IndexVector mark(blockCols());
+  mark.setConstant(-1);
+  std::vector<Index> indices;
+  indices.reserve(mat.nonZeros());
+  for(Index i=0; i<nbr; ++i)
+  {
+    const Index start = Index(indices.size());
+    for(Index r=i*BlockSize; r<(i+1)*BlockSize; ++r)
+      for(typename RowMajorMatrix::InnerIterator it(mat, r); it; ++it)
+      {
+        Index j = it.index()/BlockSize;
+        if(mark(j)<start)
+        {
+          mark(j) = Index(indices.size());
+          indices.push_back(j);
+        }
+      }
+    std::sort(indices.begin()+start, indices.end());
+    for(Index k=start; k<Index(indices.size()); ++k)
+      mark(indices[k]) = k;
+    m_outerIndex(i+1) = Index(indices.size());
+  }
+  m_innerIndex = Map<const IndexVector>(indices.data(), Index(indices.size()));
+
+  // scatter the coefficients into their blocks
+  m_values.setZero(nonZeroBlocks()*BlockSize*BlockSize);
+  for(Index i=0; i<nbr; ++i)
+  {
+    for(Index k=m_outerIndex(i); k<m_outerIndex(i+1); ++k)
+      mark(m_innerIndex(k)) = k;
+    for(Index r=0; r<BlockSize; ++r)
+      for(typename RowMajorMatrix::InnerIterator it(mat, i*BlockSize+r); it; ++it)
+        valueBlock(mark(it.index()/BlockSize))(r, it.index()%BlockSize) = it.value();
+  }
+  return *this;
+}
+
+template<typename Scalar, int _BlockSize, typename _Index>
+template<bool Conjugate>
+void BlockSparseMatrix<Scalar,_BlockSize,_Index>::transposeTo(BlockSparseMatrix& dst) const
+{
+  const Index nbr = blockRows(), nbc = blockCols();
+  dst.resize(m_cols, m_rows);
+  for(Index k=0; k<nonZeroBlocks(); ++k)
+    ++dst.m_outerIndex(m_innerIndex(k)+1);
+  for(Index j=0; j<nbc; ++j)
+    dst.m_outerIndex(j+1) += dst.m_outerIndex(j);
+  dst.m_innerIndex.resize(nonZeroBlocks());
+  dst.m_values.resize(m_values.size());
+
+  // the rows of blocks are scanned in order, so that the block columns of each row of dst are sorted
+  IndexVector pos = dst.m_outerIndex.head(nbc);
+  for(Index i=0; i<nbr; ++i)
+    for(Index k=m_outerIndex(i); k<m_outerIndex(i+1); ++k)
+    {
+      Index p = pos(m_innerIndex(k))++;
+      dst.m_innerIndex(p) = i;
+      if(Conjugate)
+        dst.valueBlock(p) = valueBlock(k).adjoint();
+      else
+        dst.valueBlock(p) = valueBlock(k).transpose();
+    }
+}
+
+/** \ingroup SparseCore_Module
+  * \class BlockSparseSelfAdjointView
+  * \brief Expression of the selfadjoint matrix stored in the lower or upper triangular part of a BlockSparseMatrix
+  *
+  * This is the return type of BlockSparseMatrix::selfadjointView(). Its products with dense vectors and matrices
+  * read the diagonal blocks and the blocks of the \a UpLo triangular part only. If \a UpLo is \c Lower|Upper,
+  * the whole matrix is used.
+  */
+template<typename MatrixType, int UpLo>
+class BlockSparseSelfAdjointView : public EigenBase<BlockSparseSelfAdjointView<MatrixType,UpLo> >
+{
+  public:
+    typedef typename MatrixType::Scalar Scalar;
+    typedef typename MatrixType::Index Index;
+
+    inline BlockSparseSelfAdjointView(const MatrixType& matrix) : m_matrix(matrix)
+    {
+      eigen_assert(rows()==cols() && "SelfAdjointView is only for squared matrices");
+    }
+
+    inline Index rows() const { return m_matrix.rows(); }
+    inline Index cols() const { return m_matrix.cols(); }
+
+    /** \internal \returns a reference to the nested matrix */
+    const MatrixType& matrix() const { return m_matrix; }
+
+    /** Efficient selfadjoint block sparse matrix times dense vector/matrix product */
+    template<typename OtherDerived>
+    inline BlockSparseTimeDenseProduct<MatrixType,OtherDerived,UpLo>
+    operator*(const MatrixBase<OtherDerived>& rhs) const
+    { return BlockSparseTimeDenseProduct<MatrixType,OtherDerived,UpLo>(m_matrix, rhs.derived()); }
+
+  protected:
+    const MatrixType& m_matrix;
+};
+
+namespace internal {
+
+// A dense rhs having several columns is copied into a row major matrix, such that the rows matching a block are
+// contiguous in memory. Its columns are then processed by panels of PanelWidth columns, for which the products
+// with the blocks are fixed size products.
+template<typename Lhs, typename Rhs> struct block_sparse_product_traits
+{
+  typedef typename Rhs::Scalar Scalar;
+  enum {
+    BlockSize = Lhs::BlockSize,
+    Cols = Rhs::ColsAtCompileTime,
+    Options = Cols==1 ? ColMajor : RowMajor,
+    PackRhs = Cols!=1 && !(int(Rhs::Flags)&RowMajorBit),
+    PanelWidth = Cols==1 ? 1 : 4*packet_traits<Scalar>::size
+  };
+  typedef Matrix<Scalar,Rhs::RowsAtCompileTime,Cols,Options,Rhs::MaxRowsAtCompileTime,Rhs::MaxColsAtCompileTime> PackedRhs;
+  typedef typename conditional<PackRhs, PackedRhs, const Rhs&>::type ActualRhs;
+  typedef Matrix<Scalar,BlockSize,Cols,Options,BlockSize,Rhs::MaxColsAtCompileTime> Accumulator;
+};
+
+// Full product: the rows of blocks of the result are independent, they are split among the threads
+// such that each thread processes the same number of blocks.
+template<typename Lhs, typename Rhs, typename Res, int UpLo>
+struct block_sparse_time_dense_product_impl
+{
+  typedef typename Lhs::Index Index;
+  typedef typename Res::Scalar Scalar;
+  typedef block_sparse_product_traits<Lhs,Rhs> Traits;
+  typedef typename remove_all<typename Traits::ActualRhs>::type ActualRhs;
+  enum { BlockSize = Lhs::BlockSize, PanelWidth = Traits::PanelWidth };
+
+  static void run(const Lhs& lhs, const Rhs& _rhs, Res& res, const Scalar& alpha)
+  {
+    typename Traits::ActualRhs rhs(_rhs);
+    const Index n = lhs.blockRows();
+#ifdef EIGEN_HAS_OPENMP
+    const Index* outer = lhs.outerIndexPtr();
+    Index threads = sparse_parallel_threads(std::ptrdiff_t(lhs.nonZeros()) * rhs.cols());
+    if(threads>1)
+    {
+      ei_declare_aligned_stack_constructed_variable(Index, starts, (threads+1), 0);
+      sparse_balanced_partition(outer, n, threads, starts);
+      #pragma omp parallel for schedule(static,1) num_threads(threads)
+      for(Index t=0; t<threads; ++t)
+        processRows(lhs, rhs, res, alpha, starts[t], starts[t+1]);
+      return;
+    }
+#endif
+    processRows(lhs, rhs, res, alpha, 0, n);
+  }
+
+  static void processRows(const Lhs& lhs, const ActualRhs& rhs, Res& res, const Scalar& alpha, Index begin, Index end)
+  {
+    Index c = 0;
+    for(; c+PanelWidth<=rhs.cols(); c+=PanelWidth)
+      processPanel<PanelWidth>(lhs, rhs, res, alpha, begin, end, c, PanelWidth);
+    if(c<rhs.cols())
+      processPanel<Dynamic>(lhs, rhs, res, alpha, begin, end, c, rhs.cols()-c);
+  }
+
+  template<int Width>
+  static void processPanel(const Lhs& lhs, const ActualRhs& rhs, Res& res, const Scalar& alpha,
+                           Index begin, Index end, Index c0, Index width)
+  {
+    const Index* outer = lhs.outerIndexPtr();
+    const Index* inner = lhs.innerIndexPtr();
+    Matrix<Scalar,BlockSize,Width,Traits::Options,BlockSize,Width==Dynamic?PanelWidth:Width> acc(int(BlockSize), width);
+    for(Index i=begin; i<end; ++i)
+    {
+      acc.setZero();
+      for(Index k=outer[i]; k<outer[i+1]; ++k)
+      {
+        Block<const ActualRhs,BlockSize,Width> rhsBlock(rhs, inner[k]*BlockSize, c0, BlockSize, width);
+        // a row of the block at once keeps the products small enough to be unrolled
+        if(Width==1)
+          acc.noalias() += lhs.valueBlock(k).lazyProduct(rhsBlock);
+        else
+          for(int r=0; r<BlockSize; ++r)
+            acc.row(r).noalias() += lhs.valueBlock(k).row(r).lazyProduct(rhsBlock);
+      }
+      Block<Res,BlockSize,Width>(res, i*BlockSize, c0, BlockSize, width) += alpha * acc;
+    }
+  }
+};
+
+// Selfadjoint product from the lower or upper triangular part: each off diagonal block contributes to two rows
+// of blocks of the result.
+template<typename Lhs, typename Rhs, typename Res, int UpLo>
+struct block_sparse_selfadjoint_time_dense_product_impl
+{
+  typedef typename Lhs::Index Index;
+  typedef typename Res::Scalar Scalar;
+  typedef typename Lhs::BlockType BlockType;
+  typedef block_sparse_product_traits<Lhs,Rhs> Traits;
+  enum { BlockSize = Lhs::BlockSize };
+
+  static void run(const Lhs& lhs, const Rhs& _rhs, Res& res, const Scalar& alpha)
+  {
+    typename Traits::ActualRhs rhs(_rhs);
+    const Index* outer = lhs.outerIndexPtr();
+    const Index* inner = lhs.innerIndexPtr();
+    typename Traits::Accumulator acc(int(BlockSize), rhs.cols());
+    BlockType diag;
+    for(Index i=0; i<lhs.blockRows(); ++i)
+    {
+      acc.setZero();
+      for(Index k=outer[i]; k<outer[i+1]; ++k)
+      {
+        const Index j = inner[k];
+        if(j==i)
+        {
+          diag = lhs.valueBlock(k);
+          if(UpLo==Lower)
+            diag.template triangularView<StrictlyUpper>() = lhs.valueBlock(k).adjoint();
+          else
+            diag.template triangularView<StrictlyLower>() = lhs.valueBlock(k).adjoint();
+          // as for dense selfadjoint views, the imaginary part of the diagonal is ignored
+          diag.diagonal() = diag.diagonal().real().template cast<Scalar>();
+          acc.noalias() += diag.lazyProduct(rhs.template middleRows<BlockSize>(i*BlockSize));
+        }
+        else if((UpLo==Lower) == (j<i))
+        {
+          acc.noalias() += lhs.valueBlock(k).lazyProduct(rhs.template middleRows<BlockSize>(j*BlockSize));
+          res.template middleRows<BlockSize>(j*BlockSize).noalias()
+            += (alpha * lhs.valueBlock(k).adjoint()).lazyProduct(rhs.template middleRows<BlockSize>(i*BlockSize));
+        }
+      }
+      res.template middleRows<BlockSize>(i*BlockSize) += alpha * acc;
+    }
+  }
+};
+
+template<typename Lhs, typename Rhs, typename Res>
+struct block_sparse_selfadjoint_time_dense_product_impl<Lhs,Rhs,Res,Lower|Upper>
+  : block_sparse_time_dense_product_impl<Lhs,Rhs,Res,Lower|Upper>
+{};
+
+} // end namespace internal
+
+template<typename Lhs, typename Rhs, int UpLo>
+class BlockSparseTimeDenseProduct
+  : public ProductBase<BlockSparseTimeDenseProduct<Lhs,Rhs,UpLo>, Lhs, Rhs>
+{
+  public:
+    EIGEN_PRODUCT_PUBLIC_INTERFACE(BlockSparseTimeDenseProduct)
+
+    BlockSparseTimeDenseProduct(const Lhs& lhs, const Rhs& rhs) : Base(lhs,rhs)
+    {}
+
+    template<typename Dest> void scaleAndAddTo(Dest& dest, Scalar alpha) const
+    {
+      internal::block_sparse_selfadjoint_time_dense_product_impl<Lhs,_RhsNested,Dest,UpLo>::run(m_lhs, m_rhs, dest, alpha);
+    }
+
+  private:
+    BlockSparseTimeDenseProduct& operator=(const BlockSparseTimeDenseProduct&);
+};
+
+#endif // EIGEN_BLOCKSPARSEMATRIX_H
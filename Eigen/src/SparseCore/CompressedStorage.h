@@ -30,6 +30,8 @@ namespace internal {
 /** \internal
   * Stores a sparse set of values as a list of values and a list of indices.
   *
+  * The positions within the storage are always handled as \c size_t, such that \a _Index only has to be
+  * large enough to hold the stored indices themselves.
   */
 template<typename _Scalar,typename _Index>
 class CompressedStorage
@@ -105,7 +107,7 @@ class CompressedStorage
 
     void append(const Scalar& v, Index i)
     {
-      Index id = static_cast<Index>(m_size);
+      size_t id = m_size;
       resize(m_size+1, 1);
       m_values[id] = v;
       m_indices[id] = i;
@@ -131,13 +133,13 @@ class CompressedStorage
     }
 
     /** \returns the largest \c k such that for all \c j in [0,k) index[\c j]\<\a key */
-    inline Index searchLowerIndex(Index key) const
+    inline size_t searchLowerIndex(Index key) const
     {
       return searchLowerIndex(0, m_size, key);
     }
 
     /** \returns the largest \c k in [start,end) such that for all \c j in [start,k) index[\c j]\<\a key */
-    inline Index searchLowerIndex(size_t start, size_t end, Index key) const
+    inline size_t searchLowerIndex(size_t start, size_t end, Index key) const
     {
       while(end>start)
       {
@@ -147,7 +149,7 @@ class CompressedStorage
         else
           end = mid;
       }
-      return static_cast<Index>(start);
+      return start;
     }
 
     /** \returns the stored value at index \a key
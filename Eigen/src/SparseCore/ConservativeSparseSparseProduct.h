@@ -25,109 +25,243 @@
 #ifndef EIGEN_CONSERVATIVESPARSESPARSEPRODUCT_H
 #define EIGEN_CONSERVATIVESPARSESPARSEPRODUCT_H
 
+/** \internal
+  * A column of a sparse product which receives at most rows/EIGEN_SPARSE_PRODUCT_HASH_RATIO contributions
+  * is accumulated into a small hash table rather than into a dense vector of the size of the columns.
+  * Setting it to 0 disables the hash based accumulator.
+  */
+#ifndef EIGEN_SPARSE_PRODUCT_HASH_RATIO
+#define EIGEN_SPARSE_PRODUCT_HASH_RATIO 32
+#endif
+
 namespace internal {
 
-template<typename Lhs, typename Rhs, typename ResultType>
-static void conservative_sparse_sparse_product_impl(const Lhs& lhs, const Rhs& rhs, ResultType& res)
+/** \internal
+  * Accumulates the contributions to a single column of a sparse product. Depending on the maximal number
+  * of nonzeros announced by init(), the entries are accumulated into either a dense vector with markers,
+  * or a hash table with linear probing. In both cases, the entries are collected in the order they have
+  * been encountered, i.e., they are not sorted.
+  */
+template<typename Scalar, typename Index>
+class sparse_product_accumulator
 {
-  typedef typename remove_all<Lhs>::type::Scalar Scalar;
-  typedef typename remove_all<Lhs>::type::Index Index;
-
-  // make sure to call innerSize/outerSize since we fake the storage order.
-  Index rows = lhs.innerSize();
-  Index cols = rhs.outerSize();
-  eigen_assert(lhs.outerSize() == rhs.innerSize());
+  public:
+    sparse_product_accumulator(Index size) : m_size(size), m_stamp(0), m_nnz(0), m_useHash(false) {}
 
-  std::vector<bool> mask(rows,false);
-  Matrix<Scalar,Dynamic,1> values(rows);
-  Matrix<Index,Dynamic,1>  indices(rows);
-
-  // estimate the number of non zero entries
-  // given a rhs column containing Y non zeros, we assume that the respective Y columns
-  // of the lhs differs in average of one non zeros, thus the number of non zeros for
-  // the product of a rhs column with the lhs is X+Y where X is the average number of non zero
-  // per column of the lhs.
-  // Therefore, we have nnz(lhs*rhs) = nnz(lhs) + nnz(rhs)
-  Index estimated_nnz_prod = lhs.nonZeros() + rhs.nonZeros();
-
-  res.setZero();
-  res.reserve(Index(estimated_nnz_prod));
-  // we compute each column of the result, one after the other
-  for (Index j=0; j<cols; ++j)
-  {
-
-    res.startVec(j);
-    Index nnz = 0;
-    for (typename Rhs::InnerIterator rhsIt(rhs, j); rhsIt; ++rhsIt)
+    /** Starts a new column receiving at most \a bound contributions */
+    void init(Index bound)
     {
-      Scalar y = rhsIt.value();
-      Index k = rhsIt.index();
-      for (typename Lhs::InnerIterator lhsIt(lhs, k); lhsIt; ++lhsIt)
+      m_nnz = 0;
+      m_useHash = EIGEN_SPARSE_PRODUCT_HASH_RATIO>0 && bound < m_size/(std::max)(Index(EIGEN_SPARSE_PRODUCT_HASH_RATIO),Index(1));
+      if(m_indices.size() < (std::min)(bound,m_size))
+        m_indices.resize((std::min)(bound,m_size));
+      if(m_useHash)
       {
-        Index i = lhsIt.index();
-        Scalar x = lhsIt.value();
-        if(!mask[i])
+        // keep the table at most half full
+        Index tableSize = 2;
+        while(tableSize < 2*bound)
+          tableSize *= 2;
+        if(m_keys.size() < tableSize)
         {
-          mask[i] = true;
-          values[i] = x * y;
-          indices[nnz] = i;
-          ++nnz;
+          m_keys.setConstant(tableSize, -1);
+          m_hashValues.resize(tableSize);
         }
-        else
-          values[i] += x * y;
+        m_hashMask = tableSize-1;
+      }
+      else
+      {
+        if(m_marker.size()==0)
+        {
+          m_marker.setConstant(m_size, -1);
+          m_values.resize(m_size);
+        }
+        ++m_stamp;
       }
     }
 
-    // unordered insertion
-    for(int k=0; k<nnz; ++k)
+    /** Adds \a value to the \a i-th entry of the current column */
+    inline void add(Index i, const Scalar& value)
     {
-      int i = indices[k];
-      res.insertBackByOuterInnerUnordered(j,i) = values[i];
-      mask[i] = false;
+      if(m_useHash)
+      {
+        Index h = hash(i);
+        while(m_keys.coeff(h)!=-1 && m_keys.coeff(h)!=i)
+          h = (h+1) & m_hashMask;
+        if(m_keys.coeff(h)==-1)
+        {
+          m_keys.coeffRef(h) = i;
+          m_hashValues.coeffRef(h) = value;
+          m_indices.coeffRef(m_nnz++) = h;
+        }
+        else
+          m_hashValues.coeffRef(h) += value;
+      }
+      else if(m_marker.coeff(i)!=m_stamp)
+      {
+        m_marker.coeffRef(i) = m_stamp;
+        m_values.coeffRef(i) = value;
+        m_indices.coeffRef(m_nnz++) = i;
+      }
+      else
+        m_values.coeffRef(i) += value;
     }
 
-#if 0
-    // alternative ordered insertion code:
-
-    int t200 = rows/(log2(200)*1.39);
-    int t = (rows*100)/139;
-
-    // FIXME reserve nnz non zeros
-    // FIXME implement fast sort algorithms for very small nnz
-    // if the result is sparse enough => use a quick sort
-    // otherwise => loop through the entire vector
-    // In order to avoid to perform an expensive log2 when the
-    // result is clearly very sparse we use a linear bound up to 200.
-    //if((nnz<200 && nnz<t200) || nnz * log2(nnz) < t)
-    //res.startVec(j);
-    if(true)
+    /** \returns the number of nonzeros of the current column */
+    inline Index nonZeros() const { return m_nnz; }
+
+    /** Copies the nonzeros of the current column to \a indices and \a values,
+      * and makes the accumulator ready for the next column. */
+    template<typename OutIndex>
+    void flush(OutIndex* indices, Scalar* values)
     {
-      if(nnz>1) std::sort(indices.data(),indices.data()+nnz);
-      for(int k=0; k<nnz; ++k)
+      for(Index k=0; k<m_nnz; ++k)
       {
-        int i = indices[k];
-        res.insertBackByOuterInner(j,i) = values[i];
-        mask[i] = false;
+        Index h = m_indices.coeff(k);
+        Index i = m_useHash ? m_keys.coeff(h) : h;
+        indices[k] = OutIndex(i);
+        values[k] = m_useHash ? m_hashValues.coeff(h) : m_values.coeff(i);
+        if(m_useHash)
+          m_keys.coeffRef(h) = -1;
       }
+      m_nnz = 0;
     }
-    else
+
+  protected:
+    inline Index hash(Index i) const
     {
-      // dense path
-      for(int i=0; i<rows; ++i)
+      return Index((std::size_t(i) * std::size_t(2654435761u)) & std::size_t(m_hashMask));
+    }
+
+    Index m_size;
+    Index m_stamp;
+    Index m_nnz;
+    Index m_hashMask;
+    bool m_useHash;
+    Matrix<Index,Dynamic,1> m_marker;
+    Matrix<Scalar,Dynamic,1> m_values;
+    Matrix<Index,Dynamic,1> m_keys;
+    Matrix<Scalar,Dynamic,1> m_hashValues;
+    Matrix<Index,Dynamic,1> m_indices;
+};
+
+/** \internal
+  * Stores into \a outerIndex[j+1] the number of nonzeros of the j-th column of the product \a lhs * \a rhs,
+  * for j in [\a begin, \a end). Only the structure of the operands is visited: the rows already reached by the
+  * current column are marked with its index.
+  */
+template<typename Lhs, typename Rhs, typename Index, typename ResIndex>
+static void conservative_sparse_sparse_product_count(const Lhs& lhs, const Rhs& rhs, Index begin, Index end, ResIndex* outerIndex)
+{
+  Matrix<Index,Dynamic,1> mask;
+  mask.setConstant(lhs.innerSize(), -1);
+  for (Index j=begin; j<end; ++j)
+  {
+    Index nnz = 0;
+    for (typename Rhs::InnerIterator rhsIt(rhs, j); rhsIt; ++rhsIt)
+      for (typename Lhs::InnerIterator lhsIt(lhs, rhsIt.index()); lhsIt; ++lhsIt)
       {
-        if(mask[i])
+        const Index i = lhsIt.index();
+        if(mask.coeff(i)!=j)
         {
-          mask[i] = false;
-          res.insertBackByOuterInner(j,i) = values[i];
+          mask.coeffRef(i) = j;
+          ++nnz;
         }
       }
-    }
-#endif
+    outerIndex[j+1] = ResIndex(nnz);
+  }
+}
 
+/** \internal
+  * Computes the columns [\a begin, \a end) of the product \a lhs * \a rhs. \a bounds[j+1]-bounds[j] must be an upper
+  * bound of the number of nonzeros of the j-th column. The j-th column is written at the position \a outerIndex[j]
+  * of \a innerIndices and \a values.
+  */
+template<typename Lhs, typename Rhs, typename Index, typename ResIndex, typename ResInnerIndex, typename Scalar>
+static void conservative_sparse_sparse_product_pass(const Lhs& lhs, const Rhs& rhs, const Index* bounds, Index begin, Index end,
+                                                    const ResIndex* outerIndex, ResInnerIndex* innerIndices, Scalar* values)
+{
+  sparse_product_accumulator<Scalar,Index> acc(lhs.innerSize());
+  for (Index j=begin; j<end; ++j)
+  {
+    acc.init(bounds[j+1]-bounds[j]);
+    for (typename Rhs::InnerIterator rhsIt(rhs, j); rhsIt; ++rhsIt)
+    {
+      Scalar y = rhsIt.value();
+      for (typename Lhs::InnerIterator lhsIt(lhs, rhsIt.index()); lhsIt; ++lhsIt)
+        acc.add(lhsIt.index(), lhsIt.value() * y);
+    }
+    acc.flush(innerIndices+outerIndex[j], values+outerIndex[j]);
   }
-  res.finalize();
 }
 
+/** \internal
+  * Computes \a res = \a lhs * \a rhs assuming all matrices are col major. The nonzeros of each column of \a res are not sorted.
+  *
+  * The product is performed in two passes: the first one counts the number of nonzeros of each column of the result,
+  * and the second one computes the values directly at their final position. The columns are split among the threads
+  * such that each thread performs roughly the same number of operations.
+  */
+template<typename Lhs, typename Rhs, typename ResultType>
+static void conservative_sparse_sparse_product_impl(const Lhs& lhs, const Rhs& rhs, ResultType& res)
+{
+  typedef typename remove_all<Lhs>::type::Scalar Scalar;
+  typedef typename remove_all<Lhs>::type::Index Index;
+  typedef typename ResultType::Index ResIndex;
+  typedef typename ResultType::InnerIndex ResInnerIndex;
+
+  // make sure to call innerSize/outerSize since we fake the storage order.
+  Index cols = rhs.outerSize();
+  eigen_assert(lhs.outerSize() == rhs.innerSize());
+
+  // the number of operations required by the first j columns of the result,
+  // which is also an upper bound of their number of nonzeros
+  Matrix<Index,Dynamic,1> lhsNnz(lhs.outerSize());
+  for (Index k=0; k<lhs.outerSize(); ++k)
+  {
+    Index nnz = 0;
+    for (typename Lhs::InnerIterator lhsIt(lhs, k); lhsIt; ++lhsIt)
+      ++nnz;
+    lhsNnz[k] = nnz;
+  }
+  Matrix<Index,Dynamic,1> flops(cols+1);
+  flops[0] = 0;
+  for (Index j=0; j<cols; ++j)
+  {
+    Index count = 0;
+    for (typename Rhs::InnerIterator rhsIt(rhs, j); rhsIt; ++rhsIt)
+      count += lhsNnz[rhsIt.index()];
+    flops[j+1] = flops[j] + count;
+  }
+
+  Index threads = sparse_parallel_threads(flops[cols]);
+  Matrix<Index,Dynamic,1> starts(threads+1);
+  sparse_balanced_partition(flops.data(), cols, threads, starts.data());
+
+  res.setZero();
+  res.makeCompressed();
+  ResIndex* outerIndex = res.outerIndexPtr();
+
+  // symbolic pass
+#ifdef EIGEN_HAS_OPENMP
+  #pragma omp parallel for schedule(static,1) num_threads(threads)
+#endif
+  for (Index t=0; t<threads; ++t)
+    conservative_sparse_sparse_product_count(lhs, rhs, starts[t], starts[t+1], outerIndex);
+
+  outerIndex[0] = 0;
+  for (Index j=0; j<cols; ++j)
+    outerIndex[j+1] += outerIndex[j];
+  res.resizeNonZeros(outerIndex[cols]);
+
+  // numeric pass
+  ResInnerIndex* innerIndices = res.innerIndexPtr();
+  Scalar* values = res.valuePtr();
+#ifdef EIGEN_HAS_OPENMP
+  #pragma omp parallel for schedule(static,1) num_threads(threads)
+#endif
+  for (Index t=0; t<threads; ++t)
+    conservative_sparse_sparse_product_pass(lhs, rhs, flops.data(), starts[t], starts[t+1], outerIndex, innerIndices, values);
+}
 
 } // end namespace internal
 
@@ -147,8 +281,8 @@ struct conservative_sparse_sparse_product_selector<Lhs,Rhs,ResultType,ColMajor,C
 
   static void run(const Lhs& lhs, const Rhs& rhs, ResultType& res)
   {
-    typedef SparseMatrix<typename ResultType::Scalar,RowMajor> RowMajorMatrix;
-    typedef SparseMatrix<typename ResultType::Scalar,ColMajor> ColMajorMatrix;
+    typedef SparseMatrix<typename ResultType::Scalar,RowMajor,typename ResultType::Index> RowMajorMatrix;
+    typedef SparseMatrix<typename ResultType::Scalar,ColMajor,typename ResultType::Index> ColMajorMatrix;
     ColMajorMatrix resCol(lhs.rows(),rhs.cols());
     internal::conservative_sparse_sparse_product_impl<Lhs,Rhs,ColMajorMatrix>(lhs, rhs, resCol);
     // sort the non zeros:
@@ -162,7 +296,7 @@ struct conservative_sparse_sparse_product_selector<Lhs,Rhs,ResultType,RowMajor,C
 {
   static void run(const Lhs& lhs, const Rhs& rhs, ResultType& res)
   {
-     typedef SparseMatrix<typename ResultType::Scalar,RowMajor> RowMajorMatrix;
+     typedef SparseMatrix<typename ResultType::Scalar,RowMajor,typename ResultType::Index> RowMajorMatrix;
      RowMajorMatrix rhsRow = rhs;
      RowMajorMatrix resRow(lhs.rows(), rhs.cols());
      internal::conservative_sparse_sparse_product_impl<RowMajorMatrix,Lhs,RowMajorMatrix>(rhsRow, lhs, resRow);
@@ -175,7 +309,7 @@ struct conservative_sparse_sparse_product_selector<Lhs,Rhs,ResultType,ColMajor,R
 {
   static void run(const Lhs& lhs, const Rhs& rhs, ResultType& res)
   {
-    typedef SparseMatrix<typename ResultType::Scalar,RowMajor> RowMajorMatrix;
+    typedef SparseMatrix<typename ResultType::Scalar,RowMajor,typename ResultType::Index> RowMajorMatrix;
     RowMajorMatrix lhsRow = lhs;
     RowMajorMatrix resRow(lhs.rows(), rhs.cols());
     internal::conservative_sparse_sparse_product_impl<Rhs,RowMajorMatrix,RowMajorMatrix>(rhs, lhsRow, resRow);
@@ -188,7 +322,7 @@ struct conservative_sparse_sparse_product_selector<Lhs,Rhs,ResultType,RowMajor,R
 {
   static void run(const Lhs& lhs, const Rhs& rhs, ResultType& res)
   {
-    typedef SparseMatrix<typename ResultType::Scalar,RowMajor> RowMajorMatrix;
+    typedef SparseMatrix<typename ResultType::Scalar,RowMajor,typename ResultType::Index> RowMajorMatrix;
     RowMajorMatrix resRow(lhs.rows(), rhs.cols());
     internal::conservative_sparse_sparse_product_impl<Rhs,Lhs,RowMajorMatrix>(rhs, lhs, resRow);
     res = resRow;
@@ -203,7 +337,7 @@ struct conservative_sparse_sparse_product_selector<Lhs,Rhs,ResultType,ColMajor,C
 
   static void run(const Lhs& lhs, const Rhs& rhs, ResultType& res)
   {
-    typedef SparseMatrix<typename ResultType::Scalar,ColMajor> ColMajorMatrix;
+    typedef SparseMatrix<typename ResultType::Scalar,ColMajor,typename ResultType::Index> ColMajorMatrix;
     ColMajorMatrix resCol(lhs.rows(), rhs.cols());
     internal::conservative_sparse_sparse_product_impl<Lhs,Rhs,ColMajorMatrix>(lhs, rhs, resCol);
     res = resCol;
@@ -215,7 +349,7 @@ struct conservative_sparse_sparse_product_selector<Lhs,Rhs,ResultType,RowMajor,C
 {
   static void run(const Lhs& lhs, const Rhs& rhs, ResultType& res)
   {
-    typedef SparseMatrix<typename ResultType::Scalar,ColMajor> ColMajorMatrix;
+    typedef SparseMatrix<typename ResultType::Scalar,ColMajor,typename ResultType::Index> ColMajorMatrix;
     ColMajorMatrix lhsCol = lhs;
     ColMajorMatrix resCol(lhs.rows(), rhs.cols());
     internal::conservative_sparse_sparse_product_impl<ColMajorMatrix,Rhs,ColMajorMatrix>(lhsCol, rhs, resCol);
@@ -228,7 +362,7 @@ struct conservative_sparse_sparse_product_selector<Lhs,Rhs,ResultType,ColMajor,R
 {
   static void run(const Lhs& lhs, const Rhs& rhs, ResultType& res)
   {
-    typedef SparseMatrix<typename ResultType::Scalar,ColMajor> ColMajorMatrix;
+    typedef SparseMatrix<typename ResultType::Scalar,ColMajor,typename ResultType::Index> ColMajorMatrix;
     ColMajorMatrix rhsCol = rhs;
     ColMajorMatrix resCol(lhs.rows(), rhs.cols());
     internal::conservative_sparse_sparse_product_impl<Lhs,ColMajorMatrix,ColMajorMatrix>(lhs, rhsCol, resCol);
@@ -241,8 +375,8 @@ struct conservative_sparse_sparse_product_selector<Lhs,Rhs,ResultType,RowMajor,R
 {
   static void run(const Lhs& lhs, const Rhs& rhs, ResultType& res)
   {
-    typedef SparseMatrix<typename ResultType::Scalar,RowMajor> RowMajorMatrix;
-    typedef SparseMatrix<typename ResultType::Scalar,ColMajor> ColMajorMatrix;
+    typedef SparseMatrix<typename ResultType::Scalar,RowMajor,typename ResultType::Index> RowMajorMatrix;
+    typedef SparseMatrix<typename ResultType::Scalar,ColMajor,typename ResultType::Index> ColMajorMatrix;
     RowMajorMatrix resRow(lhs.rows(),rhs.cols());
     internal::conservative_sparse_sparse_product_impl<Rhs,Lhs,RowMajorMatrix>(rhs, lhs, resRow);
     // sort the non zeros:
@@ -0,0 +1,414 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef EIGEN_SLICEDELLMATRIX_H
+#define EIGEN_SLICEDELLMATRIX_H
+
+namespace internal {
+
+template<typename _Scalar, int _SliceHeight, typename _Index>
+struct traits<SlicedEllMatrix<_Scalar,_SliceHeight,_Index> >
+{
+  typedef _Scalar Scalar;
+  typedef _Index Index;
+  typedef Sparse StorageKind;
+  typedef MatrixXpr XprKind;
+  enum {
+    RowsAtCompileTime = Dynamic,
+    ColsAtCompileTime = Dynamic,
+    MaxRowsAtCompileTime = Dynamic,
+    MaxColsAtCompileTime = Dynamic,
+    Flags = RowMajorBit | NestByRefBit,
+    CoeffReadCost = NumTraits<Scalar>::ReadCost,
+    SupportedAccessPatterns = InnerRandomAccessPattern
+  };
+};
+
+template<typename Lhs, typename Rhs>
+struct traits<SlicedEllTimeDenseProduct<Lhs,Rhs> >
+ : traits<ProductBase<SlicedEllTimeDenseProduct<Lhs,Rhs>, Lhs, Rhs> >
+{
+  typedef Dense StorageKind;
+  typedef MatrixXpr XprKind;
+};
+
+} // end namespace internal
+
+/** \ingroup SparseCore_Module
+  * \class SlicedEllMatrix
+  * \brief A sparse matrix stored in the sliced ELLPACK format (SELL-C-sigma) for vectorized products
+  *
+  * The rows are grouped by slices of \a _SliceHeight consecutive rows. Within a slice, the rows are padded with
+  * explicit zeros to the length of the longest one, and the coefficients are stored column of the slice per column
+  * of the slice, such that the k-th coefficients of all the rows of a slice are contiguous in memory. The product
+  * with a dense vector then processes \a _SliceHeight rows at once with independent accumulators, instead of one
+  * row at once as with a row major SparseMatrix, which helps the short rows typical of mesh matrices.
+  *
+  * To limit the amount of padding, the rows are sorted by decreasing number of nonzeros within windows of
+  * sortingScope() consecutive rows before being sliced. A sorting scope of 1 keeps the original order.
+  *
+  * A SlicedEllMatrix is built from any sparse matrix. It supports the products with dense vectors and matrices,
+  * and can be used as the matrix type of the iterative solvers. Since it stores the whole matrix, it must be used
+  * with ConjugateGradient as a full matrix:
+  * \code
+  * SparseMatrix<double> A = ...;
+  * SlicedEllMatrix<double> sA(A);
+  * ConjugateGradient<SlicedEllMatrix<double>, Lower|Upper> cg(sA);
+  * x = cg.solve(b);
+  * \endcode
+  *
+  * \tparam _Scalar the scalar type, i.e. the type of the coefficients
+  * \tparam _SliceHeight the number of rows per slice. Default is 8.
+  * \tparam _Index the type of the indices. It has to be a \b signed type (e.g., short, int, std::ptrdiff_t). Default is \c int.
+  *
+  * \sa class SparseMatrix, class BlockSparseMatrix
+  */
+template<typename _Scalar, int _SliceHeight, typename _Index>
+class SlicedEllMatrix : public EigenBase<SlicedEllMatrix<_Scalar,_SliceHeight,_Index> >
+{
+  public:
+    typedef _Scalar Scalar;
+    typedef _Index Index;
+    typedef typename NumTraits<Scalar>::Real RealScalar;
+    typedef const SlicedEllMatrix& Nested;
+    typedef SlicedEllMatrix PlainObject;
+    typedef Matrix<Index,Dynamic,1> IndexVector;
+    typedef Matrix<Scalar,Dynamic,1> ScalarVector;
+    enum {
+      SliceHeight = _SliceHeight,
+      Flags = internal::traits<SlicedEllMatrix>::Flags,
+      IsRowMajor = 1,
+      IsVectorAtCompileTime = 0,
+      RowsAtCompileTime = Dynamic,
+      ColsAtCompileTime = Dynamic,
+      MaxRowsAtCompileTime = Dynamic,
+      MaxColsAtCompileTime = Dynamic
+    };
+
+    class InnerIterator;
+
+    /** Default constructor yielding an empty \c 0 \c x \c 0 matrix */
+    SlicedEllMatrix() : m_rows(0), m_cols(0), m_sortingScope(256), m_sliceStart(IndexVector::Zero(1)) {}
+
+    /** Constructs a sliced ELLPACK matrix from the sparse matrix \a other, sorting the rows by windows of
+      * \a sortingScope rows */
+    template<typename OtherDerived>
+    SlicedEllMatrix(const SparseMatrixBase<OtherDerived>& other, Index sortingScope = 256)
+      : m_sortingScope(sortingScope)
+    {
+      *this = other.derived();
+    }
+
+    /** Copies the sparse matrix \a other, sorting its rows by windows of sortingScope() rows */
+    template<typename OtherDerived>
+    SlicedEllMatrix& operator=(const SparseMatrixBase<OtherDerived>& other);
+
+    /** Sets the number of consecutive rows within which the rows are sorted by decreasing length by the next
+      * assignment. The default is 256. */
+    SlicedEllMatrix& setSortingScope(Index sortingScope)
+    {
+      eigen_assert(sortingScope>0);
+      m_sortingScope = sortingScope;
+      return *this;
+    }
+
+    /** \returns the number of consecutive rows within which the rows are sorted by decreasing length */
+    Index sortingScope() const { return m_sortingScope; }
+
+    inline Index rows() const { return m_rows; }
+    inline Index cols() const { return m_cols; }
+    /** \returns the number of rows, i.e., the number of inner vectors visited by InnerIterator */
+    inline Index outerSize() const { return m_rows; }
+    /** \returns the number of slices */
+    inline Index slices() const { return Index(m_sliceStart.size())-1; }
+    /** \returns the number of nonzero coefficients, without the padding */
+    inline Index nonZeros() const { return m_rowLength.sum(); }
+    /** \returns the number of stored coefficients, including the padding */
+    inline Index storedCoefficients() const { return m_sliceStart(slices()); }
+
+    /** \returns the starting positions of the slices in valuePtr() and innerIndexPtr() (of size slices()+1) */
+    inline const Index* sliceStartPtr() const { return m_sliceStart.data(); }
+    /** \returns the column indices of the stored coefficients */
+    inline const Index* innerIndexPtr() const { return m_innerIndex.data(); }
+    /** \returns the stored coefficients */
+    inline const Scalar* valuePtr() const { return m_values.data(); }
+    inline Scalar* valuePtr() { return m_values.data(); }
+    /** \returns the original index of each stored row */
+    inline const Index* rowPermutationPtr() const { return m_perm.data(); }
+
+    /** Since a SlicedEllMatrix stores the whole matrix, this returns \c *this, and \a UpLo must be \c Lower|Upper */
+    template<unsigned int UpLo> inline const SlicedEllMatrix& selfadjointView() const
+    {
+      EIGEN_STATIC_ASSERT(UpLo==(Lower|Upper), THIS_METHOD_IS_ONLY_FOR_MATRICES_STORING_BOTH_TRIANGULAR_PARTS);
+      return *this;
+    }
+
+    /** \returns the product of \c *this with the dense vector or matrix \a other */
+    template<typename OtherDerived>
+    inline SlicedEllTimeDenseProduct<SlicedEllMatrix,OtherDerived>
+    operator*(const MatrixBase<OtherDerived>& other) const
+    { return SlicedEllTimeDenseProduct<SlicedEllMatrix,OtherDerived>(*this, other.derived()); }
+
+    /** \internal triggered by dense_matrix = sliced_ell_matrix; */
+    template<typename Dest> void evalTo(Dest& dst) const
+    {
+      dst.setZero(m_rows, m_cols);
+      for(Index j=0; j<m_rows; ++j)
+        for(InnerIterator it(*this, j); it; ++it)
+          dst(it.row(), it.col()) = it.value();
+    }
+
+  protected:
+    Index m_rows;
+    Index m_cols;
+    Index m_sortingScope;
+    IndexVector m_sliceStart;   // start of each slice in m_values and m_innerIndex
+    IndexVector m_innerIndex;   // column of each stored coefficient, the padding points to a valid column
+    ScalarVector m_values;      // the stored coefficients, the padding is zero
+    IndexVector m_perm;         // m_perm(k) is the original index of the k-th stored row
+    IndexVector m_invPerm;      // m_invPerm(i) is the position of the row i
+    IndexVector m_rowLength;    // the number of nonzeros of each stored row
+};
+
+/** \internal
+  * Iterates over the nonzeros of a row of a SlicedEllMatrix, the padding excluded.
+  * This allows the preconditioners reading the diagonal entries to work on a SlicedEllMatrix. */
+template<typename Scalar, int _SliceHeight, typename _Index>
+class SlicedEllMatrix<Scalar,_SliceHeight,_Index>::InnerIterator
+{
+  public:
+    InnerIterator(const SlicedEllMatrix& mat, Index outer)
+      : m_values(mat.valuePtr()), m_indices(mat.innerIndexPtr()), m_outer(outer)
+    {
+      Index k = mat.m_invPerm(outer);
+      m_id = mat.m_sliceStart(k/SliceHeight) + k%SliceHeight;
+      m_end = m_id + mat.m_rowLength(k)*SliceHeight;
+    }
+
+    inline InnerIterator& operator++() { m_id += SliceHeight; return *this; }
+
+    inline const Scalar& value() const { return m_values[m_id]; }
+    inline Index index() const { return m_indices[m_id]; }
+    inline Index outer() const { return m_outer; }
+    inline Index row() const { return m_outer; }
+    inline Index col() const { return index(); }
+
+    inline operator bool() const { return m_id < m_end; }
+
+  protected:
+    const Scalar* m_values;
+    const Index* m_indices;
+    const Index m_outer;
+    Index m_id;
+    Index m_end;
+};
+
+namespace internal {
+
+template<typename Index> struct sell_row_length_greater
+{
+  sell_row_length_greater(const Index* length) : m_length(length) {}
+  bool operator()(Index a, Index b) const { return m_length[a] > m_length[b]; }
+  const Index* m_length;
+};
+
+} // end namespace internal
+
+template<typename Scalar, int _SliceHeight, typename _Index>
+template<typename OtherDerived>
+SlicedEllMatrix<Scalar,_SliceHeight,_Index>&
+SlicedEllMatrix<Scalar,_SliceHeight,_Index>::operator=(const SparseMatrixBase<OtherDerived>& other)
+{
+  typedef SparseMatrix<Scalar,RowMajor,Index> RowMajorMatrix;
+  const RowMajorMatrix mat(other.derived());
+  m_rows = mat.rows();
+  m_cols = mat.cols();
+  const Index nbSlices = (m_rows+SliceHeight-1)/SliceHeight;
+
+  // sort the rows by decreasing length within each window of m_sortingScope rows
+  IndexVector length(m_rows);
+  for(Index i=0; i<m_rows; ++i)
+    length(i) = mat.outerIndexPtr()[i+1] - mat.outerIndexPtr()[i];
+  m_perm.resize(m_rows);
+  for(Index i=0; i<m_rows; ++i)
+    m_perm(i) = i;
+  if(m_sortingScope>1)
+    for(Index i=0; i<m_rows; i+=m_sortingScope)
+      std::stable_sort(m_perm.data()+i, m_perm.data()+(std::min)(i+m_sortingScope,m_rows),
+                       internal::sell_row_length_greater<Index>(length.data()));
+  m_invPerm.resize(m_rows);
+  m_rowLength.resize(m_rows);
+  for(Index k=0; k<m_rows; ++k)
+  {
+    m_invPerm(m_perm(k)) = k;
+    m_rowLength(k) = length(m_perm(k));
+  }
+
+  // the width of a slice is the length of its longest row
+  m_sliceStart.resize(nbSlices+1);
+  m_sliceStart(0) = 0;
+  for(Index s=0; s<nbSlices; ++s)
+  {
+    const Index end = (std::min)((s+1)*SliceHeight, m_rows);
+    Index width = 0;
+    for(Index k=s*SliceHeight; k<end; ++k)
+      width = (std::max)(width, m_rowLength(k));
+    m_sliceStart(s+1) = m_sliceStart(s) + width*SliceHeight;
+  }
+
+  m_values.setZero(storedCoefficients());
+  m_innerIndex.setZero(storedCoefficients());
+  for(Index k=0; k<m_rows; ++k)
+  {
+    Index id = m_sliceStart(k/SliceHeight) + k%SliceHeight;
+    const Index end = m_sliceStart(k/SliceHeight+1);
+    Index lastCol = 0;
+    for(typename RowMajorMatrix::InnerIterator it(mat, m_perm(k)); it; ++it, id+=SliceHeight)
+    {
+      m_values(id) = it.value();
+      m_innerIndex(id) = lastCol = it.index();
+    }
+    // the padding reads an entry of the rhs which is already in cache
+    for(; id<end; id+=SliceHeight)
+      m_innerIndex(id) = lastCol;
+  }
+  return *this;
+}
+
+namespace internal {
+
+// Computes res += alpha * lhs * rhs for a single column rhs. The SliceHeight rows of a slice are processed at once,
+// with one accumulator per row. Since the rows of a slice are independent, the inner loop over the rows of a slice
+// has no dependency and can be vectorized with gather instructions when the target has them.
+// There is no indexed gather among the packet primitives, and emulating it through an aligned buffer followed by
+// pload stalls on store forwarding, so the rhs is read with scalar loads.
+// The slices are independent, they are split among the threads such that each thread processes the same number
+// of stored coefficients.
+template<typename Lhs>
+struct sliced_ell_time_dense_vector_product
+{
+  typedef typename Lhs::Scalar Scalar;
+  typedef typename Lhs::Index Index;
+  enum { SliceHeight = Lhs::SliceHeight };
+
+  static void run(const Lhs& lhs, const Scalar* rhs, Scalar* res, const Scalar& alpha)
+  {
+    const Index n = lhs.slices();
+#ifdef EIGEN_HAS_OPENMP
+    Index threads = sparse_parallel_threads(std::ptrdiff_t(lhs.storedCoefficients()));
+    if(threads>1)
+    {
+      ei_declare_aligned_stack_constructed_variable(Index, starts, (threads+1), 0);
+      sparse_balanced_partition(lhs.sliceStartPtr(), n, threads, starts);
+      #pragma omp parallel for schedule(static,1) num_threads(threads)
+      for(Index t=0; t<threads; ++t)
+        processSlices(lhs, rhs, res, alpha, starts[t], starts[t+1]);
+      return;
+    }
+#endif
+    processSlices(lhs, rhs, res, alpha, 0, n);
+  }
+
+  static void processSlices(const Lhs& lhs, const Scalar* rhs, Scalar* res, const Scalar& alpha, Index begin, Index end)
+  {
+    const Index* sliceStart = lhs.sliceStartPtr();
+    const Index* perm = lhs.rowPermutationPtr();
+    Scalar acc[SliceHeight];
+    for(Index s=begin; s<end; ++s)
+    {
+      for(int l=0; l<SliceHeight; ++l)
+        acc[l] = Scalar(0);
+      const Scalar* values = lhs.valuePtr() + sliceStart[s];
+      const Index* indices = lhs.innerIndexPtr() + sliceStart[s];
+      const Scalar* valuesEnd = lhs.valuePtr() + sliceStart[s+1];
+      for(; values<valuesEnd; values+=SliceHeight, indices+=SliceHeight)
+        for(int l=0; l<SliceHeight; ++l)
+          acc[l] += values[l] * rhs[indices[l]];
+      const Index rowEnd = (std::min)(Index((s+1)*SliceHeight), lhs.rows());
+      for(Index k=s*SliceHeight; k<rowEnd; ++k)
+        res[perm[k]] += alpha*acc[k-s*SliceHeight];
+    }
+  }
+};
+
+template<typename Xpr> struct sliced_ell_has_direct_columns
+{
+  enum {
+    ret = (int(Xpr::Flags)&DirectAccessBit) && !(int(Xpr::Flags)&RowMajorBit)
+       && int(inner_stride_at_compile_time<Xpr>::ret)==1
+  };
+};
+
+// The columns of the rhs and of the result are processed one at once, through temporaries if they are not
+// contiguous in memory.
+template<typename Lhs, typename Rhs, typename Dest, bool DirectDest = sliced_ell_has_direct_columns<Dest>::ret>
+struct sliced_ell_time_dense_product_impl
+{
+  typedef typename Dest::Scalar Scalar;
+  typedef Matrix<Scalar,Dynamic,Dynamic> PlainMatrix;
+  typedef typename Lhs::Index Index;
+
+  static void run(const Lhs& lhs, const Rhs& rhs, Dest& dest, const Scalar& alpha)
+  {
+    typename conditional<sliced_ell_has_direct_columns<Rhs>::ret, const Rhs&, PlainMatrix>::type actualRhs(rhs);
+    for(Index j=0; j<rhs.cols(); ++j)
+      sliced_ell_time_dense_vector_product<Lhs>::run(lhs, actualRhs.data() + j*actualRhs.outerStride(),
+                                                     dest.data() + j*dest.outerStride(), alpha);
+  }
+};
+
+template<typename Lhs, typename Rhs, typename Dest>
+struct sliced_ell_time_dense_product_impl<Lhs,Rhs,Dest,false>
+{
+  typedef typename Dest::Scalar Scalar;
+  typedef Matrix<Scalar,Dynamic,Dynamic> PlainMatrix;
+
+  static void run(const Lhs& lhs, const Rhs& rhs, Dest& dest, const Scalar& alpha)
+  {
+    PlainMatrix res = PlainMatrix::Zero(dest.rows(), dest.cols());
+    sliced_ell_time_dense_product_impl<Lhs,Rhs,PlainMatrix>::run(lhs, rhs, res, alpha);
+    dest += res;
+  }
+};
+
+} // end namespace internal
+
+template<typename Lhs, typename Rhs>
+class SlicedEllTimeDenseProduct
+  : public ProductBase<SlicedEllTimeDenseProduct<Lhs,Rhs>, Lhs, Rhs>
+{
+  public:
+    EIGEN_PRODUCT_PUBLIC_INTERFACE(SlicedEllTimeDenseProduct)
+
+    SlicedEllTimeDenseProduct(const Lhs& lhs, const Rhs& rhs) : Base(lhs,rhs)
+    {}
+
+    template<typename Dest> void scaleAndAddTo(Dest& dest, Scalar alpha) const
+    {
+      internal::sliced_ell_time_dense_product_impl<Lhs,_RhsNested,Dest>::run(m_lhs, m_rhs, dest, alpha);
+    }
+
+  private:
+    SlicedEllTimeDenseProduct& operator=(const SlicedEllTimeDenseProduct&);
+};
+
+#endif // EIGEN_SLICEDELLMATRIX_H
@@ -0,0 +1,235 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef EIGEN_SPARSEASSEMBLYPLAN_H
+#define EIGEN_SPARSEASSEMBLYPLAN_H
+
+/** \ingroup SparseCore_Module
+  *
+  * \class SparseAssemblyPlan
+  *
+  * \brief Parallel and reusable assembly of a sparse matrix from a list of triplets
+  *
+  * This class fills a sparse matrix from a list of triplets like SparseMatrix::setFromTriplets() does,
+  * but in two steps. analyzePattern() computes the sorted and compressed structure of the matrix, and
+  * records which triplets contribute to each of its nonzeros. assemble() then only recomputes the values,
+  * gathering the contributions of each nonzero in the order of the triplets. This is useful when a matrix has
+  * to be assembled many times from triplets having the same row and column indices, e.g., at each Newton
+  * iteration of a finite element code.
+  *
+  * \code
+  * SparseAssemblyPlan<SparseMatrix<double> > plan;
+  * plan.compute(triplets.begin(), triplets.end(), mat);   // same as mat.setFromTriplets(...)
+  * // ... update the values of the triplets ...
+  * plan.assemble(triplets.begin(), triplets.end(), mat);  // only updates the values of mat
+  * \endcode
+  *
+  * Both steps are multithreaded when OpenMP is enabled and the number of triplets is large enough,
+  * and the result does not depend on the number of threads.
+  * As for setFromTriplets(), the matrix must be properly resized beforehand. The triplets must be
+  * accessible through random access iterators, e.g., stored into a std::vector.
+  *
+  * \tparam _MatrixType the type of the sparse matrix to assemble, a SparseMatrix<>
+  *
+  * \sa SparseMatrix::setFromTriplets()
+  */
+template<typename _MatrixType>
+class SparseAssemblyPlan
+{
+  public:
+    typedef _MatrixType MatrixType;
+    typedef typename MatrixType::Scalar Scalar;
+    typedef typename MatrixType::Index Index;
+    typedef typename MatrixType::InnerIndex InnerIndex;
+    enum { IsRowMajor = MatrixType::IsRowMajor };
+
+    SparseAssemblyPlan() : m_isInitialized(false) {}
+
+    /** Computes the structure of the matrix \a mat defined by the triplets [\a begin, \a end).
+      * On output, the values of \a mat are not set. */
+    template<typename InputIterator>
+    void analyzePattern(const InputIterator& begin, const InputIterator& end, MatrixType& mat)
+    {
+      const Index size = Index(end-begin);
+      const Index outerSize = mat.outerSize();
+      Index threads = internal::sparse_parallel_threads(size);
+      Matrix<Index,Dynamic,1> chunks(threads+1);
+      internal::sparse_balanced_partition<Index>(0, size, threads, chunks.data());
+
+      // pass 1: count the triplets per outer vector, for each chunk of triplets
+      Matrix<Index,Dynamic,Dynamic> counts(outerSize, threads);
+      counts.setZero();
+#ifdef EIGEN_HAS_OPENMP
+      #pragma omp parallel for schedule(static,1) num_threads(threads)
+#endif
+      for(Index t=0; t<threads; ++t)
+        for(Index k=chunks[t]; k<chunks[t+1]; ++k)
+          counts(outerOf(begin[k]),t)++;
+
+      // turn the counts into the positions where each chunk starts writing its triplets of each outer vector
+      Matrix<Index,Dynamic,1> tripletOuter(outerSize+1);
+      Index count = 0;
+      for(Index j=0; j<outerSize; ++j)
+      {
+        tripletOuter[j] = count;
+        for(Index t=0; t<threads; ++t)
+        {
+          Index tmp = counts(j,t);
+          counts(j,t) = count;
+          count += tmp;
+        }
+      }
+      tripletOuter[outerSize] = count;
+
+      // pass 2: bucket sort of the triplets per outer vector, preserving their relative order
+      m_order.resize(size);
+#ifdef EIGEN_HAS_OPENMP
+      #pragma omp parallel for schedule(static,1) num_threads(threads)
+#endif
+      for(Index t=0; t<threads; ++t)
+        for(Index k=chunks[t]; k<chunks[t+1]; ++k)
+          m_order[counts(outerOf(begin[k]),t)++] = k;
+
+      // pass 3: sort the triplets of each outer vector by inner index, and count the nonzeros
+      Matrix<Index,Dynamic,1> outerStarts(threads+1);
+      internal::sparse_balanced_partition(tripletOuter.data(), outerSize, threads, outerStarts.data());
+      mat.setZero();
+      mat.makeCompressed();
+      Index* outerIndex = mat.outerIndexPtr();
+#ifdef EIGEN_HAS_OPENMP
+      #pragma omp parallel for schedule(static,1) num_threads(threads)
+#endif
+      for(Index t=0; t<threads; ++t)
+        for(Index j=outerStarts[t]; j<outerStarts[t+1]; ++j)
+        {
+          Index* first = m_order.data()+tripletOuter[j];
+          Index* last  = m_order.data()+tripletOuter[j+1];
+          std::stable_sort(first, last, inner_less<InputIterator>(begin));
+          Index nnz = 0;
+          for(Index* p=first; p<last; ++p)
+            if(p==first || innerOf(begin[*p])!=innerOf(begin[*(p-1)]))
+              ++nnz;
+          outerIndex[j+1] = nnz;
+        }
+
+      outerIndex[0] = 0;
+      for(Index j=0; j<outerSize; ++j)
+        outerIndex[j+1] += outerIndex[j];
+      mat.resizeNonZeros(outerIndex[outerSize]);
+
+      // pass 4: fill the inner indices, and the contributions of each nonzero
+      m_slotStarts.resize(outerIndex[outerSize]+1);
+      m_slotStarts[outerIndex[outerSize]] = size;
+      InnerIndex* innerIndex = mat.innerIndexPtr();
+#ifdef EIGEN_HAS_OPENMP
+      #pragma omp parallel for schedule(static,1) num_threads(threads)
+#endif
+      for(Index t=0; t<threads; ++t)
+        for(Index j=outerStarts[t]; j<outerStarts[t+1]; ++j)
+        {
+          Index s = outerIndex[j];
+          for(Index p=tripletOuter[j]; p<tripletOuter[j+1]; ++p)
+            if(p==tripletOuter[j] || innerOf(begin[m_order[p]])!=innerOf(begin[m_order[p-1]]))
+            {
+              innerIndex[s] = innerOf(begin[m_order[p]]);
+              m_slotStarts[s++] = p;
+            }
+        }
+
+      m_size = size;
+      m_isInitialized = true;
+    }
+
+    /** Computes the values of \a mat from the triplets [\a begin, \a end) which must have the same row and column
+      * indices than the ones given to the last call to analyzePattern(). When several triplets define the same
+      * nonzero, their values are combined in the order of the triplets using the functor \a dup_func:
+      * \code
+      * value = dup_func(OldValue, NewValue)
+      * \endcode
+      */
+    template<typename InputIterator, typename DupFunctor>
+    void assemble(const InputIterator& begin, const InputIterator& end, MatrixType& mat, DupFunctor dup_func) const
+    {
+      eigen_assert(m_isInitialized && "SparseAssemblyPlan is not initialized.");
+      eigen_assert(Index(end-begin)==m_size && mat.isCompressed() && mat.nonZeros()+1==m_slotStarts.size()
+                   && "the structure changed since the last call to analyzePattern()");
+      EIGEN_UNUSED_VARIABLE(end);
+
+      const Index nnz = mat.nonZeros();
+      Index threads = internal::sparse_parallel_threads(m_size);
+      Matrix<Index,Dynamic,1> starts(threads+1);
+      internal::sparse_balanced_partition(m_slotStarts.data(), nnz, threads, starts.data());
+      Scalar* values = mat.valuePtr();
+#ifdef EIGEN_HAS_OPENMP
+      #pragma omp parallel for schedule(static,1) num_threads(threads)
+#endif
+      for(Index t=0; t<threads; ++t)
+        for(Index s=starts[t]; s<starts[t+1]; ++s)
+        {
+          Index p = m_slotStarts[s];
+          Scalar value = begin[m_order[p]].value();
+          for(++p; p<m_slotStarts[s+1]; ++p)
+            value = dup_func(value, Scalar(begin[m_order[p]].value()));
+          values[s] = value;
+        }
+    }
+
+    /** Same as assemble(begin,end,mat,dup_func) with the duplicates summed up. */
+    template<typename InputIterator>
+    void assemble(const InputIterator& begin, const InputIterator& end, MatrixType& mat) const
+    {
+      assemble(begin, end, mat, internal::scalar_sum_op<Scalar>());
+    }
+
+    /** Fills \a mat from the triplets [\a begin, \a end). This is equivalent to analyzePattern() followed by assemble(). */
+    template<typename InputIterator, typename DupFunctor>
+    void compute(const InputIterator& begin, const InputIterator& end, MatrixType& mat, DupFunctor dup_func)
+    {
+      analyzePattern(begin, end, mat);
+      assemble(begin, end, mat, dup_func);
+    }
+
+    /** Same as compute(begin,end,mat,dup_func) with the duplicates summed up. */
+    template<typename InputIterator>
+    void compute(const InputIterator& begin, const InputIterator& end, MatrixType& mat)
+    {
+      compute(begin, end, mat, internal::scalar_sum_op<Scalar>());
+    }
+
+  protected:
+    template<typename Triplet> static Index outerOf(const Triplet& t) { return Index(IsRowMajor ? t.row() : t.col()); }
+    template<typename Triplet> static Index innerOf(const Triplet& t) { return Index(IsRowMajor ? t.col() : t.row()); }
+
+    template<typename InputIterator> struct inner_less
+    {
+      inner_less(const InputIterator& begin) : m_begin(begin) {}
+      bool operator()(Index a, Index b) const { return innerOf(m_begin[a]) < innerOf(m_begin[b]); }
+      InputIterator m_begin;
+    };
+
+    Matrix<Index,Dynamic,1> m_order;       // the triplets sorted by outer index, then inner index, then position
+    Matrix<Index,Dynamic,1> m_slotStarts;  // position in m_order of the first triplet of each nonzero
+    Index m_size;
+    bool m_isInitialized;
+};
+
+#endif // EIGEN_SPARSEASSEMBLYPLAN_H
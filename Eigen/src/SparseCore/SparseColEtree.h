@@ -0,0 +1,119 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef EIGEN_SPARSE_COLETREE_H
+#define EIGEN_SPARSE_COLETREE_H
+
+namespace internal {
+
+/** \internal
+  * Find the root of the tree/set containing the vertex \a i, with path halving. */
+template<typename Index, typename IndexVector>
+Index etree_find(Index i, IndexVector& pp)
+{
+  Index p = pp(i);  // parent
+  Index gp = pp(p); // grand parent
+  while (gp != p)
+  {
+    pp(i) = gp;     // parent pointer on find path is changed to former grand parent
+    i = gp;
+    p = pp(i);
+    gp = pp(p);
+  }
+  return p;
+}
+
+/** \internal
+  * Computes the column elimination tree of the column major matrix \a mat, i.e., the elimination
+  * tree of \f$ A^T A \f$, without forming \f$ A^T A \f$.
+  *
+  * The k-th column of the tree is the column \c perm[k] of \a mat if \a perm is not null.
+  * On output, \a parent holds the parent of each node (\c mat.cols() for the roots), and
+  * \a firstRowElt(i) is the leftmost (permuted) column having a nonzero in the row \c i.
+  * For the purpose of QR factorizations, the diagonal entries are considered as structurally
+  * nonzero even when they are not stored.
+  *
+  * This is the algorithm of J. W. H. Liu for symmetric matrices where each row clique of A
+  * is replaced by a star centered at its first vertex, which has the same fill.
+  */
+template<typename MatrixType, typename IndexVector>
+void coletree(const MatrixType& mat, IndexVector& parent, IndexVector& firstRowElt, const typename MatrixType::Index* perm = 0)
+{
+  typedef typename MatrixType::Index Index;
+  const Index nc = mat.cols();
+  const Index m = mat.rows();
+  const Index diagSize = (std::min)(nc,m);
+  IndexVector root(nc);   // root of subtree of etree
+  root.setZero();
+  IndexVector pp(nc);     // disjoint sets
+  pp.setZero();
+  parent.resize(nc);
+
+  // compute the first nonzero column in each row
+  firstRowElt.resize(m);
+  firstRowElt.setConstant(nc);
+  firstRowElt.head(diagSize).setLinSpaced(diagSize, 0, diagSize-1);
+  for(Index col = 0; col < nc; ++col)
+  {
+    Index pcol = perm ? perm[col] : col;
+    for(typename MatrixType::InnerIterator it(mat, pcol); it; ++it)
+    {
+      Index row = it.index();
+      firstRowElt(row) = (std::min)(firstRowElt(row), col);
+    }
+  }
+
+  for(Index col = 0; col < nc; ++col)
+  {
+    bool found_diag = col>=m;
+    pp(col) = col;
+    Index cset = col;
+    root(cset) = col;
+    parent(col) = nc;
+    // the diagonal element is treated here even if it does not exist in the matrix,
+    // hence the loop is executed once more
+    Index pcol = perm ? perm[col] : col;
+    for(typename MatrixType::InnerIterator it(mat, pcol); it || !found_diag; ++it)
+    {
+      // a sequence of interleaved find and union is performed
+      Index i = col;
+      if(it) i = it.index();
+      if(i == col) found_diag = true;
+
+      Index row = firstRowElt(i);
+      if(row >= col) continue;
+      Index rset = etree_find(row, pp);  // find the name of the set containing row
+      Index rroot = root(rset);
+      if(rroot != col)
+      {
+        parent(rroot) = col;
+        pp(cset) = rset;
+        cset = rset;
+        root(cset) = col;
+      }
+    }
+  }
+}
+
+} // end namespace internal
+
+#endif // EIGEN_SPARSE_COLETREE_H
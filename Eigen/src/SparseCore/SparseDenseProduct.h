@@ -141,6 +141,269 @@ class SparseDenseOuterProduct<Lhs,Rhs,Transpose>::InnerIterator : public _LhsNes
     Scalar m_factor;
 };
 
+namespace internal {
+
+template<typename SparseLhsType, typename DenseRhsType, typename DenseResType,
+         int LhsStorageOrder = ((SparseLhsType::Flags&RowMajorBit)==RowMajorBit) ? RowMajor : ColMajor,
+         bool ColPerCol = ((DenseRhsType::Flags&RowMajorBit)==0) || DenseRhsType::ColsAtCompileTime==1>
+struct sparse_time_dense_product_impl;
+
+// Panel kernels used when the dense operands are column major and have many columns. A panel of Width
+// columns of the rhs is copied into a row major buffer, such that the contribution of each nonzero of the
+// lhs to a row of the result is computed with packets running along the columns of the panel.
+template<typename Scalar, bool Enable>
+struct sparse_time_dense_panel
+{
+  typedef typename packet_traits<Scalar>::type Packet;
+  enum {
+    PacketSize = packet_traits<Scalar>::size,
+    Width = 4*PacketSize
+  };
+  typedef Map<Matrix<Scalar,Dynamic,Width,RowMajor>,Aligned> PanelMap;
+
+  // row major lhs: the rows of the lhs in [begin,end) are reduced against the packed panel.
+  // Returns the index of the first column of rhs which has not been processed.
+  template<typename Lhs, typename Rhs, typename Res, typename Index>
+  static Index runRowMajor(const Lhs& lhs, const Rhs& rhs, Res& res, const Scalar& alpha, Index begin, Index end)
+  {
+    typedef typename Lhs::InnerIterator LhsInnerIterator;
+    const Index panels = rhs.cols()/Width;
+    if(panels==0)
+      return 0;
+    const Index size = rhs.rows()*Width;
+    ei_declare_aligned_stack_constructed_variable(Scalar, rhsPanel, size, 0);
+    EIGEN_ALIGN16 Scalar acc[Width];
+    const Packet pAlpha = pset1<Packet>(alpha);
+    for(Index p=0; p<panels; ++p)
+    {
+      const Index c0 = p*Width;
+      PanelMap(rhsPanel, rhs.rows(), Width) = rhs.middleCols(c0, Width);
+      for(Index j=begin; j<end; ++j)
+      {
+        Packet a0 = pset1<Packet>(Scalar(0)), a1 = a0, a2 = a0, a3 = a0;
+        for(LhsInnerIterator it(lhs,j); it ;++it)
+        {
+          const Packet v = pset1<Packet>(it.value());
+          const Scalar* b = rhsPanel + it.index()*Width;
+          a0 = pmadd(v, pload<Packet>(b),              a0);
+          a1 = pmadd(v, pload<Packet>(b+  PacketSize), a1);
+          a2 = pmadd(v, pload<Packet>(b+2*PacketSize), a2);
+          a3 = pmadd(v, pload<Packet>(b+3*PacketSize), a3);
+        }
+        pstore(acc,              pmul(pAlpha,a0));
+        pstore(acc+  PacketSize, pmul(pAlpha,a1));
+        pstore(acc+2*PacketSize, pmul(pAlpha,a2));
+        pstore(acc+3*PacketSize, pmul(pAlpha,a3));
+        for(Index k=0; k<Width; ++k)
+          res.coeffRef(j,c0+k) += acc[k];
+      }
+    }
+    return panels*Width;
+  }
+
+  // column major lhs: the columns of the lhs in [begin,end) are scattered into a row major result panel
+  // which is eventually added to the result. Returns the index of the first unprocessed column of rhs.
+  template<typename Lhs, typename Rhs, typename Res, typename Index>
+  static Index runColMajor(const Lhs& lhs, const Rhs& rhs, Res& res, const Scalar& alpha, Index begin, Index end)
+  {
+    typedef typename Lhs::InnerIterator LhsInnerIterator;
+    const Index panels = rhs.cols()/Width;
+    if(panels==0)
+      return 0;
+    const Index rhsSize = (end-begin)*Width;
+    const Index resSize = res.rows()*Width;
+    ei_declare_aligned_stack_constructed_variable(Scalar, rhsPanel, rhsSize, 0);
+    ei_declare_aligned_stack_constructed_variable(Scalar, resPanel, resSize, 0);
+    const Packet pAlpha = pset1<Packet>(alpha);
+    for(Index p=0; p<panels; ++p)
+    {
+      const Index c0 = p*Width;
+      PanelMap(rhsPanel, end-begin, Width) = rhs.block(begin, c0, end-begin, Width);
+      PanelMap(resPanel, res.rows(), Width).setZero();
+      for(Index j=begin; j<end; ++j)
+      {
+        const Scalar* b = rhsPanel + (j-begin)*Width;
+        const Packet b0 = pmul(pAlpha, pload<Packet>(b));
+        const Packet b1 = pmul(pAlpha, pload<Packet>(b+  PacketSize));
+        const Packet b2 = pmul(pAlpha, pload<Packet>(b+2*PacketSize));
+        const Packet b3 = pmul(pAlpha, pload<Packet>(b+3*PacketSize));
+        for(LhsInnerIterator it(lhs,j); it ;++it)
+        {
+          const Packet v = pset1<Packet>(it.value());
+          Scalar* r = resPanel + it.index()*Width;
+          pstore(r,              pmadd(v, b0, pload<Packet>(r)));
+          pstore(r+  PacketSize, pmadd(v, b1, pload<Packet>(r+  PacketSize)));
+          pstore(r+2*PacketSize, pmadd(v, b2, pload<Packet>(r+2*PacketSize)));
+          pstore(r+3*PacketSize, pmadd(v, b3, pload<Packet>(r+3*PacketSize)));
+        }
+      }
+      res.middleCols(c0, Width) += PanelMap(resPanel, res.rows(), Width);
+    }
+    return panels*Width;
+  }
+};
+
+// the panel kernels are disabled for vectors, and when the rhs has too few columns at compile time
+template<typename Scalar>
+struct sparse_time_dense_panel<Scalar,false>
+{
+  template<typename Lhs, typename Rhs, typename Res, typename Index>
+  static Index runRowMajor(const Lhs&, const Rhs&, Res&, const Scalar&, Index, Index) { return 0; }
+  template<typename Lhs, typename Rhs, typename Res, typename Index>
+  static Index runColMajor(const Lhs&, const Rhs&, Res&, const Scalar&, Index, Index) { return 0; }
+};
+
+// Row major lhs: each row of the result is computed independently, so that the rows are
+// split among the threads such that each thread processes the same number of nonzeros.
+template<typename SparseLhsType, typename DenseRhsType, typename DenseResType, bool ColPerCol>
+struct sparse_time_dense_product_impl<SparseLhsType,DenseRhsType,DenseResType, RowMajor, ColPerCol>
+{
+  typedef typename internal::remove_all<SparseLhsType>::type Lhs;
+  typedef typename internal::remove_all<DenseRhsType>::type Rhs;
+  typedef typename internal::remove_all<DenseResType>::type Res;
+  typedef typename Lhs::Index Index;
+  typedef typename Lhs::InnerIterator LhsInnerIterator;
+  typedef typename Res::Scalar ResScalar;
+  typedef sparse_time_dense_panel<ResScalar, ColPerCol && int(Rhs::ColsAtCompileTime)!=1
+                                   && (int(Rhs::ColsAtCompileTime)==Dynamic
+                                       || int(Rhs::ColsAtCompileTime)>=4*int(packet_traits<ResScalar>::size))> Panel;
+
+  static void run(const SparseLhsType& lhs, const DenseRhsType& rhs, DenseResType& res, const ResScalar& alpha)
+  {
+    const Index n = lhs.outerSize();
+#ifdef EIGEN_HAS_OPENMP
+    const Index* outer = sparse_outer_index_ptr<Lhs>::run(lhs);
+    Index threads = sparse_parallel_threads(std::ptrdiff_t(outer ? outer[n]-outer[0] : n) * rhs.cols());
+    if(threads>1)
+    {
+      ei_declare_aligned_stack_constructed_variable(Index, starts, (threads+1), 0);
+      sparse_balanced_partition(outer, n, threads, starts);
+      #pragma omp parallel for schedule(static,1) num_threads(threads)
+      for(Index t=0; t<threads; ++t)
+        processRows(lhs, rhs, res, alpha, starts[t], starts[t+1]);
+      return;
+    }
+#endif
+    processRows(lhs, rhs, res, alpha, 0, n);
+  }
+
+  static void processRows(const SparseLhsType& lhs, const DenseRhsType& rhs, DenseResType& res, const ResScalar& alpha, Index begin, Index end)
+  {
+    if(ColPerCol)
+    {
+      for(Index c=Panel::runRowMajor(lhs, rhs, res, alpha, begin, end); c<rhs.cols(); ++c)
+        for(Index j=begin; j<end; ++j)
+        {
+          ResScalar tmp(0);
+          for(LhsInnerIterator it(lhs,j); it ;++it)
+            tmp += it.value() * rhs.coeff(it.index(),c);
+          res.coeffRef(j,c) += alpha * tmp;
+        }
+    }
+    else
+    {
+      for(Index j=begin; j<end; ++j)
+      {
+        typename Res::RowXpr res_j(res.row(j));
+        for(LhsInnerIterator it(lhs,j); it ;++it)
+          res_j += (alpha*it.value()) * rhs.row(it.index());
+      }
+    }
+  }
+};
+
+// Column major lhs: the columns of the lhs are scattered into the result. When multithreading is enabled,
+// the columns are split among the threads, and each thread but the first one accumulates its contribution
+// into a private buffer. The buffers are eventually summed up into the result.
+template<typename SparseLhsType, typename DenseRhsType, typename DenseResType, bool ColPerCol>
+struct sparse_time_dense_product_impl<SparseLhsType,DenseRhsType,DenseResType, ColMajor, ColPerCol>
+{
+  typedef typename internal::remove_all<SparseLhsType>::type Lhs;
+  typedef typename internal::remove_all<DenseRhsType>::type Rhs;
+  typedef typename internal::remove_all<DenseResType>::type Res;
+  typedef typename Lhs::Index Index;
+  typedef typename Lhs::InnerIterator LhsInnerIterator;
+  typedef typename Res::Scalar ResScalar;
+  typedef sparse_time_dense_panel<ResScalar, ColPerCol && int(Rhs::ColsAtCompileTime)!=1
+                                   && (int(Rhs::ColsAtCompileTime)==Dynamic
+                                       || int(Rhs::ColsAtCompileTime)>=4*int(packet_traits<ResScalar>::size))> Panel;
+  typedef Matrix<ResScalar,Dynamic,Dynamic> ResBuffer;
+
+  static void run(const SparseLhsType& lhs, const DenseRhsType& rhs, DenseResType& res, const ResScalar& alpha)
+  {
+    const Index n = lhs.outerSize();
+#ifdef EIGEN_HAS_OPENMP
+    const Index* outer = sparse_outer_index_ptr<Lhs>::run(lhs);
+    Index threads = sparse_parallel_threads(std::ptrdiff_t(outer ? outer[n]-outer[0] : n) * rhs.cols());
+    if(threads>1)
+    {
+      ei_declare_aligned_stack_constructed_variable(Index, starts, (threads+1), 0);
+      sparse_balanced_partition(outer, n, threads, starts);
+      const Index rows = res.rows(), cols = res.cols();
+      ResBuffer buffers(rows, cols*(threads-1));
+      #pragma omp parallel for schedule(static,1) num_threads(threads)
+      for(Index t=0; t<threads; ++t)
+      {
+        if(t==0)
+          processCols(lhs, rhs, res, alpha, starts[0], starts[1]);
+        else
+        {
+          Block<ResBuffer> buffer(buffers, 0, (t-1)*cols, rows, cols);
+          buffer.setZero();
+          processCols(lhs, rhs, buffer, alpha, starts[t], starts[t+1]);
+        }
+      }
+
+      // reduction: the rows of the result are split among the threads
+      #pragma omp parallel for schedule(static,1) num_threads(threads)
+      for(Index t=0; t<threads; ++t)
+      {
+        Index r0 = (rows*t)/threads, r1 = (rows*(t+1))/threads;
+        for(Index k=1; k<threads; ++k)
+          res.middleRows(r0, r1-r0) += buffers.block(r0, (k-1)*cols, r1-r0, cols);
+      }
+      return;
+    }
+#endif
+    processCols(lhs, rhs, res, alpha, 0, n);
+  }
+
+  template<typename Dest>
+  static void processCols(const SparseLhsType& lhs, const DenseRhsType& rhs, Dest& res, const ResScalar& alpha, Index begin, Index end)
+  {
+    if(ColPerCol)
+    {
+      for(Index c=Panel::runColMajor(lhs, rhs, res, alpha, begin, end); c<rhs.cols(); ++c)
+        for(Index j=begin; j<end; ++j)
+        {
+          ResScalar rhs_j = alpha * rhs.coeff(j,c);
+          for(LhsInnerIterator it(lhs,j); it ;++it)
+            res.coeffRef(it.index(),c) += it.value() * rhs_j;
+        }
+    }
+    else
+    {
+      for(Index j=begin; j<end; ++j)
+      {
+        typename Rhs::ConstRowXpr rhs_j(rhs.row(j));
+        for(LhsInnerIterator it(lhs,j); it ;++it)
+          res.row(it.index()) += (alpha*it.value()) * rhs_j;
+      }
+    }
+  }
+};
+
+/** \internal
+  * Computes \a res += \a alpha * \a lhs * \a rhs where \a lhs is sparse, and \a rhs and \a res are dense.
+  * This kernel is multithreaded when OpenMP is enabled and the product is large enough. */
+template<typename SparseLhsType, typename DenseRhsType, typename DenseResType, typename AlphaType>
+inline void sparse_time_dense_product(const SparseLhsType& lhs, const DenseRhsType& rhs, DenseResType& res, const AlphaType& alpha)
+{
+  sparse_time_dense_product_impl<SparseLhsType,DenseRhsType,DenseResType>::run(lhs, rhs, res, alpha);
+}
+
+} // end namespace internal
+
 namespace internal {
 template<typename Lhs, typename Rhs>
 struct traits<SparseTimeDenseProduct<Lhs,Rhs> >
@@ -163,27 +426,7 @@ class SparseTimeDenseProduct
 
     template<typename Dest> void scaleAndAddTo(Dest& dest, Scalar alpha) const
     {
-      typedef typename _LhsNested::InnerIterator LhsInnerIterator;
-      enum {
-        LhsIsRowMajor = (_LhsNested::Flags&RowMajorBit)==RowMajorBit,
-        RhsIsVector   = _RhsNested::ColsAtCompileTime==1
-      };
-      Index j=0;
-      for(j=0; j<m_lhs.outerSize(); ++j)
-      {
-        typename Rhs::Scalar rhs_j = alpha * m_rhs.coeff(LhsIsRowMajor ? 0 : j,0);
-        typename Dest::RowXpr dest_j(dest.row(LhsIsRowMajor ? j : 0));
-        typename Dest::Scalar tmp(0);
-        for(LhsInnerIterator it(m_lhs,j); it ;++it)
-        {
-          if(LhsIsRowMajor && RhsIsVector)  tmp += (it.value()) * m_rhs.coeff(it.index());
-          else if(LhsIsRowMajor)            dest_j += (alpha*it.value()) * m_rhs.row(it.index());
-          else if(RhsIsVector)              dest.coeffRef(it.index()) += it.value() * rhs_j;
-          else                              dest.row(it.index()) += (alpha*it.value()) * m_rhs.row(j);
-        }
-        if(LhsIsRowMajor && RhsIsVector)
-          dest.coeffRef(LhsIsRowMajor ? j : 0) = alpha * tmp;
-      }
+      internal::sparse_time_dense_product(m_lhs, m_rhs, dest, alpha);
     }
 
   private:
@@ -211,13 +454,13 @@ class DenseTimeSparseProduct
     DenseTimeSparseProduct(const Lhs& lhs, const Rhs& rhs) : Base(lhs,rhs)
     {}
 
+    // evaluated as dest^T += alpha * rhs^T * lhs^T
     template<typename Dest> void scaleAndAddTo(Dest& dest, Scalar alpha) const
     {
-      typedef typename _RhsNested::InnerIterator RhsInnerIterator;
-      enum { RhsIsRowMajor = (_RhsNested::Flags&RowMajorBit)==RowMajorBit };
-      for(Index j=0; j<m_rhs.outerSize(); ++j)
-        for(RhsInnerIterator i(m_rhs,j); i; ++i)
-          dest.col(RhsIsRowMajor ? i.index() : j) += (alpha*i.value()) * m_lhs.col(RhsIsRowMajor ? j : i.index());
+      Transpose<const _LhsNested> lhs_t(m_lhs);
+      Transpose<const _RhsNested> rhs_t(m_rhs);
+      Transpose<Dest> dest_t(dest);
+      internal::sparse_time_dense_product(rhs_t, lhs_t, dest_t, alpha);
     }
 
   private:
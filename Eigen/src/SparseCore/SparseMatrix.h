@@ -46,14 +46,22 @@
   * \tparam _Options Union of bit flags controlling the storage scheme. Currently the only possibility
   *                 is RowMajor. The default is 0 which means column-major.
   * \tparam _Index the type of the indices. It has to be a \b signed type (e.g., short, int, std::ptrdiff_t). Default is \c int.
+  * \tparam _InnerIndex the type of the stored inner indices. It has to be a \b signed type large enough to hold
+  *                    innerSize()-1. Default is \c _Index.
+  *
+  * The positions of the non zeros, i.e., the outer index array, are stored with the type \c _Index, whereas the inner
+  * index of each non zero is stored with the type \c _InnerIndex. Matrices having more than 2^31 non zeros but
+  * less than 2^31 rows and columns can thus be stored with a 64 bits \c _Index and a 32 bits \c _InnerIndex,
+  * such that the index traffic of the products is not doubled. A 16 bits \c _InnerIndex is also possible for
+  * small local blocks.
   *
   * This class can be extended with the help of the plugin mechanism described on the page
   * \ref TopicCustomizingEigen by defining the preprocessor symbol \c EIGEN_SPARSEMATRIX_PLUGIN.
   */
 
 namespace internal {
-template<typename _Scalar, int _Options, typename _Index>
-struct traits<SparseMatrix<_Scalar, _Options, _Index> >
+template<typename _Scalar, int _Options, typename _Index, typename _InnerIndex>
+struct traits<SparseMatrix<_Scalar, _Options, _Index, _InnerIndex> >
 {
   typedef _Scalar Scalar;
   typedef _Index Index;
@@ -70,10 +78,10 @@ struct traits<SparseMatrix<_Scalar, _Options, _Index> >
   };
 };
 
-template<typename _Scalar, int _Options, typename _Index, int DiagIndex>
-struct traits<Diagonal<const SparseMatrix<_Scalar, _Options, _Index>, DiagIndex> >
+template<typename _Scalar, int _Options, typename _Index, typename _InnerIndex, int DiagIndex>
+struct traits<Diagonal<const SparseMatrix<_Scalar, _Options, _Index, _InnerIndex>, DiagIndex> >
 {
-  typedef SparseMatrix<_Scalar, _Options, _Index> MatrixType;
+  typedef SparseMatrix<_Scalar, _Options, _Index, _InnerIndex> MatrixType;
   typedef typename nested<MatrixType>::type MatrixTypeNested;
   typedef typename remove_reference<MatrixTypeNested>::type _MatrixTypeNested;
 
@@ -94,9 +102,9 @@ struct traits<Diagonal<const SparseMatrix<_Scalar, _Options, _Index>, DiagIndex>
 
 } // end namespace internal
 
-template<typename _Scalar, int _Options, typename _Index>
+template<typename _Scalar, int _Options, typename _Index, typename _InnerIndex>
 class SparseMatrix
-  : public SparseMatrixBase<SparseMatrix<_Scalar, _Options, _Index> >
+  : public SparseMatrixBase<SparseMatrix<_Scalar, _Options, _Index, _InnerIndex> >
 {
   public:
     EIGEN_SPARSE_PUBLIC_INTERFACE(SparseMatrix)
@@ -105,14 +113,15 @@ class SparseMatrix
 
     typedef MappedSparseMatrix<Scalar,Flags> Map;
     using Base::IsRowMajor;
-    typedef internal::CompressedStorage<Scalar,Index> Storage;
+    typedef _InnerIndex InnerIndex;
+    typedef internal::CompressedStorage<Scalar,InnerIndex> Storage;
     enum {
       Options = _Options
     };
 
   protected:
 
-    typedef SparseMatrix<Scalar,(Flags&~RowMajorBit)|(IsRowMajor?RowMajorBit:0)> TransposedSparseMatrix;
+    typedef SparseMatrix<Scalar,(Flags&~RowMajorBit)|(IsRowMajor?RowMajorBit:0),Index,InnerIndex> TransposedSparseMatrix;
 
     Index m_outerSize;
     Index m_innerSize;
@@ -150,11 +159,11 @@ class SparseMatrix
     /** \returns a const pointer to the array of inner indices.
       * This function is aimed at interoperability with other libraries.
       * \sa valuePtr(), outerIndexPtr() */
-    inline const Index* innerIndexPtr() const { return &m_data.index(0); }
+    inline const InnerIndex* innerIndexPtr() const { return &m_data.index(0); }
     /** \returns a non-const pointer to the array of inner indices.
       * This function is aimed at interoperability with other libraries.
       * \sa valuePtr(), outerIndexPtr() */
-    inline Index* innerIndexPtr() { return &m_data.index(0); }
+    inline InnerIndex* innerIndexPtr() { return &m_data.index(0); }
 
     /** \returns a const pointer to the array of the starting positions of the inner vectors.
       * This function is aimed at interoperability with other libraries.
@@ -403,7 +412,7 @@ class SparseMatrix
       * \sa insertBack, insertBackByOuterInner */
     inline void startVec(Index outer)
     {
-      eigen_assert(m_outerIndex[outer]==int(m_data.size()) && "You must call startVec for each inner vector sequentially");
+      eigen_assert(size_t(m_outerIndex[outer])==m_data.size() && "You must call startVec for each inner vector sequentially");
       eigen_assert(m_outerIndex[outer+1]==0 && "You must call startVec for each inner vector sequentially");
       m_outerIndex[outer+1] = m_outerIndex[outer];
     }
@@ -434,7 +443,13 @@ class SparseMatrix
     template<typename InputIterators>
     void setFromTriplets(const InputIterators& begin, const InputIterators& end);
 
-    void sumupDuplicates();
+    template<typename InputIterators,typename DupFunctor>
+    void setFromTriplets(const InputIterators& begin, const InputIterators& end, DupFunctor dup_func);
+
+    void sumupDuplicates() { collapseDuplicates(internal::scalar_sum_op<Scalar>()); }
+
+    template<typename DupFunctor>
+    void collapseDuplicates(DupFunctor dup_func);
 
     //---
     
@@ -522,6 +537,8 @@ class SparseMatrix
     {
       const Index outerSize = IsRowMajor ? rows : cols;
       m_innerSize = IsRowMajor ? cols : rows;
+      eigen_assert((m_innerSize==0 || Index(InnerIndex(m_innerSize-1))==m_innerSize-1)
+                   && "the inner size is too large for the InnerIndex type");
       m_data.clear();
       if (m_outerSize != outerSize || m_outerSize==0)
       {
@@ -670,7 +687,7 @@ class SparseMatrix
           for (typename _OtherCopy::InnerIterator it(otherCopy, j); it; ++it)
           {
             Index pos = positions[it.index()]++;
-            m_data.index(pos) = j;
+            m_data.index(pos) = static_cast<InnerIndex>(j);
             m_data.value(pos) = it.value();
           }
         }
@@ -693,8 +710,8 @@ class SparseMatrix
         else
           for (Index i=0; i<m.outerSize(); ++i)
           {
-            int p = m.m_outerIndex[i];
-            int pe = m.m_outerIndex[i]+m.m_innerNonZeros[i];
+            Index p = m.m_outerIndex[i];
+            Index pe = m.m_outerIndex[i]+m.m_innerNonZeros[i];
             Index k=p;
             for (; k<pe; ++k)
               s << "(" << m.m_data.value(k) << "," << m.m_data.index(k) << ") ";
@@ -853,7 +870,7 @@ protected:
         --p;
       }
 
-      m_data.index(p) = inner;
+      m_data.index(p) = static_cast<InnerIndex>(inner);
       return (m_data.value(p) = 0);
     }
 
@@ -900,7 +917,7 @@ protected:
 
       m_innerNonZeros[outer]++;
 
-      m_data.index(p) = inner;
+      m_data.index(p) = static_cast<InnerIndex>(inner);
       return (m_data.value(p) = 0);
     }
 
@@ -917,7 +934,7 @@ public:
 
       Index p = m_outerIndex[outer] + m_innerNonZeros[outer];
       m_innerNonZeros[outer]++;
-      m_data.index(p) = inner;
+      m_data.index(p) = static_cast<InnerIndex>(inner);
       return (m_data.value(p) = 0);
     }
 
@@ -925,6 +942,7 @@ private:
   static void check_template_parameters()
   {
     EIGEN_STATIC_ASSERT(NumTraits<Index>::IsSigned,THE_INDEX_TYPE_MUST_BE_A_SIGNED_TYPE);
+    EIGEN_STATIC_ASSERT(NumTraits<InnerIndex>::IsSigned,THE_INDEX_TYPE_MUST_BE_A_SIGNED_TYPE);
   }
 
   struct default_prunning_func {
@@ -938,8 +956,8 @@ private:
   };
 };
 
-template<typename Scalar, int _Options, typename _Index>
-class SparseMatrix<Scalar,_Options,_Index>::InnerIterator
+template<typename Scalar, int _Options, typename _Index, typename _InnerIndex>
+class SparseMatrix<Scalar,_Options,_Index,_InnerIndex>::InnerIterator
 {
   public:
     InnerIterator(const SparseMatrix& mat, Index outer)
@@ -965,14 +983,14 @@ class SparseMatrix<Scalar,_Options,_Index>::InnerIterator
 
   protected:
     const Scalar* m_values;
-    const Index* m_indices;
+    const InnerIndex* m_indices;
     const Index m_outer;
     Index m_id;
     Index m_end;
 };
 
-template<typename Scalar, int _Options, typename _Index>
-class SparseMatrix<Scalar,_Options,_Index>::ReverseInnerIterator
+template<typename Scalar, int _Options, typename _Index, typename _InnerIndex>
+class SparseMatrix<Scalar,_Options,_Index,_InnerIndex>::ReverseInnerIterator
 {
   public:
     ReverseInnerIterator(const SparseMatrix& mat, Index outer)
@@ -998,7 +1016,7 @@ class SparseMatrix<Scalar,_Options,_Index>::ReverseInnerIterator
 
   protected:
     const Scalar* m_values;
-    const Index* m_indices;
+    const InnerIndex* m_indices;
     const Index m_outer;
     Index m_id;
     const Index m_start;
@@ -1006,17 +1024,17 @@ class SparseMatrix<Scalar,_Options,_Index>::ReverseInnerIterator
 
 namespace internal {
 
-template<typename InputIterator, typename SparseMatrixType>
-void set_from_triplets(const InputIterator& begin, const InputIterator& end, SparseMatrixType& mat, int Options = 0)
+template<typename InputIterator, typename SparseMatrixType, typename DupFunctor>
+void set_from_triplets(const InputIterator& begin, const InputIterator& end, SparseMatrixType& mat, DupFunctor dup_func)
 {
-  EIGEN_UNUSED_VARIABLE(Options);
   enum { IsRowMajor = SparseMatrixType::IsRowMajor };
   typedef typename SparseMatrixType::Scalar Scalar;
   typedef typename SparseMatrixType::Index Index;
-  SparseMatrix<Scalar,IsRowMajor?ColMajor:RowMajor> trMat(mat.rows(),mat.cols());
+  typedef typename SparseMatrixType::InnerIndex InnerIndex;
+  SparseMatrix<Scalar,IsRowMajor?ColMajor:RowMajor,Index,InnerIndex> trMat(mat.rows(),mat.cols());
 
   // pass 1: count the nnz per inner-vector
-  VectorXi wi(trMat.outerSize());
+  Matrix<Index,Dynamic,1> wi(trMat.outerSize());
   wi.setZero();
   for(InputIterator it(begin); it!=end; ++it)
     wi(IsRowMajor ? it->col() : it->row())++;
@@ -1027,7 +1045,7 @@ void set_from_triplets(const InputIterator& begin, const InputIterator& end, Spa
     trMat.insertBackUncompressed(it->row(),it->col()) = it->value();
 
   // pass 3:
-  trMat.sumupDuplicates();
+  trMat.collapseDuplicates(dup_func);
 
   // pass 4: transposed copy -> implicit sorting
   mat = trMat;
@@ -1073,24 +1091,43 @@ void set_from_triplets(const InputIterator& begin, const InputIterator& end, Spa
   * an abstract iterator over a complex data-structure that would be expensive to evaluate. The triplets should rather
   * be explicitely stored into a std::vector for instance.
   */
-template<typename Scalar, int _Options, typename _Index>
+template<typename Scalar, int _Options, typename _Index, typename _InnerIndex>
 template<typename InputIterators>
-void SparseMatrix<Scalar,_Options,_Index>::setFromTriplets(const InputIterators& begin, const InputIterators& end)
+void SparseMatrix<Scalar,_Options,_Index,_InnerIndex>::setFromTriplets(const InputIterators& begin, const InputIterators& end)
+{
+  internal::set_from_triplets(begin, end, *this, internal::scalar_sum_op<Scalar>());
+}
+
+/** The same as setFromTriplets but when duplicates are met the functor \a dup_func is applied:
+  * \code
+  * value = dup_func(OldValue, NewValue)
+  * \endcode
+  * Here is a C++11 example keeping the latest entry only:
+  * \code
+  * mat.setFromTriplets(triplets.begin(), triplets.end(), [] (const Scalar&,const Scalar &b) { return b; });
+  * \endcode
+  *
+  * \sa SparseAssemblyPlan for repeated assemblies of the same structure
+  */
+template<typename Scalar, int _Options, typename _Index, typename _InnerIndex>
+template<typename InputIterators,typename DupFunctor>
+void SparseMatrix<Scalar,_Options,_Index,_InnerIndex>::setFromTriplets(const InputIterators& begin, const InputIterators& end, DupFunctor dup_func)
 {
-  internal::set_from_triplets(begin, end, *this);
+  internal::set_from_triplets(begin, end, *this, dup_func);
 }
 
 /** \internal */
-template<typename Scalar, int _Options, typename _Index>
-void SparseMatrix<Scalar,_Options,_Index>::sumupDuplicates()
+template<typename Scalar, int _Options, typename _Index, typename _InnerIndex>
+template<typename DupFunctor>
+void SparseMatrix<Scalar,_Options,_Index,_InnerIndex>::collapseDuplicates(DupFunctor dup_func)
 {
   eigen_assert(!isCompressed());
   // TODO, in practice we should be able to use m_innerNonZeros for that task
-  VectorXi wi(innerSize());
+  Matrix<Index,Dynamic,1> wi(innerSize());
   wi.fill(-1);
   Index count = 0;
   // for each inner-vector, wi[inner_index] will hold the position of first element into the index/value buffers
-  for(int j=0; j<outerSize(); ++j)
+  for(Index j=0; j<outerSize(); ++j)
   {
     Index start   = count;
     Index oldEnd  = m_outerIndex[j]+m_innerNonZeros[j];
@@ -1100,7 +1137,7 @@ void SparseMatrix<Scalar,_Options,_Index>::sumupDuplicates()
       if(wi(i)>=start)
       {
         // we already meet this entry => accumulate it
-        m_data.value(wi(i)) += m_data.value(k);
+        m_data.value(wi(i)) = dup_func(m_data.value(wi(i)), m_data.value(k));
       }
       else
       {
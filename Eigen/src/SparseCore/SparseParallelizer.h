@@ -0,0 +1,107 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef EIGEN_SPARSE_PARALLELIZER_H
+#define EIGEN_SPARSE_PARALLELIZER_H
+
+/** \internal
+  * The minimal amount of work, roughly measured in number of nonzeros to process,
+  * for which a sparse kernel is worth being multithreaded.
+  * This threshold has been found experimentally on 2D and 3D Poisson problems.
+  */
+#ifndef EIGEN_SPARSE_PARALLEL_THRESHOLD
+#define EIGEN_SPARSE_PARALLEL_THRESHOLD 20000
+#endif
+
+namespace internal {
+
+/** \internal
+  * \returns the number of threads to use for a sparse kernel involving \a work operations.
+  * It is one if OpenMP is not enabled, if we are already in a parallel session,
+  * or if \a work is too small. */
+inline int sparse_parallel_threads(std::ptrdiff_t work)
+{
+#ifdef EIGEN_HAS_OPENMP
+  if(omp_get_num_threads()>1 || work < EIGEN_SPARSE_PARALLEL_THRESHOLD)
+    return 1;
+  return std::max<int>(1, nbThreads());
+#else
+  EIGEN_UNUSED_VARIABLE(work);
+  return 1;
+#endif
+}
+
+/** \internal
+  * \returns a pointer to the starting positions of the inner vectors of \a mat if they are
+  * directly available, and the null pointer otherwise.
+  */
+template<typename T> struct sparse_outer_index_ptr
+{
+  static const typename T::Index* run(const T&) { return 0; }
+};
+
+template<typename Scalar, int Options, typename Index, typename InnerIndex>
+struct sparse_outer_index_ptr<SparseMatrix<Scalar,Options,Index,InnerIndex> >
+{
+  static const Index* run(const SparseMatrix<Scalar,Options,Index,InnerIndex>& mat) { return mat.outerIndexPtr(); }
+};
+
+template<typename Scalar, int Options, typename Index>
+struct sparse_outer_index_ptr<MappedSparseMatrix<Scalar,Options,Index> >
+{
+  static const Index* run(const MappedSparseMatrix<Scalar,Options,Index>& mat) { return mat.outerIndexPtr(); }
+};
+
+// the inner vectors of the transpose are the ones of the nested expression
+template<typename MatrixType>
+struct sparse_outer_index_ptr<Transpose<MatrixType> >
+{
+  typedef typename remove_all<MatrixType>::type _MatrixType;
+  static const typename _MatrixType::Index* run(const Transpose<MatrixType>& mat)
+  { return sparse_outer_index_ptr<_MatrixType>::run(mat.nestedExpression()); }
+};
+
+/** \internal
+  * Splits the \a n inner vectors starting at \a outer into \a threads contiguous chunks having roughly the
+  * same number of nonzeros. On output, the k-th chunk is [\a starts[k], \a starts[k+1]).
+  * If \a outer is null, then the chunks have the same number of inner vectors.
+  */
+template<typename Index>
+void sparse_balanced_partition(const Index* outer, Index n, Index threads, Index* starts)
+{
+  starts[0] = 0;
+  starts[threads] = n;
+  for(Index k=1; k<threads; ++k)
+  {
+    if(outer)
+    {
+      std::ptrdiff_t target = outer[0] + std::ptrdiff_t((double(outer[n]-outer[0]) * k) / threads);
+      starts[k] = Index(std::lower_bound(outer+starts[k-1], outer+n, target) - outer);
+    }
+    else
+      starts[k] = Index((std::ptrdiff_t(n) * k) / threads);
+  }
+}
+
+} // end namespace internal
+
+#endif // EIGEN_SPARSE_PARALLELIZER_H
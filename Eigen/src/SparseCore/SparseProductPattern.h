@@ -0,0 +1,210 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef EIGEN_SPARSEPRODUCTPATTERN_H
+#define EIGEN_SPARSEPRODUCTPATTERN_H
+
+/** \ingroup SparseCore_Module
+  *
+  * \class SparseProductPattern
+  *
+  * \brief Sparse * sparse product with a reusable structure
+  *
+  * This class computes the product of two sparse matrices in two steps. analyzePattern() computes the
+  * structure of the result, and records where each elementary product lhs(i,k)*rhs(k,j) has to be
+  * accumulated. evaluate() then only recomputes the values of the result, without any memory
+  * allocation nor sorting. This is useful when the same product has to be evaluated many times with
+  * different values but the same sparsity patterns, e.g., for Galerkin projections or Jacobian
+  * updates in time stepping schemes.
+  *
+  * \code
+  * SparseProductPattern<SparseMatrix<double> > prod;
+  * prod.compute(A, B, C);       // computes C = A * B
+  * // ... update the values of A and B ...
+  * prod.evaluate(A, B, C);      // updates the values of C
+  * \endcode
+  *
+  * The two factors and the result must all be of type \a _MatrixType, and the factors must be in
+  * compressed mode. The inner indices of each inner vector of the result are sorted.
+  * Both steps are multithreaded when OpenMP is enabled and the product is large enough.
+  *
+  * \tparam _MatrixType the type of the sparse matrices, a SparseMatrix<>
+  *
+  * \warning The scatter map stores one index per elementary product, that is as many as the
+  *          number of flops of the product.
+  */
+template<typename _MatrixType>
+class SparseProductPattern
+{
+  public:
+    typedef _MatrixType MatrixType;
+    typedef typename MatrixType::Scalar Scalar;
+    typedef typename MatrixType::Index Index;
+    typedef typename MatrixType::InnerIndex InnerIndex;
+
+    SparseProductPattern() : m_isInitialized(false) {}
+
+    /** Computes the structure of \a res = \a lhs * \a rhs, and the scatter map used by evaluate().
+      * Only the structures of the factors are read, and the values of \a res are not set. */
+    void analyzePattern(const MatrixType& lhs, const MatrixType& rhs, MatrixType& res)
+    {
+      eigen_assert(lhs.cols()==rhs.rows() && "invalid matrix product");
+      eigen_assert(lhs.isCompressed() && rhs.isCompressed() && "the factors must be in compressed mode");
+
+      // the outer vectors of the result are formed from the outer vectors of the "right" factor
+      const MatrixType& left  = MatrixType::IsRowMajor ? rhs : lhs;
+      const MatrixType& right = MatrixType::IsRowMajor ? lhs : rhs;
+      const Index outerSize = right.outerSize();
+      const Index innerSize = left.innerSize();
+
+      // number of elementary products per outer vector
+      const Index* lOuter = left.outerIndexPtr();
+      const InnerIndex* lInner = left.innerIndexPtr();
+      const Index* rOuter = right.outerIndexPtr();
+      const InnerIndex* rInner = right.innerIndexPtr();
+      m_flops.resize(outerSize+1);
+      m_flops[0] = 0;
+      for(Index j=0; j<outerSize; ++j)
+      {
+        Index count = 0;
+        for(Index q=rOuter[j]; q<rOuter[j+1]; ++q)
+          count += lOuter[rInner[q]+1] - lOuter[rInner[q]];
+        m_flops[j+1] = m_flops[j] + count;
+      }
+      Index threads = internal::sparse_parallel_threads(m_flops[outerSize]);
+      Matrix<Index,Dynamic,1> starts(threads+1);
+      internal::sparse_balanced_partition(m_flops.data(), outerSize, threads, starts.data());
+
+      // the structure of the result is computed from the structures of the factors only
+      res.resize(lhs.rows(), rhs.cols());
+      res.makeCompressed();
+      Index* resOuter = res.outerIndexPtr();
+#ifdef EIGEN_HAS_OPENMP
+      #pragma omp parallel for schedule(static,1) num_threads(threads)
+#endif
+      for(Index t=0; t<threads; ++t)
+        internal::conservative_sparse_sparse_product_count(left, right, starts[t], starts[t+1], resOuter);
+      resOuter[0] = 0;
+      for(Index j=0; j<outerSize; ++j)
+        resOuter[j+1] += resOuter[j];
+      res.resizeNonZeros(resOuter[outerSize]);
+      InnerIndex* resInner = res.innerIndexPtr();
+
+      // sorted inner indices of the result, and scatter map: position in res of each elementary product,
+      // in the order they are enumerated by evaluate()
+      m_map.resize(m_flops[outerSize]);
+#ifdef EIGEN_HAS_OPENMP
+      #pragma omp parallel for schedule(static,1) num_threads(threads)
+#endif
+      for(Index t=0; t<threads; ++t)
+      {
+        Matrix<Index,Dynamic,1> mask, position(innerSize);
+        mask.setConstant(innerSize, -1);
+        for(Index j=starts[t]; j<starts[t+1]; ++j)
+        {
+          // the inner indices already reached by the j-th outer vector are marked with j
+          Index k = resOuter[j];
+          for(Index q=rOuter[j]; q<rOuter[j+1]; ++q)
+            for(Index p=lOuter[rInner[q]]; p<lOuter[rInner[q]+1]; ++p)
+              if(mask[lInner[p]]!=j)
+              {
+                mask[lInner[p]] = j;
+                resInner[k++] = lInner[p];
+              }
+          std::sort(resInner+resOuter[j], resInner+resOuter[j+1]);
+          for(Index p=resOuter[j]; p<resOuter[j+1]; ++p)
+            position[resInner[p]] = p;
+          Index f = m_flops[j];
+          for(Index q=rOuter[j]; q<rOuter[j+1]; ++q)
+            for(Index p=lOuter[rInner[q]]; p<lOuter[rInner[q]+1]; ++p)
+              m_map[f++] = position[lInner[p]];
+        }
+      }
+
+      m_lhsNonZeros = lhs.nonZeros();
+      m_rhsNonZeros = rhs.nonZeros();
+      m_resNonZeros = res.nonZeros();
+      m_isInitialized = true;
+    }
+
+    /** Computes the values of \a res = \a lhs * \a rhs. The structures of \a lhs, \a rhs, and \a res must
+      * be the ones given to the last call to analyzePattern(). */
+    void evaluate(const MatrixType& lhs, const MatrixType& rhs, MatrixType& res) const
+    {
+      eigen_assert(m_isInitialized && "SparseProductPattern is not initialized.");
+      eigen_assert(lhs.isCompressed() && rhs.isCompressed() && res.isCompressed());
+      eigen_assert(lhs.nonZeros()==m_lhsNonZeros && rhs.nonZeros()==m_rhsNonZeros && res.nonZeros()==m_resNonZeros
+                   && "the sparsity patterns changed since the last call to analyzePattern()");
+
+      const MatrixType& left  = MatrixType::IsRowMajor ? rhs : lhs;
+      const MatrixType& right = MatrixType::IsRowMajor ? lhs : rhs;
+      const Index outerSize = right.outerSize();
+
+      Index threads = internal::sparse_parallel_threads(m_flops[outerSize]);
+      Matrix<Index,Dynamic,1> starts(threads+1);
+      internal::sparse_balanced_partition(m_flops.data(), outerSize, threads, starts.data());
+#ifdef EIGEN_HAS_OPENMP
+      #pragma omp parallel for schedule(static,1) num_threads(threads)
+#endif
+      for(Index t=0; t<threads; ++t)
+        evaluateOuterVectors(left, right, res, starts[t], starts[t+1]);
+    }
+
+    /** Computes \a res = \a lhs * \a rhs. This is equivalent to analyzePattern() followed by evaluate(). */
+    void compute(const MatrixType& lhs, const MatrixType& rhs, MatrixType& res)
+    {
+      analyzePattern(lhs, rhs, res);
+      evaluate(lhs, rhs, res);
+    }
+
+  protected:
+    void evaluateOuterVectors(const MatrixType& left, const MatrixType& right, MatrixType& res, Index begin, Index end) const
+    {
+      const Index* lOuter = left.outerIndexPtr();
+      const Scalar* lValues = left.valuePtr();
+      const Index* rOuter = right.outerIndexPtr();
+      const InnerIndex* rInner = right.innerIndexPtr();
+      const Scalar* rValues = right.valuePtr();
+      const Index* resOuter = res.outerIndexPtr();
+      Scalar* resValues = res.valuePtr();
+
+      std::fill(resValues+resOuter[begin], resValues+resOuter[end], Scalar(0));
+      const Index* map = m_map.data() + m_flops[begin];
+      for(Index j=begin; j<end; ++j)
+        for(Index q=rOuter[j]; q<rOuter[j+1]; ++q)
+        {
+          // the left factor is the lhs for column major matrices, and the rhs for row major ones
+          const Scalar y = rValues[q];
+          for(Index p=lOuter[rInner[q]]; p<lOuter[rInner[q]+1]; ++p)
+            resValues[*map++] += MatrixType::IsRowMajor ? y * lValues[p] : lValues[p] * y;
+        }
+    }
+
+    Matrix<Index,Dynamic,1> m_map;
+    Matrix<Index,Dynamic,1> m_flops;
+    Index m_lhsNonZeros;
+    Index m_rhsNonZeros;
+    Index m_resNonZeros;
+    bool m_isInitialized;
+};
+
+#endif // EIGEN_SPARSEPRODUCTPATTERN_H
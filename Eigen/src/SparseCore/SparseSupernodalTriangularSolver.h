@@ -0,0 +1,376 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef EIGEN_SPARSESUPERNODALTRIANGULARSOLVER_H
+#define EIGEN_SPARSESUPERNODALTRIANGULARSOLVER_H
+
+/** Supernodes narrower than this number of columns are solved column per column rather than with
+  * dense blocked kernels. */
+#ifndef EIGEN_SPARSE_SUPERNODE_MIN_WIDTH
+#define EIGEN_SPARSE_SUPERNODE_MIN_WIDTH 4
+#endif
+
+/** Minimal number of right hand sides for which the direct solvers use the blocked triangular solves. */
+#ifndef EIGEN_SPARSE_SUPERNODE_MIN_RHS
+#define EIGEN_SPARSE_SUPERNODE_MIN_RHS 8
+#endif
+
+/** Number of right hand side columns solved at once. */
+#ifndef EIGEN_SPARSE_SUPERNODE_PANEL_WIDTH
+#define EIGEN_SPARSE_SUPERNODE_PANEL_WIDTH 64
+#endif
+
+/** \ingroup SparseCore_Module
+  *
+  * \class SparseSupernodalTriangularSolver
+  *
+  * \brief Blocked sparse triangular solves for many right hand sides
+  *
+  * This class detects the supernodes of a column major sparse triangular factor, i.e., the sets of
+  * consecutive columns sharing the same structure below (resp. above) their diagonal block, and solves
+  * triangular systems with many right hand sides using dense level-3 kernels. For each supernode,
+  * the dense diagonal block is solved with a dense triangular solve, and the contribution of the
+  * off-diagonal block to the other unknowns is computed with a dense matrix product.
+  *
+  * The analysis only depends on the sparsity pattern of the factor. The values are read from the matrix
+  * given to solveInPlace(), and can thus change as long as the pattern remains the same.
+  *
+  * \code
+  * SparseSupernodalTriangularSolver<SparseMatrix<double> > solver;
+  * solver.analyze<Lower>(L);              // X = L.triangularView<Lower>().solve(X);
+  * solver.solveInPlace(L, X);
+  * solver.analyzeAdjoint<Upper>(L);       // X = L.adjoint().triangularView<Upper>().solve(X);
+  * solver.solveInPlace(L, X);
+  * \endcode
+  *
+  * The inner indices of each column of the factor must be sorted. SimplicialLLT, SimplicialLDLT, and
+  * SparseQR use this class to solve for multiple right hand sides.
+  *
+  * \tparam _MatrixType the type of the triangular factor, a compressed column major SparseMatrix<>
+  */
+template<typename _MatrixType>
+class SparseSupernodalTriangularSolver
+{
+  public:
+    typedef _MatrixType MatrixType;
+    typedef typename MatrixType::Scalar Scalar;
+    typedef typename MatrixType::Index Index;
+    typedef typename MatrixType::InnerIndex InnerIndex;
+    typedef Matrix<Scalar,Dynamic,Dynamic> DenseMatrix;
+    typedef Matrix<Scalar,Dynamic,Dynamic,RowMajor> RowMajorMatrix;
+
+    SparseSupernodalTriangularSolver() : m_isInitialized(false) {}
+
+    /** Analyzes the solves with \a mat.triangularView<Mode>() restricted to the top-left \a size x \a size
+      * block of \a mat. By default, the whole matrix is considered. */
+    template<int Mode>
+    void analyze(const MatrixType& mat, Index size = -1)
+    {
+      analyzeImpl(mat, Mode, false, size);
+    }
+
+    /** Analyzes the solves with \a mat.adjoint().triangularView<Mode>() restricted to the top-left \a size x \a size
+      * block of \a mat. By default, the whole matrix is considered. */
+    template<int Mode>
+    void analyzeAdjoint(const MatrixType& mat, Index size = -1)
+    {
+      analyzeImpl(mat, Mode, true, size);
+    }
+
+    /** Solves in place the triangular system analyzed by the last call to analyze() or analyzeAdjoint().
+      * Only the first size() rows of \a other are modified. */
+    template<typename Dest>
+    void solveInPlace(const MatrixType& mat, MatrixBase<Dest>& other) const
+    {
+      eigen_assert(m_isInitialized && "SparseSupernodalTriangularSolver is not initialized.");
+      eigen_assert(mat.isCompressed() && mat.nonZeros()==m_nonZeros && "the pattern changed since the last analysis");
+      eigen_assert(other.rows()>=size());
+
+      // gather the dense blocks of the wide supernodes
+      const Index nbSupernodes = supernodes();
+      Matrix<Scalar,Dynamic,1> blocks = Matrix<Scalar,Dynamic,1>::Zero(m_blockPtr[nbSupernodes]);
+      const Index* outer = mat.outerIndexPtr();
+      const InnerIndex* inner = mat.innerIndexPtr();
+      const Scalar* values = mat.valuePtr();
+      for(Index s=0; s<nbSupernodes; ++s)
+      {
+        const Index first = m_start[s], width = m_start[s+1]-first;
+        if(width<EIGEN_SPARSE_SUPERNODE_MIN_WIDTH)
+          continue;
+        const Index height = m_rowPtr[s+1]-m_rowPtr[s];
+        Scalar* diag = blocks.data() + m_blockPtr[s];
+        Scalar* off = diag + width*width;
+        for(Index j=first; j<first+width; ++j)
+        {
+          Index k = 0;
+          for(Index p=outer[j]; p<outer[j+1]; ++p)
+          {
+            Index i = inner[p];
+            if(i>=first && i<first+width)
+              diag[(j-first)*width + i-first] = values[p];
+            else if(i<size())
+              off[(j-first)*height + k++] = values[p];
+          }
+        }
+      }
+
+      // the right hand sides are processed per panel of columns copied into a row major buffer,
+      // such that the updates of the unknowns of a row are contiguous
+      const Index panelWidth = EIGEN_SPARSE_SUPERNODE_PANEL_WIDTH;
+      RowMajorMatrix x;
+      for(Index c=0; c<other.cols(); c+=panelWidth)
+      {
+        const Index actualWidth = (std::min)(panelWidth, Index(other.cols()-c));
+        x = other.block(0, c, size(), actualWidth);
+        solvePanel(mat, blocks.data(), x);
+        other.block(0, c, size(), actualWidth) = x;
+      }
+    }
+
+    /** \returns the number of supernodes */
+    Index supernodes() const { return m_start.size()-1; }
+
+    /** \returns the size of the analyzed triangular system */
+    Index size() const { return m_start[m_start.size()-1]; }
+
+    /** \returns whether analyze() or analyzeAdjoint() has been called */
+    bool isInitialized() const { return m_isInitialized; }
+
+  protected:
+    void analyzeImpl(const MatrixType& mat, int mode, bool adjoint, Index size)
+    {
+      EIGEN_STATIC_ASSERT(int(MatrixType::IsRowMajor)==0,THIS_METHOD_IS_ONLY_FOR_COLUMN_MAJOR_MATRICES);
+      eigen_assert(mat.isCompressed());
+      eigen_assert((mode & (Upper|Lower)) && !(mode & ZeroDiag));
+      if(size<0)
+        size = mat.cols();
+      eigen_assert(size<=mat.rows() && size<=mat.cols());
+
+      m_unitDiag = (mode & UnitDiag)==UnitDiag;
+      m_adjoint = adjoint;
+      // the triangular part which is actually stored in mat
+      m_storedLower = ((mode & Lower)==Lower) != adjoint;
+      m_nonZeros = mat.nonZeros();
+
+      const Index* outer = mat.outerIndexPtr();
+      const InnerIndex* inner = mat.innerIndexPtr();
+
+      // first and last+1 positions of the off-diagonal entries of each column within the leading block
+      Matrix<Index,Dynamic,1> offStart(size), offEnd(size);
+      for(Index j=0; j<size; ++j)
+      {
+        Index p = outer[j], end = outer[j+1];
+        if(m_storedLower)
+        {
+          while(p<end && inner[p]<=j) ++p;
+          Index e = p;
+          while(e<end && inner[e]<size) ++e;
+          offStart[j] = p; offEnd[j] = e;
+        }
+        else
+        {
+          Index e = p;
+          while(e<end && inner[e]<j) ++e;
+          offStart[j] = p; offEnd[j] = e;
+        }
+        eigen_assert((m_unitDiag || hasDiagonal(mat, j)) && "the diagonal of the triangular factor must be stored");
+      }
+
+      // two consecutive columns j-1 and j belong to the same supernode if
+      //  - lower: struct(L(:,j-1)) = {j} U struct(L(:,j)), considering the rows below the diagonal,
+      //  - upper: struct(U(:,j)) = struct(U(:,j-1)) U {j-1}, considering the rows above the diagonal.
+      std::vector<Index> starts;
+      if(size>0)
+        starts.push_back(0);
+      for(Index j=1; j<size; ++j)
+      {
+        const InnerIndex *a, *aEnd, *b, *bEnd;
+        bool merge;
+        if(m_storedLower)
+        {
+          a = inner+offStart[j-1]; aEnd = inner+offEnd[j-1];
+          b = inner+offStart[j];   bEnd = inner+offEnd[j];
+          merge = a<aEnd && *a==j && (aEnd-a-1)==(bEnd-b) && std::equal(a+1, aEnd, b);
+        }
+        else
+        {
+          a = inner+offStart[j];   aEnd = inner+offEnd[j];
+          b = inner+offStart[j-1]; bEnd = inner+offEnd[j-1];
+          merge = a<aEnd && *(aEnd-1)==j-1 && (aEnd-a-1)==(bEnd-b) && std::equal(b, bEnd, a);
+        }
+        if(!merge)
+          starts.push_back(j);
+      }
+      starts.push_back(size);
+
+      // off-diagonal rows, and offsets of the dense blocks
+      const Index nbSupernodes = Index(starts.size())-1;
+      m_start.resize(nbSupernodes+1);
+      m_rowPtr.resize(nbSupernodes+1);
+      m_blockPtr.resize(nbSupernodes+1);
+      m_rowPtr[0] = 0;
+      m_blockPtr[0] = 0;
+      for(Index s=0; s<nbSupernodes; ++s)
+      {
+        m_start[s] = starts[s];
+        const Index width = starts[s+1]-starts[s];
+        // rows below the last column, or above the first one
+        const Index j = m_storedLower ? starts[s+1]-1 : starts[s];
+        const Index height = offEnd[j]-offStart[j];
+        m_rowPtr[s+1] = m_rowPtr[s] + height;
+        m_blockPtr[s+1] = m_blockPtr[s] + (width<EIGEN_SPARSE_SUPERNODE_MIN_WIDTH ? 0 : width*(width+height));
+      }
+      m_start[nbSupernodes] = size;
+      m_rows.resize(m_rowPtr[nbSupernodes]);
+      for(Index s=0; s<nbSupernodes; ++s)
+      {
+        const Index j = m_storedLower ? m_start[s+1]-1 : m_start[s];
+        std::copy(inner+offStart[j], inner+offEnd[j], m_rows.data()+m_rowPtr[s]);
+      }
+
+      m_isInitialized = true;
+    }
+
+    static bool hasDiagonal(const MatrixType& mat, Index j)
+    {
+      for(typename MatrixType::InnerIterator it(mat,j); it; ++it)
+        if(it.index()==j)
+          return true;
+      return false;
+    }
+
+    void solvePanel(const MatrixType& mat, const Scalar* blocks, RowMajorMatrix& x) const
+    {
+      const Index nbSupernodes = supernodes();
+      const bool forward = m_storedLower != m_adjoint;
+      RowMajorMatrix tmp;
+      for(Index k=0; k<nbSupernodes; ++k)
+      {
+        const Index s = forward ? k : nbSupernodes-1-k;
+        const Index first = m_start[s], width = m_start[s+1]-first;
+        if(width<EIGEN_SPARSE_SUPERNODE_MIN_WIDTH)
+        {
+          // narrow supernodes are processed column per column
+          for(Index jj=0; jj<width; ++jj)
+          {
+            const Index j = forward ? first+jj : first+width-1-jj;
+            if(m_adjoint) solveColumnAdjoint(mat, j, x);
+            else          solveColumn(mat, j, x);
+          }
+          continue;
+        }
+
+        const Index height = m_rowPtr[s+1]-m_rowPtr[s];
+        const Index* rows = m_rows.data() + m_rowPtr[s];
+        Map<const DenseMatrix> diag(blocks + m_blockPtr[s], width, width);
+        Map<const DenseMatrix> off(blocks + m_blockPtr[s] + width*width, height, width);
+        Block<RowMajorMatrix> xs(x, first, 0, width, x.cols());
+
+        if(!m_adjoint)
+        {
+          solveDiagonalBlock(diag, xs);
+          if(height>0)
+          {
+            tmp.noalias() = off * xs;
+            for(Index i=0; i<height; ++i)
+              x.row(rows[i]) -= tmp.row(i);
+          }
+        }
+        else
+        {
+          if(height>0)
+          {
+            tmp.resize(height, x.cols());
+            for(Index i=0; i<height; ++i)
+              tmp.row(i) = x.row(rows[i]);
+            xs.noalias() -= off.adjoint() * tmp;
+          }
+          solveDiagonalBlock(diag.adjoint(), xs);
+        }
+      }
+    }
+
+    // x(j,:) /= L(j,j), then x(i,:) -= L(i,j) * x(j,:) for the off-diagonal entries of column j
+    void solveColumn(const MatrixType& mat, Index j, RowMajorMatrix& x) const
+    {
+      const Index begin = mat.outerIndexPtr()[j], end = mat.outerIndexPtr()[j+1];
+      const InnerIndex* inner = mat.innerIndexPtr();
+      const Scalar* values = mat.valuePtr();
+      if(!m_unitDiag)
+        for(Index p=begin; p<end; ++p)
+          if(inner[p]==j)
+            x.row(j) /= values[p];
+      for(Index p=begin; p<end; ++p)
+      {
+        const Index i = inner[p];
+        if(i!=j && i<size())
+          x.row(i) -= values[p] * x.row(j);
+      }
+    }
+
+    // x(j,:) -= conj(L(i,j)) * x(i,:) for the off-diagonal entries of column j, then x(j,:) /= conj(L(j,j))
+    void solveColumnAdjoint(const MatrixType& mat, Index j, RowMajorMatrix& x) const
+    {
+      const Index begin = mat.outerIndexPtr()[j], end = mat.outerIndexPtr()[j+1];
+      const InnerIndex* inner = mat.innerIndexPtr();
+      const Scalar* values = mat.valuePtr();
+      Scalar diag(1);
+      for(Index p=begin; p<end; ++p)
+      {
+        const Index i = inner[p];
+        if(i==j)
+          diag = values[p];
+        else if(i<size())
+          x.row(j) -= internal::conj(values[p]) * x.row(i);
+      }
+      if(!m_unitDiag)
+        x.row(j) /= internal::conj(diag);
+    }
+
+    template<typename BlockType, typename Dest>
+    void solveDiagonalBlock(const BlockType& diag, Dest& x) const
+    {
+      // diag is the block of the triangular system, which is lower iff the solve is a forward one
+      if(m_storedLower != m_adjoint)
+      {
+        if(m_unitDiag) diag.template triangularView<UnitLower>().solveInPlace(x);
+        else           diag.template triangularView<Lower>().solveInPlace(x);
+      }
+      else
+      {
+        if(m_unitDiag) diag.template triangularView<UnitUpper>().solveInPlace(x);
+        else           diag.template triangularView<Upper>().solveInPlace(x);
+      }
+    }
+
+    Matrix<Index,Dynamic,1> m_start;     // first column of each supernode
+    Matrix<Index,Dynamic,1> m_rowPtr;    // start of the off-diagonal rows of each supernode in m_rows
+    Matrix<Index,Dynamic,1> m_rows;      // off-diagonal rows of the supernodes
+    Matrix<Index,Dynamic,1> m_blockPtr;  // offset of the dense blocks of each supernode
+    Index m_nonZeros;
+    bool m_storedLower;
+    bool m_adjoint;
+    bool m_unitDiag;
+    bool m_isInitialized;
+};
+
+#endif // EIGEN_SPARSESUPERNODALTRIANGULARSOLVER_H
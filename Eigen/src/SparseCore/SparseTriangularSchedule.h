@@ -0,0 +1,219 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef EIGEN_SPARSETRIANGULARSCHEDULE_H
+#define EIGEN_SPARSETRIANGULARSCHEDULE_H
+
+/** \ingroup SparseCore_Module
+  *
+  * \class SparseTriangularSchedule
+  *
+  * \brief Level scheduling of sparse triangular solves
+  *
+  * This class analyzes the dependencies of a sparse triangular solve once, and then performs solves
+  * level by level: all the unknowns of a given level only depend on unknowns of the previous levels, and
+  * they are computed in parallel when OpenMP is enabled. The analysis stores a row-wise copy of the
+  * pattern of the triangular factor, so that the values of the factor are read from the matrix given
+  * to solveInPlace(). The values can thus change between two solves, but not the sparsity pattern.
+  *
+  * \code
+  * SparseTriangularSchedule<SparseMatrix<double> > schedule;
+  * schedule.analyze<Lower>(L);              // x = L.triangularView<Lower>().solve(x);
+  * schedule.solveInPlace(L, x);
+  * schedule.analyzeAdjoint<Upper>(L);       // x = L.adjoint().triangularView<Upper>().solve(x);
+  * schedule.solveInPlace(L, x);
+  * \endcode
+  *
+  * Sparse factorizations such as SimplicialLLT, SimplicialLDLT, and IncompleteLUT compute such schedules
+  * when OpenMP is enabled, the first time one of their solves is large enough to be multithreaded.
+  *
+  * \tparam _MatrixType the type of the triangular factor, a compressed SparseMatrix<>
+  */
+template<typename _MatrixType>
+class SparseTriangularSchedule
+{
+  public:
+    typedef _MatrixType MatrixType;
+    typedef typename MatrixType::Scalar Scalar;
+    typedef typename MatrixType::Index Index;
+    typedef typename MatrixType::InnerIndex InnerIndex;
+
+    SparseTriangularSchedule() : m_isInitialized(false) {}
+
+    /** Analyzes the solves with \a mat.triangularView<Mode>() */
+    template<int Mode>
+    void analyze(const MatrixType& mat)
+    {
+      analyzeImpl(mat, Mode, false);
+    }
+
+    /** Analyzes the solves with \a mat.adjoint().triangularView<Mode>() */
+    template<int Mode>
+    void analyzeAdjoint(const MatrixType& mat)
+    {
+      analyzeImpl(mat, Mode, true);
+    }
+
+    /** Solves in place the triangular system analyzed by the last call to analyze() or analyzeAdjoint().
+      * The pattern of \a mat must be the one given to the analysis. */
+    template<typename Dest>
+    void solveInPlace(const MatrixType& mat, MatrixBase<Dest>& other) const
+    {
+      eigen_assert(m_isInitialized && "SparseTriangularSchedule is not initialized.");
+      eigen_assert(mat.rows()==m_levelRows.size() && other.rows()==mat.rows());
+      eigen_assert(mat.isCompressed() && mat.nonZeros()==m_nonZeros && "the pattern changed since the last analysis");
+
+      const Scalar* values = mat.valuePtr();
+      Index threads = internal::sparse_parallel_threads(std::ptrdiff_t(m_cols.size() + mat.rows()) * other.cols());
+      if(threads==1)
+      {
+        // the natural ordering is more cache friendly
+        const Index size = mat.rows();
+        for(Index k=0; k<size; ++k)
+          solveRow(values, other, m_isLower ? k : size-1-k);
+        return;
+      }
+#ifdef EIGEN_HAS_OPENMP
+      #pragma omp parallel num_threads(threads)
+      {
+        for(Index l=0; l<levels(); ++l)
+        {
+          #pragma omp for schedule(static)
+          for(Index k=m_levelPtr[l]; k<m_levelPtr[l+1]; ++k)
+            solveRow(values, other, m_levelRows[k]);
+        }
+      }
+#endif
+    }
+
+    /** \returns the number of levels, i.e., the number of sequential steps of the solve */
+    Index levels() const { return m_levelPtr.size()-1; }
+
+    /** \returns whether analyze() or analyzeAdjoint() has been called */
+    bool isInitialized() const { return m_isInitialized; }
+
+  protected:
+    void analyzeImpl(const MatrixType& mat, int mode, bool adjoint)
+    {
+      eigen_assert(mat.rows()==mat.cols() && mat.isCompressed());
+      eigen_assert((mode & (Upper|Lower)) && !(mode & ZeroDiag));
+      const Index size = mat.rows();
+      const bool isLower = (mode & Lower)==Lower;
+      // if true, the rows of the triangular matrix are the inner vectors of mat
+      const bool directRows = bool(MatrixType::IsRowMajor) != adjoint;
+      const Index* outer = mat.outerIndexPtr();
+      const InnerIndex* inner = mat.innerIndexPtr();
+
+      m_isLower = isLower;
+      m_unitDiag = (mode & UnitDiag)==UnitDiag;
+      m_conjugate = adjoint && NumTraits<Scalar>::IsComplex;
+      m_nonZeros = mat.nonZeros();
+
+      // copy the strictly triangular part row per row, and locate the diagonal
+      m_diag.setConstant(size, -1);
+      m_rowPtr.setZero(size+1);
+      for(Index j=0; j<size; ++j)
+        for(Index p=outer[j]; p<outer[j+1]; ++p)
+        {
+          Index row = directRows ? j : inner[p];
+          Index col = directRows ? inner[p] : j;
+          if(row==col)
+            m_diag[row] = p;
+          else if(isLower == (col<row))
+            ++m_rowPtr[row+1];
+        }
+      for(Index i=0; i<size; ++i)
+        m_rowPtr[i+1] += m_rowPtr[i];
+      m_cols.resize(m_rowPtr[size]);
+      m_pos.resize(m_rowPtr[size]);
+      Matrix<Index,Dynamic,1> fill = m_rowPtr.head(size);
+      for(Index j=0; j<size; ++j)
+        for(Index p=outer[j]; p<outer[j+1]; ++p)
+        {
+          Index row = directRows ? j : inner[p];
+          Index col = directRows ? inner[p] : j;
+          if(row!=col && isLower == (col<row))
+          {
+            m_cols[fill[row]] = col;
+            m_pos[fill[row]++] = p;
+          }
+        }
+      eigen_assert((m_unitDiag || (m_diag.array()>=0).all()) && "the diagonal of the triangular factor must be stored");
+
+      // the level of an unknown is one more than the highest level of the unknowns it depends on
+      Matrix<Index,Dynamic,1> level(size);
+      Index nbLevels = 0;
+      for(Index k=0; k<size; ++k)
+      {
+        Index i = isLower ? k : size-1-k;
+        Index l = 0;
+        for(Index p=m_rowPtr[i]; p<m_rowPtr[i+1]; ++p)
+          l = (std::max)(l, level[m_cols[p]]+1);
+        level[i] = l;
+        nbLevels = (std::max)(nbLevels, l+1);
+      }
+
+      // sort the unknowns per level
+      m_levelPtr.setZero(nbLevels+1);
+      for(Index i=0; i<size; ++i)
+        ++m_levelPtr[level[i]+1];
+      for(Index l=0; l<nbLevels; ++l)
+        m_levelPtr[l+1] += m_levelPtr[l];
+      m_levelRows.resize(size);
+      fill = m_levelPtr.head(nbLevels);
+      for(Index i=0; i<size; ++i)
+        m_levelRows[fill[level[i]]++] = i;
+
+      m_isInitialized = true;
+    }
+
+    template<typename Dest>
+    inline void solveRow(const Scalar* values, MatrixBase<Dest>& other, Index i) const
+    {
+      for(Index c=0; c<other.cols(); ++c)
+      {
+        Scalar tmp = other.coeff(i,c);
+        for(Index p=m_rowPtr[i]; p<m_rowPtr[i+1]; ++p)
+          tmp -= value(values, m_pos[p]) * other.coeff(m_cols[p],c);
+        other.coeffRef(i,c) = m_unitDiag ? tmp : tmp / value(values, m_diag[i]);
+      }
+    }
+
+    inline Scalar value(const Scalar* values, Index p) const
+    {
+      return m_conjugate ? internal::conj(values[p]) : values[p];
+    }
+
+    Matrix<Index,Dynamic,1> m_rowPtr;     // start of each row of the strictly triangular part
+    Matrix<Index,Dynamic,1> m_cols;       // column indices of the strictly triangular part
+    Matrix<Index,Dynamic,1> m_pos;        // position of these entries in the value array of the factor
+    Matrix<Index,Dynamic,1> m_diag;       // position of the diagonal entries in the value array of the factor
+    Matrix<Index,Dynamic,1> m_levelPtr;   // start of each level in m_levelRows
+    Matrix<Index,Dynamic,1> m_levelRows;  // the unknowns sorted per level
+    Index m_nonZeros;
+    bool m_isLower;
+    bool m_unitDiag;
+    bool m_conjugate;
+    bool m_isInitialized;
+};
+
+#endif // EIGEN_SPARSETRIANGULARSCHEDULE_H
@@ -81,21 +81,26 @@ const int OuterRandomAccessPattern  = 0x4 | CoherentAccessPattern;
 const int RandomAccessPattern       = 0x8 | OuterRandomAccessPattern | InnerRandomAccessPattern;
 
 template<typename Derived> class SparseMatrixBase;
-template<typename _Scalar, int _Flags = 0, typename _Index = int>  class SparseMatrix;
+template<typename _Scalar, int _Flags = 0, typename _Index = int, typename _InnerIndex = _Index>  class SparseMatrix;
 template<typename _Scalar, int _Flags = 0, typename _Index = int>  class DynamicSparseMatrix;
 template<typename _Scalar, int _Flags = 0, typename _Index = int>  class SparseVector;
 template<typename _Scalar, int _Flags = 0, typename _Index = int>  class MappedSparseMatrix;
+template<typename _Scalar, int _BlockSize, typename _Index = int>  class BlockSparseMatrix;
+template<typename _Scalar, int _SliceHeight = 8, typename _Index = int>  class SlicedEllMatrix;
 
 template<typename MatrixType, int Size>           class SparseInnerVectorSet;
 template<typename MatrixType, int Mode>           class SparseTriangularView;
 template<typename MatrixType, unsigned int UpLo>  class SparseSelfAdjointView;
 template<typename Lhs, typename Rhs>              class SparseDiagonalProduct;
 template<typename MatrixType> class SparseView;
+template<typename MatrixType, int UpLo>           class BlockSparseSelfAdjointView;
 
 template<typename Lhs, typename Rhs>        class SparseSparseProduct;
 template<typename Lhs, typename Rhs>        class SparseTimeDenseProduct;
 template<typename Lhs, typename Rhs>        class DenseTimeSparseProduct;
 template<typename Lhs, typename Rhs, bool Transpose> class SparseDenseOuterProduct;
+template<typename Lhs, typename Rhs, int UpLo> class BlockSparseTimeDenseProduct;
+template<typename Lhs, typename Rhs>        class SlicedEllTimeDenseProduct;
 
 template<typename Lhs, typename Rhs> struct SparseSparseProductReturnType;
 template<typename Lhs, typename Rhs, int InnerSize = internal::traits<Lhs>::ColsAtCompileTime> struct DenseSparseProductReturnType;
@@ -126,9 +131,10 @@ template<typename T,int Rows> struct sparse_eval<T,Rows,1> {
 
 template<typename T,int Rows,int Cols> struct sparse_eval {
     typedef typename traits<T>::Scalar _Scalar;
+    typedef typename traits<T>::Index _Index;
     enum { _Flags = traits<T>::Flags };
   public:
-    typedef SparseMatrix<_Scalar, _Flags> type;
+    typedef SparseMatrix<_Scalar, _Flags, _Index> type;
 };
 
 template<typename T> struct sparse_eval<T,1,1> {
@@ -145,7 +151,7 @@ template<typename T> struct plain_matrix_type<T,Sparse>
     };
 
   public:
-    typedef SparseMatrix<_Scalar, _Flags> type;
+    typedef SparseMatrix<_Scalar, _Flags, typename traits<T>::Index> type;
 };
 
 } // end namespace internal
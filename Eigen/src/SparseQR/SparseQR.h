@@ -0,0 +1,629 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef EIGEN_SPARSE_QR_H
+#define EIGEN_SPARSE_QR_H
+
+template<typename MatrixType, typename OrderingType> class SparseQR;
+template<typename SparseQRType> struct SparseQRMatrixQReturnType;
+template<typename SparseQRType> struct SparseQRMatrixQTransposeReturnType;
+template<typename SparseQRType, typename Derived> struct SparseQR_QProduct;
+
+namespace internal {
+  template <typename SparseQRType> struct traits<SparseQRMatrixQReturnType<SparseQRType> >
+  {
+    typedef typename SparseQRType::MatrixType ReturnType;
+  };
+  template <typename SparseQRType> struct traits<SparseQRMatrixQTransposeReturnType<SparseQRType> >
+  {
+    typedef typename SparseQRType::MatrixType ReturnType;
+  };
+  template <typename SparseQRType, typename Derived> struct traits<SparseQR_QProduct<SparseQRType, Derived> >
+  {
+    typedef typename Derived::PlainObject ReturnType;
+  };
+} // End namespace internal
+
+/** \ingroup SparseQR_Module
+  * \class SparseQR
+  * \brief Sparse left-looking rank-revealing QR factorization
+  *
+  * This class computes a QR factorization of a sparse matrix \b A such that
+  * \f[ \mathbf{A} \, \mathbf{P} = \mathbf{Q} \, \mathbf{R} \f]
+  * where \b P is a column permutation, \b Q is a unitary matrix represented as a product
+  * of sparse Householder reflectors, and \b R is a sparse upper triangular (or trapezoidal) matrix.
+  *
+  * The permutation \b P is made of a fill-in reducing column ordering computed once by analyzePattern(),
+  * followed by the moves of the columns detected as linearly dependent at the end of the matrix.
+  * A column is considered dependent when the norm of the part of its column still to be eliminated is
+  * below the pivot threshold, see setPivotThreshold(). The number of independent columns found this way
+  * is an estimate of the numerical rank of \b A, see rank().
+  *
+  * The matrix \b A can be either square or rectangular. For overdetermined systems, solve() returns the
+  * least-squares solution. For rank deficient matrices, it returns a basic solution, i.e., a solution
+  * having zeros at the positions of the dependent columns.
+  *
+  * The symbolic analysis (column ordering and column elimination tree) computed by analyzePattern()
+  * is reused by all subsequent calls to factorize() on matrices having the same sparsity pattern.
+  *
+  * \tparam _MatrixType the type of the sparse matrix A, it must be a column-major SparseMatrix<>
+  * \tparam _OrderingType the fill-in reducing column ordering policy, e.g. AMDOrdering (the default, applied
+  *                       to the pattern of \f$ A^T A \f$), COLAMDOrdering or NaturalOrdering
+  *
+  * \sa SimplicialLDLT, ColPivHouseholderQR
+  */
+template<typename _MatrixType, typename _OrderingType = AMDOrdering<typename _MatrixType::Index> >
+class SparseQR
+{
+  public:
+    typedef _MatrixType MatrixType;
+    typedef _OrderingType OrderingType;
+    typedef typename MatrixType::Scalar Scalar;
+    typedef typename MatrixType::RealScalar RealScalar;
+    typedef typename MatrixType::Index Index;
+    typedef SparseMatrix<Scalar,ColMajor,Index> QRMatrixType;
+    typedef Matrix<Index, Dynamic, 1> IndexVector;
+    typedef Matrix<Scalar, Dynamic, 1> ScalarVector;
+    typedef PermutationMatrix<Dynamic, Dynamic, Index> PermutationType;
+
+  public:
+    SparseQR()
+      : m_isInitialized(false), m_analysisIsOk(false), m_factorizationIsOk(false), m_isEtreeOk(false),
+        m_info(Success), m_supernodesIsOk(false), m_useDefaultThreshold(true), m_threshold(0), m_nonzeropivots(0)
+    {}
+
+    /** Constructs and computes the QR factorization of \a mat
+      * \sa compute() */
+    SparseQR(const MatrixType& mat)
+      : m_isInitialized(false), m_analysisIsOk(false), m_factorizationIsOk(false), m_isEtreeOk(false),
+        m_info(Success), m_supernodesIsOk(false), m_useDefaultThreshold(true), m_threshold(0), m_nonzeropivots(0)
+    {
+      compute(mat);
+    }
+
+    /** Computes the QR factorization of \a mat
+      * \sa analyzePattern(), factorize() */
+    SparseQR& compute(const MatrixType& mat)
+    {
+      analyzePattern(mat);
+      factorize(mat);
+      return *this;
+    }
+
+    void analyzePattern(const MatrixType& mat);
+    void factorize(const MatrixType& mat);
+
+    /** \returns the number of rows of the input matrix */
+    inline Index rows() const { return m_pmat.rows(); }
+
+    /** \returns the number of columns of the input matrix */
+    inline Index cols() const { return m_pmat.cols(); }
+
+    /** \returns a const reference to the sparse upper triangular matrix R of the QR factorization.
+      *
+      * Only the top-left rank() x rank() block is triangular, the dependent columns come last.
+      */
+    const QRMatrixType& matrixR() const { return m_R; }
+
+    /** \returns the estimated rank of the input matrix, i.e., the number of pivots above the threshold
+      * \sa setPivotThreshold() */
+    Index rank() const
+    {
+      eigen_assert(m_isInitialized && "The factorization should be called first, use compute()");
+      return m_nonzeropivots;
+    }
+
+    /** \returns an expression of the matrix Q as products of sparse Householder reflectors.
+      *
+      * It can only be applied to dense matrices, e.g.:
+      * \code
+      * VectorXd y = qr.matrixQ().adjoint() * b;
+      * \endcode
+      */
+    SparseQRMatrixQReturnType<SparseQR> matrixQ() const
+    { return SparseQRMatrixQReturnType<SparseQR>(*this); }
+
+    /** \returns a const reference to the column permutation P such that A P = Q R.
+      * It combines the fill-in reducing ordering and the moves of the dependent columns.
+      */
+    const PermutationType& colsPermutation() const
+    {
+      eigen_assert(m_isInitialized && "Decomposition is not initialized.");
+      return m_outputPerm_c;
+    }
+
+    /** Sets the threshold that is used to determine linearly dependent columns during the factorization.
+      *
+      * A column is considered dependent when the 2-norm of its part to be eliminated is less than
+      * or equal to \a threshold. By default, the threshold is
+      * \f$ 20 (m+n) \epsilon \max_j \| A_j \| \f$ as in SuiteSparseQR.
+      */
+    void setPivotThreshold(const RealScalar& threshold)
+    {
+      m_useDefaultThreshold = false;
+      m_threshold = threshold;
+    }
+
+    /** \returns the solution X of \f$ A X = B \f$ in the least-squares sense
+      *
+      * \sa compute()
+      */
+    template<typename Rhs>
+    inline const internal::solve_retval<SparseQR, Rhs> solve(const MatrixBase<Rhs>& B) const
+    {
+      eigen_assert(m_isInitialized && "The factorization should be called first, use compute()");
+      eigen_assert(this->rows() == B.rows() && "SparseQR::solve() : invalid number of rows in the right hand side matrix");
+      return internal::solve_retval<SparseQR, Rhs>(*this, B.derived());
+    }
+
+    /** \brief Reports whether previous computation was successful.
+      *
+      * \returns \c Success if computation was succesful.
+      */
+    ComputationInfo info() const
+    {
+      eigen_assert(m_isInitialized && "Decomposition is not initialized.");
+      return m_info;
+    }
+
+#ifndef EIGEN_PARSED_BY_DOXYGEN
+    /** \internal */
+    template<typename Rhs, typename Dest>
+    void _solve(const MatrixBase<Rhs>& B, MatrixBase<Dest>& dest) const
+    {
+      eigen_assert(m_factorizationIsOk && "The decomposition is not in a valid state for solving, you must first call either compute() or analyzePattern()/factorize()");
+      eigen_assert(rows() == B.rows());
+
+      const Index rank = m_nonzeropivots;
+      typename Dest::PlainObject y = matrixQ().adjoint() * B;
+
+      // back substitution with the top-left rank x rank triangular block of R,
+      // the diagonal entry is the last one of each column.
+      if(B.cols()>=EIGEN_SPARSE_SUPERNODE_MIN_RHS)
+      {
+        // the supernodes are detected by the first solve with many right hand sides
+        if(!m_supernodesIsOk)
+        {
+          m_supernodesR.template analyze<Upper>(m_R, rank);
+          m_supernodesIsOk = true;
+        }
+        m_supernodesR.solveInPlace(m_R, y);
+      }
+      else
+      {
+        for(Index j = rank-1; j >= 0; --j)
+        {
+          Index end = m_R.outerIndexPtr()[j+1]-1;
+          eigen_assert(m_R.innerIndexPtr()[end]==j);
+          y.row(j) /= m_R.valuePtr()[end];
+          for(Index p = m_R.outerIndexPtr()[j]; p < end; ++p)
+            y.row(m_R.innerIndexPtr()[p]) -= m_R.valuePtr()[p] * y.row(j);
+        }
+      }
+
+      // the dependent variables are set to zero
+      typename Dest::PlainObject x(cols(), B.cols());
+      x.topRows(rank) = y.topRows(rank);
+      x.bottomRows(cols()-rank).setZero();
+
+      dest = colsPermutation() * x;
+    }
+#endif // EIGEN_PARSED_BY_DOXYGEN
+
+  protected:
+    void permuteColumns(const MatrixType& mat);
+
+    bool m_isInitialized;
+    bool m_analysisIsOk;
+    bool m_factorizationIsOk;
+    bool m_isEtreeOk;                 // whether m_etree matches the fill-in reducing ordering only
+    mutable ComputationInfo m_info;
+    QRMatrixType m_pmat;              // the column permuted input matrix
+    QRMatrixType m_R;                 // the triangular factor
+    mutable SparseSupernodalTriangularSolver<QRMatrixType> m_supernodesR; // blocked solves with R for multiple right hand sides
+    mutable bool m_supernodesIsOk;
+    QRMatrixType m_Q;                 // the Householder vectors
+    ScalarVector m_hcoeffs;           // the Householder coefficients
+    PermutationType m_perm_c;         // the fill-in reducing column permutation
+    PermutationType m_pivotperm;      // the moves of the dependent columns
+    PermutationType m_outputPerm_c;   // the final column permutation
+    bool m_useDefaultThreshold;
+    RealScalar m_threshold;           // threshold to determine the dependent columns
+    Index m_nonzeropivots;            // the number of nonzero pivots, i.e., the estimated rank
+    IndexVector m_etree;              // column elimination tree
+    IndexVector m_firstRowElt;        // first (permuted) column of each row
+
+    template<typename, typename> friend struct SparseQR_QProduct;
+};
+
+/** \internal
+  * Computes a fill-in reducing column ordering, either directly from the columns of \a mat, or from the
+  * pattern of \f$ A^T A \f$ without the diagonal entries, depending on OrderingType::ColumnOrdering.
+  */
+template<typename MatrixType, typename OrderingType>
+void SparseQR<MatrixType,OrderingType>::analyzePattern(const MatrixType& mat)
+{
+  EIGEN_STATIC_ASSERT(int(MatrixType::IsRowMajor)==0,THIS_METHOD_IS_ONLY_FOR_COLUMN_MAJOR_MATRICES);
+  const Index n = mat.cols();
+
+  OrderingType ordering;
+  if(OrderingType::ColumnOrdering)
+    ordering(mat, m_perm_c);
+  else
+  {
+    // for each row, the list of columns having a nonzero in that row
+    SparseMatrix<Scalar,RowMajor,Index> rowPattern(mat.rows(), n);
+    rowPattern = mat;
+
+    QRMatrixType AtA(n, n);
+    IndexVector mark(n);
+    mark.setConstant(-1);
+    AtA.reserve(mat.nonZeros());
+    for(Index j = 0; j < n; ++j)
+    {
+      AtA.startVec(j);
+      mark(j) = j;  // skip the diagonal
+      Index start = AtA.nonZeros();
+      for(typename MatrixType::InnerIterator it(mat, j); it; ++it)
+        for(typename SparseMatrix<Scalar,RowMajor,Index>::InnerIterator rit(rowPattern, it.index()); rit; ++rit)
+        {
+          Index k = rit.index();
+          if(mark(k) != j)
+          {
+            mark(k) = j;
+            AtA.insertBackByOuterInnerUnordered(j, k) = Scalar(1);
+          }
+        }
+      std::sort(AtA.innerIndexPtr()+start, AtA.innerIndexPtr()+AtA.nonZeros());
+    }
+    AtA.finalize();
+    internal::order_temporary_pattern(ordering, AtA, m_perm_c);
+  }
+  if(m_perm_c.size()==0)
+    m_perm_c.setIdentity(n);
+
+  // compute the column elimination tree of the permuted matrix
+  internal::coletree(mat, m_etree, m_firstRowElt, m_perm_c.indices().data());
+  m_isEtreeOk = true;
+
+  m_R.resize(0,0);
+  m_Q.resize(0,0);
+  m_isInitialized = true;
+  m_analysisIsOk = true;
+  m_factorizationIsOk = false;
+  m_info = Success;
+}
+
+/** \internal
+  * Copies the columns of \a mat into m_pmat following the fill-in reducing ordering */
+template<typename MatrixType, typename OrderingType>
+void SparseQR<MatrixType,OrderingType>::permuteColumns(const MatrixType& mat)
+{
+  const Index n = mat.cols();
+  m_pmat.resize(mat.rows(), n);
+  m_pmat.reserve(mat.nonZeros());
+  for(Index j = 0; j < n; ++j)
+  {
+    m_pmat.startVec(j);
+    for(typename MatrixType::InnerIterator it(mat, m_perm_c.indices()(j)); it; ++it)
+      m_pmat.insertBackByOuterInner(j, it.index()) = it.value();
+  }
+  m_pmat.finalize();
+}
+
+/** Performs the numerical QR factorization of the input matrix
+  *
+  * The function SparseQR::analyzePattern(const MatrixType&) must have been called beforehand with
+  * a matrix having the same sparsity pattern than \a mat.
+  *
+  * \param mat The sparse column-major matrix
+  */
+template<typename MatrixType, typename OrderingType>
+void SparseQR<MatrixType,OrderingType>::factorize(const MatrixType& mat)
+{
+  eigen_assert(m_analysisIsOk && "analyzePattern() should be called before this step");
+  eigen_assert(mat.cols()==m_perm_c.size() && "the matrix does not match the analyzed pattern");
+  const Index m = mat.rows();
+  const Index n = mat.cols();
+  const Index diagSize = (std::min)(m,n);
+
+  permuteColumns(mat);
+  if(!m_isEtreeOk)
+  {
+    // the tree has been altered by the dependent columns of the previous factorization
+    internal::coletree(m_pmat, m_etree, m_firstRowElt);
+    m_isEtreeOk = true;
+  }
+
+  IndexVector markR(n), markQ(m);   // the visited nodes of the etree and rows of Q
+  markR.setConstant(-1);
+  markQ.setConstant(-1);
+  IndexVector Ridx(n), Qidx(m);     // the patterns of the current column of R and Q
+  ScalarVector tval(m);             // the current column, kept to zero outside of its pattern
+  tval.setZero();
+
+  // default threshold as in MatLab, see: Tim Davis, "Algorithm 915, SuiteSparseQR: Multifrontal
+  // Multithreaded Rank-Revealing Sparse QR Factorization", ACM Trans. on Math. Soft. 38(1), 2011
+  RealScalar pivotThreshold = m_threshold;
+  if(m_useDefaultThreshold)
+  {
+    RealScalar max2Norm = 0;
+    for(Index j = 0; j < n; ++j)
+    {
+      RealScalar sqrNorm(0);
+      for(typename QRMatrixType::InnerIterator it(m_pmat, j); it; ++it)
+        sqrNorm += internal::abs2(it.value());
+      max2Norm = (std::max)(max2Norm, internal::sqrt(sqrNorm));
+    }
+    pivotThreshold = RealScalar(20) * RealScalar(m + n) * max2Norm * NumTraits<RealScalar>::epsilon();
+  }
+
+  // reuse the sizes of the previous factorization to limit the reallocations
+  Index nnzR = m_R.nonZeros(), nnzQ = m_Q.nonZeros();
+  m_R.resize(diagSize, n);
+  m_R.reserve((std::max)(nnzR, m_pmat.nonZeros()));
+  m_Q.resize(m, diagSize);
+  m_Q.reserve((std::max)(nnzQ, m_pmat.nonZeros()));
+  m_hcoeffs.setZero(diagSize);
+  m_pivotperm.setIdentity(n);
+
+  Index nonzeroCol = 0; // the number of independent columns found so far
+  for(Index col = 0; col < n; ++col)
+  {
+    // the current column is the node nonzeroCol of the elimination tree
+    const Index k = nonzeroCol;
+    Index nzcolR = 0, nzcolQ = 0;
+    markR(k) = col;
+    if(k < m)
+    {
+      Qidx(nzcolQ++) = k;
+      markQ(k) = col;
+    }
+
+    // Symbolic step: the pattern of R(:,col) is made of all the nodes reachable from the rows of
+    // the current column through the etree. The diagonal entry is always considered as nonzero.
+    bool found_diag = k >= m;
+    for(typename QRMatrixType::InnerIterator it(m_pmat, col); it || !found_diag; ++it)
+    {
+      Index curIdx = k;
+      if(it) curIdx = it.index();
+      if(curIdx == k) found_diag = true;
+
+      Index st = m_firstRowElt(curIdx);
+      eigen_internal_assert(st <= k);
+      for(; markR(st) != col; st = m_etree(st))
+      {
+        Ridx(nzcolR++) = st;
+        markR(st) = col;
+      }
+
+      if(it) tval(curIdx) = it.value();
+      if(curIdx > k && markQ(curIdx) != col)
+      {
+        Qidx(nzcolQ++) = curIdx;
+        markQ(curIdx) = col;
+      }
+    }
+
+    // Numeric step: apply the previous reflectors in a topological order of the etree,
+    // an increasing order is a valid one.
+    std::sort(Ridx.data(), Ridx.data()+nzcolR);
+    for(Index i = 0; i < nzcolR; ++i)
+    {
+      const Index curIdx = Ridx(i);
+      Scalar tdot(0);
+      for(typename QRMatrixType::InnerIterator itq(m_Q, curIdx); itq; ++itq)
+        tdot += internal::conj(itq.value()) * tval(itq.index());
+      tdot *= m_hcoeffs(curIdx);
+      for(typename QRMatrixType::InnerIterator itq(m_Q, curIdx); itq; ++itq)
+        tval(itq.index()) -= itq.value() * tdot;
+
+      // the pattern of the reflectors of the children is inherited by the current one
+      if(m_etree(curIdx) == k)
+      {
+        for(typename QRMatrixType::InnerIterator itq(m_Q, curIdx); itq; ++itq)
+        {
+          Index iQ = itq.index();
+          if(iQ > k && markQ(iQ) != col)
+          {
+            Qidx(nzcolQ++) = iQ;
+            markQ(iQ) = col;
+          }
+        }
+      }
+    }
+
+    // compute the Householder reflector that eliminates the current column below k
+    Scalar tau(0);
+    RealScalar beta(0);
+    if(k < diagSize)
+    {
+      Scalar c0 = tval(k);
+      RealScalar sqrNorm(0);
+      for(Index i = 1; i < nzcolQ; ++i)
+        sqrNorm += internal::abs2(tval(Qidx(i)));
+      if(sqrNorm == RealScalar(0) && internal::imag(c0) == RealScalar(0))
+      {
+        beta = internal::real(c0);
+      }
+      else
+      {
+        beta = internal::sqrt(internal::abs2(c0) + sqrNorm);
+        if(internal::real(c0) >= RealScalar(0))
+          beta = -beta;
+        for(Index i = 1; i < nzcolQ; ++i)
+          tval(Qidx(i)) /= (c0 - beta);
+        tau = internal::conj((beta-c0) / beta);
+      }
+    }
+
+    // store R(:,col) in increasing row order
+    m_R.startVec(col);
+    for(Index i = 0; i < nzcolR; ++i)
+    {
+      Index curIdx = Ridx(i);
+      m_R.insertBackByOuterInner(col, curIdx) = tval(curIdx);
+      tval(curIdx) = Scalar(0);
+    }
+
+    if(k < diagSize && internal::abs(beta) > pivotThreshold)
+    {
+      m_R.insertBackByOuterInner(col, k) = beta;
+      m_hcoeffs(k) = tau;
+      // store the Householder vector, its first entry is 1
+      std::sort(Qidx.data()+1, Qidx.data()+nzcolQ);
+      m_Q.startVec(k);
+      m_Q.insertBackByOuterInner(k, k) = Scalar(1);
+      for(Index i = 1; i < nzcolQ; ++i)
+        m_Q.insertBackByOuterInner(k, Qidx(i)) = tval(Qidx(i));
+      ++nonzeroCol;
+    }
+    else if(k < diagSize)
+    {
+      // dependent column: move it to the end and update the elimination tree accordingly
+      for(Index j = k; j < n-1; ++j)
+        std::swap(m_pivotperm.indices()(j), m_pivotperm.indices()(j+1));
+      internal::coletree(m_pmat, m_etree, m_firstRowElt, m_pivotperm.indices().data());
+      m_isEtreeOk = false;
+    }
+    if(k < m)
+      tval(k) = Scalar(0);
+    for(Index i = 1; i < nzcolQ; ++i)
+      tval(Qidx(i)) = Scalar(0);
+  }
+
+  // the remaining Householder vectors are empty
+  for(Index j = nonzeroCol; j < diagSize; ++j)
+    m_Q.startVec(j);
+  m_Q.finalize();
+  m_R.finalize();
+  m_nonzeropivots = nonzeroCol;
+
+  m_outputPerm_c = m_perm_c;
+  if(nonzeroCol < n)
+  {
+    // permute the columns of R to put the dependent ones at the end
+    QRMatrixType tmpR(diagSize, n);
+    tmpR.reserve(m_R.nonZeros());
+    for(Index j = 0; j < n; ++j)
+    {
+      tmpR.startVec(j);
+      for(typename QRMatrixType::InnerIterator it(m_R, m_pivotperm.indices()(j)); it; ++it)
+        tmpR.insertBackByOuterInner(j, it.index()) = it.value();
+      m_outputPerm_c.indices()(j) = m_perm_c.indices()(m_pivotperm.indices()(j));
+    }
+    tmpR.finalize();
+    m_R.swap(tmpR);
+  }
+  m_supernodesIsOk = false;
+
+  m_info = Success;
+  m_factorizationIsOk = true;
+}
+
+/** \internal
+  * Applies the sequence of Householder reflectors of a SparseQR object, or its adjoint, to a dense matrix */
+template <typename SparseQRType, typename Derived>
+struct SparseQR_QProduct : ReturnByValue<SparseQR_QProduct<SparseQRType, Derived> >
+{
+  typedef typename SparseQRType::QRMatrixType MatrixType;
+  typedef typename SparseQRType::Scalar Scalar;
+  typedef typename SparseQRType::Index Index;
+
+  SparseQR_QProduct(const SparseQRType& qr, const Derived& other, bool transpose)
+    : m_qr(qr), m_other(other), m_transpose(transpose)
+  {}
+  inline Index rows() const { return m_qr.rows(); }
+  inline Index cols() const { return m_other.cols(); }
+
+  template<typename DesType>
+  void evalTo(DesType& res) const
+  {
+    const Index rank = m_qr.m_nonzeropivots;
+    res = m_other;
+    for(Index j = 0; j < res.cols(); ++j)
+    {
+      for(Index l = 0; l < rank; ++l)
+      {
+        // Q^* = H_{r-1} ... H_0 and Q = H_0^* ... H_{r-1}^*
+        const Index k = m_transpose ? l : rank-l-1;
+        Scalar tdot(0);
+        for(typename MatrixType::InnerIterator itq(m_qr.m_Q, k); itq; ++itq)
+          tdot += internal::conj(itq.value()) * res.coeff(itq.index(), j);
+        tdot *= m_transpose ? m_qr.m_hcoeffs(k) : internal::conj(m_qr.m_hcoeffs(k));
+        for(typename MatrixType::InnerIterator itq(m_qr.m_Q, k); itq; ++itq)
+          res.coeffRef(itq.index(), j) -= itq.value() * tdot;
+      }
+    }
+  }
+
+  const SparseQRType& m_qr;
+  const Derived& m_other;
+  bool m_transpose;
+};
+
+template<typename SparseQRType>
+struct SparseQRMatrixQReturnType
+{
+  SparseQRMatrixQReturnType(const SparseQRType& qr) : m_qr(qr) {}
+  template<typename Derived>
+  SparseQR_QProduct<SparseQRType, Derived> operator*(const MatrixBase<Derived>& other) const
+  {
+    return SparseQR_QProduct<SparseQRType,Derived>(m_qr, other.derived(), false);
+  }
+  SparseQRMatrixQTransposeReturnType<SparseQRType> adjoint() const
+  {
+    return SparseQRMatrixQTransposeReturnType<SparseQRType>(m_qr);
+  }
+  const SparseQRType& m_qr;
+};
+
+template<typename SparseQRType>
+struct SparseQRMatrixQTransposeReturnType
+{
+  SparseQRMatrixQTransposeReturnType(const SparseQRType& qr) : m_qr(qr) {}
+  template<typename Derived>
+  SparseQR_QProduct<SparseQRType, Derived> operator*(const MatrixBase<Derived>& other) const
+  {
+    return SparseQR_QProduct<SparseQRType, Derived>(m_qr, other.derived(), true);
+  }
+  const SparseQRType& m_qr;
+};
+
+namespace internal {
+
+template<typename _MatrixType, typename OrderingType, typename Rhs>
+struct solve_retval<SparseQR<_MatrixType,OrderingType>, Rhs>
+  : solve_retval_base<SparseQR<_MatrixType,OrderingType>, Rhs>
+{
+  typedef SparseQR<_MatrixType,OrderingType> Dec;
+  EIGEN_MAKE_SOLVE_HELPERS(Dec,Rhs)
+
+  template<typename Dest> void evalTo(Dest& dst) const
+  {
+    dec()._solve(rhs(),dst);
+  }
+};
+
+} // end namespace internal
+
+#endif // EIGEN_SPARSE_QR_H
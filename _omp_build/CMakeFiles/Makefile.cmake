@@ -0,0 +1,1626 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/CTestConfig.cmake"
+  "/root/repo/CTestCustom.cmake.in"
+  "/root/repo/Eigen/CMakeLists.txt"
+  "/root/repo/Eigen/src/CMakeLists.txt"
+  "/root/repo/Eigen/src/Cholesky/CMakeLists.txt"
+  "/root/repo/Eigen/src/CholmodSupport/CMakeLists.txt"
+  "/root/repo/Eigen/src/Core/CMakeLists.txt"
+  "/root/repo/Eigen/src/Core/arch/AltiVec/CMakeLists.txt"
+  "/root/repo/Eigen/src/Core/arch/CMakeLists.txt"
+  "/root/repo/Eigen/src/Core/arch/Default/CMakeLists.txt"
+  "/root/repo/Eigen/src/Core/arch/NEON/CMakeLists.txt"
+  "/root/repo/Eigen/src/Core/arch/SSE/CMakeLists.txt"
+  "/root/repo/Eigen/src/Core/products/CMakeLists.txt"
+  "/root/repo/Eigen/src/Core/util/CMakeLists.txt"
+  "/root/repo/Eigen/src/Eigen2Support/CMakeLists.txt"
+  "/root/repo/Eigen/src/Eigen2Support/Geometry/CMakeLists.txt"
+  "/root/repo/Eigen/src/Eigenvalues/CMakeLists.txt"
+  "/root/repo/Eigen/src/Geometry/CMakeLists.txt"
+  "/root/repo/Eigen/src/Geometry/arch/CMakeLists.txt"
+  "/root/repo/Eigen/src/Householder/CMakeLists.txt"
+  "/root/repo/Eigen/src/IterativeLinearSolvers/CMakeLists.txt"
+  "/root/repo/Eigen/src/Jacobi/CMakeLists.txt"
+  "/root/repo/Eigen/src/LU/CMakeLists.txt"
+  "/root/repo/Eigen/src/LU/arch/CMakeLists.txt"
+  "/root/repo/Eigen/src/OrderingMethods/CMakeLists.txt"
+  "/root/repo/Eigen/src/PardisoSupport/CMakeLists.txt"
+  "/root/repo/Eigen/src/QR/CMakeLists.txt"
+  "/root/repo/Eigen/src/SVD/CMakeLists.txt"
+  "/root/repo/Eigen/src/SparseCholesky/CMakeLists.txt"
+  "/root/repo/Eigen/src/SparseCore/CMakeLists.txt"
+  "/root/repo/Eigen/src/SparseQR/CMakeLists.txt"
+  "/root/repo/Eigen/src/StlSupport/CMakeLists.txt"
+  "/root/repo/Eigen/src/SuperLUSupport/CMakeLists.txt"
+  "/root/repo/Eigen/src/UmfPackSupport/CMakeLists.txt"
+  "/root/repo/Eigen/src/misc/CMakeLists.txt"
+  "/root/repo/Eigen/src/plugins/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeFortranCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "DartConfiguration.tcl"
+  "is64.cpp"
+  "/root/repo/blas/CMakeLists.txt"
+  "/root/repo/blas/testing/CMakeLists.txt"
+  "/root/repo/cmake/EigenConfigureTesting.cmake"
+  "/root/repo/cmake/EigenDetermineOSVersion.cmake"
+  "/root/repo/cmake/EigenTesting.cmake"
+  "/root/repo/cmake/FindAdolc.cmake"
+  "/root/repo/cmake/FindCholmod.cmake"
+  "/root/repo/cmake/FindFFTW.cmake"
+  "/root/repo/cmake/FindGLEW.cmake"
+  "/root/repo/cmake/FindGMP.cmake"
+  "/root/repo/cmake/FindGSL.cmake"
+  "/root/repo/cmake/FindGoogleHash.cmake"
+  "/root/repo/cmake/FindMPFR.cmake"
+  "/root/repo/cmake/FindStandardMathLibrary.cmake"
+  "/root/repo/cmake/FindSuperLU.cmake"
+  "/root/repo/cmake/FindUmfpack.cmake"
+  "/root/repo/cmake/RegexUtils.cmake"
+  "/root/repo/cmake/language_support.cmake"
+  "/root/repo/demos/CMakeLists.txt"
+  "/root/repo/doc/CMakeLists.txt"
+  "/root/repo/doc/Doxyfile.in"
+  "/root/repo/doc/eigendoxy_footer.html.in"
+  "/root/repo/doc/eigendoxy_header.html.in"
+  "/root/repo/doc/examples/CMakeLists.txt"
+  "/root/repo/doc/snippets/CMakeLists.txt"
+  "/root/repo/doc/snippets/compile_snippet.cpp.in"
+  "/root/repo/eigen3.pc.in"
+  "/root/repo/lapack/CMakeLists.txt"
+  "/root/repo/scripts/CMakeLists.txt"
+  "/root/repo/scripts/buildtests.in"
+  "/root/repo/scripts/check.in"
+  "/root/repo/scripts/debug.in"
+  "/root/repo/scripts/release.in"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/unsupported/CMakeLists.txt"
+  "/root/repo/unsupported/Eigen/CMakeLists.txt"
+  "/root/repo/unsupported/Eigen/src/AutoDiff/CMakeLists.txt"
+  "/root/repo/unsupported/Eigen/src/BVH/CMakeLists.txt"
+  "/root/repo/unsupported/Eigen/src/CMakeLists.txt"
+  "/root/repo/unsupported/Eigen/src/FFT/CMakeLists.txt"
+  "/root/repo/unsupported/Eigen/src/IterativeSolvers/CMakeLists.txt"
+  "/root/repo/unsupported/Eigen/src/KroneckerProduct/CMakeLists.txt"
+  "/root/repo/unsupported/Eigen/src/MatrixFunctions/CMakeLists.txt"
+  "/root/repo/unsupported/Eigen/src/MoreVectorization/CMakeLists.txt"
+  "/root/repo/unsupported/Eigen/src/NonLinearOptimization/CMakeLists.txt"
+  "/root/repo/unsupported/Eigen/src/NumericalDiff/CMakeLists.txt"
+  "/root/repo/unsupported/Eigen/src/Polynomials/CMakeLists.txt"
+  "/root/repo/unsupported/Eigen/src/Skyline/CMakeLists.txt"
+  "/root/repo/unsupported/Eigen/src/SparseExtra/CMakeLists.txt"
+  "/root/repo/unsupported/Eigen/src/Splines/CMakeLists.txt"
+  "/root/repo/unsupported/doc/CMakeLists.txt"
+  "/root/repo/unsupported/doc/Doxyfile.in"
+  "/root/repo/unsupported/doc/examples/CMakeLists.txt"
+  "/root/repo/unsupported/doc/snippets/CMakeLists.txt"
+  "/root/repo/unsupported/test/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompilerABI.c"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompilerABI.cpp"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCompilerIdDetection.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompileFeatures.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerABI.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerId.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineFortranCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFortranCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeFortranCompilerABI.F90"
+  "/usr/share/cmake-3.25/Modules/CMakeFortranInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitIncludeInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseLibraryArchitecture.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePushCheckState.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystem.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCompilerCommon.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestFortranCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeUnixFindMake.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ADSP-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMCC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/AppleClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Borland-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Bruce-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompilerInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Comeau-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Cray-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Embarcadero-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Fujitsu-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/FujitsuClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GHS-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-FindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-Fortran.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IAR-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-C-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-CXX-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Intel-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IntelLLVM-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/MSVC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVHPC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVIDIA-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/OpenWatcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PGI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PathScale-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SCO-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SDCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Tasking-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TinyCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Watcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindGLUT.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenGL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindQt4.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/FeatureTesting.cmake"
+  "/usr/share/cmake-3.25/Modules/MacroAddFileDependencies.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-Determine-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-Fortran.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "eigen3.pc"
+  "DartConfiguration.tcl"
+  "DartConfiguration.tcl"
+  "CTestCustom.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/Cholesky/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/CholmodSupport/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/Core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/Core/products/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/Core/util/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/Core/arch/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/Core/arch/SSE/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/Core/arch/AltiVec/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/Core/arch/NEON/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/Core/arch/Default/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/Eigen2Support/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/Eigen2Support/Geometry/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/Eigenvalues/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/Geometry/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/Geometry/arch/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/Householder/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/IterativeLinearSolvers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/Jacobi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/LU/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/LU/arch/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/OrderingMethods/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/PardisoSupport/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/QR/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/SVD/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/SparseCholesky/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/SparseCore/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/SparseQR/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/StlSupport/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/SuperLUSupport/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/UmfPackSupport/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/misc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Eigen/src/plugins/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "doc/Doxyfile-unsupported"
+  "doc/Doxyfile"
+  "doc/eigendoxy_header.html"
+  "doc/eigendoxy_footer.html"
+  "doc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "doc/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "doc/snippets/compile_AngleAxis_mimic_euler.cpp"
+  "doc/snippets/compile_ColPivHouseholderQR_solve.cpp"
+  "doc/snippets/compile_ComplexEigenSolver_compute.cpp"
+  "doc/snippets/compile_ComplexEigenSolver_eigenvalues.cpp"
+  "doc/snippets/compile_ComplexEigenSolver_eigenvectors.cpp"
+  "doc/snippets/compile_ComplexSchur_compute.cpp"
+  "doc/snippets/compile_ComplexSchur_matrixT.cpp"
+  "doc/snippets/compile_ComplexSchur_matrixU.cpp"
+  "doc/snippets/compile_Cwise_abs.cpp"
+  "doc/snippets/compile_Cwise_abs2.cpp"
+  "doc/snippets/compile_Cwise_acos.cpp"
+  "doc/snippets/compile_Cwise_boolean_and.cpp"
+  "doc/snippets/compile_Cwise_boolean_or.cpp"
+  "doc/snippets/compile_Cwise_cos.cpp"
+  "doc/snippets/compile_Cwise_cube.cpp"
+  "doc/snippets/compile_Cwise_equal_equal.cpp"
+  "doc/snippets/compile_Cwise_exp.cpp"
+  "doc/snippets/compile_Cwise_greater.cpp"
+  "doc/snippets/compile_Cwise_greater_equal.cpp"
+  "doc/snippets/compile_Cwise_inverse.cpp"
+  "doc/snippets/compile_Cwise_less.cpp"
+  "doc/snippets/compile_Cwise_less_equal.cpp"
+  "doc/snippets/compile_Cwise_log.cpp"
+  "doc/snippets/compile_Cwise_max.cpp"
+  "doc/snippets/compile_Cwise_min.cpp"
+  "doc/snippets/compile_Cwise_minus.cpp"
+  "doc/snippets/compile_Cwise_minus_equal.cpp"
+  "doc/snippets/compile_Cwise_not_equal.cpp"
+  "doc/snippets/compile_Cwise_plus.cpp"
+  "doc/snippets/compile_Cwise_plus_equal.cpp"
+  "doc/snippets/compile_Cwise_pow.cpp"
+  "doc/snippets/compile_Cwise_product.cpp"
+  "doc/snippets/compile_Cwise_quotient.cpp"
+  "doc/snippets/compile_Cwise_sin.cpp"
+  "doc/snippets/compile_Cwise_slash_equal.cpp"
+  "doc/snippets/compile_Cwise_sqrt.cpp"
+  "doc/snippets/compile_Cwise_square.cpp"
+  "doc/snippets/compile_Cwise_tan.cpp"
+  "doc/snippets/compile_Cwise_times_equal.cpp"
+  "doc/snippets/compile_DenseBase_LinSpaced.cpp"
+  "doc/snippets/compile_DenseBase_LinSpaced_seq.cpp"
+  "doc/snippets/compile_DenseBase_setLinSpaced.cpp"
+  "doc/snippets/compile_DirectionWise_replicate.cpp"
+  "doc/snippets/compile_DirectionWise_replicate_int.cpp"
+  "doc/snippets/compile_EigenSolver_EigenSolver_MatrixType.cpp"
+  "doc/snippets/compile_EigenSolver_compute.cpp"
+  "doc/snippets/compile_EigenSolver_eigenvalues.cpp"
+  "doc/snippets/compile_EigenSolver_eigenvectors.cpp"
+  "doc/snippets/compile_EigenSolver_pseudoEigenvectors.cpp"
+  "doc/snippets/compile_FullPivHouseholderQR_solve.cpp"
+  "doc/snippets/compile_FullPivLU_image.cpp"
+  "doc/snippets/compile_FullPivLU_kernel.cpp"
+  "doc/snippets/compile_FullPivLU_solve.cpp"
+  "doc/snippets/compile_HessenbergDecomposition_compute.cpp"
+  "doc/snippets/compile_HessenbergDecomposition_matrixH.cpp"
+  "doc/snippets/compile_HessenbergDecomposition_packedMatrix.cpp"
+  "doc/snippets/compile_HouseholderQR_solve.cpp"
+  "doc/snippets/compile_HouseholderSequence_HouseholderSequence.cpp"
+  "doc/snippets/compile_IOFormat.cpp"
+  "doc/snippets/compile_JacobiSVD_basic.cpp"
+  "doc/snippets/compile_Jacobi_makeGivens.cpp"
+  "doc/snippets/compile_Jacobi_makeJacobi.cpp"
+  "doc/snippets/compile_LLT_example.cpp"
+  "doc/snippets/compile_LLT_solve.cpp"
+  "doc/snippets/compile_Map_general_stride.cpp"
+  "doc/snippets/compile_Map_inner_stride.cpp"
+  "doc/snippets/compile_Map_outer_stride.cpp"
+  "doc/snippets/compile_Map_placement_new.cpp"
+  "doc/snippets/compile_Map_simple.cpp"
+  "doc/snippets/compile_MatrixBase_adjoint.cpp"
+  "doc/snippets/compile_MatrixBase_all.cpp"
+  "doc/snippets/compile_MatrixBase_array.cpp"
+  "doc/snippets/compile_MatrixBase_array_const.cpp"
+  "doc/snippets/compile_MatrixBase_asDiagonal.cpp"
+  "doc/snippets/compile_MatrixBase_block_int_int.cpp"
+  "doc/snippets/compile_MatrixBase_block_int_int_int_int.cpp"
+  "doc/snippets/compile_MatrixBase_bottomLeftCorner_int_int.cpp"
+  "doc/snippets/compile_MatrixBase_bottomRightCorner_int_int.cpp"
+  "doc/snippets/compile_MatrixBase_bottomRows_int.cpp"
+  "doc/snippets/compile_MatrixBase_cast.cpp"
+  "doc/snippets/compile_MatrixBase_col.cpp"
+  "doc/snippets/compile_MatrixBase_colwise.cpp"
+  "doc/snippets/compile_MatrixBase_computeInverseAndDetWithCheck.cpp"
+  "doc/snippets/compile_MatrixBase_computeInverseWithCheck.cpp"
+  "doc/snippets/compile_MatrixBase_cwiseAbs.cpp"
+  "doc/snippets/compile_MatrixBase_cwiseAbs2.cpp"
+  "doc/snippets/compile_MatrixBase_cwiseEqual.cpp"
+  "doc/snippets/compile_MatrixBase_cwiseInverse.cpp"
+  "doc/snippets/compile_MatrixBase_cwiseMax.cpp"
+  "doc/snippets/compile_MatrixBase_cwiseMin.cpp"
+  "doc/snippets/compile_MatrixBase_cwiseNotEqual.cpp"
+  "doc/snippets/compile_MatrixBase_cwiseProduct.cpp"
+  "doc/snippets/compile_MatrixBase_cwiseQuotient.cpp"
+  "doc/snippets/compile_MatrixBase_cwiseSqrt.cpp"
+  "doc/snippets/compile_MatrixBase_diagonal.cpp"
+  "doc/snippets/compile_MatrixBase_diagonal_int.cpp"
+  "doc/snippets/compile_MatrixBase_diagonal_template_int.cpp"
+  "doc/snippets/compile_MatrixBase_eigenvalues.cpp"
+  "doc/snippets/compile_MatrixBase_end_int.cpp"
+  "doc/snippets/compile_MatrixBase_eval.cpp"
+  "doc/snippets/compile_MatrixBase_extract.cpp"
+  "doc/snippets/compile_MatrixBase_fixedBlock_int_int.cpp"
+  "doc/snippets/compile_MatrixBase_identity.cpp"
+  "doc/snippets/compile_MatrixBase_identity_int_int.cpp"
+  "doc/snippets/compile_MatrixBase_inverse.cpp"
+  "doc/snippets/compile_MatrixBase_isDiagonal.cpp"
+  "doc/snippets/compile_MatrixBase_isIdentity.cpp"
+  "doc/snippets/compile_MatrixBase_isOnes.cpp"
+  "doc/snippets/compile_MatrixBase_isOrthogonal.cpp"
+  "doc/snippets/compile_MatrixBase_isUnitary.cpp"
+  "doc/snippets/compile_MatrixBase_isZero.cpp"
+  "doc/snippets/compile_MatrixBase_leftCols_int.cpp"
+  "doc/snippets/compile_MatrixBase_marked.cpp"
+  "doc/snippets/compile_MatrixBase_noalias.cpp"
+  "doc/snippets/compile_MatrixBase_ones.cpp"
+  "doc/snippets/compile_MatrixBase_ones_int.cpp"
+  "doc/snippets/compile_MatrixBase_ones_int_int.cpp"
+  "doc/snippets/compile_MatrixBase_operatorNorm.cpp"
+  "doc/snippets/compile_MatrixBase_part.cpp"
+  "doc/snippets/compile_MatrixBase_prod.cpp"
+  "doc/snippets/compile_MatrixBase_random.cpp"
+  "doc/snippets/compile_MatrixBase_random_int.cpp"
+  "doc/snippets/compile_MatrixBase_random_int_int.cpp"
+  "doc/snippets/compile_MatrixBase_replicate.cpp"
+  "doc/snippets/compile_MatrixBase_replicate_int_int.cpp"
+  "doc/snippets/compile_MatrixBase_reverse.cpp"
+  "doc/snippets/compile_MatrixBase_rightCols_int.cpp"
+  "doc/snippets/compile_MatrixBase_row.cpp"
+  "doc/snippets/compile_MatrixBase_rowwise.cpp"
+  "doc/snippets/compile_MatrixBase_segment_int_int.cpp"
+  "doc/snippets/compile_MatrixBase_select.cpp"
+  "doc/snippets/compile_MatrixBase_set.cpp"
+  "doc/snippets/compile_MatrixBase_setIdentity.cpp"
+  "doc/snippets/compile_MatrixBase_setOnes.cpp"
+  "doc/snippets/compile_MatrixBase_setRandom.cpp"
+  "doc/snippets/compile_MatrixBase_setZero.cpp"
+  "doc/snippets/compile_MatrixBase_start_int.cpp"
+  "doc/snippets/compile_MatrixBase_template_int_bottomRows.cpp"
+  "doc/snippets/compile_MatrixBase_template_int_end.cpp"
+  "doc/snippets/compile_MatrixBase_template_int_int_bottomLeftCorner.cpp"
+  "doc/snippets/compile_MatrixBase_template_int_int_bottomRightCorner.cpp"
+  "doc/snippets/compile_MatrixBase_template_int_int_topLeftCorner.cpp"
+  "doc/snippets/compile_MatrixBase_template_int_int_topRightCorner.cpp"
+  "doc/snippets/compile_MatrixBase_template_int_leftCols.cpp"
+  "doc/snippets/compile_MatrixBase_template_int_rightCols.cpp"
+  "doc/snippets/compile_MatrixBase_template_int_segment.cpp"
+  "doc/snippets/compile_MatrixBase_template_int_start.cpp"
+  "doc/snippets/compile_MatrixBase_template_int_topRows.cpp"
+  "doc/snippets/compile_MatrixBase_topLeftCorner_int_int.cpp"
+  "doc/snippets/compile_MatrixBase_topRightCorner_int_int.cpp"
+  "doc/snippets/compile_MatrixBase_topRows_int.cpp"
+  "doc/snippets/compile_MatrixBase_transpose.cpp"
+  "doc/snippets/compile_MatrixBase_zero.cpp"
+  "doc/snippets/compile_MatrixBase_zero_int.cpp"
+  "doc/snippets/compile_MatrixBase_zero_int_int.cpp"
+  "doc/snippets/compile_Matrix_resize_NoChange_int.cpp"
+  "doc/snippets/compile_Matrix_resize_int.cpp"
+  "doc/snippets/compile_Matrix_resize_int_NoChange.cpp"
+  "doc/snippets/compile_Matrix_resize_int_int.cpp"
+  "doc/snippets/compile_Matrix_setConstant_int.cpp"
+  "doc/snippets/compile_Matrix_setConstant_int_int.cpp"
+  "doc/snippets/compile_Matrix_setIdentity_int_int.cpp"
+  "doc/snippets/compile_Matrix_setOnes_int.cpp"
+  "doc/snippets/compile_Matrix_setOnes_int_int.cpp"
+  "doc/snippets/compile_Matrix_setRandom_int.cpp"
+  "doc/snippets/compile_Matrix_setRandom_int_int.cpp"
+  "doc/snippets/compile_Matrix_setZero_int.cpp"
+  "doc/snippets/compile_Matrix_setZero_int_int.cpp"
+  "doc/snippets/compile_PartialPivLU_solve.cpp"
+  "doc/snippets/compile_PartialRedux_count.cpp"
+  "doc/snippets/compile_PartialRedux_maxCoeff.cpp"
+  "doc/snippets/compile_PartialRedux_minCoeff.cpp"
+  "doc/snippets/compile_PartialRedux_norm.cpp"
+  "doc/snippets/compile_PartialRedux_prod.cpp"
+  "doc/snippets/compile_PartialRedux_squaredNorm.cpp"
+  "doc/snippets/compile_PartialRedux_sum.cpp"
+  "doc/snippets/compile_RealSchur_RealSchur_MatrixType.cpp"
+  "doc/snippets/compile_RealSchur_compute.cpp"
+  "doc/snippets/compile_SelfAdjointEigenSolver_SelfAdjointEigenSolver.cpp"
+  "doc/snippets/compile_SelfAdjointEigenSolver_SelfAdjointEigenSolver_MatrixType.cpp"
+  "doc/snippets/compile_SelfAdjointEigenSolver_SelfAdjointEigenSolver_MatrixType2.cpp"
+  "doc/snippets/compile_SelfAdjointEigenSolver_compute_MatrixType.cpp"
+  "doc/snippets/compile_SelfAdjointEigenSolver_compute_MatrixType2.cpp"
+  "doc/snippets/compile_SelfAdjointEigenSolver_eigenvalues.cpp"
+  "doc/snippets/compile_SelfAdjointEigenSolver_eigenvectors.cpp"
+  "doc/snippets/compile_SelfAdjointEigenSolver_operatorInverseSqrt.cpp"
+  "doc/snippets/compile_SelfAdjointEigenSolver_operatorSqrt.cpp"
+  "doc/snippets/compile_SelfAdjointView_eigenvalues.cpp"
+  "doc/snippets/compile_SelfAdjointView_operatorNorm.cpp"
+  "doc/snippets/compile_TopicAliasing_block.cpp"
+  "doc/snippets/compile_TopicAliasing_block_correct.cpp"
+  "doc/snippets/compile_TopicAliasing_cwise.cpp"
+  "doc/snippets/compile_TopicAliasing_mult1.cpp"
+  "doc/snippets/compile_TopicAliasing_mult2.cpp"
+  "doc/snippets/compile_TopicAliasing_mult3.cpp"
+  "doc/snippets/compile_TopicStorageOrders_example.cpp"
+  "doc/snippets/compile_Tridiagonalization_Tridiagonalization_MatrixType.cpp"
+  "doc/snippets/compile_Tridiagonalization_compute.cpp"
+  "doc/snippets/compile_Tridiagonalization_decomposeInPlace.cpp"
+  "doc/snippets/compile_Tridiagonalization_diagonal.cpp"
+  "doc/snippets/compile_Tridiagonalization_householderCoefficients.cpp"
+  "doc/snippets/compile_Tridiagonalization_packedMatrix.cpp"
+  "doc/snippets/compile_Tutorial_AdvancedInitialization_Block.cpp"
+  "doc/snippets/compile_Tutorial_AdvancedInitialization_CommaTemporary.cpp"
+  "doc/snippets/compile_Tutorial_AdvancedInitialization_Join.cpp"
+  "doc/snippets/compile_Tutorial_AdvancedInitialization_LinSpaced.cpp"
+  "doc/snippets/compile_Tutorial_AdvancedInitialization_ThreeWays.cpp"
+  "doc/snippets/compile_Tutorial_AdvancedInitialization_Zero.cpp"
+  "doc/snippets/compile_Tutorial_Map_rowmajor.cpp"
+  "doc/snippets/compile_Tutorial_Map_using.cpp"
+  "doc/snippets/compile_Tutorial_commainit_01.cpp"
+  "doc/snippets/compile_Tutorial_commainit_01b.cpp"
+  "doc/snippets/compile_Tutorial_commainit_02.cpp"
+  "doc/snippets/compile_Tutorial_solve_matrix_inverse.cpp"
+  "doc/snippets/compile_Tutorial_solve_multiple_rhs.cpp"
+  "doc/snippets/compile_Tutorial_solve_reuse_decomposition.cpp"
+  "doc/snippets/compile_Tutorial_solve_singular.cpp"
+  "doc/snippets/compile_Tutorial_solve_triangular.cpp"
+  "doc/snippets/compile_Tutorial_solve_triangular_inplace.cpp"
+  "doc/snippets/compile_Vectorwise_reverse.cpp"
+  "doc/snippets/compile_class_FullPivLU.cpp"
+  "doc/snippets/compile_tut_arithmetic_redux_minmax.cpp"
+  "doc/snippets/compile_tut_arithmetic_transpose_aliasing.cpp"
+  "doc/snippets/compile_tut_arithmetic_transpose_conjugate.cpp"
+  "doc/snippets/compile_tut_arithmetic_transpose_inplace.cpp"
+  "doc/snippets/compile_tut_matrix_assignment_resizing.cpp"
+  "doc/snippets/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "CMakeFiles/3.25.1/CMakeFortranCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeFortranCompiler.cmake"
+  "blas/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "blas/testing/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lapack/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unsupported/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unsupported/Eigen/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unsupported/Eigen/src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unsupported/Eigen/src/AutoDiff/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unsupported/Eigen/src/BVH/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unsupported/Eigen/src/FFT/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unsupported/Eigen/src/IterativeSolvers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unsupported/Eigen/src/MatrixFunctions/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unsupported/Eigen/src/MoreVectorization/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unsupported/Eigen/src/NonLinearOptimization/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unsupported/Eigen/src/NumericalDiff/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unsupported/Eigen/src/Polynomials/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unsupported/Eigen/src/Skyline/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unsupported/Eigen/src/SparseExtra/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unsupported/Eigen/src/KroneckerProduct/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unsupported/Eigen/src/Splines/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unsupported/doc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unsupported/doc/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unsupported/doc/snippets/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unsupported/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "demos/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "buildtests.sh"
+  "check.sh"
+  "debug.sh"
+  "release.sh"
+  "scripts/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/buildtests.dir/DependInfo.cmake"
+  "CMakeFiles/check.dir/DependInfo.cmake"
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "doc/CMakeFiles/doc-eigen-prerequisites.dir/DependInfo.cmake"
+  "doc/CMakeFiles/doc-unsupported-prerequisites.dir/DependInfo.cmake"
+  "doc/CMakeFiles/doc.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/all_examples.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/DenseBase_middleCols_int.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/DenseBase_middleRows_int.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/DenseBase_template_int_middleCols.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/DenseBase_template_int_middleRows.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/MatrixBase_cwise_const.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/QuickStart_example.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/QuickStart_example2_dynamic.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/QuickStart_example2_fixed.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/TemplateKeyword_flexible.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/TemplateKeyword_simple.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/TutorialLinAlgComputeTwice.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/TutorialLinAlgExComputeSolveError.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/TutorialLinAlgExSolveColPivHouseholderQR.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/TutorialLinAlgExSolveLDLT.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/TutorialLinAlgInverseDeterminant.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/TutorialLinAlgRankRevealing.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/TutorialLinAlgSVDSolve.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/TutorialLinAlgSelfAdjointEigenSolver.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/TutorialLinAlgSetThreshold.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/Tutorial_ArrayClass_accessors.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/Tutorial_ArrayClass_addition.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/Tutorial_ArrayClass_cwise_other.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/Tutorial_ArrayClass_interop.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/Tutorial_ArrayClass_interop_matrix.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/Tutorial_ArrayClass_mult.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/Tutorial_BlockOperations_block_assignment.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/Tutorial_BlockOperations_colrow.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/Tutorial_BlockOperations_corner.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/Tutorial_BlockOperations_print_block.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/Tutorial_BlockOperations_vector.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/Tutorial_PartialLU_solve.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_broadcast_1nn.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_broadcast_simple.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_broadcast_simple_rowwise.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_colwise.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_maxnorm.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_reductions_bool.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_reductions_norm.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_rowwise.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_visitors.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/Tutorial_simple_example_dynamic_size.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/Tutorial_simple_example_fixed_size.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/class_Block.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/class_CwiseBinaryOp.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/class_CwiseUnaryOp.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/class_CwiseUnaryOp_ptrfun.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/class_FixedBlock.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/class_FixedVectorBlock.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/class_VectorBlock.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/function_taking_eigenbase.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/tut_arithmetic_add_sub.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/tut_arithmetic_dot_cross.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/tut_arithmetic_matrix_mul.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/tut_arithmetic_redux_basic.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/tut_arithmetic_scalar_mul_div.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/tut_matrix_coefficient_accessors.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/tut_matrix_resize.dir/DependInfo.cmake"
+  "doc/examples/CMakeFiles/tut_matrix_resize_fixed_size.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/all_snippets.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_AngleAxis_mimic_euler.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_ColPivHouseholderQR_solve.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_ComplexEigenSolver_compute.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_ComplexEigenSolver_eigenvalues.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_ComplexEigenSolver_eigenvectors.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_ComplexSchur_compute.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_ComplexSchur_matrixT.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_ComplexSchur_matrixU.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_abs.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_abs2.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_acos.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_boolean_and.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_boolean_or.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_cos.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_cube.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_equal_equal.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_exp.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_greater.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_greater_equal.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_inverse.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_less.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_less_equal.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_log.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_max.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_min.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_minus.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_minus_equal.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_not_equal.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_plus.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_plus_equal.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_pow.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_product.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_quotient.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_sin.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_slash_equal.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_sqrt.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_square.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_tan.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Cwise_times_equal.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_DenseBase_LinSpaced.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_DenseBase_LinSpaced_seq.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_DenseBase_setLinSpaced.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_DirectionWise_replicate.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_DirectionWise_replicate_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_EigenSolver_EigenSolver_MatrixType.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_EigenSolver_compute.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_EigenSolver_eigenvalues.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_EigenSolver_eigenvectors.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_EigenSolver_pseudoEigenvectors.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_FullPivHouseholderQR_solve.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_FullPivLU_image.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_FullPivLU_kernel.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_FullPivLU_solve.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_HessenbergDecomposition_compute.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_HessenbergDecomposition_matrixH.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_HessenbergDecomposition_packedMatrix.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_HouseholderQR_solve.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_HouseholderSequence_HouseholderSequence.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_IOFormat.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_JacobiSVD_basic.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Jacobi_makeGivens.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Jacobi_makeJacobi.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_LLT_example.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_LLT_solve.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Map_general_stride.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Map_inner_stride.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Map_outer_stride.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Map_placement_new.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Map_simple.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_adjoint.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_all.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_array.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_array_const.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_asDiagonal.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_block_int_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_block_int_int_int_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_bottomLeftCorner_int_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_bottomRightCorner_int_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_bottomRows_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_cast.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_col.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_colwise.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_computeInverseAndDetWithCheck.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_computeInverseWithCheck.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_cwiseAbs.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_cwiseAbs2.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_cwiseEqual.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_cwiseInverse.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_cwiseMax.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_cwiseMin.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_cwiseNotEqual.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_cwiseProduct.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_cwiseQuotient.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_cwiseSqrt.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_diagonal.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_diagonal_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_diagonal_template_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_eigenvalues.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_end_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_eval.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_extract.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_fixedBlock_int_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_identity.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_identity_int_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_inverse.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_isDiagonal.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_isIdentity.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_isOnes.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_isOrthogonal.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_isUnitary.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_isZero.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_leftCols_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_marked.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_noalias.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_ones.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_ones_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_ones_int_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_operatorNorm.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_part.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_prod.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_random.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_random_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_random_int_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_replicate.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_replicate_int_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_reverse.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_rightCols_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_row.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_rowwise.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_segment_int_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_select.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_set.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_setIdentity.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_setOnes.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_setRandom.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_setZero.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_start_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_template_int_bottomRows.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_template_int_end.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_template_int_int_bottomLeftCorner.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_template_int_int_bottomRightCorner.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_template_int_int_topLeftCorner.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_template_int_int_topRightCorner.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_template_int_leftCols.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_template_int_rightCols.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_template_int_segment.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_template_int_start.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_template_int_topRows.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_topLeftCorner_int_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_topRightCorner_int_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_topRows_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_transpose.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_zero.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_zero_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_MatrixBase_zero_int_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Matrix_resize_NoChange_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Matrix_resize_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Matrix_resize_int_NoChange.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Matrix_resize_int_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Matrix_setConstant_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Matrix_setConstant_int_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Matrix_setIdentity_int_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Matrix_setOnes_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Matrix_setOnes_int_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Matrix_setRandom_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Matrix_setRandom_int_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Matrix_setZero_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Matrix_setZero_int_int.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_PartialPivLU_solve.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_PartialRedux_count.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_PartialRedux_maxCoeff.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_PartialRedux_minCoeff.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_PartialRedux_norm.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_PartialRedux_prod.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_PartialRedux_squaredNorm.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_PartialRedux_sum.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_RealSchur_RealSchur_MatrixType.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_RealSchur_compute.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_SelfAdjointEigenSolver_SelfAdjointEigenSolver.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_SelfAdjointEigenSolver_SelfAdjointEigenSolver_MatrixType.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_SelfAdjointEigenSolver_SelfAdjointEigenSolver_MatrixType2.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_SelfAdjointEigenSolver_compute_MatrixType.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_SelfAdjointEigenSolver_compute_MatrixType2.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_SelfAdjointEigenSolver_eigenvalues.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_SelfAdjointEigenSolver_eigenvectors.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_SelfAdjointEigenSolver_operatorInverseSqrt.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_SelfAdjointEigenSolver_operatorSqrt.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_SelfAdjointView_eigenvalues.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_SelfAdjointView_operatorNorm.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_TopicAliasing_block.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_TopicAliasing_block_correct.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_TopicAliasing_cwise.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_TopicAliasing_mult1.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_TopicAliasing_mult2.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_TopicAliasing_mult3.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_TopicStorageOrders_example.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Tridiagonalization_Tridiagonalization_MatrixType.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Tridiagonalization_compute.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Tridiagonalization_decomposeInPlace.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Tridiagonalization_diagonal.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Tridiagonalization_householderCoefficients.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Tridiagonalization_packedMatrix.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Tutorial_AdvancedInitialization_Block.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Tutorial_AdvancedInitialization_CommaTemporary.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Tutorial_AdvancedInitialization_Join.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Tutorial_AdvancedInitialization_LinSpaced.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Tutorial_AdvancedInitialization_ThreeWays.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Tutorial_AdvancedInitialization_Zero.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Tutorial_Map_rowmajor.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Tutorial_Map_using.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Tutorial_commainit_01.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Tutorial_commainit_01b.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Tutorial_commainit_02.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Tutorial_solve_matrix_inverse.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Tutorial_solve_multiple_rhs.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Tutorial_solve_reuse_decomposition.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Tutorial_solve_singular.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Tutorial_solve_triangular.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Tutorial_solve_triangular_inplace.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_Vectorwise_reverse.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_class_FullPivLU.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_tut_arithmetic_redux_minmax.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_tut_arithmetic_transpose_aliasing.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_tut_arithmetic_transpose_conjugate.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_tut_arithmetic_transpose_inplace.dir/DependInfo.cmake"
+  "doc/snippets/CMakeFiles/compile_tut_matrix_assignment_resizing.dir/DependInfo.cmake"
+  "test/CMakeFiles/meta.dir/DependInfo.cmake"
+  "test/CMakeFiles/sizeof.dir/DependInfo.cmake"
+  "test/CMakeFiles/dynalloc.dir/DependInfo.cmake"
+  "test/CMakeFiles/nomalloc.dir/DependInfo.cmake"
+  "test/CMakeFiles/nomalloc_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/nomalloc_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/nomalloc_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/nomalloc_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/memory_arena.dir/DependInfo.cmake"
+  "test/CMakeFiles/memory_arena_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/memory_arena_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/memory_arena_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_workspace.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_workspace_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_workspace_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_workspace_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_workspace_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/parallel_eval.dir/DependInfo.cmake"
+  "test/CMakeFiles/parallel_eval_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/parallel_eval_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/parallel_eval_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/parallel_eval_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/parallel_eval_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/parallel_eval_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/parallel_eval_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/parallel_eval_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/fused_evaluation.dir/DependInfo.cmake"
+  "test/CMakeFiles/fused_evaluation_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/fused_evaluation_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/fused_evaluation_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/fused_evaluation_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/fused_evaluation_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/reproducible_redux.dir/DependInfo.cmake"
+  "test/CMakeFiles/reproducible_redux_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/reproducible_redux_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/reproducible_redux_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/reproducible_redux_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/reproducible_redux_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/first_aligned.dir/DependInfo.cmake"
+  "test/CMakeFiles/mixingtypes.dir/DependInfo.cmake"
+  "test/CMakeFiles/mixingtypes_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/mixingtypes_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/mixingtypes_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/packetmath.dir/DependInfo.cmake"
+  "test/CMakeFiles/packetmath_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/packetmath_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/packetmath_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/unalignedassert.dir/DependInfo.cmake"
+  "test/CMakeFiles/vectorization_logic.dir/DependInfo.cmake"
+  "test/CMakeFiles/basicstuff.dir/DependInfo.cmake"
+  "test/CMakeFiles/basicstuff_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/basicstuff_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/basicstuff_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/basicstuff_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/basicstuff_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/basicstuff_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/basicstuff_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/linearstructure.dir/DependInfo.cmake"
+  "test/CMakeFiles/linearstructure_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/linearstructure_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/linearstructure_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/linearstructure_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/linearstructure_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/linearstructure_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/linearstructure_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/linearstructure_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/linearstructure_9.dir/DependInfo.cmake"
+  "test/CMakeFiles/integer_types.dir/DependInfo.cmake"
+  "test/CMakeFiles/integer_types_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/integer_types_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/integer_types_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/integer_types_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/integer_types_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/integer_types_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/integer_types_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/integer_types_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/cwiseop.dir/DependInfo.cmake"
+  "test/CMakeFiles/cwiseop_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/cwiseop_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/cwiseop_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/cwiseop_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/cwiseop_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/cwiseop_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/unalignedcount.dir/DependInfo.cmake"
+  "test/CMakeFiles/exceptions.dir/DependInfo.cmake"
+  "test/CMakeFiles/redux.dir/DependInfo.cmake"
+  "test/CMakeFiles/redux_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/redux_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/redux_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/redux_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/redux_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/redux_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/redux_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/redux_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/visitor.dir/DependInfo.cmake"
+  "test/CMakeFiles/visitor_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/visitor_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/visitor_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/visitor_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/visitor_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/visitor_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/visitor_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/visitor_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/visitor_9.dir/DependInfo.cmake"
+  "test/CMakeFiles/visitor_10.dir/DependInfo.cmake"
+  "test/CMakeFiles/visitor_11.dir/DependInfo.cmake"
+  "test/CMakeFiles/visitor_12.dir/DependInfo.cmake"
+  "test/CMakeFiles/visitor_13.dir/DependInfo.cmake"
+  "test/CMakeFiles/block.dir/DependInfo.cmake"
+  "test/CMakeFiles/block_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/block_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/block_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/block_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/block_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/block_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/block_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/block_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/corners.dir/DependInfo.cmake"
+  "test/CMakeFiles/corners_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/corners_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/corners_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/corners_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/corners_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_small.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_small_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_small_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_small_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_small_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_small_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_small_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_large.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_large_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_large_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_large_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_large_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_large_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_large_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_extra.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_extra_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_extra_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_extra_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_extra_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_extra_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/diagonalmatrices.dir/DependInfo.cmake"
+  "test/CMakeFiles/diagonalmatrices_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/diagonalmatrices_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/diagonalmatrices_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/diagonalmatrices_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/diagonalmatrices_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/diagonalmatrices_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/diagonalmatrices_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/diagonalmatrices_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/diagonalmatrices_9.dir/DependInfo.cmake"
+  "test/CMakeFiles/adjoint.dir/DependInfo.cmake"
+  "test/CMakeFiles/adjoint_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/adjoint_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/adjoint_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/adjoint_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/adjoint_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/adjoint_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/adjoint_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/adjoint_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/adjoint_9.dir/DependInfo.cmake"
+  "test/CMakeFiles/adjoint_10.dir/DependInfo.cmake"
+  "test/CMakeFiles/diagonal.dir/DependInfo.cmake"
+  "test/CMakeFiles/diagonal_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/diagonal_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/miscmatrices.dir/DependInfo.cmake"
+  "test/CMakeFiles/miscmatrices_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/miscmatrices_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/miscmatrices_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/miscmatrices_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/miscmatrices_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/commainitializer.dir/DependInfo.cmake"
+  "test/CMakeFiles/smallvectors.dir/DependInfo.cmake"
+  "test/CMakeFiles/map.dir/DependInfo.cmake"
+  "test/CMakeFiles/map_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/map_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/map_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/map_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/map_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/map_11.dir/DependInfo.cmake"
+  "test/CMakeFiles/map_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/map_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/map_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/map_9.dir/DependInfo.cmake"
+  "test/CMakeFiles/map_10.dir/DependInfo.cmake"
+  "test/CMakeFiles/mapstride.dir/DependInfo.cmake"
+  "test/CMakeFiles/mapstride_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/mapstride_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/mapstride_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/mapstride_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/mapstride_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/mapstride_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/mapstaticmethods.dir/DependInfo.cmake"
+  "test/CMakeFiles/mapstaticmethods_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/mapstaticmethods_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/mapstaticmethods_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/mapstaticmethods_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/mapstaticmethods_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/mapstaticmethods_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/mapstaticmethods_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/mapstaticmethods_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/array.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_for_matrix.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_for_matrix_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_for_matrix_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_for_matrix_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_for_matrix_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_for_matrix_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_for_matrix_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_for_matrix_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_for_matrix_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_replicate.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_replicate_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_replicate_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_replicate_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_replicate_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_replicate_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_replicate_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_reverse.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_reverse_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_reverse_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_reverse_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_reverse_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_reverse_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_reverse_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_reverse_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_reverse_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/array_reverse_9.dir/DependInfo.cmake"
+  "test/CMakeFiles/triangular.dir/DependInfo.cmake"
+  "test/CMakeFiles/triangular_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/triangular_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/triangular_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/triangular_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/triangular_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/triangular_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/triangular_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/triangular_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/triangular_9.dir/DependInfo.cmake"
+  "test/CMakeFiles/selfadjoint.dir/DependInfo.cmake"
+  "test/CMakeFiles/selfadjoint_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/selfadjoint_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/selfadjoint_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/selfadjoint_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/selfadjoint_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_selfadjoint.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_selfadjoint_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_selfadjoint_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_selfadjoint_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_selfadjoint_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_selfadjoint_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_selfadjoint_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_selfadjoint_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_symm.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_symm_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_symm_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_symm_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_symm_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_symm_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_symm_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_symm_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_symm_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_syrk.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_syrk_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_syrk_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_syrk_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_syrk_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmv.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmv_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmv_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmv_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmv_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmv_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmv_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm_11.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm_111.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm_21.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm_121.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm_31.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm_131.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm_12.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm_112.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm_22.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm_122.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm_32.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm_132.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm_13.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm_113.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm_23.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm_123.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm_33.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm_133.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm_14.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm_114.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm_24.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm_124.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm_34.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trmm_134.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trsolve.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trsolve_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trsolve_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trsolve_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trsolve_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trsolve_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trsolve_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trsolve_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_trsolve_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_mmtr.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_mmtr_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_mmtr_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_mmtr_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_mmtr_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_notemporary.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_notemporary_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_notemporary_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_notemporary_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/product_notemporary_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/stable_norm.dir/DependInfo.cmake"
+  "test/CMakeFiles/stable_norm_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/stable_norm_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/stable_norm_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/stable_norm_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/stable_norm_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/bandmatrix.dir/DependInfo.cmake"
+  "test/CMakeFiles/cholesky.dir/DependInfo.cmake"
+  "test/CMakeFiles/cholesky_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/cholesky_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/cholesky_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/cholesky_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/cholesky_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/cholesky_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/cholesky_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/cholesky_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/cholesky_9.dir/DependInfo.cmake"
+  "test/CMakeFiles/lu.dir/DependInfo.cmake"
+  "test/CMakeFiles/lu_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/lu_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/lu_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/lu_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/lu_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/lu_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/lu_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/lu_9.dir/DependInfo.cmake"
+  "test/CMakeFiles/determinant.dir/DependInfo.cmake"
+  "test/CMakeFiles/determinant_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/determinant_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/determinant_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/determinant_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/determinant_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/determinant_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/inverse.dir/DependInfo.cmake"
+  "test/CMakeFiles/inverse_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/inverse_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/inverse_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/inverse_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/inverse_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/inverse_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/inverse_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_11.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_9.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_10.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_12.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_colpivoting.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_colpivoting_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_colpivoting_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_colpivoting_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_colpivoting_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_colpivoting_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_colpivoting_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_colpivoting_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_colpivoting_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_colpivoting_9.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_fullpivoting.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_fullpivoting_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_fullpivoting_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_fullpivoting_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_fullpivoting_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_fullpivoting_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_fullpivoting_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/qr_fullpivoting_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/upperbidiagonalization.dir/DependInfo.cmake"
+  "test/CMakeFiles/upperbidiagonalization_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/upperbidiagonalization_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/upperbidiagonalization_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/upperbidiagonalization_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/upperbidiagonalization_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/upperbidiagonalization_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/upperbidiagonalization_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/hessenberg.dir/DependInfo.cmake"
+  "test/CMakeFiles/hessenberg_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/hessenberg_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/hessenberg_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/hessenberg_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/hessenberg_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/hessenberg_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/schur_real.dir/DependInfo.cmake"
+  "test/CMakeFiles/schur_real_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/schur_real_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/schur_real_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/schur_real_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/schur_real_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/schur_complex.dir/DependInfo.cmake"
+  "test/CMakeFiles/schur_complex_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/schur_complex_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/schur_complex_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/schur_complex_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/schur_complex_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigensolver_selfadjoint.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigensolver_selfadjoint_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigensolver_selfadjoint_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigensolver_selfadjoint_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigensolver_selfadjoint_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigensolver_selfadjoint_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigensolver_selfadjoint_9.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigensolver_selfadjoint_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigensolver_selfadjoint_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigensolver_selfadjoint_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigensolver_generic.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigensolver_generic_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigensolver_generic_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigensolver_generic_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigensolver_generic_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigensolver_generic_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigensolver_complex.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigensolver_complex_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigensolver_complex_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigensolver_complex_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigensolver_complex_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigensolver_complex_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/jacobi.dir/DependInfo.cmake"
+  "test/CMakeFiles/jacobi_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/jacobi_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/jacobi_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/jacobi_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/jacobi_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/jacobi_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/jacobisvd.dir/DependInfo.cmake"
+  "test/CMakeFiles/jacobisvd_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/jacobisvd_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/jacobisvd_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/jacobisvd_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/jacobisvd_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/jacobisvd_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/jacobisvd_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/jacobisvd_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/jacobisvd_9.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_orthomethods.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_orthomethods_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_orthomethods_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_orthomethods_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_orthomethods_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_orthomethods_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_orthomethods_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_homogeneous.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_homogeneous_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_homogeneous_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_homogeneous_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_quaternion.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_quaternion_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_quaternion_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_quaternion_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_quaternion_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_quaternion_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_quaternion_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_transformations.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_transformations_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_transformations_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_transformations_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_transformations_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_transformations_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_transformations_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_eulerangles.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_eulerangles_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_eulerangles_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_hyperplane.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_hyperplane_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_hyperplane_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_hyperplane_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_hyperplane_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_parametrizedline.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_parametrizedline_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_parametrizedline_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_parametrizedline_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_parametrizedline_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_alignedbox.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_alignedbox_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_alignedbox_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_alignedbox_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_alignedbox_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_alignedbox_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_alignedbox_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_alignedbox_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_alignedbox_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_alignedbox_9.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_alignedbox_10.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_alignedbox_11.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_alignedbox_12.dir/DependInfo.cmake"
+  "test/CMakeFiles/geo_alignedbox_13.dir/DependInfo.cmake"
+  "test/CMakeFiles/stdvector.dir/DependInfo.cmake"
+  "test/CMakeFiles/stdvector_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/stdvector_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/stdvector_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/stdvector_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/stdvector_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/stdvector_overload.dir/DependInfo.cmake"
+  "test/CMakeFiles/stdvector_overload_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/stdvector_overload_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/stdvector_overload_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/stdvector_overload_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/stdvector_overload_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/stdlist.dir/DependInfo.cmake"
+  "test/CMakeFiles/stdlist_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/stdlist_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/stdlist_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/stdlist_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/stdlist_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/stddeque.dir/DependInfo.cmake"
+  "test/CMakeFiles/stddeque_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/stddeque_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/stddeque_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/stddeque_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/stddeque_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/resize.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_vector.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_vector_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_vector_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_basic.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_basic_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_basic_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_product.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_product_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_product_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_product_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_product_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_product_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_product_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_block_matrix.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_block_matrix_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_block_matrix_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_sliced_ell.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_sliced_ell_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_sliced_ell_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_sliced_ell_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_solvers.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_solvers_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_solvers_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparseqr.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparseqr_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparseqr_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/umeyama.dir/DependInfo.cmake"
+  "test/CMakeFiles/umeyama_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/umeyama_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/umeyama_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/umeyama_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/umeyama_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/umeyama_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/umeyama_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/umeyama_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/householder.dir/DependInfo.cmake"
+  "test/CMakeFiles/householder_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/householder_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/householder_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/householder_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/householder_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/householder_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/householder_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/householder_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/swap.dir/DependInfo.cmake"
+  "test/CMakeFiles/swap_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/swap_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/swap_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/swap_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/conservative_resize.dir/DependInfo.cmake"
+  "test/CMakeFiles/conservative_resize_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/conservative_resize_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/conservative_resize_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/conservative_resize_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/conservative_resize_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/conservative_resize_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/permutationmatrices.dir/DependInfo.cmake"
+  "test/CMakeFiles/permutationmatrices_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/permutationmatrices_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/permutationmatrices_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/permutationmatrices_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/permutationmatrices_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/permutationmatrices_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/permutationmatrices_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_permutations.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_permutations_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/sparse_permutations_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigen2support.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigen2support_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigen2support_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigen2support_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigen2support_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/eigen2support_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/nullary.dir/DependInfo.cmake"
+  "test/CMakeFiles/nullary_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/nullary_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/nullary_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/nullary_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/nullary_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/nullary_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/nullary_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/nullary_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/nesting_ops.dir/DependInfo.cmake"
+  "test/CMakeFiles/nesting_ops_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/nesting_ops_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/nesting_ops_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/nesting_ops_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/zerosized.dir/DependInfo.cmake"
+  "test/CMakeFiles/dontalign.dir/DependInfo.cmake"
+  "test/CMakeFiles/dontalign_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/dontalign_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/dontalign_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/dontalign_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/dontalign_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/dontalign_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/dontalign_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/dontalign_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/sizeoverflow.dir/DependInfo.cmake"
+  "test/CMakeFiles/prec_inverse_4x4.dir/DependInfo.cmake"
+  "test/CMakeFiles/prec_inverse_4x4_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/prec_inverse_4x4_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/prec_inverse_4x4_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/vectorwiseop.dir/DependInfo.cmake"
+  "test/CMakeFiles/vectorwiseop_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/vectorwiseop_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/vectorwiseop_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/vectorwiseop_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/vectorwiseop_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/vectorwiseop_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/vectorwiseop_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/vectorwiseop_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/simplicial_cholesky.dir/DependInfo.cmake"
+  "test/CMakeFiles/simplicial_cholesky_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/simplicial_cholesky_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/conjugate_gradient.dir/DependInfo.cmake"
+  "test/CMakeFiles/conjugate_gradient_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/conjugate_gradient_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/bicgstab.dir/DependInfo.cmake"
+  "test/CMakeFiles/bicgstab_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/bicgstab_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/gmres.dir/DependInfo.cmake"
+  "test/CMakeFiles/gmres_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/gmres_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/minres.dir/DependInfo.cmake"
+  "test/CMakeFiles/minres_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/minres_2.dir/DependInfo.cmake"
+  "blas/CMakeFiles/blas.dir/DependInfo.cmake"
+  "blas/CMakeFiles/eigen_blas_static.dir/DependInfo.cmake"
+  "blas/CMakeFiles/eigen_blas.dir/DependInfo.cmake"
+  "blas/testing/CMakeFiles/sblat1.dir/DependInfo.cmake"
+  "blas/testing/CMakeFiles/sblat2.dir/DependInfo.cmake"
+  "blas/testing/CMakeFiles/sblat3.dir/DependInfo.cmake"
+  "blas/testing/CMakeFiles/dblat1.dir/DependInfo.cmake"
+  "blas/testing/CMakeFiles/dblat2.dir/DependInfo.cmake"
+  "blas/testing/CMakeFiles/dblat3.dir/DependInfo.cmake"
+  "blas/testing/CMakeFiles/cblat1.dir/DependInfo.cmake"
+  "blas/testing/CMakeFiles/cblat2.dir/DependInfo.cmake"
+  "blas/testing/CMakeFiles/cblat3.dir/DependInfo.cmake"
+  "blas/testing/CMakeFiles/zblat1.dir/DependInfo.cmake"
+  "blas/testing/CMakeFiles/zblat2.dir/DependInfo.cmake"
+  "blas/testing/CMakeFiles/zblat3.dir/DependInfo.cmake"
+  "lapack/CMakeFiles/lapack.dir/DependInfo.cmake"
+  "lapack/CMakeFiles/eigen_lapack_static.dir/DependInfo.cmake"
+  "lapack/CMakeFiles/eigen_lapack.dir/DependInfo.cmake"
+  "unsupported/doc/examples/CMakeFiles/unsupported_examples.dir/DependInfo.cmake"
+  "unsupported/doc/examples/CMakeFiles/example_BVH_Example.dir/DependInfo.cmake"
+  "unsupported/doc/examples/CMakeFiles/example_FFT.dir/DependInfo.cmake"
+  "unsupported/doc/examples/CMakeFiles/example_MatrixExponential.dir/DependInfo.cmake"
+  "unsupported/doc/examples/CMakeFiles/example_MatrixFunction.dir/DependInfo.cmake"
+  "unsupported/doc/examples/CMakeFiles/example_MatrixLogarithm.dir/DependInfo.cmake"
+  "unsupported/doc/examples/CMakeFiles/example_MatrixSine.dir/DependInfo.cmake"
+  "unsupported/doc/examples/CMakeFiles/example_MatrixSinh.dir/DependInfo.cmake"
+  "unsupported/doc/examples/CMakeFiles/example_MatrixSquareRoot.dir/DependInfo.cmake"
+  "unsupported/doc/examples/CMakeFiles/example_PolynomialSolver1.dir/DependInfo.cmake"
+  "unsupported/doc/examples/CMakeFiles/example_PolynomialUtils1.dir/DependInfo.cmake"
+  "unsupported/doc/snippets/CMakeFiles/unsupported_snippets.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/NumericalDiff.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/autodiff.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/BVH.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/BVH_1.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/BVH_2.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/BVH_3.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/matrix_exponential.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/matrix_exponential_2.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/matrix_exponential_1.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/matrix_exponential_8.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/matrix_exponential_6.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/matrix_exponential_5.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/matrix_exponential_7.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/matrix_exponential_3.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/matrix_exponential_4.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/matrix_exponential_9.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/matrix_function.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/matrix_function_1.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/matrix_function_2.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/matrix_function_3.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/matrix_function_4.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/matrix_function_5.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/matrix_function_6.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/matrix_function_7.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/matrix_square_root.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/matrix_square_root_1.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/matrix_square_root_2.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/matrix_square_root_3.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/matrix_square_root_4.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/matrix_square_root_5.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/alignedvector3.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/FFT.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/sparse_extra.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/sparse_extra_1.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/sparse_extra_2.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/sparse_extra_3.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/polynomialsolver.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/polynomialsolver_1.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/polynomialsolver_2.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/polynomialsolver_3.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/polynomialsolver_4.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/polynomialsolver_5.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/polynomialsolver_6.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/polynomialsolver_7.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/polynomialsolver_8.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/polynomialsolver_9.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/polynomialsolver_10.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/polynomialutils.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/polynomialutils_2.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/polynomialutils_3.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/polynomialutils_4.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/polynomialutils_5.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/polynomialutils_6.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/polynomialutils_7.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/polynomialutils_8.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/polynomialutils_9.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/kronecker_product.dir/DependInfo.cmake"
+  "unsupported/test/CMakeFiles/splines.dir/DependInfo.cmake"
+  "demos/CMakeFiles/demos.dir/DependInfo.cmake"
+  )
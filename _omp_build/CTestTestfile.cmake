@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_omp_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("Eigen")
+subdirs("doc")
+subdirs("test")
+subdirs("blas")
+subdirs("lapack")
+subdirs("unsupported")
+subdirs("demos")
+subdirs("scripts")
@@ -0,0 +1,126 @@
+# Install script for directory: /root/repo/Eigen/src/Core
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Devel" OR NOT CMAKE_INSTALL_COMPONENT)
+  list(APPEND CMAKE_ABSOLUTE_DESTINATION_FILES
+   "/usr/local/include/eigen3/Eigen/src/Core/Array.h;/usr/local/include/eigen3/Eigen/src/Core/ArrayBase.h;/usr/local/include/eigen3/Eigen/src/Core/ArrayWrapper.h;/usr/local/include/eigen3/Eigen/src/Core/Assign.h;/usr/local/include/eigen3/Eigen/src/Core/Assign_MKL.h;/usr/local/include/eigen3/Eigen/src/Core/BandMatrix.h;/usr/local/include/eigen3/Eigen/src/Core/Block.h;/usr/local/include/eigen3/Eigen/src/Core/BlockedTranspose.h;/usr/local/include/eigen3/Eigen/src/Core/BooleanRedux.h;/usr/local/include/eigen3/Eigen/src/Core/CommaInitializer.h;/usr/local/include/eigen3/Eigen/src/Core/CwiseBinaryOp.h;/usr/local/include/eigen3/Eigen/src/Core/CwiseNullaryOp.h;/usr/local/include/eigen3/Eigen/src/Core/CwiseUnaryOp.h;/usr/local/include/eigen3/Eigen/src/Core/CwiseUnaryView.h;/usr/local/include/eigen3/Eigen/src/Core/DenseBase.h;/usr/local/include/eigen3/Eigen/src/Core/DenseCoeffsBase.h;/usr/local/include/eigen3/Eigen/src/Core/DenseStorage.h;/usr/local/include/eigen3/Eigen/src/Core/Diagonal.h;/usr/local/include/eigen3/Eigen/src/Core/DiagonalMatrix.h;/usr/local/include/eigen3/Eigen/src/Core/DiagonalProduct.h;/usr/local/include/eigen3/Eigen/src/Core/Dot.h;/usr/local/include/eigen3/Eigen/src/Core/EigenBase.h;/usr/local/include/eigen3/Eigen/src/Core/Flagged.h;/usr/local/include/eigen3/Eigen/src/Core/ForceAlignedAccess.h;/usr/local/include/eigen3/Eigen/src/Core/Functors.h;/usr/local/include/eigen3/Eigen/src/Core/FusedEvaluation.h;/usr/local/include/eigen3/Eigen/src/Core/Fuzzy.h;/usr/local/include/eigen3/Eigen/src/Core/GeneralProduct.h;/usr/local/include/eigen3/Eigen/src/Core/GenericPacketMath.h;/usr/local/include/eigen3/Eigen/src/Core/GlobalFunctions.h;/usr/local/include/eigen3/Eigen/src/Core/IO.h;/usr/local/include/eigen3/Eigen/src/Core/Map.h;/usr/local/include/eigen3/Eigen/src/Core/MapBase.h;/usr/local/include/eigen3/Eigen/src/Core/MathFunctions.h;/usr/local/include/eigen3/Eigen/src/Core/Matrix.h;/usr/local/include/eigen3/Eigen/src/Core/MatrixBase.h;/usr/local/include/eigen3/Eigen/src/Core/NestByValue.h;/usr/local/include/eigen3/Eigen/src/Core/NoAlias.h;/usr/local/include/eigen3/Eigen/src/Core/NumTraits.h;/usr/local/include/eigen3/Eigen/src/Core/PermutationMatrix.h;/usr/local/include/eigen3/Eigen/src/Core/PlainObjectBase.h;/usr/local/include/eigen3/Eigen/src/Core/Product.h;/usr/local/include/eigen3/Eigen/src/Core/ProductBase.h;/usr/local/include/eigen3/Eigen/src/Core/Random.h;/usr/local/include/eigen3/Eigen/src/Core/Redux.h;/usr/local/include/eigen3/Eigen/src/Core/Replicate.h;/usr/local/include/eigen3/Eigen/src/Core/ReturnByValue.h;/usr/local/include/eigen3/Eigen/src/Core/Reverse.h;/usr/local/include/eigen3/Eigen/src/Core/Select.h;/usr/local/include/eigen3/Eigen/src/Core/SelfAdjointView.h;/usr/local/include/eigen3/Eigen/src/Core/SelfCwiseBinaryOp.h;/usr/local/include/eigen3/Eigen/src/Core/SolveTriangular.h;/usr/local/include/eigen3/Eigen/src/Core/StableNorm.h;/usr/local/include/eigen3/Eigen/src/Core/Stride.h;/usr/local/include/eigen3/Eigen/src/Core/Swap.h;/usr/local/include/eigen3/Eigen/src/Core/Transpose.h;/usr/local/include/eigen3/Eigen/src/Core/Transpositions.h;/usr/local/include/eigen3/Eigen/src/Core/TriangularMatrix.h;/usr/local/include/eigen3/Eigen/src/Core/VectorBlock.h;/usr/local/include/eigen3/Eigen/src/Core/VectorwiseOp.h;/usr/local/include/eigen3/Eigen/src/Core/Visitor.h")
+  if(CMAKE_WARN_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(WARNING "ABSOLUTE path INSTALL DESTINATION : ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  if(CMAKE_ERROR_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(FATAL_ERROR "ABSOLUTE path INSTALL DESTINATION forbidden (by caller): ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  file(INSTALL DESTINATION "/usr/local/include/eigen3/Eigen/src/Core" TYPE FILE FILES
+    "/root/repo/Eigen/src/Core/Array.h"
+    "/root/repo/Eigen/src/Core/ArrayBase.h"
+    "/root/repo/Eigen/src/Core/ArrayWrapper.h"
+    "/root/repo/Eigen/src/Core/Assign.h"
+    "/root/repo/Eigen/src/Core/Assign_MKL.h"
+    "/root/repo/Eigen/src/Core/BandMatrix.h"
+    "/root/repo/Eigen/src/Core/Block.h"
+    "/root/repo/Eigen/src/Core/BlockedTranspose.h"
+    "/root/repo/Eigen/src/Core/BooleanRedux.h"
+    "/root/repo/Eigen/src/Core/CommaInitializer.h"
+    "/root/repo/Eigen/src/Core/CwiseBinaryOp.h"
+    "/root/repo/Eigen/src/Core/CwiseNullaryOp.h"
+    "/root/repo/Eigen/src/Core/CwiseUnaryOp.h"
+    "/root/repo/Eigen/src/Core/CwiseUnaryView.h"
+    "/root/repo/Eigen/src/Core/DenseBase.h"
+    "/root/repo/Eigen/src/Core/DenseCoeffsBase.h"
+    "/root/repo/Eigen/src/Core/DenseStorage.h"
+    "/root/repo/Eigen/src/Core/Diagonal.h"
+    "/root/repo/Eigen/src/Core/DiagonalMatrix.h"
+    "/root/repo/Eigen/src/Core/DiagonalProduct.h"
+    "/root/repo/Eigen/src/Core/Dot.h"
+    "/root/repo/Eigen/src/Core/EigenBase.h"
+    "/root/repo/Eigen/src/Core/Flagged.h"
+    "/root/repo/Eigen/src/Core/ForceAlignedAccess.h"
+    "/root/repo/Eigen/src/Core/Functors.h"
+    "/root/repo/Eigen/src/Core/FusedEvaluation.h"
+    "/root/repo/Eigen/src/Core/Fuzzy.h"
+    "/root/repo/Eigen/src/Core/GeneralProduct.h"
+    "/root/repo/Eigen/src/Core/GenericPacketMath.h"
+    "/root/repo/Eigen/src/Core/GlobalFunctions.h"
+    "/root/repo/Eigen/src/Core/IO.h"
+    "/root/repo/Eigen/src/Core/Map.h"
+    "/root/repo/Eigen/src/Core/MapBase.h"
+    "/root/repo/Eigen/src/Core/MathFunctions.h"
+    "/root/repo/Eigen/src/Core/Matrix.h"
+    "/root/repo/Eigen/src/Core/MatrixBase.h"
+    "/root/repo/Eigen/src/Core/NestByValue.h"
+    "/root/repo/Eigen/src/Core/NoAlias.h"
+    "/root/repo/Eigen/src/Core/NumTraits.h"
+    "/root/repo/Eigen/src/Core/PermutationMatrix.h"
+    "/root/repo/Eigen/src/Core/PlainObjectBase.h"
+    "/root/repo/Eigen/src/Core/Product.h"
+    "/root/repo/Eigen/src/Core/ProductBase.h"
+    "/root/repo/Eigen/src/Core/Random.h"
+    "/root/repo/Eigen/src/Core/Redux.h"
+    "/root/repo/Eigen/src/Core/Replicate.h"
+    "/root/repo/Eigen/src/Core/ReturnByValue.h"
+    "/root/repo/Eigen/src/Core/Reverse.h"
+    "/root/repo/Eigen/src/Core/Select.h"
+    "/root/repo/Eigen/src/Core/SelfAdjointView.h"
+    "/root/repo/Eigen/src/Core/SelfCwiseBinaryOp.h"
+    "/root/repo/Eigen/src/Core/SolveTriangular.h"
+    "/root/repo/Eigen/src/Core/StableNorm.h"
+    "/root/repo/Eigen/src/Core/Stride.h"
+    "/root/repo/Eigen/src/Core/Swap.h"
+    "/root/repo/Eigen/src/Core/Transpose.h"
+    "/root/repo/Eigen/src/Core/Transpositions.h"
+    "/root/repo/Eigen/src/Core/TriangularMatrix.h"
+    "/root/repo/Eigen/src/Core/VectorBlock.h"
+    "/root/repo/Eigen/src/Core/VectorwiseOp.h"
+    "/root/repo/Eigen/src/Core/Visitor.h"
+    )
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_omp_build/Eigen/src/Core/products/cmake_install.cmake")
+  include("/root/repo/_omp_build/Eigen/src/Core/util/cmake_install.cmake")
+  include("/root/repo/_omp_build/Eigen/src/Core/arch/cmake_install.cmake")
+
+endif()
+
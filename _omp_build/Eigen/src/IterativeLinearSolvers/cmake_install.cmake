@@ -0,0 +1,70 @@
+# Install script for directory: /root/repo/Eigen/src/IterativeLinearSolvers
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Devel" OR NOT CMAKE_INSTALL_COMPONENT)
+  list(APPEND CMAKE_ABSOLUTE_DESTINATION_FILES
+   "/usr/local/include/eigen3/Eigen/src/IterativeLinearSolvers/BasicPreconditioners.h;/usr/local/include/eigen3/Eigen/src/IterativeLinearSolvers/BiCGSTAB.h;/usr/local/include/eigen3/Eigen/src/IterativeLinearSolvers/BlockConjugateGradient.h;/usr/local/include/eigen3/Eigen/src/IterativeLinearSolvers/ConjugateGradient.h;/usr/local/include/eigen3/Eigen/src/IterativeLinearSolvers/GMRES.h;/usr/local/include/eigen3/Eigen/src/IterativeLinearSolvers/IncompleteCholesky.h;/usr/local/include/eigen3/Eigen/src/IterativeLinearSolvers/IncompleteLUT.h;/usr/local/include/eigen3/Eigen/src/IterativeLinearSolvers/IterativeSolverBase.h;/usr/local/include/eigen3/Eigen/src/IterativeLinearSolvers/KrylovKernels.h;/usr/local/include/eigen3/Eigen/src/IterativeLinearSolvers/MINRES.h;/usr/local/include/eigen3/Eigen/src/IterativeLinearSolvers/PipelinedBiCGSTAB.h;/usr/local/include/eigen3/Eigen/src/IterativeLinearSolvers/PipelinedConjugateGradient.h;/usr/local/include/eigen3/Eigen/src/IterativeLinearSolvers/SmoothedAggregationAMG.h")
+  if(CMAKE_WARN_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(WARNING "ABSOLUTE path INSTALL DESTINATION : ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  if(CMAKE_ERROR_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(FATAL_ERROR "ABSOLUTE path INSTALL DESTINATION forbidden (by caller): ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  file(INSTALL DESTINATION "/usr/local/include/eigen3/Eigen/src/IterativeLinearSolvers" TYPE FILE FILES
+    "/root/repo/Eigen/src/IterativeLinearSolvers/BasicPreconditioners.h"
+    "/root/repo/Eigen/src/IterativeLinearSolvers/BiCGSTAB.h"
+    "/root/repo/Eigen/src/IterativeLinearSolvers/BlockConjugateGradient.h"
+    "/root/repo/Eigen/src/IterativeLinearSolvers/ConjugateGradient.h"
+    "/root/repo/Eigen/src/IterativeLinearSolvers/GMRES.h"
+    "/root/repo/Eigen/src/IterativeLinearSolvers/IncompleteCholesky.h"
+    "/root/repo/Eigen/src/IterativeLinearSolvers/IncompleteLUT.h"
+    "/root/repo/Eigen/src/IterativeLinearSolvers/IterativeSolverBase.h"
+    "/root/repo/Eigen/src/IterativeLinearSolvers/KrylovKernels.h"
+    "/root/repo/Eigen/src/IterativeLinearSolvers/MINRES.h"
+    "/root/repo/Eigen/src/IterativeLinearSolvers/PipelinedBiCGSTAB.h"
+    "/root/repo/Eigen/src/IterativeLinearSolvers/PipelinedConjugateGradient.h"
+    "/root/repo/Eigen/src/IterativeLinearSolvers/SmoothedAggregationAMG.h"
+    )
+endif()
+
@@ -0,0 +1,90 @@
+# Install script for directory: /root/repo/Eigen/src/SparseCore
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Devel" OR NOT CMAKE_INSTALL_COMPONENT)
+  list(APPEND CMAKE_ABSOLUTE_DESTINATION_FILES
+   "/usr/local/include/eigen3/Eigen/src/SparseCore/AmbiVector.h;/usr/local/include/eigen3/Eigen/src/SparseCore/BlockSparseMatrix.h;/usr/local/include/eigen3/Eigen/src/SparseCore/CompressedStorage.h;/usr/local/include/eigen3/Eigen/src/SparseCore/ConservativeSparseSparseProduct.h;/usr/local/include/eigen3/Eigen/src/SparseCore/CoreIterators.h;/usr/local/include/eigen3/Eigen/src/SparseCore/MappedSparseMatrix.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SlicedEllMatrix.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SparseAssemblyPlan.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SparseAssign.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SparseBlock.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SparseColEtree.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SparseCwiseBinaryOp.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SparseCwiseUnaryOp.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SparseDenseProduct.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SparseDiagonalProduct.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SparseDot.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SparseFuzzy.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SparseMatrix.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SparseMatrixBase.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SparseParallelizer.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SparseProduct.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SparseProductPattern.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SparseRedux.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SparseSelfAdjointView.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SparseSparseProductWithPruning.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SparseSupernodalTriangularSolver.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SparseTranspose.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SparseTriangularSchedule.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SparseTriangularView.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SparseUtil.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SparseVector.h;/usr/local/include/eigen3/Eigen/src/SparseCore/SparseView.h;/usr/local/include/eigen3/Eigen/src/SparseCore/TriangularSolver.h")
+  if(CMAKE_WARN_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(WARNING "ABSOLUTE path INSTALL DESTINATION : ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  if(CMAKE_ERROR_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(FATAL_ERROR "ABSOLUTE path INSTALL DESTINATION forbidden (by caller): ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  file(INSTALL DESTINATION "/usr/local/include/eigen3/Eigen/src/SparseCore" TYPE FILE FILES
+    "/root/repo/Eigen/src/SparseCore/AmbiVector.h"
+    "/root/repo/Eigen/src/SparseCore/BlockSparseMatrix.h"
+    "/root/repo/Eigen/src/SparseCore/CompressedStorage.h"
+    "/root/repo/Eigen/src/SparseCore/ConservativeSparseSparseProduct.h"
+    "/root/repo/Eigen/src/SparseCore/CoreIterators.h"
+    "/root/repo/Eigen/src/SparseCore/MappedSparseMatrix.h"
+    "/root/repo/Eigen/src/SparseCore/SlicedEllMatrix.h"
+    "/root/repo/Eigen/src/SparseCore/SparseAssemblyPlan.h"
+    "/root/repo/Eigen/src/SparseCore/SparseAssign.h"
+    "/root/repo/Eigen/src/SparseCore/SparseBlock.h"
+    "/root/repo/Eigen/src/SparseCore/SparseColEtree.h"
+    "/root/repo/Eigen/src/SparseCore/SparseCwiseBinaryOp.h"
+    "/root/repo/Eigen/src/SparseCore/SparseCwiseUnaryOp.h"
+    "/root/repo/Eigen/src/SparseCore/SparseDenseProduct.h"
+    "/root/repo/Eigen/src/SparseCore/SparseDiagonalProduct.h"
+    "/root/repo/Eigen/src/SparseCore/SparseDot.h"
+    "/root/repo/Eigen/src/SparseCore/SparseFuzzy.h"
+    "/root/repo/Eigen/src/SparseCore/SparseMatrix.h"
+    "/root/repo/Eigen/src/SparseCore/SparseMatrixBase.h"
+    "/root/repo/Eigen/src/SparseCore/SparseParallelizer.h"
+    "/root/repo/Eigen/src/SparseCore/SparseProduct.h"
+    "/root/repo/Eigen/src/SparseCore/SparseProductPattern.h"
+    "/root/repo/Eigen/src/SparseCore/SparseRedux.h"
+    "/root/repo/Eigen/src/SparseCore/SparseSelfAdjointView.h"
+    "/root/repo/Eigen/src/SparseCore/SparseSparseProductWithPruning.h"
+    "/root/repo/Eigen/src/SparseCore/SparseSupernodalTriangularSolver.h"
+    "/root/repo/Eigen/src/SparseCore/SparseTranspose.h"
+    "/root/repo/Eigen/src/SparseCore/SparseTriangularSchedule.h"
+    "/root/repo/Eigen/src/SparseCore/SparseTriangularView.h"
+    "/root/repo/Eigen/src/SparseCore/SparseUtil.h"
+    "/root/repo/Eigen/src/SparseCore/SparseVector.h"
+    "/root/repo/Eigen/src/SparseCore/SparseView.h"
+    "/root/repo/Eigen/src/SparseCore/TriangularSolver.h"
+    )
+endif()
+
@@ -0,0 +1,53 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/eigen_blas.dir/chbmv.f.o"
+  "CMakeFiles/eigen_blas.dir/chpmv.f.o"
+  "CMakeFiles/eigen_blas.dir/chpr.f.o"
+  "CMakeFiles/eigen_blas.dir/chpr2.f.o"
+  "CMakeFiles/eigen_blas.dir/complex_double.cpp.o"
+  "CMakeFiles/eigen_blas.dir/complex_double.cpp.o.d"
+  "CMakeFiles/eigen_blas.dir/complex_single.cpp.o"
+  "CMakeFiles/eigen_blas.dir/complex_single.cpp.o.d"
+  "CMakeFiles/eigen_blas.dir/complexdots.f.o"
+  "CMakeFiles/eigen_blas.dir/ctbmv.f.o"
+  "CMakeFiles/eigen_blas.dir/ctpmv.f.o"
+  "CMakeFiles/eigen_blas.dir/ctpsv.f.o"
+  "CMakeFiles/eigen_blas.dir/double.cpp.o"
+  "CMakeFiles/eigen_blas.dir/double.cpp.o.d"
+  "CMakeFiles/eigen_blas.dir/drotm.f.o"
+  "CMakeFiles/eigen_blas.dir/drotmg.f.o"
+  "CMakeFiles/eigen_blas.dir/dsbmv.f.o"
+  "CMakeFiles/eigen_blas.dir/dspmv.f.o"
+  "CMakeFiles/eigen_blas.dir/dspr.f.o"
+  "CMakeFiles/eigen_blas.dir/dspr2.f.o"
+  "CMakeFiles/eigen_blas.dir/dtbmv.f.o"
+  "CMakeFiles/eigen_blas.dir/dtpmv.f.o"
+  "CMakeFiles/eigen_blas.dir/dtpsv.f.o"
+  "CMakeFiles/eigen_blas.dir/lsame.f.o"
+  "CMakeFiles/eigen_blas.dir/single.cpp.o"
+  "CMakeFiles/eigen_blas.dir/single.cpp.o.d"
+  "CMakeFiles/eigen_blas.dir/srotm.f.o"
+  "CMakeFiles/eigen_blas.dir/srotmg.f.o"
+  "CMakeFiles/eigen_blas.dir/ssbmv.f.o"
+  "CMakeFiles/eigen_blas.dir/sspmv.f.o"
+  "CMakeFiles/eigen_blas.dir/sspr.f.o"
+  "CMakeFiles/eigen_blas.dir/sspr2.f.o"
+  "CMakeFiles/eigen_blas.dir/stbmv.f.o"
+  "CMakeFiles/eigen_blas.dir/stpmv.f.o"
+  "CMakeFiles/eigen_blas.dir/stpsv.f.o"
+  "CMakeFiles/eigen_blas.dir/xerbla.cpp.o"
+  "CMakeFiles/eigen_blas.dir/xerbla.cpp.o.d"
+  "CMakeFiles/eigen_blas.dir/zhbmv.f.o"
+  "CMakeFiles/eigen_blas.dir/zhpmv.f.o"
+  "CMakeFiles/eigen_blas.dir/zhpr.f.o"
+  "CMakeFiles/eigen_blas.dir/zhpr2.f.o"
+  "CMakeFiles/eigen_blas.dir/ztbmv.f.o"
+  "CMakeFiles/eigen_blas.dir/ztpmv.f.o"
+  "CMakeFiles/eigen_blas.dir/ztpsv.f.o"
+  "libeigen_blas.pdb"
+  "libeigen_blas.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX Fortran)
+  include(CMakeFiles/eigen_blas.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,77 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  "Fortran"
+  )
+# The set of files for implicit dependencies of each language:
+set(CMAKE_DEPENDS_CHECK_Fortran
+  "/root/repo/blas/chbmv.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/chbmv.f.o"
+  "/root/repo/blas/chpmv.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/chpmv.f.o"
+  "/root/repo/blas/chpr.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/chpr.f.o"
+  "/root/repo/blas/chpr2.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/chpr2.f.o"
+  "/root/repo/blas/complexdots.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/complexdots.f.o"
+  "/root/repo/blas/ctbmv.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/ctbmv.f.o"
+  "/root/repo/blas/ctpmv.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/ctpmv.f.o"
+  "/root/repo/blas/ctpsv.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/ctpsv.f.o"
+  "/root/repo/blas/drotm.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/drotm.f.o"
+  "/root/repo/blas/drotmg.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/drotmg.f.o"
+  "/root/repo/blas/dsbmv.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/dsbmv.f.o"
+  "/root/repo/blas/dspmv.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/dspmv.f.o"
+  "/root/repo/blas/dspr.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/dspr.f.o"
+  "/root/repo/blas/dspr2.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/dspr2.f.o"
+  "/root/repo/blas/dtbmv.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/dtbmv.f.o"
+  "/root/repo/blas/dtpmv.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/dtpmv.f.o"
+  "/root/repo/blas/dtpsv.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/dtpsv.f.o"
+  "/root/repo/blas/lsame.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/lsame.f.o"
+  "/root/repo/blas/srotm.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/srotm.f.o"
+  "/root/repo/blas/srotmg.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/srotmg.f.o"
+  "/root/repo/blas/ssbmv.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/ssbmv.f.o"
+  "/root/repo/blas/sspmv.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/sspmv.f.o"
+  "/root/repo/blas/sspr.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/sspr.f.o"
+  "/root/repo/blas/sspr2.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/sspr2.f.o"
+  "/root/repo/blas/stbmv.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/stbmv.f.o"
+  "/root/repo/blas/stpmv.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/stpmv.f.o"
+  "/root/repo/blas/stpsv.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/stpsv.f.o"
+  "/root/repo/blas/zhbmv.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/zhbmv.f.o"
+  "/root/repo/blas/zhpmv.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/zhpmv.f.o"
+  "/root/repo/blas/zhpr.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/zhpr.f.o"
+  "/root/repo/blas/zhpr2.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/zhpr2.f.o"
+  "/root/repo/blas/ztbmv.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/ztbmv.f.o"
+  "/root/repo/blas/ztpmv.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/ztpmv.f.o"
+  "/root/repo/blas/ztpsv.f" "/root/repo/_omp_build/blas/CMakeFiles/eigen_blas_static.dir/ztpsv.f.o"
+  )
+set(CMAKE_Fortran_COMPILER_ID "GNU")
+set(CMAKE_Fortran_SUBMODULE_SEP "@")
+set(CMAKE_Fortran_SUBMODULE_EXT ".smod")
+
+# Preprocessor definitions for this target.
+set(CMAKE_TARGET_DEFINITIONS_Fortran
+  "EIGEN_PERMANENTLY_DISABLE_STUPID_WARNINGS"
+  )
+
+# The include file search paths:
+set(CMAKE_Fortran_TARGET_INCLUDE_PATH
+  "blas"
+  "/root/repo/blas"
+  "/root/repo"
+  "."
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/blas/complex_double.cpp" "blas/CMakeFiles/eigen_blas_static.dir/complex_double.cpp.o" "gcc" "blas/CMakeFiles/eigen_blas_static.dir/complex_double.cpp.o.d"
+  "/root/repo/blas/complex_single.cpp" "blas/CMakeFiles/eigen_blas_static.dir/complex_single.cpp.o" "gcc" "blas/CMakeFiles/eigen_blas_static.dir/complex_single.cpp.o.d"
+  "/root/repo/blas/double.cpp" "blas/CMakeFiles/eigen_blas_static.dir/double.cpp.o" "gcc" "blas/CMakeFiles/eigen_blas_static.dir/double.cpp.o.d"
+  "/root/repo/blas/single.cpp" "blas/CMakeFiles/eigen_blas_static.dir/single.cpp.o" "gcc" "blas/CMakeFiles/eigen_blas_static.dir/single.cpp.o.d"
+  "/root/repo/blas/xerbla.cpp" "blas/CMakeFiles/eigen_blas_static.dir/xerbla.cpp.o" "gcc" "blas/CMakeFiles/eigen_blas_static.dir/xerbla.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
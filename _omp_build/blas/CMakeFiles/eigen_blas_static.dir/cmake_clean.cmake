@@ -0,0 +1,53 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/eigen_blas_static.dir/chbmv.f.o"
+  "CMakeFiles/eigen_blas_static.dir/chpmv.f.o"
+  "CMakeFiles/eigen_blas_static.dir/chpr.f.o"
+  "CMakeFiles/eigen_blas_static.dir/chpr2.f.o"
+  "CMakeFiles/eigen_blas_static.dir/complex_double.cpp.o"
+  "CMakeFiles/eigen_blas_static.dir/complex_double.cpp.o.d"
+  "CMakeFiles/eigen_blas_static.dir/complex_single.cpp.o"
+  "CMakeFiles/eigen_blas_static.dir/complex_single.cpp.o.d"
+  "CMakeFiles/eigen_blas_static.dir/complexdots.f.o"
+  "CMakeFiles/eigen_blas_static.dir/ctbmv.f.o"
+  "CMakeFiles/eigen_blas_static.dir/ctpmv.f.o"
+  "CMakeFiles/eigen_blas_static.dir/ctpsv.f.o"
+  "CMakeFiles/eigen_blas_static.dir/double.cpp.o"
+  "CMakeFiles/eigen_blas_static.dir/double.cpp.o.d"
+  "CMakeFiles/eigen_blas_static.dir/drotm.f.o"
+  "CMakeFiles/eigen_blas_static.dir/drotmg.f.o"
+  "CMakeFiles/eigen_blas_static.dir/dsbmv.f.o"
+  "CMakeFiles/eigen_blas_static.dir/dspmv.f.o"
+  "CMakeFiles/eigen_blas_static.dir/dspr.f.o"
+  "CMakeFiles/eigen_blas_static.dir/dspr2.f.o"
+  "CMakeFiles/eigen_blas_static.dir/dtbmv.f.o"
+  "CMakeFiles/eigen_blas_static.dir/dtpmv.f.o"
+  "CMakeFiles/eigen_blas_static.dir/dtpsv.f.o"
+  "CMakeFiles/eigen_blas_static.dir/lsame.f.o"
+  "CMakeFiles/eigen_blas_static.dir/single.cpp.o"
+  "CMakeFiles/eigen_blas_static.dir/single.cpp.o.d"
+  "CMakeFiles/eigen_blas_static.dir/srotm.f.o"
+  "CMakeFiles/eigen_blas_static.dir/srotmg.f.o"
+  "CMakeFiles/eigen_blas_static.dir/ssbmv.f.o"
+  "CMakeFiles/eigen_blas_static.dir/sspmv.f.o"
+  "CMakeFiles/eigen_blas_static.dir/sspr.f.o"
+  "CMakeFiles/eigen_blas_static.dir/sspr2.f.o"
+  "CMakeFiles/eigen_blas_static.dir/stbmv.f.o"
+  "CMakeFiles/eigen_blas_static.dir/stpmv.f.o"
+  "CMakeFiles/eigen_blas_static.dir/stpsv.f.o"
+  "CMakeFiles/eigen_blas_static.dir/xerbla.cpp.o"
+  "CMakeFiles/eigen_blas_static.dir/xerbla.cpp.o.d"
+  "CMakeFiles/eigen_blas_static.dir/zhbmv.f.o"
+  "CMakeFiles/eigen_blas_static.dir/zhpmv.f.o"
+  "CMakeFiles/eigen_blas_static.dir/zhpr.f.o"
+  "CMakeFiles/eigen_blas_static.dir/zhpr2.f.o"
+  "CMakeFiles/eigen_blas_static.dir/ztbmv.f.o"
+  "CMakeFiles/eigen_blas_static.dir/ztpmv.f.o"
+  "CMakeFiles/eigen_blas_static.dir/ztpsv.f.o"
+  "libeigen_blas_static.a"
+  "libeigen_blas_static.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX Fortran)
+  include(CMakeFiles/eigen_blas_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
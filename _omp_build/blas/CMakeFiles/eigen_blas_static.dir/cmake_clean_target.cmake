@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libeigen_blas_static.a"
+)
@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/blas
+# Build directory: /root/repo/_omp_build/blas
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("testing")
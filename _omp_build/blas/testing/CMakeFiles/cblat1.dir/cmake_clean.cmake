@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cblat1.dir/cblat1.f.o"
+  "cblat1"
+  "cblat1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang Fortran)
+  include(CMakeFiles/cblat1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cblat2.dir/cblat2.f.o"
+  "cblat2"
+  "cblat2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang Fortran)
+  include(CMakeFiles/cblat2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
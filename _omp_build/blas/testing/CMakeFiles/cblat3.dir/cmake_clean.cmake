@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cblat3.dir/cblat3.f.o"
+  "cblat3"
+  "cblat3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang Fortran)
+  include(CMakeFiles/cblat3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dblat1.dir/dblat1.f.o"
+  "dblat1"
+  "dblat1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang Fortran)
+  include(CMakeFiles/dblat1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
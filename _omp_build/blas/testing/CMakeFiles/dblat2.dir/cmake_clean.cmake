@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dblat2.dir/dblat2.f.o"
+  "dblat2"
+  "dblat2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang Fortran)
+  include(CMakeFiles/dblat2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
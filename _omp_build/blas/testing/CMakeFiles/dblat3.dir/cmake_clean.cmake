@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dblat3.dir/dblat3.f.o"
+  "dblat3"
+  "dblat3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang Fortran)
+  include(CMakeFiles/dblat3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
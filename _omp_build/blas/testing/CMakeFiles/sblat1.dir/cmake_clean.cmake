@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sblat1.dir/sblat1.f.o"
+  "sblat1"
+  "sblat1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang Fortran)
+  include(CMakeFiles/sblat1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sblat2.dir/sblat2.f.o"
+  "sblat2"
+  "sblat2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang Fortran)
+  include(CMakeFiles/sblat2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sblat3.dir/sblat3.f.o"
+  "sblat3"
+  "sblat3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang Fortran)
+  include(CMakeFiles/sblat3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zblat1.dir/zblat1.f.o"
+  "zblat1"
+  "zblat1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang Fortran)
+  include(CMakeFiles/zblat1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zblat2.dir/zblat2.f.o"
+  "zblat2"
+  "zblat2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang Fortran)
+  include(CMakeFiles/zblat2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zblat3.dir/zblat3.f.o"
+  "zblat3"
+  "zblat3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang Fortran)
+  include(CMakeFiles/zblat3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,30 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/blas/testing
+# Build directory: /root/repo/_omp_build/blas/testing
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(sblat1 "/root/repo/blas/testing/runblastest.sh" "sblat1" "/root/repo/blas/testing/sblat1.dat")
+set_tests_properties(sblat1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/blas/testing/CMakeLists.txt;17;add_test;/root/repo/blas/testing/CMakeLists.txt;22;ei_add_blas_test;/root/repo/blas/testing/CMakeLists.txt;0;")
+add_test(sblat2 "/root/repo/blas/testing/runblastest.sh" "sblat2" "/root/repo/blas/testing/sblat2.dat")
+set_tests_properties(sblat2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/blas/testing/CMakeLists.txt;17;add_test;/root/repo/blas/testing/CMakeLists.txt;23;ei_add_blas_test;/root/repo/blas/testing/CMakeLists.txt;0;")
+add_test(sblat3 "/root/repo/blas/testing/runblastest.sh" "sblat3" "/root/repo/blas/testing/sblat3.dat")
+set_tests_properties(sblat3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/blas/testing/CMakeLists.txt;17;add_test;/root/repo/blas/testing/CMakeLists.txt;24;ei_add_blas_test;/root/repo/blas/testing/CMakeLists.txt;0;")
+add_test(dblat1 "/root/repo/blas/testing/runblastest.sh" "dblat1" "/root/repo/blas/testing/dblat1.dat")
+set_tests_properties(dblat1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/blas/testing/CMakeLists.txt;17;add_test;/root/repo/blas/testing/CMakeLists.txt;26;ei_add_blas_test;/root/repo/blas/testing/CMakeLists.txt;0;")
+add_test(dblat2 "/root/repo/blas/testing/runblastest.sh" "dblat2" "/root/repo/blas/testing/dblat2.dat")
+set_tests_properties(dblat2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/blas/testing/CMakeLists.txt;17;add_test;/root/repo/blas/testing/CMakeLists.txt;27;ei_add_blas_test;/root/repo/blas/testing/CMakeLists.txt;0;")
+add_test(dblat3 "/root/repo/blas/testing/runblastest.sh" "dblat3" "/root/repo/blas/testing/dblat3.dat")
+set_tests_properties(dblat3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/blas/testing/CMakeLists.txt;17;add_test;/root/repo/blas/testing/CMakeLists.txt;28;ei_add_blas_test;/root/repo/blas/testing/CMakeLists.txt;0;")
+add_test(cblat1 "/root/repo/blas/testing/runblastest.sh" "cblat1" "/root/repo/blas/testing/cblat1.dat")
+set_tests_properties(cblat1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/blas/testing/CMakeLists.txt;17;add_test;/root/repo/blas/testing/CMakeLists.txt;30;ei_add_blas_test;/root/repo/blas/testing/CMakeLists.txt;0;")
+add_test(cblat2 "/root/repo/blas/testing/runblastest.sh" "cblat2" "/root/repo/blas/testing/cblat2.dat")
+set_tests_properties(cblat2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/blas/testing/CMakeLists.txt;17;add_test;/root/repo/blas/testing/CMakeLists.txt;31;ei_add_blas_test;/root/repo/blas/testing/CMakeLists.txt;0;")
+add_test(cblat3 "/root/repo/blas/testing/runblastest.sh" "cblat3" "/root/repo/blas/testing/cblat3.dat")
+set_tests_properties(cblat3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/blas/testing/CMakeLists.txt;17;add_test;/root/repo/blas/testing/CMakeLists.txt;32;ei_add_blas_test;/root/repo/blas/testing/CMakeLists.txt;0;")
+add_test(zblat1 "/root/repo/blas/testing/runblastest.sh" "zblat1" "/root/repo/blas/testing/zblat1.dat")
+set_tests_properties(zblat1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/blas/testing/CMakeLists.txt;17;add_test;/root/repo/blas/testing/CMakeLists.txt;34;ei_add_blas_test;/root/repo/blas/testing/CMakeLists.txt;0;")
+add_test(zblat2 "/root/repo/blas/testing/runblastest.sh" "zblat2" "/root/repo/blas/testing/zblat2.dat")
+set_tests_properties(zblat2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/blas/testing/CMakeLists.txt;17;add_test;/root/repo/blas/testing/CMakeLists.txt;35;ei_add_blas_test;/root/repo/blas/testing/CMakeLists.txt;0;")
+add_test(zblat3 "/root/repo/blas/testing/runblastest.sh" "zblat3" "/root/repo/blas/testing/zblat3.dat")
+set_tests_properties(zblat3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/blas/testing/CMakeLists.txt;17;add_test;/root/repo/blas/testing/CMakeLists.txt;36;ei_add_blas_test;/root/repo/blas/testing/CMakeLists.txt;0;")
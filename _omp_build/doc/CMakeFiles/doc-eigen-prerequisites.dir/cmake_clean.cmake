@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/doc-eigen-prerequisites"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/doc-eigen-prerequisites.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
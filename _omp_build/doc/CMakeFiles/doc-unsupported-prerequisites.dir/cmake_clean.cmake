@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/doc-unsupported-prerequisites"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/doc-unsupported-prerequisites.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
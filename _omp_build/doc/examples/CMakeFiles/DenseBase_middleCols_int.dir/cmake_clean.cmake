@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DenseBase_middleCols_int.dir/DenseBase_middleCols_int.cpp.o"
+  "CMakeFiles/DenseBase_middleCols_int.dir/DenseBase_middleCols_int.cpp.o.d"
+  "DenseBase_middleCols_int"
+  "DenseBase_middleCols_int.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DenseBase_middleCols_int.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DenseBase_middleRows_int.dir/DenseBase_middleRows_int.cpp.o"
+  "CMakeFiles/DenseBase_middleRows_int.dir/DenseBase_middleRows_int.cpp.o.d"
+  "DenseBase_middleRows_int"
+  "DenseBase_middleRows_int.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DenseBase_middleRows_int.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
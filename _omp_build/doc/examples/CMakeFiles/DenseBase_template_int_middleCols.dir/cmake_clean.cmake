@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DenseBase_template_int_middleCols.dir/DenseBase_template_int_middleCols.cpp.o"
+  "CMakeFiles/DenseBase_template_int_middleCols.dir/DenseBase_template_int_middleCols.cpp.o.d"
+  "DenseBase_template_int_middleCols"
+  "DenseBase_template_int_middleCols.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DenseBase_template_int_middleCols.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DenseBase_template_int_middleRows.dir/DenseBase_template_int_middleRows.cpp.o"
+  "CMakeFiles/DenseBase_template_int_middleRows.dir/DenseBase_template_int_middleRows.cpp.o.d"
+  "DenseBase_template_int_middleRows"
+  "DenseBase_template_int_middleRows.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DenseBase_template_int_middleRows.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,19 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/doc/examples/MatrixBase_cwise_const.cpp" "doc/examples/CMakeFiles/MatrixBase_cwise_const.dir/MatrixBase_cwise_const.cpp.o" "gcc" "doc/examples/CMakeFiles/MatrixBase_cwise_const.dir/MatrixBase_cwise_const.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MatrixBase_cwise_const.dir/MatrixBase_cwise_const.cpp.o"
+  "CMakeFiles/MatrixBase_cwise_const.dir/MatrixBase_cwise_const.cpp.o.d"
+  "MatrixBase_cwise_const"
+  "MatrixBase_cwise_const.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MatrixBase_cwise_const.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/QuickStart_example.dir/QuickStart_example.cpp.o"
+  "CMakeFiles/QuickStart_example.dir/QuickStart_example.cpp.o.d"
+  "QuickStart_example"
+  "QuickStart_example.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/QuickStart_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/QuickStart_example2_dynamic.dir/QuickStart_example2_dynamic.cpp.o"
+  "CMakeFiles/QuickStart_example2_dynamic.dir/QuickStart_example2_dynamic.cpp.o.d"
+  "QuickStart_example2_dynamic"
+  "QuickStart_example2_dynamic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/QuickStart_example2_dynamic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
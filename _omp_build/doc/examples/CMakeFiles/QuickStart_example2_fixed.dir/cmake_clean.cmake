@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/QuickStart_example2_fixed.dir/QuickStart_example2_fixed.cpp.o"
+  "CMakeFiles/QuickStart_example2_fixed.dir/QuickStart_example2_fixed.cpp.o.d"
+  "QuickStart_example2_fixed"
+  "QuickStart_example2_fixed.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/QuickStart_example2_fixed.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TemplateKeyword_flexible.dir/TemplateKeyword_flexible.cpp.o"
+  "CMakeFiles/TemplateKeyword_flexible.dir/TemplateKeyword_flexible.cpp.o.d"
+  "TemplateKeyword_flexible"
+  "TemplateKeyword_flexible.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TemplateKeyword_flexible.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
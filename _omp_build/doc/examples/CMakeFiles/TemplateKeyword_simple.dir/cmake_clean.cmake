@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TemplateKeyword_simple.dir/TemplateKeyword_simple.cpp.o"
+  "CMakeFiles/TemplateKeyword_simple.dir/TemplateKeyword_simple.cpp.o.d"
+  "TemplateKeyword_simple"
+  "TemplateKeyword_simple.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TemplateKeyword_simple.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TutorialLinAlgComputeTwice.dir/TutorialLinAlgComputeTwice.cpp.o"
+  "CMakeFiles/TutorialLinAlgComputeTwice.dir/TutorialLinAlgComputeTwice.cpp.o.d"
+  "TutorialLinAlgComputeTwice"
+  "TutorialLinAlgComputeTwice.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TutorialLinAlgComputeTwice.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TutorialLinAlgExComputeSolveError.dir/TutorialLinAlgExComputeSolveError.cpp.o"
+  "CMakeFiles/TutorialLinAlgExComputeSolveError.dir/TutorialLinAlgExComputeSolveError.cpp.o.d"
+  "TutorialLinAlgExComputeSolveError"
+  "TutorialLinAlgExComputeSolveError.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TutorialLinAlgExComputeSolveError.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TutorialLinAlgExSolveColPivHouseholderQR.dir/TutorialLinAlgExSolveColPivHouseholderQR.cpp.o"
+  "CMakeFiles/TutorialLinAlgExSolveColPivHouseholderQR.dir/TutorialLinAlgExSolveColPivHouseholderQR.cpp.o.d"
+  "TutorialLinAlgExSolveColPivHouseholderQR"
+  "TutorialLinAlgExSolveColPivHouseholderQR.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TutorialLinAlgExSolveColPivHouseholderQR.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
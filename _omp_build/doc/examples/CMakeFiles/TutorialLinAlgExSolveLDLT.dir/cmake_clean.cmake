@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TutorialLinAlgExSolveLDLT.dir/TutorialLinAlgExSolveLDLT.cpp.o"
+  "CMakeFiles/TutorialLinAlgExSolveLDLT.dir/TutorialLinAlgExSolveLDLT.cpp.o.d"
+  "TutorialLinAlgExSolveLDLT"
+  "TutorialLinAlgExSolveLDLT.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TutorialLinAlgExSolveLDLT.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
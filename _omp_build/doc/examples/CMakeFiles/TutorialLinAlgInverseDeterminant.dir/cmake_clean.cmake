@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TutorialLinAlgInverseDeterminant.dir/TutorialLinAlgInverseDeterminant.cpp.o"
+  "CMakeFiles/TutorialLinAlgInverseDeterminant.dir/TutorialLinAlgInverseDeterminant.cpp.o.d"
+  "TutorialLinAlgInverseDeterminant"
+  "TutorialLinAlgInverseDeterminant.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TutorialLinAlgInverseDeterminant.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
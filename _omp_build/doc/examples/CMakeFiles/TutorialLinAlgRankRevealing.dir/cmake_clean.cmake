@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TutorialLinAlgRankRevealing.dir/TutorialLinAlgRankRevealing.cpp.o"
+  "CMakeFiles/TutorialLinAlgRankRevealing.dir/TutorialLinAlgRankRevealing.cpp.o.d"
+  "TutorialLinAlgRankRevealing"
+  "TutorialLinAlgRankRevealing.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TutorialLinAlgRankRevealing.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TutorialLinAlgSVDSolve.dir/TutorialLinAlgSVDSolve.cpp.o"
+  "CMakeFiles/TutorialLinAlgSVDSolve.dir/TutorialLinAlgSVDSolve.cpp.o.d"
+  "TutorialLinAlgSVDSolve"
+  "TutorialLinAlgSVDSolve.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TutorialLinAlgSVDSolve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TutorialLinAlgSelfAdjointEigenSolver.dir/TutorialLinAlgSelfAdjointEigenSolver.cpp.o"
+  "CMakeFiles/TutorialLinAlgSelfAdjointEigenSolver.dir/TutorialLinAlgSelfAdjointEigenSolver.cpp.o.d"
+  "TutorialLinAlgSelfAdjointEigenSolver"
+  "TutorialLinAlgSelfAdjointEigenSolver.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TutorialLinAlgSelfAdjointEigenSolver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Tutorial_ArrayClass_accessors.dir/Tutorial_ArrayClass_accessors.cpp.o"
+  "CMakeFiles/Tutorial_ArrayClass_accessors.dir/Tutorial_ArrayClass_accessors.cpp.o.d"
+  "Tutorial_ArrayClass_accessors"
+  "Tutorial_ArrayClass_accessors.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tutorial_ArrayClass_accessors.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Tutorial_ArrayClass_addition.dir/Tutorial_ArrayClass_addition.cpp.o"
+  "CMakeFiles/Tutorial_ArrayClass_addition.dir/Tutorial_ArrayClass_addition.cpp.o.d"
+  "Tutorial_ArrayClass_addition"
+  "Tutorial_ArrayClass_addition.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tutorial_ArrayClass_addition.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
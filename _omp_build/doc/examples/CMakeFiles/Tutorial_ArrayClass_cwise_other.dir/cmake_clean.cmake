@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Tutorial_ArrayClass_cwise_other.dir/Tutorial_ArrayClass_cwise_other.cpp.o"
+  "CMakeFiles/Tutorial_ArrayClass_cwise_other.dir/Tutorial_ArrayClass_cwise_other.cpp.o.d"
+  "Tutorial_ArrayClass_cwise_other"
+  "Tutorial_ArrayClass_cwise_other.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tutorial_ArrayClass_cwise_other.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Tutorial_ArrayClass_interop.dir/Tutorial_ArrayClass_interop.cpp.o"
+  "CMakeFiles/Tutorial_ArrayClass_interop.dir/Tutorial_ArrayClass_interop.cpp.o.d"
+  "Tutorial_ArrayClass_interop"
+  "Tutorial_ArrayClass_interop.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tutorial_ArrayClass_interop.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
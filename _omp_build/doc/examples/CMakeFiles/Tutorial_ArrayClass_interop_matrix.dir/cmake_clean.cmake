@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Tutorial_ArrayClass_interop_matrix.dir/Tutorial_ArrayClass_interop_matrix.cpp.o"
+  "CMakeFiles/Tutorial_ArrayClass_interop_matrix.dir/Tutorial_ArrayClass_interop_matrix.cpp.o.d"
+  "Tutorial_ArrayClass_interop_matrix"
+  "Tutorial_ArrayClass_interop_matrix.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tutorial_ArrayClass_interop_matrix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Tutorial_ArrayClass_mult.dir/Tutorial_ArrayClass_mult.cpp.o"
+  "CMakeFiles/Tutorial_ArrayClass_mult.dir/Tutorial_ArrayClass_mult.cpp.o.d"
+  "Tutorial_ArrayClass_mult"
+  "Tutorial_ArrayClass_mult.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tutorial_ArrayClass_mult.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
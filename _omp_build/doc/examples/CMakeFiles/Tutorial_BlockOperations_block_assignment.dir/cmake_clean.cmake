@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Tutorial_BlockOperations_block_assignment.dir/Tutorial_BlockOperations_block_assignment.cpp.o"
+  "CMakeFiles/Tutorial_BlockOperations_block_assignment.dir/Tutorial_BlockOperations_block_assignment.cpp.o.d"
+  "Tutorial_BlockOperations_block_assignment"
+  "Tutorial_BlockOperations_block_assignment.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tutorial_BlockOperations_block_assignment.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Tutorial_BlockOperations_colrow.dir/Tutorial_BlockOperations_colrow.cpp.o"
+  "CMakeFiles/Tutorial_BlockOperations_colrow.dir/Tutorial_BlockOperations_colrow.cpp.o.d"
+  "Tutorial_BlockOperations_colrow"
+  "Tutorial_BlockOperations_colrow.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tutorial_BlockOperations_colrow.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Tutorial_BlockOperations_corner.dir/Tutorial_BlockOperations_corner.cpp.o"
+  "CMakeFiles/Tutorial_BlockOperations_corner.dir/Tutorial_BlockOperations_corner.cpp.o.d"
+  "Tutorial_BlockOperations_corner"
+  "Tutorial_BlockOperations_corner.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tutorial_BlockOperations_corner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Tutorial_BlockOperations_print_block.dir/Tutorial_BlockOperations_print_block.cpp.o"
+  "CMakeFiles/Tutorial_BlockOperations_print_block.dir/Tutorial_BlockOperations_print_block.cpp.o.d"
+  "Tutorial_BlockOperations_print_block"
+  "Tutorial_BlockOperations_print_block.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tutorial_BlockOperations_print_block.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
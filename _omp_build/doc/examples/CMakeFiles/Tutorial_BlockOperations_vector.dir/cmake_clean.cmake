@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Tutorial_BlockOperations_vector.dir/Tutorial_BlockOperations_vector.cpp.o"
+  "CMakeFiles/Tutorial_BlockOperations_vector.dir/Tutorial_BlockOperations_vector.cpp.o.d"
+  "Tutorial_BlockOperations_vector"
+  "Tutorial_BlockOperations_vector.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tutorial_BlockOperations_vector.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Tutorial_PartialLU_solve.dir/Tutorial_PartialLU_solve.cpp.o"
+  "CMakeFiles/Tutorial_PartialLU_solve.dir/Tutorial_PartialLU_solve.cpp.o.d"
+  "Tutorial_PartialLU_solve"
+  "Tutorial_PartialLU_solve.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tutorial_PartialLU_solve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
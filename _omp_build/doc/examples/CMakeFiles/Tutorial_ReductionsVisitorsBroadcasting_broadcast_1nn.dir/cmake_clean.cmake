@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_broadcast_1nn.dir/Tutorial_ReductionsVisitorsBroadcasting_broadcast_1nn.cpp.o"
+  "CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_broadcast_1nn.dir/Tutorial_ReductionsVisitorsBroadcasting_broadcast_1nn.cpp.o.d"
+  "Tutorial_ReductionsVisitorsBroadcasting_broadcast_1nn"
+  "Tutorial_ReductionsVisitorsBroadcasting_broadcast_1nn.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_broadcast_1nn.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_broadcast_simple.dir/Tutorial_ReductionsVisitorsBroadcasting_broadcast_simple.cpp.o"
+  "CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_broadcast_simple.dir/Tutorial_ReductionsVisitorsBroadcasting_broadcast_simple.cpp.o.d"
+  "Tutorial_ReductionsVisitorsBroadcasting_broadcast_simple"
+  "Tutorial_ReductionsVisitorsBroadcasting_broadcast_simple.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_broadcast_simple.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
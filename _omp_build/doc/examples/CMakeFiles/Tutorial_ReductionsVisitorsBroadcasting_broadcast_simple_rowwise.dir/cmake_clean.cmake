@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_broadcast_simple_rowwise.dir/Tutorial_ReductionsVisitorsBroadcasting_broadcast_simple_rowwise.cpp.o"
+  "CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_broadcast_simple_rowwise.dir/Tutorial_ReductionsVisitorsBroadcasting_broadcast_simple_rowwise.cpp.o.d"
+  "Tutorial_ReductionsVisitorsBroadcasting_broadcast_simple_rowwise"
+  "Tutorial_ReductionsVisitorsBroadcasting_broadcast_simple_rowwise.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_broadcast_simple_rowwise.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
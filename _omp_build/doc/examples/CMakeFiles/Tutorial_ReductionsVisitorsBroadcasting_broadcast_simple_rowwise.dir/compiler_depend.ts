@@ -0,0 +1,2 @@
+# CMAKE generated file: DO NOT EDIT!
+# Timestamp file for compiler generated dependencies management for Tutorial_ReductionsVisitorsBroadcasting_broadcast_simple_rowwise.
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_colwise.dir/Tutorial_ReductionsVisitorsBroadcasting_colwise.cpp.o"
+  "CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_colwise.dir/Tutorial_ReductionsVisitorsBroadcasting_colwise.cpp.o.d"
+  "Tutorial_ReductionsVisitorsBroadcasting_colwise"
+  "Tutorial_ReductionsVisitorsBroadcasting_colwise.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_colwise.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
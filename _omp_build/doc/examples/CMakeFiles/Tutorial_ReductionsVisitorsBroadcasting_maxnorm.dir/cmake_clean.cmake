@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_maxnorm.dir/Tutorial_ReductionsVisitorsBroadcasting_maxnorm.cpp.o"
+  "CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_maxnorm.dir/Tutorial_ReductionsVisitorsBroadcasting_maxnorm.cpp.o.d"
+  "Tutorial_ReductionsVisitorsBroadcasting_maxnorm"
+  "Tutorial_ReductionsVisitorsBroadcasting_maxnorm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_maxnorm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
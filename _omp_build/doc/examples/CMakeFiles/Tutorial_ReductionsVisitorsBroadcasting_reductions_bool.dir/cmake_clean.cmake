@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_reductions_bool.dir/Tutorial_ReductionsVisitorsBroadcasting_reductions_bool.cpp.o"
+  "CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_reductions_bool.dir/Tutorial_ReductionsVisitorsBroadcasting_reductions_bool.cpp.o.d"
+  "Tutorial_ReductionsVisitorsBroadcasting_reductions_bool"
+  "Tutorial_ReductionsVisitorsBroadcasting_reductions_bool.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_reductions_bool.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_reductions_norm.dir/Tutorial_ReductionsVisitorsBroadcasting_reductions_norm.cpp.o"
+  "CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_reductions_norm.dir/Tutorial_ReductionsVisitorsBroadcasting_reductions_norm.cpp.o.d"
+  "Tutorial_ReductionsVisitorsBroadcasting_reductions_norm"
+  "Tutorial_ReductionsVisitorsBroadcasting_reductions_norm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_reductions_norm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_visitors.dir/Tutorial_ReductionsVisitorsBroadcasting_visitors.cpp.o"
+  "CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_visitors.dir/Tutorial_ReductionsVisitorsBroadcasting_visitors.cpp.o.d"
+  "Tutorial_ReductionsVisitorsBroadcasting_visitors"
+  "Tutorial_ReductionsVisitorsBroadcasting_visitors.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tutorial_ReductionsVisitorsBroadcasting_visitors.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
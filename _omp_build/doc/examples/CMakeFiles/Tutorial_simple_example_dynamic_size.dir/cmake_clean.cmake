@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Tutorial_simple_example_dynamic_size.dir/Tutorial_simple_example_dynamic_size.cpp.o"
+  "CMakeFiles/Tutorial_simple_example_dynamic_size.dir/Tutorial_simple_example_dynamic_size.cpp.o.d"
+  "Tutorial_simple_example_dynamic_size"
+  "Tutorial_simple_example_dynamic_size.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tutorial_simple_example_dynamic_size.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
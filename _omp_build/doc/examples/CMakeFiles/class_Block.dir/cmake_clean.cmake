@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/class_Block.dir/class_Block.cpp.o"
+  "CMakeFiles/class_Block.dir/class_Block.cpp.o.d"
+  "class_Block"
+  "class_Block.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/class_Block.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
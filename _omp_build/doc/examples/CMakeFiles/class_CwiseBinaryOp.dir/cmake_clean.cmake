@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/class_CwiseBinaryOp.dir/class_CwiseBinaryOp.cpp.o"
+  "CMakeFiles/class_CwiseBinaryOp.dir/class_CwiseBinaryOp.cpp.o.d"
+  "class_CwiseBinaryOp"
+  "class_CwiseBinaryOp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/class_CwiseBinaryOp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
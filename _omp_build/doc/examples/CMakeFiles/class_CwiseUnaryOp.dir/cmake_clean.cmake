@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/class_CwiseUnaryOp.dir/class_CwiseUnaryOp.cpp.o"
+  "CMakeFiles/class_CwiseUnaryOp.dir/class_CwiseUnaryOp.cpp.o.d"
+  "class_CwiseUnaryOp"
+  "class_CwiseUnaryOp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/class_CwiseUnaryOp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
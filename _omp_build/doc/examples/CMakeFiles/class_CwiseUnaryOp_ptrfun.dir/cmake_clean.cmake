@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/class_CwiseUnaryOp_ptrfun.dir/class_CwiseUnaryOp_ptrfun.cpp.o"
+  "CMakeFiles/class_CwiseUnaryOp_ptrfun.dir/class_CwiseUnaryOp_ptrfun.cpp.o.d"
+  "class_CwiseUnaryOp_ptrfun"
+  "class_CwiseUnaryOp_ptrfun.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/class_CwiseUnaryOp_ptrfun.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
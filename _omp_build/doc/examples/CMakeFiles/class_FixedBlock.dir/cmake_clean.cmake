@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/class_FixedBlock.dir/class_FixedBlock.cpp.o"
+  "CMakeFiles/class_FixedBlock.dir/class_FixedBlock.cpp.o.d"
+  "class_FixedBlock"
+  "class_FixedBlock.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/class_FixedBlock.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
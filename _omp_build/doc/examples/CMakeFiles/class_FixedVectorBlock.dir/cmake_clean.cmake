@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/class_FixedVectorBlock.dir/class_FixedVectorBlock.cpp.o"
+  "CMakeFiles/class_FixedVectorBlock.dir/class_FixedVectorBlock.cpp.o.d"
+  "class_FixedVectorBlock"
+  "class_FixedVectorBlock.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/class_FixedVectorBlock.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
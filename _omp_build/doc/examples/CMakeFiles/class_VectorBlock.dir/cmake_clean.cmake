@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/class_VectorBlock.dir/class_VectorBlock.cpp.o"
+  "CMakeFiles/class_VectorBlock.dir/class_VectorBlock.cpp.o.d"
+  "class_VectorBlock"
+  "class_VectorBlock.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/class_VectorBlock.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/function_taking_eigenbase.dir/function_taking_eigenbase.cpp.o"
+  "CMakeFiles/function_taking_eigenbase.dir/function_taking_eigenbase.cpp.o.d"
+  "function_taking_eigenbase"
+  "function_taking_eigenbase.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/function_taking_eigenbase.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
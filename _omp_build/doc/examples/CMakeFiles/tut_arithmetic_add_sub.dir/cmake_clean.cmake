@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tut_arithmetic_add_sub.dir/tut_arithmetic_add_sub.cpp.o"
+  "CMakeFiles/tut_arithmetic_add_sub.dir/tut_arithmetic_add_sub.cpp.o.d"
+  "tut_arithmetic_add_sub"
+  "tut_arithmetic_add_sub.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tut_arithmetic_add_sub.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
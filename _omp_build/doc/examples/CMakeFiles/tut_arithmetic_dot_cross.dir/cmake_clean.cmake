@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tut_arithmetic_dot_cross.dir/tut_arithmetic_dot_cross.cpp.o"
+  "CMakeFiles/tut_arithmetic_dot_cross.dir/tut_arithmetic_dot_cross.cpp.o.d"
+  "tut_arithmetic_dot_cross"
+  "tut_arithmetic_dot_cross.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tut_arithmetic_dot_cross.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
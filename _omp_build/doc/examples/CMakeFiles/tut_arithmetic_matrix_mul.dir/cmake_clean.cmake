@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tut_arithmetic_matrix_mul.dir/tut_arithmetic_matrix_mul.cpp.o"
+  "CMakeFiles/tut_arithmetic_matrix_mul.dir/tut_arithmetic_matrix_mul.cpp.o.d"
+  "tut_arithmetic_matrix_mul"
+  "tut_arithmetic_matrix_mul.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tut_arithmetic_matrix_mul.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tut_arithmetic_redux_basic.dir/tut_arithmetic_redux_basic.cpp.o"
+  "CMakeFiles/tut_arithmetic_redux_basic.dir/tut_arithmetic_redux_basic.cpp.o.d"
+  "tut_arithmetic_redux_basic"
+  "tut_arithmetic_redux_basic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tut_arithmetic_redux_basic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tut_arithmetic_scalar_mul_div.dir/tut_arithmetic_scalar_mul_div.cpp.o"
+  "CMakeFiles/tut_arithmetic_scalar_mul_div.dir/tut_arithmetic_scalar_mul_div.cpp.o.d"
+  "tut_arithmetic_scalar_mul_div"
+  "tut_arithmetic_scalar_mul_div.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tut_arithmetic_scalar_mul_div.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tut_matrix_coefficient_accessors.dir/tut_matrix_coefficient_accessors.cpp.o"
+  "CMakeFiles/tut_matrix_coefficient_accessors.dir/tut_matrix_coefficient_accessors.cpp.o.d"
+  "tut_matrix_coefficient_accessors"
+  "tut_matrix_coefficient_accessors.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tut_matrix_coefficient_accessors.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
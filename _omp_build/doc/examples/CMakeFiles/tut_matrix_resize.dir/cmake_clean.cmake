@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tut_matrix_resize.dir/tut_matrix_resize.cpp.o"
+  "CMakeFiles/tut_matrix_resize.dir/tut_matrix_resize.cpp.o.d"
+  "tut_matrix_resize"
+  "tut_matrix_resize.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tut_matrix_resize.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
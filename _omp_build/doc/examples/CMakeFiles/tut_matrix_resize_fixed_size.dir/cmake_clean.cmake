@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tut_matrix_resize_fixed_size.dir/tut_matrix_resize_fixed_size.cpp.o"
+  "CMakeFiles/tut_matrix_resize_fixed_size.dir/tut_matrix_resize_fixed_size.cpp.o.d"
+  "tut_matrix_resize_fixed_size"
+  "tut_matrix_resize_fixed_size.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tut_matrix_resize_fixed_size.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_AngleAxis_mimic_euler.dir/compile_AngleAxis_mimic_euler.cpp.o"
+  "CMakeFiles/compile_AngleAxis_mimic_euler.dir/compile_AngleAxis_mimic_euler.cpp.o.d"
+  "compile_AngleAxis_mimic_euler"
+  "compile_AngleAxis_mimic_euler.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_AngleAxis_mimic_euler.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_ColPivHouseholderQR_solve.dir/compile_ColPivHouseholderQR_solve.cpp.o"
+  "CMakeFiles/compile_ColPivHouseholderQR_solve.dir/compile_ColPivHouseholderQR_solve.cpp.o.d"
+  "compile_ColPivHouseholderQR_solve"
+  "compile_ColPivHouseholderQR_solve.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_ColPivHouseholderQR_solve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
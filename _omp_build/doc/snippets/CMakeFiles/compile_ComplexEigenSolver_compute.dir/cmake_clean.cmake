@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_ComplexEigenSolver_compute.dir/compile_ComplexEigenSolver_compute.cpp.o"
+  "CMakeFiles/compile_ComplexEigenSolver_compute.dir/compile_ComplexEigenSolver_compute.cpp.o.d"
+  "compile_ComplexEigenSolver_compute"
+  "compile_ComplexEigenSolver_compute.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_ComplexEigenSolver_compute.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
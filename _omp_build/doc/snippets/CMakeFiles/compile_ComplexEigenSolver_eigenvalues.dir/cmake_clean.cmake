@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_ComplexEigenSolver_eigenvalues.dir/compile_ComplexEigenSolver_eigenvalues.cpp.o"
+  "CMakeFiles/compile_ComplexEigenSolver_eigenvalues.dir/compile_ComplexEigenSolver_eigenvalues.cpp.o.d"
+  "compile_ComplexEigenSolver_eigenvalues"
+  "compile_ComplexEigenSolver_eigenvalues.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_ComplexEigenSolver_eigenvalues.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_ComplexEigenSolver_eigenvectors.dir/compile_ComplexEigenSolver_eigenvectors.cpp.o"
+  "CMakeFiles/compile_ComplexEigenSolver_eigenvectors.dir/compile_ComplexEigenSolver_eigenvectors.cpp.o.d"
+  "compile_ComplexEigenSolver_eigenvectors"
+  "compile_ComplexEigenSolver_eigenvectors.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_ComplexEigenSolver_eigenvectors.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_ComplexSchur_compute.dir/compile_ComplexSchur_compute.cpp.o"
+  "CMakeFiles/compile_ComplexSchur_compute.dir/compile_ComplexSchur_compute.cpp.o.d"
+  "compile_ComplexSchur_compute"
+  "compile_ComplexSchur_compute.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_ComplexSchur_compute.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_ComplexSchur_matrixT.dir/compile_ComplexSchur_matrixT.cpp.o"
+  "CMakeFiles/compile_ComplexSchur_matrixT.dir/compile_ComplexSchur_matrixT.cpp.o.d"
+  "compile_ComplexSchur_matrixT"
+  "compile_ComplexSchur_matrixT.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_ComplexSchur_matrixT.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
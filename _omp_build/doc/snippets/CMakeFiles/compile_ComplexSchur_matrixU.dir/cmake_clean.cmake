@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_ComplexSchur_matrixU.dir/compile_ComplexSchur_matrixU.cpp.o"
+  "CMakeFiles/compile_ComplexSchur_matrixU.dir/compile_ComplexSchur_matrixU.cpp.o.d"
+  "compile_ComplexSchur_matrixU"
+  "compile_ComplexSchur_matrixU.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_ComplexSchur_matrixU.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
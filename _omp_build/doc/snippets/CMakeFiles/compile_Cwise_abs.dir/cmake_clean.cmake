@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Cwise_abs.dir/compile_Cwise_abs.cpp.o"
+  "CMakeFiles/compile_Cwise_abs.dir/compile_Cwise_abs.cpp.o.d"
+  "compile_Cwise_abs"
+  "compile_Cwise_abs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Cwise_abs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
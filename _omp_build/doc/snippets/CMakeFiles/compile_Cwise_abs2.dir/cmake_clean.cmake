@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Cwise_abs2.dir/compile_Cwise_abs2.cpp.o"
+  "CMakeFiles/compile_Cwise_abs2.dir/compile_Cwise_abs2.cpp.o.d"
+  "compile_Cwise_abs2"
+  "compile_Cwise_abs2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Cwise_abs2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
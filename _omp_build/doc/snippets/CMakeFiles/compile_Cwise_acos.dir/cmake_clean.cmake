@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Cwise_acos.dir/compile_Cwise_acos.cpp.o"
+  "CMakeFiles/compile_Cwise_acos.dir/compile_Cwise_acos.cpp.o.d"
+  "compile_Cwise_acos"
+  "compile_Cwise_acos.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Cwise_acos.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Cwise_boolean_and.dir/compile_Cwise_boolean_and.cpp.o"
+  "CMakeFiles/compile_Cwise_boolean_and.dir/compile_Cwise_boolean_and.cpp.o.d"
+  "compile_Cwise_boolean_and"
+  "compile_Cwise_boolean_and.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Cwise_boolean_and.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Cwise_boolean_or.dir/compile_Cwise_boolean_or.cpp.o"
+  "CMakeFiles/compile_Cwise_boolean_or.dir/compile_Cwise_boolean_or.cpp.o.d"
+  "compile_Cwise_boolean_or"
+  "compile_Cwise_boolean_or.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Cwise_boolean_or.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
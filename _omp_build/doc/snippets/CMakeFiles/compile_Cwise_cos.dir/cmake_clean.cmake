@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Cwise_cos.dir/compile_Cwise_cos.cpp.o"
+  "CMakeFiles/compile_Cwise_cos.dir/compile_Cwise_cos.cpp.o.d"
+  "compile_Cwise_cos"
+  "compile_Cwise_cos.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Cwise_cos.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
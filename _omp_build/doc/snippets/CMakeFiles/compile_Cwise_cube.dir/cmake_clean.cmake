@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Cwise_cube.dir/compile_Cwise_cube.cpp.o"
+  "CMakeFiles/compile_Cwise_cube.dir/compile_Cwise_cube.cpp.o.d"
+  "compile_Cwise_cube"
+  "compile_Cwise_cube.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Cwise_cube.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
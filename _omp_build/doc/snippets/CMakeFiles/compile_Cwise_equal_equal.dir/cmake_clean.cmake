@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Cwise_equal_equal.dir/compile_Cwise_equal_equal.cpp.o"
+  "CMakeFiles/compile_Cwise_equal_equal.dir/compile_Cwise_equal_equal.cpp.o.d"
+  "compile_Cwise_equal_equal"
+  "compile_Cwise_equal_equal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Cwise_equal_equal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Cwise_exp.dir/compile_Cwise_exp.cpp.o"
+  "CMakeFiles/compile_Cwise_exp.dir/compile_Cwise_exp.cpp.o.d"
+  "compile_Cwise_exp"
+  "compile_Cwise_exp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Cwise_exp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
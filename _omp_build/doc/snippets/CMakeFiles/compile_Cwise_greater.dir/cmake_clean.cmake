@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Cwise_greater.dir/compile_Cwise_greater.cpp.o"
+  "CMakeFiles/compile_Cwise_greater.dir/compile_Cwise_greater.cpp.o.d"
+  "compile_Cwise_greater"
+  "compile_Cwise_greater.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Cwise_greater.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Cwise_inverse.dir/compile_Cwise_inverse.cpp.o"
+  "CMakeFiles/compile_Cwise_inverse.dir/compile_Cwise_inverse.cpp.o.d"
+  "compile_Cwise_inverse"
+  "compile_Cwise_inverse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Cwise_inverse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Cwise_less.dir/compile_Cwise_less.cpp.o"
+  "CMakeFiles/compile_Cwise_less.dir/compile_Cwise_less.cpp.o.d"
+  "compile_Cwise_less"
+  "compile_Cwise_less.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Cwise_less.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Cwise_log.dir/compile_Cwise_log.cpp.o"
+  "CMakeFiles/compile_Cwise_log.dir/compile_Cwise_log.cpp.o.d"
+  "compile_Cwise_log"
+  "compile_Cwise_log.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Cwise_log.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Cwise_max.dir/compile_Cwise_max.cpp.o"
+  "CMakeFiles/compile_Cwise_max.dir/compile_Cwise_max.cpp.o.d"
+  "compile_Cwise_max"
+  "compile_Cwise_max.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Cwise_max.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Cwise_min.dir/compile_Cwise_min.cpp.o"
+  "CMakeFiles/compile_Cwise_min.dir/compile_Cwise_min.cpp.o.d"
+  "compile_Cwise_min"
+  "compile_Cwise_min.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Cwise_min.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
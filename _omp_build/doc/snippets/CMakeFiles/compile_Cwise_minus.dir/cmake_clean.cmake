@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Cwise_minus.dir/compile_Cwise_minus.cpp.o"
+  "CMakeFiles/compile_Cwise_minus.dir/compile_Cwise_minus.cpp.o.d"
+  "compile_Cwise_minus"
+  "compile_Cwise_minus.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Cwise_minus.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
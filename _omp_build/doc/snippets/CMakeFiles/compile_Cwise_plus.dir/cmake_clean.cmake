@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Cwise_plus.dir/compile_Cwise_plus.cpp.o"
+  "CMakeFiles/compile_Cwise_plus.dir/compile_Cwise_plus.cpp.o.d"
+  "compile_Cwise_plus"
+  "compile_Cwise_plus.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Cwise_plus.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Cwise_pow.dir/compile_Cwise_pow.cpp.o"
+  "CMakeFiles/compile_Cwise_pow.dir/compile_Cwise_pow.cpp.o.d"
+  "compile_Cwise_pow"
+  "compile_Cwise_pow.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Cwise_pow.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
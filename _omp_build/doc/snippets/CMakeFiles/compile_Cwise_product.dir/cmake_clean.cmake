@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Cwise_product.dir/compile_Cwise_product.cpp.o"
+  "CMakeFiles/compile_Cwise_product.dir/compile_Cwise_product.cpp.o.d"
+  "compile_Cwise_product"
+  "compile_Cwise_product.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Cwise_product.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
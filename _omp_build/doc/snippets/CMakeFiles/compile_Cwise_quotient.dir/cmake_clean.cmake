@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Cwise_quotient.dir/compile_Cwise_quotient.cpp.o"
+  "CMakeFiles/compile_Cwise_quotient.dir/compile_Cwise_quotient.cpp.o.d"
+  "compile_Cwise_quotient"
+  "compile_Cwise_quotient.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Cwise_quotient.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Cwise_sin.dir/compile_Cwise_sin.cpp.o"
+  "CMakeFiles/compile_Cwise_sin.dir/compile_Cwise_sin.cpp.o.d"
+  "compile_Cwise_sin"
+  "compile_Cwise_sin.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Cwise_sin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
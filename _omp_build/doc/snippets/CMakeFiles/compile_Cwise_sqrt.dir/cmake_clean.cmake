@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Cwise_sqrt.dir/compile_Cwise_sqrt.cpp.o"
+  "CMakeFiles/compile_Cwise_sqrt.dir/compile_Cwise_sqrt.cpp.o.d"
+  "compile_Cwise_sqrt"
+  "compile_Cwise_sqrt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Cwise_sqrt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Cwise_square.dir/compile_Cwise_square.cpp.o"
+  "CMakeFiles/compile_Cwise_square.dir/compile_Cwise_square.cpp.o.d"
+  "compile_Cwise_square"
+  "compile_Cwise_square.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Cwise_square.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
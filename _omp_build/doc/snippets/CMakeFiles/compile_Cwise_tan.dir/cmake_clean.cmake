@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Cwise_tan.dir/compile_Cwise_tan.cpp.o"
+  "CMakeFiles/compile_Cwise_tan.dir/compile_Cwise_tan.cpp.o.d"
+  "compile_Cwise_tan"
+  "compile_Cwise_tan.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Cwise_tan.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_DenseBase_LinSpaced.dir/compile_DenseBase_LinSpaced.cpp.o"
+  "CMakeFiles/compile_DenseBase_LinSpaced.dir/compile_DenseBase_LinSpaced.cpp.o.d"
+  "compile_DenseBase_LinSpaced"
+  "compile_DenseBase_LinSpaced.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_DenseBase_LinSpaced.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
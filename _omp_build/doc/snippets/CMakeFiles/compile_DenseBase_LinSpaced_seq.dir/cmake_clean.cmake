@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_DenseBase_LinSpaced_seq.dir/compile_DenseBase_LinSpaced_seq.cpp.o"
+  "CMakeFiles/compile_DenseBase_LinSpaced_seq.dir/compile_DenseBase_LinSpaced_seq.cpp.o.d"
+  "compile_DenseBase_LinSpaced_seq"
+  "compile_DenseBase_LinSpaced_seq.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_DenseBase_LinSpaced_seq.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_DenseBase_setLinSpaced.dir/compile_DenseBase_setLinSpaced.cpp.o"
+  "CMakeFiles/compile_DenseBase_setLinSpaced.dir/compile_DenseBase_setLinSpaced.cpp.o.d"
+  "compile_DenseBase_setLinSpaced"
+  "compile_DenseBase_setLinSpaced.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_DenseBase_setLinSpaced.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_DirectionWise_replicate.dir/compile_DirectionWise_replicate.cpp.o"
+  "CMakeFiles/compile_DirectionWise_replicate.dir/compile_DirectionWise_replicate.cpp.o.d"
+  "compile_DirectionWise_replicate"
+  "compile_DirectionWise_replicate.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_DirectionWise_replicate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_DirectionWise_replicate_int.dir/compile_DirectionWise_replicate_int.cpp.o"
+  "CMakeFiles/compile_DirectionWise_replicate_int.dir/compile_DirectionWise_replicate_int.cpp.o.d"
+  "compile_DirectionWise_replicate_int"
+  "compile_DirectionWise_replicate_int.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_DirectionWise_replicate_int.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
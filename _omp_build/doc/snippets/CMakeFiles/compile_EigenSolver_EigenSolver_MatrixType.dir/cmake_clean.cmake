@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_EigenSolver_EigenSolver_MatrixType.dir/compile_EigenSolver_EigenSolver_MatrixType.cpp.o"
+  "CMakeFiles/compile_EigenSolver_EigenSolver_MatrixType.dir/compile_EigenSolver_EigenSolver_MatrixType.cpp.o.d"
+  "compile_EigenSolver_EigenSolver_MatrixType"
+  "compile_EigenSolver_EigenSolver_MatrixType.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_EigenSolver_EigenSolver_MatrixType.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
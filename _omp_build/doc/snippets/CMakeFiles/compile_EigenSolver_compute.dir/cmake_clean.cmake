@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_EigenSolver_compute.dir/compile_EigenSolver_compute.cpp.o"
+  "CMakeFiles/compile_EigenSolver_compute.dir/compile_EigenSolver_compute.cpp.o.d"
+  "compile_EigenSolver_compute"
+  "compile_EigenSolver_compute.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_EigenSolver_compute.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_EigenSolver_eigenvalues.dir/compile_EigenSolver_eigenvalues.cpp.o"
+  "CMakeFiles/compile_EigenSolver_eigenvalues.dir/compile_EigenSolver_eigenvalues.cpp.o.d"
+  "compile_EigenSolver_eigenvalues"
+  "compile_EigenSolver_eigenvalues.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_EigenSolver_eigenvalues.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_EigenSolver_eigenvectors.dir/compile_EigenSolver_eigenvectors.cpp.o"
+  "CMakeFiles/compile_EigenSolver_eigenvectors.dir/compile_EigenSolver_eigenvectors.cpp.o.d"
+  "compile_EigenSolver_eigenvectors"
+  "compile_EigenSolver_eigenvectors.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_EigenSolver_eigenvectors.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
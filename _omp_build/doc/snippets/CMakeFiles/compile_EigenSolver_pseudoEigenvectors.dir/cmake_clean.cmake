@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_EigenSolver_pseudoEigenvectors.dir/compile_EigenSolver_pseudoEigenvectors.cpp.o"
+  "CMakeFiles/compile_EigenSolver_pseudoEigenvectors.dir/compile_EigenSolver_pseudoEigenvectors.cpp.o.d"
+  "compile_EigenSolver_pseudoEigenvectors"
+  "compile_EigenSolver_pseudoEigenvectors.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_EigenSolver_pseudoEigenvectors.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
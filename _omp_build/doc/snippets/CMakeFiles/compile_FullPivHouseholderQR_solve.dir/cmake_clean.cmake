@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_FullPivHouseholderQR_solve.dir/compile_FullPivHouseholderQR_solve.cpp.o"
+  "CMakeFiles/compile_FullPivHouseholderQR_solve.dir/compile_FullPivHouseholderQR_solve.cpp.o.d"
+  "compile_FullPivHouseholderQR_solve"
+  "compile_FullPivHouseholderQR_solve.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_FullPivHouseholderQR_solve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
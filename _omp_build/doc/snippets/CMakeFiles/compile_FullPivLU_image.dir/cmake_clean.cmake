@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_FullPivLU_image.dir/compile_FullPivLU_image.cpp.o"
+  "CMakeFiles/compile_FullPivLU_image.dir/compile_FullPivLU_image.cpp.o.d"
+  "compile_FullPivLU_image"
+  "compile_FullPivLU_image.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_FullPivLU_image.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
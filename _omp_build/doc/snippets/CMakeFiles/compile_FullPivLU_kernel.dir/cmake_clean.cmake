@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_FullPivLU_kernel.dir/compile_FullPivLU_kernel.cpp.o"
+  "CMakeFiles/compile_FullPivLU_kernel.dir/compile_FullPivLU_kernel.cpp.o.d"
+  "compile_FullPivLU_kernel"
+  "compile_FullPivLU_kernel.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_FullPivLU_kernel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
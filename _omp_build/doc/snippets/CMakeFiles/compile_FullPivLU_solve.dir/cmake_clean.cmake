@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_FullPivLU_solve.dir/compile_FullPivLU_solve.cpp.o"
+  "CMakeFiles/compile_FullPivLU_solve.dir/compile_FullPivLU_solve.cpp.o.d"
+  "compile_FullPivLU_solve"
+  "compile_FullPivLU_solve.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_FullPivLU_solve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
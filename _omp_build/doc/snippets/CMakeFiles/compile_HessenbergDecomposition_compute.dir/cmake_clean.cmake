@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_HessenbergDecomposition_compute.dir/compile_HessenbergDecomposition_compute.cpp.o"
+  "CMakeFiles/compile_HessenbergDecomposition_compute.dir/compile_HessenbergDecomposition_compute.cpp.o.d"
+  "compile_HessenbergDecomposition_compute"
+  "compile_HessenbergDecomposition_compute.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_HessenbergDecomposition_compute.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_HessenbergDecomposition_matrixH.dir/compile_HessenbergDecomposition_matrixH.cpp.o"
+  "CMakeFiles/compile_HessenbergDecomposition_matrixH.dir/compile_HessenbergDecomposition_matrixH.cpp.o.d"
+  "compile_HessenbergDecomposition_matrixH"
+  "compile_HessenbergDecomposition_matrixH.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_HessenbergDecomposition_matrixH.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_HessenbergDecomposition_packedMatrix.dir/compile_HessenbergDecomposition_packedMatrix.cpp.o"
+  "CMakeFiles/compile_HessenbergDecomposition_packedMatrix.dir/compile_HessenbergDecomposition_packedMatrix.cpp.o.d"
+  "compile_HessenbergDecomposition_packedMatrix"
+  "compile_HessenbergDecomposition_packedMatrix.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_HessenbergDecomposition_packedMatrix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
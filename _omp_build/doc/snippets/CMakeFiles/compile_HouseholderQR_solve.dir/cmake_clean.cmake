@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_HouseholderQR_solve.dir/compile_HouseholderQR_solve.cpp.o"
+  "CMakeFiles/compile_HouseholderQR_solve.dir/compile_HouseholderQR_solve.cpp.o.d"
+  "compile_HouseholderQR_solve"
+  "compile_HouseholderQR_solve.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_HouseholderQR_solve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
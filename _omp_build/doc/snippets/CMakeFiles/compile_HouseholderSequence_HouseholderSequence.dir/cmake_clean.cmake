@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_HouseholderSequence_HouseholderSequence.dir/compile_HouseholderSequence_HouseholderSequence.cpp.o"
+  "CMakeFiles/compile_HouseholderSequence_HouseholderSequence.dir/compile_HouseholderSequence_HouseholderSequence.cpp.o.d"
+  "compile_HouseholderSequence_HouseholderSequence"
+  "compile_HouseholderSequence_HouseholderSequence.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_HouseholderSequence_HouseholderSequence.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
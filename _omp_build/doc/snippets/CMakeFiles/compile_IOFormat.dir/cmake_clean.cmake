@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_IOFormat.dir/compile_IOFormat.cpp.o"
+  "CMakeFiles/compile_IOFormat.dir/compile_IOFormat.cpp.o.d"
+  "compile_IOFormat"
+  "compile_IOFormat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_IOFormat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
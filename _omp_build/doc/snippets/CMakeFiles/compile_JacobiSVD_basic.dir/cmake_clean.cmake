@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_JacobiSVD_basic.dir/compile_JacobiSVD_basic.cpp.o"
+  "CMakeFiles/compile_JacobiSVD_basic.dir/compile_JacobiSVD_basic.cpp.o.d"
+  "compile_JacobiSVD_basic"
+  "compile_JacobiSVD_basic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_JacobiSVD_basic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
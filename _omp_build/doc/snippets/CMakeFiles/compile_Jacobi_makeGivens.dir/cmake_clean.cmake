@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Jacobi_makeGivens.dir/compile_Jacobi_makeGivens.cpp.o"
+  "CMakeFiles/compile_Jacobi_makeGivens.dir/compile_Jacobi_makeGivens.cpp.o.d"
+  "compile_Jacobi_makeGivens"
+  "compile_Jacobi_makeGivens.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Jacobi_makeGivens.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Jacobi_makeJacobi.dir/compile_Jacobi_makeJacobi.cpp.o"
+  "CMakeFiles/compile_Jacobi_makeJacobi.dir/compile_Jacobi_makeJacobi.cpp.o.d"
+  "compile_Jacobi_makeJacobi"
+  "compile_Jacobi_makeJacobi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Jacobi_makeJacobi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
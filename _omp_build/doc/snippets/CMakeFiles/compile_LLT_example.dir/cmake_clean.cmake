@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_LLT_example.dir/compile_LLT_example.cpp.o"
+  "CMakeFiles/compile_LLT_example.dir/compile_LLT_example.cpp.o.d"
+  "compile_LLT_example"
+  "compile_LLT_example.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_LLT_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
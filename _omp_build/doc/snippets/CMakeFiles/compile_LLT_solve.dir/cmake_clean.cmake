@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_LLT_solve.dir/compile_LLT_solve.cpp.o"
+  "CMakeFiles/compile_LLT_solve.dir/compile_LLT_solve.cpp.o.d"
+  "compile_LLT_solve"
+  "compile_LLT_solve.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_LLT_solve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Map_general_stride.dir/compile_Map_general_stride.cpp.o"
+  "CMakeFiles/compile_Map_general_stride.dir/compile_Map_general_stride.cpp.o.d"
+  "compile_Map_general_stride"
+  "compile_Map_general_stride.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Map_general_stride.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Map_placement_new.dir/compile_Map_placement_new.cpp.o"
+  "CMakeFiles/compile_Map_placement_new.dir/compile_Map_placement_new.cpp.o.d"
+  "compile_Map_placement_new"
+  "compile_Map_placement_new.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Map_placement_new.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Map_simple.dir/compile_Map_simple.cpp.o"
+  "CMakeFiles/compile_Map_simple.dir/compile_Map_simple.cpp.o.d"
+  "compile_Map_simple"
+  "compile_Map_simple.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Map_simple.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
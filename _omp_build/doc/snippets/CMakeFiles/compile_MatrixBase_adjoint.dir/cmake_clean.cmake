@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_adjoint.dir/compile_MatrixBase_adjoint.cpp.o"
+  "CMakeFiles/compile_MatrixBase_adjoint.dir/compile_MatrixBase_adjoint.cpp.o.d"
+  "compile_MatrixBase_adjoint"
+  "compile_MatrixBase_adjoint.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_adjoint.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
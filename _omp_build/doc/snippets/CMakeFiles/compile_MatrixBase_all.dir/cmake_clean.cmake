@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_all.dir/compile_MatrixBase_all.cpp.o"
+  "CMakeFiles/compile_MatrixBase_all.dir/compile_MatrixBase_all.cpp.o.d"
+  "compile_MatrixBase_all"
+  "compile_MatrixBase_all.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_all.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
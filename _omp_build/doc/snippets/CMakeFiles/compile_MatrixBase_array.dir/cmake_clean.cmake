@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_array.dir/compile_MatrixBase_array.cpp.o"
+  "CMakeFiles/compile_MatrixBase_array.dir/compile_MatrixBase_array.cpp.o.d"
+  "compile_MatrixBase_array"
+  "compile_MatrixBase_array.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_array.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_array_const.dir/compile_MatrixBase_array_const.cpp.o"
+  "CMakeFiles/compile_MatrixBase_array_const.dir/compile_MatrixBase_array_const.cpp.o.d"
+  "compile_MatrixBase_array_const"
+  "compile_MatrixBase_array_const.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_array_const.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
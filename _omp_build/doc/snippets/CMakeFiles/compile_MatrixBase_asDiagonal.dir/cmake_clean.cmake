@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_asDiagonal.dir/compile_MatrixBase_asDiagonal.cpp.o"
+  "CMakeFiles/compile_MatrixBase_asDiagonal.dir/compile_MatrixBase_asDiagonal.cpp.o.d"
+  "compile_MatrixBase_asDiagonal"
+  "compile_MatrixBase_asDiagonal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_asDiagonal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_bottomRows_int.dir/compile_MatrixBase_bottomRows_int.cpp.o"
+  "CMakeFiles/compile_MatrixBase_bottomRows_int.dir/compile_MatrixBase_bottomRows_int.cpp.o.d"
+  "compile_MatrixBase_bottomRows_int"
+  "compile_MatrixBase_bottomRows_int.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_bottomRows_int.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
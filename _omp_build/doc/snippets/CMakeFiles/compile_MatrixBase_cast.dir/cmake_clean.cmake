@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_cast.dir/compile_MatrixBase_cast.cpp.o"
+  "CMakeFiles/compile_MatrixBase_cast.dir/compile_MatrixBase_cast.cpp.o.d"
+  "compile_MatrixBase_cast"
+  "compile_MatrixBase_cast.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_cast.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
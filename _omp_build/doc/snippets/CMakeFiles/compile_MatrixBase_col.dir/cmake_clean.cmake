@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_col.dir/compile_MatrixBase_col.cpp.o"
+  "CMakeFiles/compile_MatrixBase_col.dir/compile_MatrixBase_col.cpp.o.d"
+  "compile_MatrixBase_col"
+  "compile_MatrixBase_col.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_col.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_colwise.dir/compile_MatrixBase_colwise.cpp.o"
+  "CMakeFiles/compile_MatrixBase_colwise.dir/compile_MatrixBase_colwise.cpp.o.d"
+  "compile_MatrixBase_colwise"
+  "compile_MatrixBase_colwise.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_colwise.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_computeInverseAndDetWithCheck.dir/compile_MatrixBase_computeInverseAndDetWithCheck.cpp.o"
+  "CMakeFiles/compile_MatrixBase_computeInverseAndDetWithCheck.dir/compile_MatrixBase_computeInverseAndDetWithCheck.cpp.o.d"
+  "compile_MatrixBase_computeInverseAndDetWithCheck"
+  "compile_MatrixBase_computeInverseAndDetWithCheck.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_computeInverseAndDetWithCheck.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_computeInverseWithCheck.dir/compile_MatrixBase_computeInverseWithCheck.cpp.o"
+  "CMakeFiles/compile_MatrixBase_computeInverseWithCheck.dir/compile_MatrixBase_computeInverseWithCheck.cpp.o.d"
+  "compile_MatrixBase_computeInverseWithCheck"
+  "compile_MatrixBase_computeInverseWithCheck.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_computeInverseWithCheck.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
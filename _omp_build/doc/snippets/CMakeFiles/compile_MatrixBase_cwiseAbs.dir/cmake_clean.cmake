@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_cwiseAbs.dir/compile_MatrixBase_cwiseAbs.cpp.o"
+  "CMakeFiles/compile_MatrixBase_cwiseAbs.dir/compile_MatrixBase_cwiseAbs.cpp.o.d"
+  "compile_MatrixBase_cwiseAbs"
+  "compile_MatrixBase_cwiseAbs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_cwiseAbs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_cwiseAbs2.dir/compile_MatrixBase_cwiseAbs2.cpp.o"
+  "CMakeFiles/compile_MatrixBase_cwiseAbs2.dir/compile_MatrixBase_cwiseAbs2.cpp.o.d"
+  "compile_MatrixBase_cwiseAbs2"
+  "compile_MatrixBase_cwiseAbs2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_cwiseAbs2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_cwiseEqual.dir/compile_MatrixBase_cwiseEqual.cpp.o"
+  "CMakeFiles/compile_MatrixBase_cwiseEqual.dir/compile_MatrixBase_cwiseEqual.cpp.o.d"
+  "compile_MatrixBase_cwiseEqual"
+  "compile_MatrixBase_cwiseEqual.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_cwiseEqual.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_cwiseInverse.dir/compile_MatrixBase_cwiseInverse.cpp.o"
+  "CMakeFiles/compile_MatrixBase_cwiseInverse.dir/compile_MatrixBase_cwiseInverse.cpp.o.d"
+  "compile_MatrixBase_cwiseInverse"
+  "compile_MatrixBase_cwiseInverse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_cwiseInverse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
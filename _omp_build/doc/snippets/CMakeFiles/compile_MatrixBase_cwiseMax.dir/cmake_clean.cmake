@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_cwiseMax.dir/compile_MatrixBase_cwiseMax.cpp.o"
+  "CMakeFiles/compile_MatrixBase_cwiseMax.dir/compile_MatrixBase_cwiseMax.cpp.o.d"
+  "compile_MatrixBase_cwiseMax"
+  "compile_MatrixBase_cwiseMax.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_cwiseMax.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
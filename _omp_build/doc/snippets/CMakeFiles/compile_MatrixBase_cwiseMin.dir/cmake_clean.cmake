@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_cwiseMin.dir/compile_MatrixBase_cwiseMin.cpp.o"
+  "CMakeFiles/compile_MatrixBase_cwiseMin.dir/compile_MatrixBase_cwiseMin.cpp.o.d"
+  "compile_MatrixBase_cwiseMin"
+  "compile_MatrixBase_cwiseMin.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_cwiseMin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_cwiseNotEqual.dir/compile_MatrixBase_cwiseNotEqual.cpp.o"
+  "CMakeFiles/compile_MatrixBase_cwiseNotEqual.dir/compile_MatrixBase_cwiseNotEqual.cpp.o.d"
+  "compile_MatrixBase_cwiseNotEqual"
+  "compile_MatrixBase_cwiseNotEqual.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_cwiseNotEqual.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_cwiseQuotient.dir/compile_MatrixBase_cwiseQuotient.cpp.o"
+  "CMakeFiles/compile_MatrixBase_cwiseQuotient.dir/compile_MatrixBase_cwiseQuotient.cpp.o.d"
+  "compile_MatrixBase_cwiseQuotient"
+  "compile_MatrixBase_cwiseQuotient.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_cwiseQuotient.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_cwiseSqrt.dir/compile_MatrixBase_cwiseSqrt.cpp.o"
+  "CMakeFiles/compile_MatrixBase_cwiseSqrt.dir/compile_MatrixBase_cwiseSqrt.cpp.o.d"
+  "compile_MatrixBase_cwiseSqrt"
+  "compile_MatrixBase_cwiseSqrt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_cwiseSqrt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
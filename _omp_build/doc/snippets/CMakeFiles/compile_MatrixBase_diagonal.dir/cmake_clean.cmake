@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_diagonal.dir/compile_MatrixBase_diagonal.cpp.o"
+  "CMakeFiles/compile_MatrixBase_diagonal.dir/compile_MatrixBase_diagonal.cpp.o.d"
+  "compile_MatrixBase_diagonal"
+  "compile_MatrixBase_diagonal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_diagonal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_eigenvalues.dir/compile_MatrixBase_eigenvalues.cpp.o"
+  "CMakeFiles/compile_MatrixBase_eigenvalues.dir/compile_MatrixBase_eigenvalues.cpp.o.d"
+  "compile_MatrixBase_eigenvalues"
+  "compile_MatrixBase_eigenvalues.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_eigenvalues.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_eval.dir/compile_MatrixBase_eval.cpp.o"
+  "CMakeFiles/compile_MatrixBase_eval.dir/compile_MatrixBase_eval.cpp.o.d"
+  "compile_MatrixBase_eval"
+  "compile_MatrixBase_eval.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_eval.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
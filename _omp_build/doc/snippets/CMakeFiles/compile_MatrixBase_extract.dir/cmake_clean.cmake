@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_extract.dir/compile_MatrixBase_extract.cpp.o"
+  "CMakeFiles/compile_MatrixBase_extract.dir/compile_MatrixBase_extract.cpp.o.d"
+  "compile_MatrixBase_extract"
+  "compile_MatrixBase_extract.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_extract.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_identity.dir/compile_MatrixBase_identity.cpp.o"
+  "CMakeFiles/compile_MatrixBase_identity.dir/compile_MatrixBase_identity.cpp.o.d"
+  "compile_MatrixBase_identity"
+  "compile_MatrixBase_identity.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_identity.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
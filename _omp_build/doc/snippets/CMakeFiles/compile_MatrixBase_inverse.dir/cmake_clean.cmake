@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_inverse.dir/compile_MatrixBase_inverse.cpp.o"
+  "CMakeFiles/compile_MatrixBase_inverse.dir/compile_MatrixBase_inverse.cpp.o.d"
+  "compile_MatrixBase_inverse"
+  "compile_MatrixBase_inverse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_inverse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_isDiagonal.dir/compile_MatrixBase_isDiagonal.cpp.o"
+  "CMakeFiles/compile_MatrixBase_isDiagonal.dir/compile_MatrixBase_isDiagonal.cpp.o.d"
+  "compile_MatrixBase_isDiagonal"
+  "compile_MatrixBase_isDiagonal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_isDiagonal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
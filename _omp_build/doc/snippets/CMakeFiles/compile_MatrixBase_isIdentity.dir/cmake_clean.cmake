@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_isIdentity.dir/compile_MatrixBase_isIdentity.cpp.o"
+  "CMakeFiles/compile_MatrixBase_isIdentity.dir/compile_MatrixBase_isIdentity.cpp.o.d"
+  "compile_MatrixBase_isIdentity"
+  "compile_MatrixBase_isIdentity.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_isIdentity.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_isOnes.dir/compile_MatrixBase_isOnes.cpp.o"
+  "CMakeFiles/compile_MatrixBase_isOnes.dir/compile_MatrixBase_isOnes.cpp.o.d"
+  "compile_MatrixBase_isOnes"
+  "compile_MatrixBase_isOnes.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_isOnes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_isOrthogonal.dir/compile_MatrixBase_isOrthogonal.cpp.o"
+  "CMakeFiles/compile_MatrixBase_isOrthogonal.dir/compile_MatrixBase_isOrthogonal.cpp.o.d"
+  "compile_MatrixBase_isOrthogonal"
+  "compile_MatrixBase_isOrthogonal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_isOrthogonal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_isUnitary.dir/compile_MatrixBase_isUnitary.cpp.o"
+  "CMakeFiles/compile_MatrixBase_isUnitary.dir/compile_MatrixBase_isUnitary.cpp.o.d"
+  "compile_MatrixBase_isUnitary"
+  "compile_MatrixBase_isUnitary.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_isUnitary.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
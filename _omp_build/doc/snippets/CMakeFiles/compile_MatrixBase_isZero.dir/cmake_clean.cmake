@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_isZero.dir/compile_MatrixBase_isZero.cpp.o"
+  "CMakeFiles/compile_MatrixBase_isZero.dir/compile_MatrixBase_isZero.cpp.o.d"
+  "compile_MatrixBase_isZero"
+  "compile_MatrixBase_isZero.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_isZero.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_marked.dir/compile_MatrixBase_marked.cpp.o"
+  "CMakeFiles/compile_MatrixBase_marked.dir/compile_MatrixBase_marked.cpp.o.d"
+  "compile_MatrixBase_marked"
+  "compile_MatrixBase_marked.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_marked.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
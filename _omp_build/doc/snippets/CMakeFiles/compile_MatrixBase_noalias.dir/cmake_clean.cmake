@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_noalias.dir/compile_MatrixBase_noalias.cpp.o"
+  "CMakeFiles/compile_MatrixBase_noalias.dir/compile_MatrixBase_noalias.cpp.o.d"
+  "compile_MatrixBase_noalias"
+  "compile_MatrixBase_noalias.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_noalias.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_ones.dir/compile_MatrixBase_ones.cpp.o"
+  "CMakeFiles/compile_MatrixBase_ones.dir/compile_MatrixBase_ones.cpp.o.d"
+  "compile_MatrixBase_ones"
+  "compile_MatrixBase_ones.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_ones.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
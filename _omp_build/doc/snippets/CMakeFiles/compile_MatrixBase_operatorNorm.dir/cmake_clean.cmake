@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_operatorNorm.dir/compile_MatrixBase_operatorNorm.cpp.o"
+  "CMakeFiles/compile_MatrixBase_operatorNorm.dir/compile_MatrixBase_operatorNorm.cpp.o.d"
+  "compile_MatrixBase_operatorNorm"
+  "compile_MatrixBase_operatorNorm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_operatorNorm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_part.dir/compile_MatrixBase_part.cpp.o"
+  "CMakeFiles/compile_MatrixBase_part.dir/compile_MatrixBase_part.cpp.o.d"
+  "compile_MatrixBase_part"
+  "compile_MatrixBase_part.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_part.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_prod.dir/compile_MatrixBase_prod.cpp.o"
+  "CMakeFiles/compile_MatrixBase_prod.dir/compile_MatrixBase_prod.cpp.o.d"
+  "compile_MatrixBase_prod"
+  "compile_MatrixBase_prod.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_prod.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
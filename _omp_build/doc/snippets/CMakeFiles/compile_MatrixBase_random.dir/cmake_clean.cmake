@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_random.dir/compile_MatrixBase_random.cpp.o"
+  "CMakeFiles/compile_MatrixBase_random.dir/compile_MatrixBase_random.cpp.o.d"
+  "compile_MatrixBase_random"
+  "compile_MatrixBase_random.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_random.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
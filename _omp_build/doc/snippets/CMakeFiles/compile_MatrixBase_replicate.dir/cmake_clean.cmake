@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_replicate.dir/compile_MatrixBase_replicate.cpp.o"
+  "CMakeFiles/compile_MatrixBase_replicate.dir/compile_MatrixBase_replicate.cpp.o.d"
+  "compile_MatrixBase_replicate"
+  "compile_MatrixBase_replicate.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_replicate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_reverse.dir/compile_MatrixBase_reverse.cpp.o"
+  "CMakeFiles/compile_MatrixBase_reverse.dir/compile_MatrixBase_reverse.cpp.o.d"
+  "compile_MatrixBase_reverse"
+  "compile_MatrixBase_reverse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_reverse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
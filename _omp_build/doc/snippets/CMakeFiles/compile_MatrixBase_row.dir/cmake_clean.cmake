@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_row.dir/compile_MatrixBase_row.cpp.o"
+  "CMakeFiles/compile_MatrixBase_row.dir/compile_MatrixBase_row.cpp.o.d"
+  "compile_MatrixBase_row"
+  "compile_MatrixBase_row.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_row.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
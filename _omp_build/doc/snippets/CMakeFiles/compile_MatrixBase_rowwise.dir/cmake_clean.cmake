@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_rowwise.dir/compile_MatrixBase_rowwise.cpp.o"
+  "CMakeFiles/compile_MatrixBase_rowwise.dir/compile_MatrixBase_rowwise.cpp.o.d"
+  "compile_MatrixBase_rowwise"
+  "compile_MatrixBase_rowwise.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_rowwise.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
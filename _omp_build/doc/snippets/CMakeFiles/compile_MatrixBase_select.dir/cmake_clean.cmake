@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_select.dir/compile_MatrixBase_select.cpp.o"
+  "CMakeFiles/compile_MatrixBase_select.dir/compile_MatrixBase_select.cpp.o.d"
+  "compile_MatrixBase_select"
+  "compile_MatrixBase_select.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_select.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_set.dir/compile_MatrixBase_set.cpp.o"
+  "CMakeFiles/compile_MatrixBase_set.dir/compile_MatrixBase_set.cpp.o.d"
+  "compile_MatrixBase_set"
+  "compile_MatrixBase_set.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_set.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
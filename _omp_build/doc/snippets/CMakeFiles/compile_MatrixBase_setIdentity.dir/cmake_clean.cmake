@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_setIdentity.dir/compile_MatrixBase_setIdentity.cpp.o"
+  "CMakeFiles/compile_MatrixBase_setIdentity.dir/compile_MatrixBase_setIdentity.cpp.o.d"
+  "compile_MatrixBase_setIdentity"
+  "compile_MatrixBase_setIdentity.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_setIdentity.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_setRandom.dir/compile_MatrixBase_setRandom.cpp.o"
+  "CMakeFiles/compile_MatrixBase_setRandom.dir/compile_MatrixBase_setRandom.cpp.o.d"
+  "compile_MatrixBase_setRandom"
+  "compile_MatrixBase_setRandom.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_setRandom.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_setZero.dir/compile_MatrixBase_setZero.cpp.o"
+  "CMakeFiles/compile_MatrixBase_setZero.dir/compile_MatrixBase_setZero.cpp.o.d"
+  "compile_MatrixBase_setZero"
+  "compile_MatrixBase_setZero.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_setZero.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_template_int_bottomRows.dir/compile_MatrixBase_template_int_bottomRows.cpp.o"
+  "CMakeFiles/compile_MatrixBase_template_int_bottomRows.dir/compile_MatrixBase_template_int_bottomRows.cpp.o.d"
+  "compile_MatrixBase_template_int_bottomRows"
+  "compile_MatrixBase_template_int_bottomRows.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_template_int_bottomRows.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_template_int_end.dir/compile_MatrixBase_template_int_end.cpp.o"
+  "CMakeFiles/compile_MatrixBase_template_int_end.dir/compile_MatrixBase_template_int_end.cpp.o.d"
+  "compile_MatrixBase_template_int_end"
+  "compile_MatrixBase_template_int_end.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_template_int_end.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
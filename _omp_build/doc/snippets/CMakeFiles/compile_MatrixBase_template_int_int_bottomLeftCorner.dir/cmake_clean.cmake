@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_template_int_int_bottomLeftCorner.dir/compile_MatrixBase_template_int_int_bottomLeftCorner.cpp.o"
+  "CMakeFiles/compile_MatrixBase_template_int_int_bottomLeftCorner.dir/compile_MatrixBase_template_int_int_bottomLeftCorner.cpp.o.d"
+  "compile_MatrixBase_template_int_int_bottomLeftCorner"
+  "compile_MatrixBase_template_int_int_bottomLeftCorner.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_template_int_int_bottomLeftCorner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_template_int_int_bottomRightCorner.dir/compile_MatrixBase_template_int_int_bottomRightCorner.cpp.o"
+  "CMakeFiles/compile_MatrixBase_template_int_int_bottomRightCorner.dir/compile_MatrixBase_template_int_int_bottomRightCorner.cpp.o.d"
+  "compile_MatrixBase_template_int_int_bottomRightCorner"
+  "compile_MatrixBase_template_int_int_bottomRightCorner.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_template_int_int_bottomRightCorner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_template_int_int_topLeftCorner.dir/compile_MatrixBase_template_int_int_topLeftCorner.cpp.o"
+  "CMakeFiles/compile_MatrixBase_template_int_int_topLeftCorner.dir/compile_MatrixBase_template_int_int_topLeftCorner.cpp.o.d"
+  "compile_MatrixBase_template_int_int_topLeftCorner"
+  "compile_MatrixBase_template_int_int_topLeftCorner.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_template_int_int_topLeftCorner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_template_int_int_topRightCorner.dir/compile_MatrixBase_template_int_int_topRightCorner.cpp.o"
+  "CMakeFiles/compile_MatrixBase_template_int_int_topRightCorner.dir/compile_MatrixBase_template_int_int_topRightCorner.cpp.o.d"
+  "compile_MatrixBase_template_int_int_topRightCorner"
+  "compile_MatrixBase_template_int_int_topRightCorner.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_template_int_int_topRightCorner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
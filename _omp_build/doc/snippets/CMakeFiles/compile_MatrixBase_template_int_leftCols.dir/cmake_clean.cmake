@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_template_int_leftCols.dir/compile_MatrixBase_template_int_leftCols.cpp.o"
+  "CMakeFiles/compile_MatrixBase_template_int_leftCols.dir/compile_MatrixBase_template_int_leftCols.cpp.o.d"
+  "compile_MatrixBase_template_int_leftCols"
+  "compile_MatrixBase_template_int_leftCols.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_template_int_leftCols.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
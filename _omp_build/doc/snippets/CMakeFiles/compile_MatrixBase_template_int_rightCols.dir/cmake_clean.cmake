@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_template_int_rightCols.dir/compile_MatrixBase_template_int_rightCols.cpp.o"
+  "CMakeFiles/compile_MatrixBase_template_int_rightCols.dir/compile_MatrixBase_template_int_rightCols.cpp.o.d"
+  "compile_MatrixBase_template_int_rightCols"
+  "compile_MatrixBase_template_int_rightCols.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_template_int_rightCols.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_template_int_segment.dir/compile_MatrixBase_template_int_segment.cpp.o"
+  "CMakeFiles/compile_MatrixBase_template_int_segment.dir/compile_MatrixBase_template_int_segment.cpp.o.d"
+  "compile_MatrixBase_template_int_segment"
+  "compile_MatrixBase_template_int_segment.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_template_int_segment.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_template_int_start.dir/compile_MatrixBase_template_int_start.cpp.o"
+  "CMakeFiles/compile_MatrixBase_template_int_start.dir/compile_MatrixBase_template_int_start.cpp.o.d"
+  "compile_MatrixBase_template_int_start"
+  "compile_MatrixBase_template_int_start.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_template_int_start.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_template_int_topRows.dir/compile_MatrixBase_template_int_topRows.cpp.o"
+  "CMakeFiles/compile_MatrixBase_template_int_topRows.dir/compile_MatrixBase_template_int_topRows.cpp.o.d"
+  "compile_MatrixBase_template_int_topRows"
+  "compile_MatrixBase_template_int_topRows.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_template_int_topRows.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_transpose.dir/compile_MatrixBase_transpose.cpp.o"
+  "CMakeFiles/compile_MatrixBase_transpose.dir/compile_MatrixBase_transpose.cpp.o.d"
+  "compile_MatrixBase_transpose"
+  "compile_MatrixBase_transpose.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_transpose.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_MatrixBase_zero.dir/compile_MatrixBase_zero.cpp.o"
+  "CMakeFiles/compile_MatrixBase_zero.dir/compile_MatrixBase_zero.cpp.o.d"
+  "compile_MatrixBase_zero"
+  "compile_MatrixBase_zero.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_MatrixBase_zero.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Matrix_resize_int_NoChange.dir/compile_Matrix_resize_int_NoChange.cpp.o"
+  "CMakeFiles/compile_Matrix_resize_int_NoChange.dir/compile_Matrix_resize_int_NoChange.cpp.o.d"
+  "compile_Matrix_resize_int_NoChange"
+  "compile_Matrix_resize_int_NoChange.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Matrix_resize_int_NoChange.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
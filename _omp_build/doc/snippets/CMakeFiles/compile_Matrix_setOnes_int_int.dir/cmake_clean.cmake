@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Matrix_setOnes_int_int.dir/compile_Matrix_setOnes_int_int.cpp.o"
+  "CMakeFiles/compile_Matrix_setOnes_int_int.dir/compile_Matrix_setOnes_int_int.cpp.o.d"
+  "compile_Matrix_setOnes_int_int"
+  "compile_Matrix_setOnes_int_int.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Matrix_setOnes_int_int.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_PartialPivLU_solve.dir/compile_PartialPivLU_solve.cpp.o"
+  "CMakeFiles/compile_PartialPivLU_solve.dir/compile_PartialPivLU_solve.cpp.o.d"
+  "compile_PartialPivLU_solve"
+  "compile_PartialPivLU_solve.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_PartialPivLU_solve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
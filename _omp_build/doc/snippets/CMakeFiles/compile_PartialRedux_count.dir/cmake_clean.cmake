@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_PartialRedux_count.dir/compile_PartialRedux_count.cpp.o"
+  "CMakeFiles/compile_PartialRedux_count.dir/compile_PartialRedux_count.cpp.o.d"
+  "compile_PartialRedux_count"
+  "compile_PartialRedux_count.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_PartialRedux_count.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_PartialRedux_maxCoeff.dir/compile_PartialRedux_maxCoeff.cpp.o"
+  "CMakeFiles/compile_PartialRedux_maxCoeff.dir/compile_PartialRedux_maxCoeff.cpp.o.d"
+  "compile_PartialRedux_maxCoeff"
+  "compile_PartialRedux_maxCoeff.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_PartialRedux_maxCoeff.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_PartialRedux_minCoeff.dir/compile_PartialRedux_minCoeff.cpp.o"
+  "CMakeFiles/compile_PartialRedux_minCoeff.dir/compile_PartialRedux_minCoeff.cpp.o.d"
+  "compile_PartialRedux_minCoeff"
+  "compile_PartialRedux_minCoeff.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_PartialRedux_minCoeff.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
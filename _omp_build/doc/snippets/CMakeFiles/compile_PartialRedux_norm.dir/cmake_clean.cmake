@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_PartialRedux_norm.dir/compile_PartialRedux_norm.cpp.o"
+  "CMakeFiles/compile_PartialRedux_norm.dir/compile_PartialRedux_norm.cpp.o.d"
+  "compile_PartialRedux_norm"
+  "compile_PartialRedux_norm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_PartialRedux_norm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_PartialRedux_prod.dir/compile_PartialRedux_prod.cpp.o"
+  "CMakeFiles/compile_PartialRedux_prod.dir/compile_PartialRedux_prod.cpp.o.d"
+  "compile_PartialRedux_prod"
+  "compile_PartialRedux_prod.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_PartialRedux_prod.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_PartialRedux_squaredNorm.dir/compile_PartialRedux_squaredNorm.cpp.o"
+  "CMakeFiles/compile_PartialRedux_squaredNorm.dir/compile_PartialRedux_squaredNorm.cpp.o.d"
+  "compile_PartialRedux_squaredNorm"
+  "compile_PartialRedux_squaredNorm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_PartialRedux_squaredNorm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
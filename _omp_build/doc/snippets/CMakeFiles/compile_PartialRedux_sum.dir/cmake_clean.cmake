@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_PartialRedux_sum.dir/compile_PartialRedux_sum.cpp.o"
+  "CMakeFiles/compile_PartialRedux_sum.dir/compile_PartialRedux_sum.cpp.o.d"
+  "compile_PartialRedux_sum"
+  "compile_PartialRedux_sum.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_PartialRedux_sum.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_RealSchur_RealSchur_MatrixType.dir/compile_RealSchur_RealSchur_MatrixType.cpp.o"
+  "CMakeFiles/compile_RealSchur_RealSchur_MatrixType.dir/compile_RealSchur_RealSchur_MatrixType.cpp.o.d"
+  "compile_RealSchur_RealSchur_MatrixType"
+  "compile_RealSchur_RealSchur_MatrixType.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_RealSchur_RealSchur_MatrixType.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
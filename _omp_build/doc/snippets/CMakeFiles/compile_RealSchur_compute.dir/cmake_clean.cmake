@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_RealSchur_compute.dir/compile_RealSchur_compute.cpp.o"
+  "CMakeFiles/compile_RealSchur_compute.dir/compile_RealSchur_compute.cpp.o.d"
+  "compile_RealSchur_compute"
+  "compile_RealSchur_compute.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_RealSchur_compute.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
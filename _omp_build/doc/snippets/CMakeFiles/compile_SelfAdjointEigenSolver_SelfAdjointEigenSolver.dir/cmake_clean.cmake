@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_SelfAdjointEigenSolver_SelfAdjointEigenSolver.dir/compile_SelfAdjointEigenSolver_SelfAdjointEigenSolver.cpp.o"
+  "CMakeFiles/compile_SelfAdjointEigenSolver_SelfAdjointEigenSolver.dir/compile_SelfAdjointEigenSolver_SelfAdjointEigenSolver.cpp.o.d"
+  "compile_SelfAdjointEigenSolver_SelfAdjointEigenSolver"
+  "compile_SelfAdjointEigenSolver_SelfAdjointEigenSolver.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_SelfAdjointEigenSolver_SelfAdjointEigenSolver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_SelfAdjointEigenSolver_compute_MatrixType.dir/compile_SelfAdjointEigenSolver_compute_MatrixType.cpp.o"
+  "CMakeFiles/compile_SelfAdjointEigenSolver_compute_MatrixType.dir/compile_SelfAdjointEigenSolver_compute_MatrixType.cpp.o.d"
+  "compile_SelfAdjointEigenSolver_compute_MatrixType"
+  "compile_SelfAdjointEigenSolver_compute_MatrixType.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_SelfAdjointEigenSolver_compute_MatrixType.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_SelfAdjointEigenSolver_compute_MatrixType2.dir/compile_SelfAdjointEigenSolver_compute_MatrixType2.cpp.o"
+  "CMakeFiles/compile_SelfAdjointEigenSolver_compute_MatrixType2.dir/compile_SelfAdjointEigenSolver_compute_MatrixType2.cpp.o.d"
+  "compile_SelfAdjointEigenSolver_compute_MatrixType2"
+  "compile_SelfAdjointEigenSolver_compute_MatrixType2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_SelfAdjointEigenSolver_compute_MatrixType2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
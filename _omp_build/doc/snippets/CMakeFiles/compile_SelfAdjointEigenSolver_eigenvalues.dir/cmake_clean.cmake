@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_SelfAdjointEigenSolver_eigenvalues.dir/compile_SelfAdjointEigenSolver_eigenvalues.cpp.o"
+  "CMakeFiles/compile_SelfAdjointEigenSolver_eigenvalues.dir/compile_SelfAdjointEigenSolver_eigenvalues.cpp.o.d"
+  "compile_SelfAdjointEigenSolver_eigenvalues"
+  "compile_SelfAdjointEigenSolver_eigenvalues.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_SelfAdjointEigenSolver_eigenvalues.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
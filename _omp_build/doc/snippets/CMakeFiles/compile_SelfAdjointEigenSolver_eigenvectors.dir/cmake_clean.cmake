@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_SelfAdjointEigenSolver_eigenvectors.dir/compile_SelfAdjointEigenSolver_eigenvectors.cpp.o"
+  "CMakeFiles/compile_SelfAdjointEigenSolver_eigenvectors.dir/compile_SelfAdjointEigenSolver_eigenvectors.cpp.o.d"
+  "compile_SelfAdjointEigenSolver_eigenvectors"
+  "compile_SelfAdjointEigenSolver_eigenvectors.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_SelfAdjointEigenSolver_eigenvectors.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_SelfAdjointEigenSolver_operatorInverseSqrt.dir/compile_SelfAdjointEigenSolver_operatorInverseSqrt.cpp.o"
+  "CMakeFiles/compile_SelfAdjointEigenSolver_operatorInverseSqrt.dir/compile_SelfAdjointEigenSolver_operatorInverseSqrt.cpp.o.d"
+  "compile_SelfAdjointEigenSolver_operatorInverseSqrt"
+  "compile_SelfAdjointEigenSolver_operatorInverseSqrt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_SelfAdjointEigenSolver_operatorInverseSqrt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
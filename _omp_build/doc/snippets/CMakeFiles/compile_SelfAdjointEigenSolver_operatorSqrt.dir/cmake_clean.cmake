@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_SelfAdjointEigenSolver_operatorSqrt.dir/compile_SelfAdjointEigenSolver_operatorSqrt.cpp.o"
+  "CMakeFiles/compile_SelfAdjointEigenSolver_operatorSqrt.dir/compile_SelfAdjointEigenSolver_operatorSqrt.cpp.o.d"
+  "compile_SelfAdjointEigenSolver_operatorSqrt"
+  "compile_SelfAdjointEigenSolver_operatorSqrt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_SelfAdjointEigenSolver_operatorSqrt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
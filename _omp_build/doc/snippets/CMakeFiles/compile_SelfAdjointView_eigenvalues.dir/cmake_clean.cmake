@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_SelfAdjointView_eigenvalues.dir/compile_SelfAdjointView_eigenvalues.cpp.o"
+  "CMakeFiles/compile_SelfAdjointView_eigenvalues.dir/compile_SelfAdjointView_eigenvalues.cpp.o.d"
+  "compile_SelfAdjointView_eigenvalues"
+  "compile_SelfAdjointView_eigenvalues.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_SelfAdjointView_eigenvalues.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
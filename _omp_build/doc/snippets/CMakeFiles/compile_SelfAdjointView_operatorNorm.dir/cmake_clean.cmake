@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_SelfAdjointView_operatorNorm.dir/compile_SelfAdjointView_operatorNorm.cpp.o"
+  "CMakeFiles/compile_SelfAdjointView_operatorNorm.dir/compile_SelfAdjointView_operatorNorm.cpp.o.d"
+  "compile_SelfAdjointView_operatorNorm"
+  "compile_SelfAdjointView_operatorNorm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_SelfAdjointView_operatorNorm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
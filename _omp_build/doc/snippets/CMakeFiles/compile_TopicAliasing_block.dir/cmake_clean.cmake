@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_TopicAliasing_block.dir/compile_TopicAliasing_block.cpp.o"
+  "CMakeFiles/compile_TopicAliasing_block.dir/compile_TopicAliasing_block.cpp.o.d"
+  "compile_TopicAliasing_block"
+  "compile_TopicAliasing_block.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_TopicAliasing_block.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
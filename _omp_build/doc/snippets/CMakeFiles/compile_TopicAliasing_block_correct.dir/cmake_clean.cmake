@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_TopicAliasing_block_correct.dir/compile_TopicAliasing_block_correct.cpp.o"
+  "CMakeFiles/compile_TopicAliasing_block_correct.dir/compile_TopicAliasing_block_correct.cpp.o.d"
+  "compile_TopicAliasing_block_correct"
+  "compile_TopicAliasing_block_correct.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_TopicAliasing_block_correct.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_TopicAliasing_cwise.dir/compile_TopicAliasing_cwise.cpp.o"
+  "CMakeFiles/compile_TopicAliasing_cwise.dir/compile_TopicAliasing_cwise.cpp.o.d"
+  "compile_TopicAliasing_cwise"
+  "compile_TopicAliasing_cwise.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_TopicAliasing_cwise.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
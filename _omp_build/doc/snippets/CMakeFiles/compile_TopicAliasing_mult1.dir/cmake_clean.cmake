@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_TopicAliasing_mult1.dir/compile_TopicAliasing_mult1.cpp.o"
+  "CMakeFiles/compile_TopicAliasing_mult1.dir/compile_TopicAliasing_mult1.cpp.o.d"
+  "compile_TopicAliasing_mult1"
+  "compile_TopicAliasing_mult1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_TopicAliasing_mult1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
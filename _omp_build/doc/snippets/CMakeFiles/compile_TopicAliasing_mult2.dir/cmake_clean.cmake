@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_TopicAliasing_mult2.dir/compile_TopicAliasing_mult2.cpp.o"
+  "CMakeFiles/compile_TopicAliasing_mult2.dir/compile_TopicAliasing_mult2.cpp.o.d"
+  "compile_TopicAliasing_mult2"
+  "compile_TopicAliasing_mult2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_TopicAliasing_mult2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
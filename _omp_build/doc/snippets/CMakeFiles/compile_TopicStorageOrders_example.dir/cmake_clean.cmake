@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_TopicStorageOrders_example.dir/compile_TopicStorageOrders_example.cpp.o"
+  "CMakeFiles/compile_TopicStorageOrders_example.dir/compile_TopicStorageOrders_example.cpp.o.d"
+  "compile_TopicStorageOrders_example"
+  "compile_TopicStorageOrders_example.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_TopicStorageOrders_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
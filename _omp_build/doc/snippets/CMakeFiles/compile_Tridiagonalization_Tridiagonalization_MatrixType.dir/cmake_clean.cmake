@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Tridiagonalization_Tridiagonalization_MatrixType.dir/compile_Tridiagonalization_Tridiagonalization_MatrixType.cpp.o"
+  "CMakeFiles/compile_Tridiagonalization_Tridiagonalization_MatrixType.dir/compile_Tridiagonalization_Tridiagonalization_MatrixType.cpp.o.d"
+  "compile_Tridiagonalization_Tridiagonalization_MatrixType"
+  "compile_Tridiagonalization_Tridiagonalization_MatrixType.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Tridiagonalization_Tridiagonalization_MatrixType.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Tridiagonalization_compute.dir/compile_Tridiagonalization_compute.cpp.o"
+  "CMakeFiles/compile_Tridiagonalization_compute.dir/compile_Tridiagonalization_compute.cpp.o.d"
+  "compile_Tridiagonalization_compute"
+  "compile_Tridiagonalization_compute.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Tridiagonalization_compute.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Tridiagonalization_decomposeInPlace.dir/compile_Tridiagonalization_decomposeInPlace.cpp.o"
+  "CMakeFiles/compile_Tridiagonalization_decomposeInPlace.dir/compile_Tridiagonalization_decomposeInPlace.cpp.o.d"
+  "compile_Tridiagonalization_decomposeInPlace"
+  "compile_Tridiagonalization_decomposeInPlace.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Tridiagonalization_decomposeInPlace.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Tridiagonalization_diagonal.dir/compile_Tridiagonalization_diagonal.cpp.o"
+  "CMakeFiles/compile_Tridiagonalization_diagonal.dir/compile_Tridiagonalization_diagonal.cpp.o.d"
+  "compile_Tridiagonalization_diagonal"
+  "compile_Tridiagonalization_diagonal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Tridiagonalization_diagonal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
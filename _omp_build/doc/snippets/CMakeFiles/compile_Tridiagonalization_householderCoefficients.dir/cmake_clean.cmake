@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Tridiagonalization_householderCoefficients.dir/compile_Tridiagonalization_householderCoefficients.cpp.o"
+  "CMakeFiles/compile_Tridiagonalization_householderCoefficients.dir/compile_Tridiagonalization_householderCoefficients.cpp.o.d"
+  "compile_Tridiagonalization_householderCoefficients"
+  "compile_Tridiagonalization_householderCoefficients.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Tridiagonalization_householderCoefficients.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
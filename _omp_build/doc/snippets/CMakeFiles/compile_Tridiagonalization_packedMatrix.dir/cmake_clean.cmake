@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Tridiagonalization_packedMatrix.dir/compile_Tridiagonalization_packedMatrix.cpp.o"
+  "CMakeFiles/compile_Tridiagonalization_packedMatrix.dir/compile_Tridiagonalization_packedMatrix.cpp.o.d"
+  "compile_Tridiagonalization_packedMatrix"
+  "compile_Tridiagonalization_packedMatrix.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Tridiagonalization_packedMatrix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Tutorial_AdvancedInitialization_Block.dir/compile_Tutorial_AdvancedInitialization_Block.cpp.o"
+  "CMakeFiles/compile_Tutorial_AdvancedInitialization_Block.dir/compile_Tutorial_AdvancedInitialization_Block.cpp.o.d"
+  "compile_Tutorial_AdvancedInitialization_Block"
+  "compile_Tutorial_AdvancedInitialization_Block.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Tutorial_AdvancedInitialization_Block.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
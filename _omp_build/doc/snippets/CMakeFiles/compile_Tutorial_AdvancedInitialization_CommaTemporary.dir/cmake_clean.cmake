@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Tutorial_AdvancedInitialization_CommaTemporary.dir/compile_Tutorial_AdvancedInitialization_CommaTemporary.cpp.o"
+  "CMakeFiles/compile_Tutorial_AdvancedInitialization_CommaTemporary.dir/compile_Tutorial_AdvancedInitialization_CommaTemporary.cpp.o.d"
+  "compile_Tutorial_AdvancedInitialization_CommaTemporary"
+  "compile_Tutorial_AdvancedInitialization_CommaTemporary.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Tutorial_AdvancedInitialization_CommaTemporary.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Tutorial_AdvancedInitialization_Join.dir/compile_Tutorial_AdvancedInitialization_Join.cpp.o"
+  "CMakeFiles/compile_Tutorial_AdvancedInitialization_Join.dir/compile_Tutorial_AdvancedInitialization_Join.cpp.o.d"
+  "compile_Tutorial_AdvancedInitialization_Join"
+  "compile_Tutorial_AdvancedInitialization_Join.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Tutorial_AdvancedInitialization_Join.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
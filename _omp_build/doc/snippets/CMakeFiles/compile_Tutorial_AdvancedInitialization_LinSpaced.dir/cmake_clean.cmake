@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Tutorial_AdvancedInitialization_LinSpaced.dir/compile_Tutorial_AdvancedInitialization_LinSpaced.cpp.o"
+  "CMakeFiles/compile_Tutorial_AdvancedInitialization_LinSpaced.dir/compile_Tutorial_AdvancedInitialization_LinSpaced.cpp.o.d"
+  "compile_Tutorial_AdvancedInitialization_LinSpaced"
+  "compile_Tutorial_AdvancedInitialization_LinSpaced.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Tutorial_AdvancedInitialization_LinSpaced.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
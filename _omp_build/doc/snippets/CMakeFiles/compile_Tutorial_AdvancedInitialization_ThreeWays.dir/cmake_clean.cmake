@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Tutorial_AdvancedInitialization_ThreeWays.dir/compile_Tutorial_AdvancedInitialization_ThreeWays.cpp.o"
+  "CMakeFiles/compile_Tutorial_AdvancedInitialization_ThreeWays.dir/compile_Tutorial_AdvancedInitialization_ThreeWays.cpp.o.d"
+  "compile_Tutorial_AdvancedInitialization_ThreeWays"
+  "compile_Tutorial_AdvancedInitialization_ThreeWays.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Tutorial_AdvancedInitialization_ThreeWays.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
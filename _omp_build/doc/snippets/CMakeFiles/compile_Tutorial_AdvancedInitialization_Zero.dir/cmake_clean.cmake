@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Tutorial_AdvancedInitialization_Zero.dir/compile_Tutorial_AdvancedInitialization_Zero.cpp.o"
+  "CMakeFiles/compile_Tutorial_AdvancedInitialization_Zero.dir/compile_Tutorial_AdvancedInitialization_Zero.cpp.o.d"
+  "compile_Tutorial_AdvancedInitialization_Zero"
+  "compile_Tutorial_AdvancedInitialization_Zero.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Tutorial_AdvancedInitialization_Zero.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Tutorial_Map_rowmajor.dir/compile_Tutorial_Map_rowmajor.cpp.o"
+  "CMakeFiles/compile_Tutorial_Map_rowmajor.dir/compile_Tutorial_Map_rowmajor.cpp.o.d"
+  "compile_Tutorial_Map_rowmajor"
+  "compile_Tutorial_Map_rowmajor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Tutorial_Map_rowmajor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Tutorial_Map_using.dir/compile_Tutorial_Map_using.cpp.o"
+  "CMakeFiles/compile_Tutorial_Map_using.dir/compile_Tutorial_Map_using.cpp.o.d"
+  "compile_Tutorial_Map_using"
+  "compile_Tutorial_Map_using.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Tutorial_Map_using.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Tutorial_commainit_01.dir/compile_Tutorial_commainit_01.cpp.o"
+  "CMakeFiles/compile_Tutorial_commainit_01.dir/compile_Tutorial_commainit_01.cpp.o.d"
+  "compile_Tutorial_commainit_01"
+  "compile_Tutorial_commainit_01.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Tutorial_commainit_01.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Tutorial_commainit_01b.dir/compile_Tutorial_commainit_01b.cpp.o"
+  "CMakeFiles/compile_Tutorial_commainit_01b.dir/compile_Tutorial_commainit_01b.cpp.o.d"
+  "compile_Tutorial_commainit_01b"
+  "compile_Tutorial_commainit_01b.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Tutorial_commainit_01b.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
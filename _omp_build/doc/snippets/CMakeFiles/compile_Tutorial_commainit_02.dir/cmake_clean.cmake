@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Tutorial_commainit_02.dir/compile_Tutorial_commainit_02.cpp.o"
+  "CMakeFiles/compile_Tutorial_commainit_02.dir/compile_Tutorial_commainit_02.cpp.o.d"
+  "compile_Tutorial_commainit_02"
+  "compile_Tutorial_commainit_02.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Tutorial_commainit_02.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
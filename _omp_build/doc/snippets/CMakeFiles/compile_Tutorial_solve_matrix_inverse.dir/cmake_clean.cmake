@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Tutorial_solve_matrix_inverse.dir/compile_Tutorial_solve_matrix_inverse.cpp.o"
+  "CMakeFiles/compile_Tutorial_solve_matrix_inverse.dir/compile_Tutorial_solve_matrix_inverse.cpp.o.d"
+  "compile_Tutorial_solve_matrix_inverse"
+  "compile_Tutorial_solve_matrix_inverse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Tutorial_solve_matrix_inverse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
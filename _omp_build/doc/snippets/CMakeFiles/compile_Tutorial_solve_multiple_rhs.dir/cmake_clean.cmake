@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Tutorial_solve_multiple_rhs.dir/compile_Tutorial_solve_multiple_rhs.cpp.o"
+  "CMakeFiles/compile_Tutorial_solve_multiple_rhs.dir/compile_Tutorial_solve_multiple_rhs.cpp.o.d"
+  "compile_Tutorial_solve_multiple_rhs"
+  "compile_Tutorial_solve_multiple_rhs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Tutorial_solve_multiple_rhs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Tutorial_solve_reuse_decomposition.dir/compile_Tutorial_solve_reuse_decomposition.cpp.o"
+  "CMakeFiles/compile_Tutorial_solve_reuse_decomposition.dir/compile_Tutorial_solve_reuse_decomposition.cpp.o.d"
+  "compile_Tutorial_solve_reuse_decomposition"
+  "compile_Tutorial_solve_reuse_decomposition.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Tutorial_solve_reuse_decomposition.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
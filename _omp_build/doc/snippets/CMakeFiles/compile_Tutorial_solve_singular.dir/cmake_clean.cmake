@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Tutorial_solve_singular.dir/compile_Tutorial_solve_singular.cpp.o"
+  "CMakeFiles/compile_Tutorial_solve_singular.dir/compile_Tutorial_solve_singular.cpp.o.d"
+  "compile_Tutorial_solve_singular"
+  "compile_Tutorial_solve_singular.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Tutorial_solve_singular.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Tutorial_solve_triangular.dir/compile_Tutorial_solve_triangular.cpp.o"
+  "CMakeFiles/compile_Tutorial_solve_triangular.dir/compile_Tutorial_solve_triangular.cpp.o.d"
+  "compile_Tutorial_solve_triangular"
+  "compile_Tutorial_solve_triangular.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Tutorial_solve_triangular.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Tutorial_solve_triangular_inplace.dir/compile_Tutorial_solve_triangular_inplace.cpp.o"
+  "CMakeFiles/compile_Tutorial_solve_triangular_inplace.dir/compile_Tutorial_solve_triangular_inplace.cpp.o.d"
+  "compile_Tutorial_solve_triangular_inplace"
+  "compile_Tutorial_solve_triangular_inplace.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Tutorial_solve_triangular_inplace.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
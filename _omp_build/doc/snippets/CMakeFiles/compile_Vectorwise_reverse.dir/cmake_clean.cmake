@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_Vectorwise_reverse.dir/compile_Vectorwise_reverse.cpp.o"
+  "CMakeFiles/compile_Vectorwise_reverse.dir/compile_Vectorwise_reverse.cpp.o.d"
+  "compile_Vectorwise_reverse"
+  "compile_Vectorwise_reverse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_Vectorwise_reverse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_class_FullPivLU.dir/compile_class_FullPivLU.cpp.o"
+  "CMakeFiles/compile_class_FullPivLU.dir/compile_class_FullPivLU.cpp.o.d"
+  "compile_class_FullPivLU"
+  "compile_class_FullPivLU.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_class_FullPivLU.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_tut_arithmetic_redux_minmax.dir/compile_tut_arithmetic_redux_minmax.cpp.o"
+  "CMakeFiles/compile_tut_arithmetic_redux_minmax.dir/compile_tut_arithmetic_redux_minmax.cpp.o.d"
+  "compile_tut_arithmetic_redux_minmax"
+  "compile_tut_arithmetic_redux_minmax.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_tut_arithmetic_redux_minmax.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
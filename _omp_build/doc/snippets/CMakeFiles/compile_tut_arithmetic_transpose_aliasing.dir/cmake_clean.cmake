@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_tut_arithmetic_transpose_aliasing.dir/compile_tut_arithmetic_transpose_aliasing.cpp.o"
+  "CMakeFiles/compile_tut_arithmetic_transpose_aliasing.dir/compile_tut_arithmetic_transpose_aliasing.cpp.o.d"
+  "compile_tut_arithmetic_transpose_aliasing"
+  "compile_tut_arithmetic_transpose_aliasing.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_tut_arithmetic_transpose_aliasing.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_tut_arithmetic_transpose_conjugate.dir/compile_tut_arithmetic_transpose_conjugate.cpp.o"
+  "CMakeFiles/compile_tut_arithmetic_transpose_conjugate.dir/compile_tut_arithmetic_transpose_conjugate.cpp.o.d"
+  "compile_tut_arithmetic_transpose_conjugate"
+  "compile_tut_arithmetic_transpose_conjugate.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_tut_arithmetic_transpose_conjugate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
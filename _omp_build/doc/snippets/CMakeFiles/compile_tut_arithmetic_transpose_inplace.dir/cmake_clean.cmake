@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_tut_arithmetic_transpose_inplace.dir/compile_tut_arithmetic_transpose_inplace.cpp.o"
+  "CMakeFiles/compile_tut_arithmetic_transpose_inplace.dir/compile_tut_arithmetic_transpose_inplace.cpp.o.d"
+  "compile_tut_arithmetic_transpose_inplace"
+  "compile_tut_arithmetic_transpose_inplace.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_tut_arithmetic_transpose_inplace.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
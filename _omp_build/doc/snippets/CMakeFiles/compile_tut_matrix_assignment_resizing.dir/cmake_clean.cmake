@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_tut_matrix_assignment_resizing.dir/compile_tut_matrix_assignment_resizing.cpp.o"
+  "CMakeFiles/compile_tut_matrix_assignment_resizing.dir/compile_tut_matrix_assignment_resizing.cpp.o.d"
+  "compile_tut_matrix_assignment_resizing"
+  "compile_tut_matrix_assignment_resizing.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_tut_matrix_assignment_resizing.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
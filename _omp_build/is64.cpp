@@ -0,0 +1,2 @@
+int main() { return (sizeof(int*) == 8 ? 1 : 0); }
+      
\ No newline at end of file
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/blas/xerbla.cpp" "lapack/CMakeFiles/eigen_lapack_static.dir/__/blas/xerbla.cpp.o" "gcc" "lapack/CMakeFiles/eigen_lapack_static.dir/__/blas/xerbla.cpp.o.d"
+  "/root/repo/lapack/complex_double.cpp" "lapack/CMakeFiles/eigen_lapack_static.dir/complex_double.cpp.o" "gcc" "lapack/CMakeFiles/eigen_lapack_static.dir/complex_double.cpp.o.d"
+  "/root/repo/lapack/complex_single.cpp" "lapack/CMakeFiles/eigen_lapack_static.dir/complex_single.cpp.o" "gcc" "lapack/CMakeFiles/eigen_lapack_static.dir/complex_single.cpp.o.d"
+  "/root/repo/lapack/double.cpp" "lapack/CMakeFiles/eigen_lapack_static.dir/double.cpp.o" "gcc" "lapack/CMakeFiles/eigen_lapack_static.dir/double.cpp.o.d"
+  "/root/repo/lapack/single.cpp" "lapack/CMakeFiles/eigen_lapack_static.dir/single.cpp.o" "gcc" "lapack/CMakeFiles/eigen_lapack_static.dir/single.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
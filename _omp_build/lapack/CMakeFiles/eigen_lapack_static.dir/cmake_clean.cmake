@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/eigen_lapack_static.dir/__/blas/xerbla.cpp.o"
+  "CMakeFiles/eigen_lapack_static.dir/__/blas/xerbla.cpp.o.d"
+  "CMakeFiles/eigen_lapack_static.dir/complex_double.cpp.o"
+  "CMakeFiles/eigen_lapack_static.dir/complex_double.cpp.o.d"
+  "CMakeFiles/eigen_lapack_static.dir/complex_single.cpp.o"
+  "CMakeFiles/eigen_lapack_static.dir/complex_single.cpp.o.d"
+  "CMakeFiles/eigen_lapack_static.dir/double.cpp.o"
+  "CMakeFiles/eigen_lapack_static.dir/double.cpp.o.d"
+  "CMakeFiles/eigen_lapack_static.dir/single.cpp.o"
+  "CMakeFiles/eigen_lapack_static.dir/single.cpp.o.d"
+  "libeigen_lapack_static.a"
+  "libeigen_lapack_static.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/eigen_lapack_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
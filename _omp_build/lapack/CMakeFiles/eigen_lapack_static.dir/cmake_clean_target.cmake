@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libeigen_lapack_static.a"
+)
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/adjoint_1.dir/adjoint.cpp.o"
+  "CMakeFiles/adjoint_1.dir/adjoint.cpp.o.d"
+  "adjoint_1"
+  "adjoint_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adjoint_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
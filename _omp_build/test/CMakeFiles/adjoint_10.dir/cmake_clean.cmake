@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/adjoint_10.dir/adjoint.cpp.o"
+  "CMakeFiles/adjoint_10.dir/adjoint.cpp.o.d"
+  "adjoint_10"
+  "adjoint_10.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adjoint_10.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/adjoint_2.dir/adjoint.cpp.o"
+  "CMakeFiles/adjoint_2.dir/adjoint.cpp.o.d"
+  "adjoint_2"
+  "adjoint_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adjoint_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
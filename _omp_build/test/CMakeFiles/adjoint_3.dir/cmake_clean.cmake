@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/adjoint_3.dir/adjoint.cpp.o"
+  "CMakeFiles/adjoint_3.dir/adjoint.cpp.o.d"
+  "adjoint_3"
+  "adjoint_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adjoint_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
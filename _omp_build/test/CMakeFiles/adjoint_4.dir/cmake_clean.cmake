@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/adjoint_4.dir/adjoint.cpp.o"
+  "CMakeFiles/adjoint_4.dir/adjoint.cpp.o.d"
+  "adjoint_4"
+  "adjoint_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adjoint_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/adjoint_5.dir/adjoint.cpp.o"
+  "CMakeFiles/adjoint_5.dir/adjoint.cpp.o.d"
+  "adjoint_5"
+  "adjoint_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adjoint_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
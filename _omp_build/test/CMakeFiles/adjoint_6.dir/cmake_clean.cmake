@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/adjoint_6.dir/adjoint.cpp.o"
+  "CMakeFiles/adjoint_6.dir/adjoint.cpp.o.d"
+  "adjoint_6"
+  "adjoint_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adjoint_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/adjoint_7.dir/adjoint.cpp.o"
+  "CMakeFiles/adjoint_7.dir/adjoint.cpp.o.d"
+  "adjoint_7"
+  "adjoint_7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adjoint_7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
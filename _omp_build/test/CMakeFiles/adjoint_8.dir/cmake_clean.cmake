@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/adjoint_8.dir/adjoint.cpp.o"
+  "CMakeFiles/adjoint_8.dir/adjoint.cpp.o.d"
+  "adjoint_8"
+  "adjoint_8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adjoint_8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
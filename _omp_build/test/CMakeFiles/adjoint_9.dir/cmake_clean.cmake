@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/adjoint_9.dir/adjoint.cpp.o"
+  "CMakeFiles/adjoint_9.dir/adjoint.cpp.o.d"
+  "adjoint_9"
+  "adjoint_9.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adjoint_9.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/array_1.dir/array.cpp.o"
+  "CMakeFiles/array_1.dir/array.cpp.o.d"
+  "array_1"
+  "array_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/array_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/array_2.dir/array.cpp.o"
+  "CMakeFiles/array_2.dir/array.cpp.o.d"
+  "array_2"
+  "array_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/array_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/array_3.dir/array.cpp.o"
+  "CMakeFiles/array_3.dir/array.cpp.o.d"
+  "array_3"
+  "array_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/array_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
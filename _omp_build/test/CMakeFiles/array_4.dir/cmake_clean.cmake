@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/array_4.dir/array.cpp.o"
+  "CMakeFiles/array_4.dir/array.cpp.o.d"
+  "array_4"
+  "array_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/array_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/array_5.dir/array.cpp.o"
+  "CMakeFiles/array_5.dir/array.cpp.o.d"
+  "array_5"
+  "array_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/array_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/array_6.dir/array.cpp.o"
+  "CMakeFiles/array_6.dir/array.cpp.o.d"
+  "array_6"
+  "array_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/array_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/array_for_matrix_4.dir/array_for_matrix.cpp.o"
+  "CMakeFiles/array_for_matrix_4.dir/array_for_matrix.cpp.o.d"
+  "array_for_matrix_4"
+  "array_for_matrix_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/array_for_matrix_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/array_replicate_3.dir/array_replicate.cpp.o"
+  "CMakeFiles/array_replicate_3.dir/array_replicate.cpp.o.d"
+  "array_replicate_3"
+  "array_replicate_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/array_replicate_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/array_reverse_7.dir/array_reverse.cpp.o"
+  "CMakeFiles/array_reverse_7.dir/array_reverse.cpp.o.d"
+  "array_reverse_7"
+  "array_reverse_7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/array_reverse_7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bandmatrix.dir/bandmatrix.cpp.o"
+  "CMakeFiles/bandmatrix.dir/bandmatrix.cpp.o.d"
+  "bandmatrix"
+  "bandmatrix.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bandmatrix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/basicstuff_1.dir/basicstuff.cpp.o"
+  "CMakeFiles/basicstuff_1.dir/basicstuff.cpp.o.d"
+  "basicstuff_1"
+  "basicstuff_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/basicstuff_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/basicstuff_2.dir/basicstuff.cpp.o"
+  "CMakeFiles/basicstuff_2.dir/basicstuff.cpp.o.d"
+  "basicstuff_2"
+  "basicstuff_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/basicstuff_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
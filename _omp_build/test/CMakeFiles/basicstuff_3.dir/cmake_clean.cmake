@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/basicstuff_3.dir/basicstuff.cpp.o"
+  "CMakeFiles/basicstuff_3.dir/basicstuff.cpp.o.d"
+  "basicstuff_3"
+  "basicstuff_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/basicstuff_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
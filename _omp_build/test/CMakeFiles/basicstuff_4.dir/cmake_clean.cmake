@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/basicstuff_4.dir/basicstuff.cpp.o"
+  "CMakeFiles/basicstuff_4.dir/basicstuff.cpp.o.d"
+  "basicstuff_4"
+  "basicstuff_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/basicstuff_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/basicstuff_5.dir/basicstuff.cpp.o"
+  "CMakeFiles/basicstuff_5.dir/basicstuff.cpp.o.d"
+  "basicstuff_5"
+  "basicstuff_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/basicstuff_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/basicstuff_6.dir/basicstuff.cpp.o"
+  "CMakeFiles/basicstuff_6.dir/basicstuff.cpp.o.d"
+  "basicstuff_6"
+  "basicstuff_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/basicstuff_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/basicstuff_7.dir/basicstuff.cpp.o"
+  "CMakeFiles/basicstuff_7.dir/basicstuff.cpp.o.d"
+  "basicstuff_7"
+  "basicstuff_7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/basicstuff_7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bicgstab_1.dir/bicgstab.cpp.o"
+  "CMakeFiles/bicgstab_1.dir/bicgstab.cpp.o.d"
+  "bicgstab_1"
+  "bicgstab_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bicgstab_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bicgstab_2.dir/bicgstab.cpp.o"
+  "CMakeFiles/bicgstab_2.dir/bicgstab.cpp.o.d"
+  "bicgstab_2"
+  "bicgstab_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bicgstab_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
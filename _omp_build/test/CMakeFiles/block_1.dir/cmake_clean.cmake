@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/block_1.dir/block.cpp.o"
+  "CMakeFiles/block_1.dir/block.cpp.o.d"
+  "block_1"
+  "block_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/block_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
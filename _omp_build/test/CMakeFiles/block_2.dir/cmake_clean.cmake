@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/block_2.dir/block.cpp.o"
+  "CMakeFiles/block_2.dir/block.cpp.o.d"
+  "block_2"
+  "block_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/block_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/block_3.dir/block.cpp.o"
+  "CMakeFiles/block_3.dir/block.cpp.o.d"
+  "block_3"
+  "block_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/block_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/block_4.dir/block.cpp.o"
+  "CMakeFiles/block_4.dir/block.cpp.o.d"
+  "block_4"
+  "block_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/block_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
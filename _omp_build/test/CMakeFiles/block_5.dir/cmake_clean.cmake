@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/block_5.dir/block.cpp.o"
+  "CMakeFiles/block_5.dir/block.cpp.o.d"
+  "block_5"
+  "block_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/block_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/block_6.dir/block.cpp.o"
+  "CMakeFiles/block_6.dir/block.cpp.o.d"
+  "block_6"
+  "block_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/block_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
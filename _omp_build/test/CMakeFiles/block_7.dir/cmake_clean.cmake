@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/block_7.dir/block.cpp.o"
+  "CMakeFiles/block_7.dir/block.cpp.o.d"
+  "block_7"
+  "block_7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/block_7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
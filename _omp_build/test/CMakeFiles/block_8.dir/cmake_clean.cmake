@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/block_8.dir/block.cpp.o"
+  "CMakeFiles/block_8.dir/block.cpp.o.d"
+  "block_8"
+  "block_8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/block_8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
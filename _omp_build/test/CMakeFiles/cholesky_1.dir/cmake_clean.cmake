@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cholesky_1.dir/cholesky.cpp.o"
+  "CMakeFiles/cholesky_1.dir/cholesky.cpp.o.d"
+  "cholesky_1"
+  "cholesky_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cholesky_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cholesky_2.dir/cholesky.cpp.o"
+  "CMakeFiles/cholesky_2.dir/cholesky.cpp.o.d"
+  "cholesky_2"
+  "cholesky_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cholesky_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
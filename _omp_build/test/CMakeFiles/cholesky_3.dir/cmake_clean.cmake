@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cholesky_3.dir/cholesky.cpp.o"
+  "CMakeFiles/cholesky_3.dir/cholesky.cpp.o.d"
+  "cholesky_3"
+  "cholesky_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cholesky_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cholesky_4.dir/cholesky.cpp.o"
+  "CMakeFiles/cholesky_4.dir/cholesky.cpp.o.d"
+  "cholesky_4"
+  "cholesky_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cholesky_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cholesky_5.dir/cholesky.cpp.o"
+  "CMakeFiles/cholesky_5.dir/cholesky.cpp.o.d"
+  "cholesky_5"
+  "cholesky_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cholesky_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cholesky_6.dir/cholesky.cpp.o"
+  "CMakeFiles/cholesky_6.dir/cholesky.cpp.o.d"
+  "cholesky_6"
+  "cholesky_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cholesky_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cholesky_7.dir/cholesky.cpp.o"
+  "CMakeFiles/cholesky_7.dir/cholesky.cpp.o.d"
+  "cholesky_7"
+  "cholesky_7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cholesky_7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cholesky_8.dir/cholesky.cpp.o"
+  "CMakeFiles/cholesky_8.dir/cholesky.cpp.o.d"
+  "cholesky_8"
+  "cholesky_8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cholesky_8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cholesky_9.dir/cholesky.cpp.o"
+  "CMakeFiles/cholesky_9.dir/cholesky.cpp.o.d"
+  "cholesky_9"
+  "cholesky_9.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cholesky_9.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/commainitializer.dir/commainitializer.cpp.o"
+  "CMakeFiles/commainitializer.dir/commainitializer.cpp.o.d"
+  "commainitializer"
+  "commainitializer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/commainitializer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
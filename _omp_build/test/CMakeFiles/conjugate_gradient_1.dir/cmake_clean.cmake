@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/conjugate_gradient_1.dir/conjugate_gradient.cpp.o"
+  "CMakeFiles/conjugate_gradient_1.dir/conjugate_gradient.cpp.o.d"
+  "conjugate_gradient_1"
+  "conjugate_gradient_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/conjugate_gradient_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
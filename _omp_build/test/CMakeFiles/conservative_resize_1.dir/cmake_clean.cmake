@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/conservative_resize_1.dir/conservative_resize.cpp.o"
+  "CMakeFiles/conservative_resize_1.dir/conservative_resize.cpp.o.d"
+  "conservative_resize_1"
+  "conservative_resize_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/conservative_resize_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
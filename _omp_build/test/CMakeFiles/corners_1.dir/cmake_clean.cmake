@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corners_1.dir/corners.cpp.o"
+  "CMakeFiles/corners_1.dir/corners.cpp.o.d"
+  "corners_1"
+  "corners_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corners_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corners_2.dir/corners.cpp.o"
+  "CMakeFiles/corners_2.dir/corners.cpp.o.d"
+  "corners_2"
+  "corners_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corners_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corners_3.dir/corners.cpp.o"
+  "CMakeFiles/corners_3.dir/corners.cpp.o.d"
+  "corners_3"
+  "corners_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corners_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
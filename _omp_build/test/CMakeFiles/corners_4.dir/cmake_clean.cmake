@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corners_4.dir/corners.cpp.o"
+  "CMakeFiles/corners_4.dir/corners.cpp.o.d"
+  "corners_4"
+  "corners_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corners_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corners_5.dir/corners.cpp.o"
+  "CMakeFiles/corners_5.dir/corners.cpp.o.d"
+  "corners_5"
+  "corners_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corners_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
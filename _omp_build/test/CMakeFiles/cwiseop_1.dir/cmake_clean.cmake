@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cwiseop_1.dir/cwiseop.cpp.o"
+  "CMakeFiles/cwiseop_1.dir/cwiseop.cpp.o.d"
+  "cwiseop_1"
+  "cwiseop_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cwiseop_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cwiseop_2.dir/cwiseop.cpp.o"
+  "CMakeFiles/cwiseop_2.dir/cwiseop.cpp.o.d"
+  "cwiseop_2"
+  "cwiseop_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cwiseop_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cwiseop_3.dir/cwiseop.cpp.o"
+  "CMakeFiles/cwiseop_3.dir/cwiseop.cpp.o.d"
+  "cwiseop_3"
+  "cwiseop_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cwiseop_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cwiseop_4.dir/cwiseop.cpp.o"
+  "CMakeFiles/cwiseop_4.dir/cwiseop.cpp.o.d"
+  "cwiseop_4"
+  "cwiseop_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cwiseop_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
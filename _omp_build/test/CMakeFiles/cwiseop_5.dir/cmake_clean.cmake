@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cwiseop_5.dir/cwiseop.cpp.o"
+  "CMakeFiles/cwiseop_5.dir/cwiseop.cpp.o.d"
+  "cwiseop_5"
+  "cwiseop_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cwiseop_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cwiseop_6.dir/cwiseop.cpp.o"
+  "CMakeFiles/cwiseop_6.dir/cwiseop.cpp.o.d"
+  "cwiseop_6"
+  "cwiseop_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cwiseop_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/determinant_1.dir/determinant.cpp.o"
+  "CMakeFiles/determinant_1.dir/determinant.cpp.o.d"
+  "determinant_1"
+  "determinant_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/determinant_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
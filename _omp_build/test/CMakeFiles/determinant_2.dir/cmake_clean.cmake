@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/determinant_2.dir/determinant.cpp.o"
+  "CMakeFiles/determinant_2.dir/determinant.cpp.o.d"
+  "determinant_2"
+  "determinant_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/determinant_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
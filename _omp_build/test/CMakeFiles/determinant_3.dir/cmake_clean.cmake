@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/determinant_3.dir/determinant.cpp.o"
+  "CMakeFiles/determinant_3.dir/determinant.cpp.o.d"
+  "determinant_3"
+  "determinant_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/determinant_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
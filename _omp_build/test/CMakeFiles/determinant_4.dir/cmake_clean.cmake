@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/determinant_4.dir/determinant.cpp.o"
+  "CMakeFiles/determinant_4.dir/determinant.cpp.o.d"
+  "determinant_4"
+  "determinant_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/determinant_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
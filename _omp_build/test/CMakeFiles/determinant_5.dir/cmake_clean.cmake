@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/determinant_5.dir/determinant.cpp.o"
+  "CMakeFiles/determinant_5.dir/determinant.cpp.o.d"
+  "determinant_5"
+  "determinant_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/determinant_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
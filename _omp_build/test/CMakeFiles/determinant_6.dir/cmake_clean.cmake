@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/determinant_6.dir/determinant.cpp.o"
+  "CMakeFiles/determinant_6.dir/determinant.cpp.o.d"
+  "determinant_6"
+  "determinant_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/determinant_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/diagonal_1.dir/diagonal.cpp.o"
+  "CMakeFiles/diagonal_1.dir/diagonal.cpp.o.d"
+  "diagonal_1"
+  "diagonal_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/diagonal_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/diagonal_2.dir/diagonal.cpp.o"
+  "CMakeFiles/diagonal_2.dir/diagonal.cpp.o.d"
+  "diagonal_2"
+  "diagonal_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/diagonal_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/diagonalmatrices_1.dir/diagonalmatrices.cpp.o"
+  "CMakeFiles/diagonalmatrices_1.dir/diagonalmatrices.cpp.o.d"
+  "diagonalmatrices_1"
+  "diagonalmatrices_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/diagonalmatrices_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/diagonalmatrices_2.dir/diagonalmatrices.cpp.o"
+  "CMakeFiles/diagonalmatrices_2.dir/diagonalmatrices.cpp.o.d"
+  "diagonalmatrices_2"
+  "diagonalmatrices_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/diagonalmatrices_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
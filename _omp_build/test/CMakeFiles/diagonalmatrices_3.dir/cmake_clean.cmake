@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/diagonalmatrices_3.dir/diagonalmatrices.cpp.o"
+  "CMakeFiles/diagonalmatrices_3.dir/diagonalmatrices.cpp.o.d"
+  "diagonalmatrices_3"
+  "diagonalmatrices_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/diagonalmatrices_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
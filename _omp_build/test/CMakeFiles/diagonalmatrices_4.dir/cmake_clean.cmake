@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/diagonalmatrices_4.dir/diagonalmatrices.cpp.o"
+  "CMakeFiles/diagonalmatrices_4.dir/diagonalmatrices.cpp.o.d"
+  "diagonalmatrices_4"
+  "diagonalmatrices_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/diagonalmatrices_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
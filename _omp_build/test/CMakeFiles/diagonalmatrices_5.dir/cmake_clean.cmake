@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/diagonalmatrices_5.dir/diagonalmatrices.cpp.o"
+  "CMakeFiles/diagonalmatrices_5.dir/diagonalmatrices.cpp.o.d"
+  "diagonalmatrices_5"
+  "diagonalmatrices_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/diagonalmatrices_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
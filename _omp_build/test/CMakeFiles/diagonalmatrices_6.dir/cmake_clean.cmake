@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/diagonalmatrices_6.dir/diagonalmatrices.cpp.o"
+  "CMakeFiles/diagonalmatrices_6.dir/diagonalmatrices.cpp.o.d"
+  "diagonalmatrices_6"
+  "diagonalmatrices_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/diagonalmatrices_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/diagonalmatrices_7.dir/diagonalmatrices.cpp.o"
+  "CMakeFiles/diagonalmatrices_7.dir/diagonalmatrices.cpp.o.d"
+  "diagonalmatrices_7"
+  "diagonalmatrices_7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/diagonalmatrices_7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/diagonalmatrices_8.dir/diagonalmatrices.cpp.o"
+  "CMakeFiles/diagonalmatrices_8.dir/diagonalmatrices.cpp.o.d"
+  "diagonalmatrices_8"
+  "diagonalmatrices_8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/diagonalmatrices_8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/diagonalmatrices_9.dir/diagonalmatrices.cpp.o"
+  "CMakeFiles/diagonalmatrices_9.dir/diagonalmatrices.cpp.o.d"
+  "diagonalmatrices_9"
+  "diagonalmatrices_9.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/diagonalmatrices_9.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dontalign_1.dir/dontalign.cpp.o"
+  "CMakeFiles/dontalign_1.dir/dontalign.cpp.o.d"
+  "dontalign_1"
+  "dontalign_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dontalign_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dontalign_2.dir/dontalign.cpp.o"
+  "CMakeFiles/dontalign_2.dir/dontalign.cpp.o.d"
+  "dontalign_2"
+  "dontalign_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dontalign_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dontalign_3.dir/dontalign.cpp.o"
+  "CMakeFiles/dontalign_3.dir/dontalign.cpp.o.d"
+  "dontalign_3"
+  "dontalign_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dontalign_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
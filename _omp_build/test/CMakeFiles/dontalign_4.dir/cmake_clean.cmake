@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dontalign_4.dir/dontalign.cpp.o"
+  "CMakeFiles/dontalign_4.dir/dontalign.cpp.o.d"
+  "dontalign_4"
+  "dontalign_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dontalign_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
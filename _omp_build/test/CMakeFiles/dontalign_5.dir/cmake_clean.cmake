@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dontalign_5.dir/dontalign.cpp.o"
+  "CMakeFiles/dontalign_5.dir/dontalign.cpp.o.d"
+  "dontalign_5"
+  "dontalign_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dontalign_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
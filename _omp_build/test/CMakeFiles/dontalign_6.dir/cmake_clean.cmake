@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dontalign_6.dir/dontalign.cpp.o"
+  "CMakeFiles/dontalign_6.dir/dontalign.cpp.o.d"
+  "dontalign_6"
+  "dontalign_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dontalign_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
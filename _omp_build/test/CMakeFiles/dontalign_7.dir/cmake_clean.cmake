@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dontalign_7.dir/dontalign.cpp.o"
+  "CMakeFiles/dontalign_7.dir/dontalign.cpp.o.d"
+  "dontalign_7"
+  "dontalign_7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dontalign_7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dontalign_8.dir/dontalign.cpp.o"
+  "CMakeFiles/dontalign_8.dir/dontalign.cpp.o.d"
+  "dontalign_8"
+  "dontalign_8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dontalign_8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
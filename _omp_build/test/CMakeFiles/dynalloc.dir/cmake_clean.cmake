@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dynalloc.dir/dynalloc.cpp.o"
+  "CMakeFiles/dynalloc.dir/dynalloc.cpp.o.d"
+  "dynalloc"
+  "dynalloc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dynalloc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/eigen2support_2.dir/eigen2support.cpp.o"
+  "CMakeFiles/eigen2support_2.dir/eigen2support.cpp.o.d"
+  "eigen2support_2"
+  "eigen2support_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/eigen2support_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/eigensolver_complex_1.dir/eigensolver_complex.cpp.o"
+  "CMakeFiles/eigensolver_complex_1.dir/eigensolver_complex.cpp.o.d"
+  "eigensolver_complex_1"
+  "eigensolver_complex_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/eigensolver_complex_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
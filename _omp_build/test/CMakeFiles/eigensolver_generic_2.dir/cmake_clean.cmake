@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/eigensolver_generic_2.dir/eigensolver_generic.cpp.o"
+  "CMakeFiles/eigensolver_generic_2.dir/eigensolver_generic.cpp.o.d"
+  "eigensolver_generic_2"
+  "eigensolver_generic_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/eigensolver_generic_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/eigensolver_generic_5.dir/eigensolver_generic.cpp.o"
+  "CMakeFiles/eigensolver_generic_5.dir/eigensolver_generic.cpp.o.d"
+  "eigensolver_generic_5"
+  "eigensolver_generic_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/eigensolver_generic_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
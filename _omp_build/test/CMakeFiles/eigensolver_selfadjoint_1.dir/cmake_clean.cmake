@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/eigensolver_selfadjoint_1.dir/eigensolver_selfadjoint.cpp.o"
+  "CMakeFiles/eigensolver_selfadjoint_1.dir/eigensolver_selfadjoint.cpp.o.d"
+  "eigensolver_selfadjoint_1"
+  "eigensolver_selfadjoint_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/eigensolver_selfadjoint_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/first_aligned.dir/first_aligned.cpp.o"
+  "CMakeFiles/first_aligned.dir/first_aligned.cpp.o.d"
+  "first_aligned"
+  "first_aligned.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/first_aligned.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fused_evaluation_1.dir/fused_evaluation.cpp.o"
+  "CMakeFiles/fused_evaluation_1.dir/fused_evaluation.cpp.o.d"
+  "fused_evaluation_1"
+  "fused_evaluation_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fused_evaluation_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
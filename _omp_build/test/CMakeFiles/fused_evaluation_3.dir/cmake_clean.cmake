@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fused_evaluation_3.dir/fused_evaluation.cpp.o"
+  "CMakeFiles/fused_evaluation_3.dir/fused_evaluation.cpp.o.d"
+  "fused_evaluation_3"
+  "fused_evaluation_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fused_evaluation_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
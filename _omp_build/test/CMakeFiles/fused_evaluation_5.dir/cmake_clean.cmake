@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fused_evaluation_5.dir/fused_evaluation.cpp.o"
+  "CMakeFiles/fused_evaluation_5.dir/fused_evaluation.cpp.o.d"
+  "fused_evaluation_5"
+  "fused_evaluation_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fused_evaluation_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
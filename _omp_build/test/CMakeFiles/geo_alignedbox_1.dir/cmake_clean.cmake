@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/geo_alignedbox_1.dir/geo_alignedbox.cpp.o"
+  "CMakeFiles/geo_alignedbox_1.dir/geo_alignedbox.cpp.o.d"
+  "geo_alignedbox_1"
+  "geo_alignedbox_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/geo_alignedbox_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/geo_eulerangles_1.dir/geo_eulerangles.cpp.o"
+  "CMakeFiles/geo_eulerangles_1.dir/geo_eulerangles.cpp.o.d"
+  "geo_eulerangles_1"
+  "geo_eulerangles_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/geo_eulerangles_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/geo_eulerangles_2.dir/geo_eulerangles.cpp.o"
+  "CMakeFiles/geo_eulerangles_2.dir/geo_eulerangles.cpp.o.d"
+  "geo_eulerangles_2"
+  "geo_eulerangles_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/geo_eulerangles_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
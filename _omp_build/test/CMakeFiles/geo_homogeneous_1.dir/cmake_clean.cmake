@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/geo_homogeneous_1.dir/geo_homogeneous.cpp.o"
+  "CMakeFiles/geo_homogeneous_1.dir/geo_homogeneous.cpp.o.d"
+  "geo_homogeneous_1"
+  "geo_homogeneous_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/geo_homogeneous_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/geo_hyperplane_1.dir/geo_hyperplane.cpp.o"
+  "CMakeFiles/geo_hyperplane_1.dir/geo_hyperplane.cpp.o.d"
+  "geo_hyperplane_1"
+  "geo_hyperplane_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/geo_hyperplane_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/geo_hyperplane_3.dir/geo_hyperplane.cpp.o"
+  "CMakeFiles/geo_hyperplane_3.dir/geo_hyperplane.cpp.o.d"
+  "geo_hyperplane_3"
+  "geo_hyperplane_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/geo_hyperplane_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
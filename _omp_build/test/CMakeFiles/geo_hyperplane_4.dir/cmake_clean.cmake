@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/geo_hyperplane_4.dir/geo_hyperplane.cpp.o"
+  "CMakeFiles/geo_hyperplane_4.dir/geo_hyperplane.cpp.o.d"
+  "geo_hyperplane_4"
+  "geo_hyperplane_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/geo_hyperplane_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
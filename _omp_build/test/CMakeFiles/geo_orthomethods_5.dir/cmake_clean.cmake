@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/geo_orthomethods_5.dir/geo_orthomethods.cpp.o"
+  "CMakeFiles/geo_orthomethods_5.dir/geo_orthomethods.cpp.o.d"
+  "geo_orthomethods_5"
+  "geo_orthomethods_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/geo_orthomethods_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
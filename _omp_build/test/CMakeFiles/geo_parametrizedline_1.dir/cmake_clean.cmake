@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/geo_parametrizedline_1.dir/geo_parametrizedline.cpp.o"
+  "CMakeFiles/geo_parametrizedline_1.dir/geo_parametrizedline.cpp.o.d"
+  "geo_parametrizedline_1"
+  "geo_parametrizedline_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/geo_parametrizedline_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
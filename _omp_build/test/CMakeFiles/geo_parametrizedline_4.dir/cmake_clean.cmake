@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/geo_parametrizedline_4.dir/geo_parametrizedline.cpp.o"
+  "CMakeFiles/geo_parametrizedline_4.dir/geo_parametrizedline.cpp.o.d"
+  "geo_parametrizedline_4"
+  "geo_parametrizedline_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/geo_parametrizedline_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
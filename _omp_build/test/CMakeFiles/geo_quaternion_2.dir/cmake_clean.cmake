@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/geo_quaternion_2.dir/geo_quaternion.cpp.o"
+  "CMakeFiles/geo_quaternion_2.dir/geo_quaternion.cpp.o.d"
+  "geo_quaternion_2"
+  "geo_quaternion_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/geo_quaternion_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
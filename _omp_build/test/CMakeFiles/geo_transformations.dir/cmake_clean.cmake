@@ -0,0 +1,5 @@
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/geo_transformations.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
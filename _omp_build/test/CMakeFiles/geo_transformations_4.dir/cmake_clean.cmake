@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/geo_transformations_4.dir/geo_transformations.cpp.o"
+  "CMakeFiles/geo_transformations_4.dir/geo_transformations.cpp.o.d"
+  "geo_transformations_4"
+  "geo_transformations_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/geo_transformations_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
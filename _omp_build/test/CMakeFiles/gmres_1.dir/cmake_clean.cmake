@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gmres_1.dir/gmres.cpp.o"
+  "CMakeFiles/gmres_1.dir/gmres.cpp.o.d"
+  "gmres_1"
+  "gmres_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gmres_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gmres_2.dir/gmres.cpp.o"
+  "CMakeFiles/gmres_2.dir/gmres.cpp.o.d"
+  "gmres_2"
+  "gmres_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gmres_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
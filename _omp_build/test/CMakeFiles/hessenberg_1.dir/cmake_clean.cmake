@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hessenberg_1.dir/hessenberg.cpp.o"
+  "CMakeFiles/hessenberg_1.dir/hessenberg.cpp.o.d"
+  "hessenberg_1"
+  "hessenberg_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hessenberg_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
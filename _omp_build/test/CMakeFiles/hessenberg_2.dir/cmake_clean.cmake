@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hessenberg_2.dir/hessenberg.cpp.o"
+  "CMakeFiles/hessenberg_2.dir/hessenberg.cpp.o.d"
+  "hessenberg_2"
+  "hessenberg_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hessenberg_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
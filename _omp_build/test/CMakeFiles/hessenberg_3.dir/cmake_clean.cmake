@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hessenberg_3.dir/hessenberg.cpp.o"
+  "CMakeFiles/hessenberg_3.dir/hessenberg.cpp.o.d"
+  "hessenberg_3"
+  "hessenberg_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hessenberg_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
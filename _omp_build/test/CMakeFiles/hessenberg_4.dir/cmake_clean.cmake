@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hessenberg_4.dir/hessenberg.cpp.o"
+  "CMakeFiles/hessenberg_4.dir/hessenberg.cpp.o.d"
+  "hessenberg_4"
+  "hessenberg_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hessenberg_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hessenberg_5.dir/hessenberg.cpp.o"
+  "CMakeFiles/hessenberg_5.dir/hessenberg.cpp.o.d"
+  "hessenberg_5"
+  "hessenberg_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hessenberg_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hessenberg_6.dir/hessenberg.cpp.o"
+  "CMakeFiles/hessenberg_6.dir/hessenberg.cpp.o.d"
+  "hessenberg_6"
+  "hessenberg_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hessenberg_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/householder_1.dir/householder.cpp.o"
+  "CMakeFiles/householder_1.dir/householder.cpp.o.d"
+  "householder_1"
+  "householder_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/householder_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
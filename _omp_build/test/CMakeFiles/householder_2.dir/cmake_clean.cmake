@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/householder_2.dir/householder.cpp.o"
+  "CMakeFiles/householder_2.dir/householder.cpp.o.d"
+  "householder_2"
+  "householder_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/householder_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/householder_3.dir/householder.cpp.o"
+  "CMakeFiles/householder_3.dir/householder.cpp.o.d"
+  "householder_3"
+  "householder_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/householder_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/householder_4.dir/householder.cpp.o"
+  "CMakeFiles/householder_4.dir/householder.cpp.o.d"
+  "householder_4"
+  "householder_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/householder_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
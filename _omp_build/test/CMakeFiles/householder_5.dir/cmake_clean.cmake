@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/householder_5.dir/householder.cpp.o"
+  "CMakeFiles/householder_5.dir/householder.cpp.o.d"
+  "householder_5"
+  "householder_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/householder_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/householder_6.dir/householder.cpp.o"
+  "CMakeFiles/householder_6.dir/householder.cpp.o.d"
+  "householder_6"
+  "householder_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/householder_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
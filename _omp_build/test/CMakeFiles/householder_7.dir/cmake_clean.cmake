@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/householder_7.dir/householder.cpp.o"
+  "CMakeFiles/householder_7.dir/householder.cpp.o.d"
+  "householder_7"
+  "householder_7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/householder_7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/householder_8.dir/householder.cpp.o"
+  "CMakeFiles/householder_8.dir/householder.cpp.o.d"
+  "householder_8"
+  "householder_8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/householder_8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
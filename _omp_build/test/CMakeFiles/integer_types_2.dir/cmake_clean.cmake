@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/integer_types_2.dir/integer_types.cpp.o"
+  "CMakeFiles/integer_types_2.dir/integer_types.cpp.o.d"
+  "integer_types_2"
+  "integer_types_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/integer_types_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
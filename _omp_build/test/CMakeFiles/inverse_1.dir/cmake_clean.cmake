@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/inverse_1.dir/inverse.cpp.o"
+  "CMakeFiles/inverse_1.dir/inverse.cpp.o.d"
+  "inverse_1"
+  "inverse_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/inverse_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
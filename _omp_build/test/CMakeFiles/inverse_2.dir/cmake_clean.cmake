@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/inverse_2.dir/inverse.cpp.o"
+  "CMakeFiles/inverse_2.dir/inverse.cpp.o.d"
+  "inverse_2"
+  "inverse_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/inverse_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/inverse_3.dir/inverse.cpp.o"
+  "CMakeFiles/inverse_3.dir/inverse.cpp.o.d"
+  "inverse_3"
+  "inverse_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/inverse_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
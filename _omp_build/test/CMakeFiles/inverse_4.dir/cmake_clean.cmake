@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/inverse_4.dir/inverse.cpp.o"
+  "CMakeFiles/inverse_4.dir/inverse.cpp.o.d"
+  "inverse_4"
+  "inverse_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/inverse_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/inverse_5.dir/inverse.cpp.o"
+  "CMakeFiles/inverse_5.dir/inverse.cpp.o.d"
+  "inverse_5"
+  "inverse_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/inverse_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
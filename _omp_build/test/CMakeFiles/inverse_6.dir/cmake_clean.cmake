@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/inverse_6.dir/inverse.cpp.o"
+  "CMakeFiles/inverse_6.dir/inverse.cpp.o.d"
+  "inverse_6"
+  "inverse_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/inverse_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
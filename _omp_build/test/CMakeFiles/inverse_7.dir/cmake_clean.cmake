@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/inverse_7.dir/inverse.cpp.o"
+  "CMakeFiles/inverse_7.dir/inverse.cpp.o.d"
+  "inverse_7"
+  "inverse_7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/inverse_7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
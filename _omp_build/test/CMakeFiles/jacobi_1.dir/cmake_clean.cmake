@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/jacobi_1.dir/jacobi.cpp.o"
+  "CMakeFiles/jacobi_1.dir/jacobi.cpp.o.d"
+  "jacobi_1"
+  "jacobi_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/jacobi_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/jacobi_2.dir/jacobi.cpp.o"
+  "CMakeFiles/jacobi_2.dir/jacobi.cpp.o.d"
+  "jacobi_2"
+  "jacobi_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/jacobi_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
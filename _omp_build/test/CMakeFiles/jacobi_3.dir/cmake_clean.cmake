@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/jacobi_3.dir/jacobi.cpp.o"
+  "CMakeFiles/jacobi_3.dir/jacobi.cpp.o.d"
+  "jacobi_3"
+  "jacobi_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/jacobi_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
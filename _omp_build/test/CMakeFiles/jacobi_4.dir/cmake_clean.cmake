@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/jacobi_4.dir/jacobi.cpp.o"
+  "CMakeFiles/jacobi_4.dir/jacobi.cpp.o.d"
+  "jacobi_4"
+  "jacobi_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/jacobi_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/jacobi_5.dir/jacobi.cpp.o"
+  "CMakeFiles/jacobi_5.dir/jacobi.cpp.o.d"
+  "jacobi_5"
+  "jacobi_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/jacobi_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/jacobi_6.dir/jacobi.cpp.o"
+  "CMakeFiles/jacobi_6.dir/jacobi.cpp.o.d"
+  "jacobi_6"
+  "jacobi_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/jacobi_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
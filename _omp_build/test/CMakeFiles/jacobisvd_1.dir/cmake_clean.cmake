@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/jacobisvd_1.dir/jacobisvd.cpp.o"
+  "CMakeFiles/jacobisvd_1.dir/jacobisvd.cpp.o.d"
+  "jacobisvd_1"
+  "jacobisvd_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/jacobisvd_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
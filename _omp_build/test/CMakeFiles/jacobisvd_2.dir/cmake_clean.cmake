@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/jacobisvd_2.dir/jacobisvd.cpp.o"
+  "CMakeFiles/jacobisvd_2.dir/jacobisvd.cpp.o.d"
+  "jacobisvd_2"
+  "jacobisvd_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/jacobisvd_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
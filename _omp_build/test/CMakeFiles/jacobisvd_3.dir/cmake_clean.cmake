@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/jacobisvd_3.dir/jacobisvd.cpp.o"
+  "CMakeFiles/jacobisvd_3.dir/jacobisvd.cpp.o.d"
+  "jacobisvd_3"
+  "jacobisvd_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/jacobisvd_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/jacobisvd_4.dir/jacobisvd.cpp.o"
+  "CMakeFiles/jacobisvd_4.dir/jacobisvd.cpp.o.d"
+  "jacobisvd_4"
+  "jacobisvd_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/jacobisvd_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/jacobisvd_5.dir/jacobisvd.cpp.o"
+  "CMakeFiles/jacobisvd_5.dir/jacobisvd.cpp.o.d"
+  "jacobisvd_5"
+  "jacobisvd_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/jacobisvd_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/jacobisvd_6.dir/jacobisvd.cpp.o"
+  "CMakeFiles/jacobisvd_6.dir/jacobisvd.cpp.o.d"
+  "jacobisvd_6"
+  "jacobisvd_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/jacobisvd_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/jacobisvd_7.dir/jacobisvd.cpp.o"
+  "CMakeFiles/jacobisvd_7.dir/jacobisvd.cpp.o.d"
+  "jacobisvd_7"
+  "jacobisvd_7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/jacobisvd_7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
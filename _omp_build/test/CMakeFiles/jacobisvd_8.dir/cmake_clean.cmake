@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/jacobisvd_8.dir/jacobisvd.cpp.o"
+  "CMakeFiles/jacobisvd_8.dir/jacobisvd.cpp.o.d"
+  "jacobisvd_8"
+  "jacobisvd_8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/jacobisvd_8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
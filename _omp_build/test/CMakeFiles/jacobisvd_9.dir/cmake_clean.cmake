@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/jacobisvd_9.dir/jacobisvd.cpp.o"
+  "CMakeFiles/jacobisvd_9.dir/jacobisvd.cpp.o.d"
+  "jacobisvd_9"
+  "jacobisvd_9.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/jacobisvd_9.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
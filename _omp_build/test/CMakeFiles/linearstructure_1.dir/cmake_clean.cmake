@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/linearstructure_1.dir/linearstructure.cpp.o"
+  "CMakeFiles/linearstructure_1.dir/linearstructure.cpp.o.d"
+  "linearstructure_1"
+  "linearstructure_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/linearstructure_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/linearstructure_2.dir/linearstructure.cpp.o"
+  "CMakeFiles/linearstructure_2.dir/linearstructure.cpp.o.d"
+  "linearstructure_2"
+  "linearstructure_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/linearstructure_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
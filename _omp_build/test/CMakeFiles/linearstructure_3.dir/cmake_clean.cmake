@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/linearstructure_3.dir/linearstructure.cpp.o"
+  "CMakeFiles/linearstructure_3.dir/linearstructure.cpp.o.d"
+  "linearstructure_3"
+  "linearstructure_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/linearstructure_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/linearstructure_4.dir/linearstructure.cpp.o"
+  "CMakeFiles/linearstructure_4.dir/linearstructure.cpp.o.d"
+  "linearstructure_4"
+  "linearstructure_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/linearstructure_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/linearstructure_5.dir/linearstructure.cpp.o"
+  "CMakeFiles/linearstructure_5.dir/linearstructure.cpp.o.d"
+  "linearstructure_5"
+  "linearstructure_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/linearstructure_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/linearstructure_6.dir/linearstructure.cpp.o"
+  "CMakeFiles/linearstructure_6.dir/linearstructure.cpp.o.d"
+  "linearstructure_6"
+  "linearstructure_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/linearstructure_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
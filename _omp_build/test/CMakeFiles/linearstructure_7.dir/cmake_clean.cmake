@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/linearstructure_7.dir/linearstructure.cpp.o"
+  "CMakeFiles/linearstructure_7.dir/linearstructure.cpp.o.d"
+  "linearstructure_7"
+  "linearstructure_7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/linearstructure_7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/linearstructure_8.dir/linearstructure.cpp.o"
+  "CMakeFiles/linearstructure_8.dir/linearstructure.cpp.o.d"
+  "linearstructure_8"
+  "linearstructure_8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/linearstructure_8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
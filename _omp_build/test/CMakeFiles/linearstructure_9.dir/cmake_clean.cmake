@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/linearstructure_9.dir/linearstructure.cpp.o"
+  "CMakeFiles/linearstructure_9.dir/linearstructure.cpp.o.d"
+  "linearstructure_9"
+  "linearstructure_9.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/linearstructure_9.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lu_1.dir/lu.cpp.o"
+  "CMakeFiles/lu_1.dir/lu.cpp.o.d"
+  "lu_1"
+  "lu_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lu_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
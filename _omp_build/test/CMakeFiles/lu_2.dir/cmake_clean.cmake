@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lu_2.dir/lu.cpp.o"
+  "CMakeFiles/lu_2.dir/lu.cpp.o.d"
+  "lu_2"
+  "lu_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lu_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lu_3.dir/lu.cpp.o"
+  "CMakeFiles/lu_3.dir/lu.cpp.o.d"
+  "lu_3"
+  "lu_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lu_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lu_4.dir/lu.cpp.o"
+  "CMakeFiles/lu_4.dir/lu.cpp.o.d"
+  "lu_4"
+  "lu_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lu_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
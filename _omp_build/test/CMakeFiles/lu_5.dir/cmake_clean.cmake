@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lu_5.dir/lu.cpp.o"
+  "CMakeFiles/lu_5.dir/lu.cpp.o.d"
+  "lu_5"
+  "lu_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lu_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lu_6.dir/lu.cpp.o"
+  "CMakeFiles/lu_6.dir/lu.cpp.o.d"
+  "lu_6"
+  "lu_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lu_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lu_7.dir/lu.cpp.o"
+  "CMakeFiles/lu_7.dir/lu.cpp.o.d"
+  "lu_7"
+  "lu_7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lu_7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
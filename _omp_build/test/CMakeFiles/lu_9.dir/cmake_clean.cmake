@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lu_9.dir/lu.cpp.o"
+  "CMakeFiles/lu_9.dir/lu.cpp.o.d"
+  "lu_9"
+  "lu_9.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lu_9.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
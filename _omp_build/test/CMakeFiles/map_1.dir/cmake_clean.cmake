@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/map_1.dir/map.cpp.o"
+  "CMakeFiles/map_1.dir/map.cpp.o.d"
+  "map_1"
+  "map_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/map_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/map_10.dir/map.cpp.o"
+  "CMakeFiles/map_10.dir/map.cpp.o.d"
+  "map_10"
+  "map_10.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/map_10.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/map_11.dir/map.cpp.o"
+  "CMakeFiles/map_11.dir/map.cpp.o.d"
+  "map_11"
+  "map_11.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/map_11.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/map_2.dir/map.cpp.o"
+  "CMakeFiles/map_2.dir/map.cpp.o.d"
+  "map_2"
+  "map_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/map_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/map_3.dir/map.cpp.o"
+  "CMakeFiles/map_3.dir/map.cpp.o.d"
+  "map_3"
+  "map_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/map_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
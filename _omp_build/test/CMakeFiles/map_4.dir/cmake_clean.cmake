@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/map_4.dir/map.cpp.o"
+  "CMakeFiles/map_4.dir/map.cpp.o.d"
+  "map_4"
+  "map_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/map_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/map_5.dir/map.cpp.o"
+  "CMakeFiles/map_5.dir/map.cpp.o.d"
+  "map_5"
+  "map_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/map_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/map_6.dir/map.cpp.o"
+  "CMakeFiles/map_6.dir/map.cpp.o.d"
+  "map_6"
+  "map_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/map_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
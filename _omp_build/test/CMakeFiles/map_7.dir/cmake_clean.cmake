@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/map_7.dir/map.cpp.o"
+  "CMakeFiles/map_7.dir/map.cpp.o.d"
+  "map_7"
+  "map_7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/map_7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/map_8.dir/map.cpp.o"
+  "CMakeFiles/map_8.dir/map.cpp.o.d"
+  "map_8"
+  "map_8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/map_8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
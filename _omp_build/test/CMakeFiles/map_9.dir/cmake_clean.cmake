@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/map_9.dir/map.cpp.o"
+  "CMakeFiles/map_9.dir/map.cpp.o.d"
+  "map_9"
+  "map_9.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/map_9.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
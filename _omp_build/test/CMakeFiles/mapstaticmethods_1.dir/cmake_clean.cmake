@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mapstaticmethods_1.dir/mapstaticmethods.cpp.o"
+  "CMakeFiles/mapstaticmethods_1.dir/mapstaticmethods.cpp.o.d"
+  "mapstaticmethods_1"
+  "mapstaticmethods_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mapstaticmethods_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
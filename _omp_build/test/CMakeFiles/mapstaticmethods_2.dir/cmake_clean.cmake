@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mapstaticmethods_2.dir/mapstaticmethods.cpp.o"
+  "CMakeFiles/mapstaticmethods_2.dir/mapstaticmethods.cpp.o.d"
+  "mapstaticmethods_2"
+  "mapstaticmethods_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mapstaticmethods_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mapstaticmethods_3.dir/mapstaticmethods.cpp.o"
+  "CMakeFiles/mapstaticmethods_3.dir/mapstaticmethods.cpp.o.d"
+  "mapstaticmethods_3"
+  "mapstaticmethods_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mapstaticmethods_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
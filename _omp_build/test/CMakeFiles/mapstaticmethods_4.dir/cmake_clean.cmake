@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mapstaticmethods_4.dir/mapstaticmethods.cpp.o"
+  "CMakeFiles/mapstaticmethods_4.dir/mapstaticmethods.cpp.o.d"
+  "mapstaticmethods_4"
+  "mapstaticmethods_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mapstaticmethods_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mapstaticmethods_5.dir/mapstaticmethods.cpp.o"
+  "CMakeFiles/mapstaticmethods_5.dir/mapstaticmethods.cpp.o.d"
+  "mapstaticmethods_5"
+  "mapstaticmethods_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mapstaticmethods_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mapstaticmethods_6.dir/mapstaticmethods.cpp.o"
+  "CMakeFiles/mapstaticmethods_6.dir/mapstaticmethods.cpp.o.d"
+  "mapstaticmethods_6"
+  "mapstaticmethods_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mapstaticmethods_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
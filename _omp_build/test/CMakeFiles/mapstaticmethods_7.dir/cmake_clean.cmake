@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mapstaticmethods_7.dir/mapstaticmethods.cpp.o"
+  "CMakeFiles/mapstaticmethods_7.dir/mapstaticmethods.cpp.o.d"
+  "mapstaticmethods_7"
+  "mapstaticmethods_7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mapstaticmethods_7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
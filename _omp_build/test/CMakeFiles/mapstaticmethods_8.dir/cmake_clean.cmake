@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mapstaticmethods_8.dir/mapstaticmethods.cpp.o"
+  "CMakeFiles/mapstaticmethods_8.dir/mapstaticmethods.cpp.o.d"
+  "mapstaticmethods_8"
+  "mapstaticmethods_8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mapstaticmethods_8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mapstride_1.dir/mapstride.cpp.o"
+  "CMakeFiles/mapstride_1.dir/mapstride.cpp.o.d"
+  "mapstride_1"
+  "mapstride_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mapstride_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
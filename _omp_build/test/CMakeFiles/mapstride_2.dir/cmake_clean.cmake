@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mapstride_2.dir/mapstride.cpp.o"
+  "CMakeFiles/mapstride_2.dir/mapstride.cpp.o.d"
+  "mapstride_2"
+  "mapstride_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mapstride_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
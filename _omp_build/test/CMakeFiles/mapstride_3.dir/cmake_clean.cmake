@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mapstride_3.dir/mapstride.cpp.o"
+  "CMakeFiles/mapstride_3.dir/mapstride.cpp.o.d"
+  "mapstride_3"
+  "mapstride_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mapstride_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mapstride_4.dir/mapstride.cpp.o"
+  "CMakeFiles/mapstride_4.dir/mapstride.cpp.o.d"
+  "mapstride_4"
+  "mapstride_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mapstride_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
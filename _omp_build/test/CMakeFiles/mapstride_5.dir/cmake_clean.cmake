@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mapstride_5.dir/mapstride.cpp.o"
+  "CMakeFiles/mapstride_5.dir/mapstride.cpp.o.d"
+  "mapstride_5"
+  "mapstride_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mapstride_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
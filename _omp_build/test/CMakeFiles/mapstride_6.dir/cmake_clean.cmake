@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mapstride_6.dir/mapstride.cpp.o"
+  "CMakeFiles/mapstride_6.dir/mapstride.cpp.o.d"
+  "mapstride_6"
+  "mapstride_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mapstride_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
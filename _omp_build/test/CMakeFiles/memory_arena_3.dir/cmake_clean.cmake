@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/memory_arena_3.dir/memory_arena.cpp.o"
+  "CMakeFiles/memory_arena_3.dir/memory_arena.cpp.o.d"
+  "memory_arena_3"
+  "memory_arena_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/memory_arena_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/meta.dir/meta.cpp.o"
+  "CMakeFiles/meta.dir/meta.cpp.o.d"
+  "meta"
+  "meta.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/meta.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/minres_1.dir/minres.cpp.o"
+  "CMakeFiles/minres_1.dir/minres.cpp.o.d"
+  "minres_1"
+  "minres_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/minres_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
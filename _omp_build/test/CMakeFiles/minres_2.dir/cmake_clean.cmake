@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/minres_2.dir/minres.cpp.o"
+  "CMakeFiles/minres_2.dir/minres.cpp.o.d"
+  "minres_2"
+  "minres_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/minres_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
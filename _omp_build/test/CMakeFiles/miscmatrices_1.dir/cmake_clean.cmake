@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/miscmatrices_1.dir/miscmatrices.cpp.o"
+  "CMakeFiles/miscmatrices_1.dir/miscmatrices.cpp.o.d"
+  "miscmatrices_1"
+  "miscmatrices_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/miscmatrices_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
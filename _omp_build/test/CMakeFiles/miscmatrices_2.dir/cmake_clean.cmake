@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/miscmatrices_2.dir/miscmatrices.cpp.o"
+  "CMakeFiles/miscmatrices_2.dir/miscmatrices.cpp.o.d"
+  "miscmatrices_2"
+  "miscmatrices_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/miscmatrices_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/miscmatrices_3.dir/miscmatrices.cpp.o"
+  "CMakeFiles/miscmatrices_3.dir/miscmatrices.cpp.o.d"
+  "miscmatrices_3"
+  "miscmatrices_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/miscmatrices_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/miscmatrices_4.dir/miscmatrices.cpp.o"
+  "CMakeFiles/miscmatrices_4.dir/miscmatrices.cpp.o.d"
+  "miscmatrices_4"
+  "miscmatrices_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/miscmatrices_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/miscmatrices_5.dir/miscmatrices.cpp.o"
+  "CMakeFiles/miscmatrices_5.dir/miscmatrices.cpp.o.d"
+  "miscmatrices_5"
+  "miscmatrices_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/miscmatrices_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
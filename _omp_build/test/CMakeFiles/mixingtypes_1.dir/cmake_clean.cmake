@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mixingtypes_1.dir/mixingtypes.cpp.o"
+  "CMakeFiles/mixingtypes_1.dir/mixingtypes.cpp.o.d"
+  "mixingtypes_1"
+  "mixingtypes_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mixingtypes_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
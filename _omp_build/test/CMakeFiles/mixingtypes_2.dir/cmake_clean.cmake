@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mixingtypes_2.dir/mixingtypes.cpp.o"
+  "CMakeFiles/mixingtypes_2.dir/mixingtypes.cpp.o.d"
+  "mixingtypes_2"
+  "mixingtypes_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mixingtypes_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mixingtypes_3.dir/mixingtypes.cpp.o"
+  "CMakeFiles/mixingtypes_3.dir/mixingtypes.cpp.o.d"
+  "mixingtypes_3"
+  "mixingtypes_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mixingtypes_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
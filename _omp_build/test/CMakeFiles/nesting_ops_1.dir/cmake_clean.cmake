@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nesting_ops_1.dir/nesting_ops.cpp.o"
+  "CMakeFiles/nesting_ops_1.dir/nesting_ops.cpp.o.d"
+  "nesting_ops_1"
+  "nesting_ops_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nesting_ops_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
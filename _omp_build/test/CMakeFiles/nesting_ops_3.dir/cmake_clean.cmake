@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nesting_ops_3.dir/nesting_ops.cpp.o"
+  "CMakeFiles/nesting_ops_3.dir/nesting_ops.cpp.o.d"
+  "nesting_ops_3"
+  "nesting_ops_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nesting_ops_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
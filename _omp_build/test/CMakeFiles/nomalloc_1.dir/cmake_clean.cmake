@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nomalloc_1.dir/nomalloc.cpp.o"
+  "CMakeFiles/nomalloc_1.dir/nomalloc.cpp.o.d"
+  "nomalloc_1"
+  "nomalloc_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nomalloc_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nomalloc_2.dir/nomalloc.cpp.o"
+  "CMakeFiles/nomalloc_2.dir/nomalloc.cpp.o.d"
+  "nomalloc_2"
+  "nomalloc_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nomalloc_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nomalloc_3.dir/nomalloc.cpp.o"
+  "CMakeFiles/nomalloc_3.dir/nomalloc.cpp.o.d"
+  "nomalloc_3"
+  "nomalloc_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nomalloc_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
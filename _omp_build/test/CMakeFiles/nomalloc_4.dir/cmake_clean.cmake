@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nomalloc_4.dir/nomalloc.cpp.o"
+  "CMakeFiles/nomalloc_4.dir/nomalloc.cpp.o.d"
+  "nomalloc_4"
+  "nomalloc_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nomalloc_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
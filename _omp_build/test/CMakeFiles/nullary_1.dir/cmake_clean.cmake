@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nullary_1.dir/nullary.cpp.o"
+  "CMakeFiles/nullary_1.dir/nullary.cpp.o.d"
+  "nullary_1"
+  "nullary_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nullary_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nullary_2.dir/nullary.cpp.o"
+  "CMakeFiles/nullary_2.dir/nullary.cpp.o.d"
+  "nullary_2"
+  "nullary_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nullary_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
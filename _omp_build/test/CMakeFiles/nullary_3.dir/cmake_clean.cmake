@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nullary_3.dir/nullary.cpp.o"
+  "CMakeFiles/nullary_3.dir/nullary.cpp.o.d"
+  "nullary_3"
+  "nullary_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nullary_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nullary_4.dir/nullary.cpp.o"
+  "CMakeFiles/nullary_4.dir/nullary.cpp.o.d"
+  "nullary_4"
+  "nullary_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nullary_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
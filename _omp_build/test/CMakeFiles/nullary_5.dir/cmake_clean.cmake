@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nullary_5.dir/nullary.cpp.o"
+  "CMakeFiles/nullary_5.dir/nullary.cpp.o.d"
+  "nullary_5"
+  "nullary_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nullary_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nullary_6.dir/nullary.cpp.o"
+  "CMakeFiles/nullary_6.dir/nullary.cpp.o.d"
+  "nullary_6"
+  "nullary_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nullary_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
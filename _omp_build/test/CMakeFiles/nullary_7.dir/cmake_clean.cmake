@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nullary_7.dir/nullary.cpp.o"
+  "CMakeFiles/nullary_7.dir/nullary.cpp.o.d"
+  "nullary_7"
+  "nullary_7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nullary_7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nullary_8.dir/nullary.cpp.o"
+  "CMakeFiles/nullary_8.dir/nullary.cpp.o.d"
+  "nullary_8"
+  "nullary_8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nullary_8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
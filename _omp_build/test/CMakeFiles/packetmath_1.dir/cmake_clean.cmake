@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/packetmath_1.dir/packetmath.cpp.o"
+  "CMakeFiles/packetmath_1.dir/packetmath.cpp.o.d"
+  "packetmath_1"
+  "packetmath_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/packetmath_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
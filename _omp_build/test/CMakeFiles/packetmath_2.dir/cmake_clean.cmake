@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/packetmath_2.dir/packetmath.cpp.o"
+  "CMakeFiles/packetmath_2.dir/packetmath.cpp.o.d"
+  "packetmath_2"
+  "packetmath_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/packetmath_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
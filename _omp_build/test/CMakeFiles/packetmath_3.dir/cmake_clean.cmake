@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/packetmath_3.dir/packetmath.cpp.o"
+  "CMakeFiles/packetmath_3.dir/packetmath.cpp.o.d"
+  "packetmath_3"
+  "packetmath_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/packetmath_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
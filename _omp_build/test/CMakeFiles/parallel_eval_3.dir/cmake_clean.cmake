@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/parallel_eval_3.dir/parallel_eval.cpp.o"
+  "CMakeFiles/parallel_eval_3.dir/parallel_eval.cpp.o.d"
+  "parallel_eval_3"
+  "parallel_eval_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parallel_eval_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/permutationmatrices_1.dir/permutationmatrices.cpp.o"
+  "CMakeFiles/permutationmatrices_1.dir/permutationmatrices.cpp.o.d"
+  "permutationmatrices_1"
+  "permutationmatrices_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/permutationmatrices_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/permutationmatrices_2.dir/permutationmatrices.cpp.o"
+  "CMakeFiles/permutationmatrices_2.dir/permutationmatrices.cpp.o.d"
+  "permutationmatrices_2"
+  "permutationmatrices_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/permutationmatrices_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/permutationmatrices_3.dir/permutationmatrices.cpp.o"
+  "CMakeFiles/permutationmatrices_3.dir/permutationmatrices.cpp.o.d"
+  "permutationmatrices_3"
+  "permutationmatrices_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/permutationmatrices_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/permutationmatrices_4.dir/permutationmatrices.cpp.o"
+  "CMakeFiles/permutationmatrices_4.dir/permutationmatrices.cpp.o.d"
+  "permutationmatrices_4"
+  "permutationmatrices_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/permutationmatrices_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/permutationmatrices_5.dir/permutationmatrices.cpp.o"
+  "CMakeFiles/permutationmatrices_5.dir/permutationmatrices.cpp.o.d"
+  "permutationmatrices_5"
+  "permutationmatrices_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/permutationmatrices_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/permutationmatrices_6.dir/permutationmatrices.cpp.o"
+  "CMakeFiles/permutationmatrices_6.dir/permutationmatrices.cpp.o.d"
+  "permutationmatrices_6"
+  "permutationmatrices_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/permutationmatrices_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/permutationmatrices_7.dir/permutationmatrices.cpp.o"
+  "CMakeFiles/permutationmatrices_7.dir/permutationmatrices.cpp.o.d"
+  "permutationmatrices_7"
+  "permutationmatrices_7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/permutationmatrices_7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
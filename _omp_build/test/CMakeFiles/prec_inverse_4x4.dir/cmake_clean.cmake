@@ -0,0 +1,5 @@
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/prec_inverse_4x4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/prec_inverse_4x4_2.dir/prec_inverse_4x4.cpp.o"
+  "CMakeFiles/prec_inverse_4x4_2.dir/prec_inverse_4x4.cpp.o.d"
+  "prec_inverse_4x4_2"
+  "prec_inverse_4x4_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/prec_inverse_4x4_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
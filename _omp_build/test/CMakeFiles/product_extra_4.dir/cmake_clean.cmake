@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/product_extra_4.dir/product_extra.cpp.o"
+  "CMakeFiles/product_extra_4.dir/product_extra.cpp.o.d"
+  "product_extra_4"
+  "product_extra_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/product_extra_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
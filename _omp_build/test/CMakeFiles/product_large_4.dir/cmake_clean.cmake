@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/product_large_4.dir/product_large.cpp.o"
+  "CMakeFiles/product_large_4.dir/product_large.cpp.o.d"
+  "product_large_4"
+  "product_large_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/product_large_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
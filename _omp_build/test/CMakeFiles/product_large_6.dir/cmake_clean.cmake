@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/product_large_6.dir/product_large.cpp.o"
+  "CMakeFiles/product_large_6.dir/product_large.cpp.o.d"
+  "product_large_6"
+  "product_large_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/product_large_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
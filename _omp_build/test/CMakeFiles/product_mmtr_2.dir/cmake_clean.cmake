@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/product_mmtr_2.dir/product_mmtr.cpp.o"
+  "CMakeFiles/product_mmtr_2.dir/product_mmtr.cpp.o.d"
+  "product_mmtr_2"
+  "product_mmtr_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/product_mmtr_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
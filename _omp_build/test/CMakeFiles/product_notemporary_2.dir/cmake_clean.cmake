@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/product_notemporary_2.dir/product_notemporary.cpp.o"
+  "CMakeFiles/product_notemporary_2.dir/product_notemporary.cpp.o.d"
+  "product_notemporary_2"
+  "product_notemporary_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/product_notemporary_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
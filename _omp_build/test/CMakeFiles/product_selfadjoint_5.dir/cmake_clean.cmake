@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/product_selfadjoint_5.dir/product_selfadjoint.cpp.o"
+  "CMakeFiles/product_selfadjoint_5.dir/product_selfadjoint.cpp.o.d"
+  "product_selfadjoint_5"
+  "product_selfadjoint_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/product_selfadjoint_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
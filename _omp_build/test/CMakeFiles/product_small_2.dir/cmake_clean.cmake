@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/product_small_2.dir/product_small.cpp.o"
+  "CMakeFiles/product_small_2.dir/product_small.cpp.o.d"
+  "product_small_2"
+  "product_small_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/product_small_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
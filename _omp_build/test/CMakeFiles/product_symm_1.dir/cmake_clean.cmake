@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/product_symm_1.dir/product_symm.cpp.o"
+  "CMakeFiles/product_symm_1.dir/product_symm.cpp.o.d"
+  "product_symm_1"
+  "product_symm_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/product_symm_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/product_symm_3.dir/product_symm.cpp.o"
+  "CMakeFiles/product_symm_3.dir/product_symm.cpp.o.d"
+  "product_symm_3"
+  "product_symm_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/product_symm_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/product_syrk_2.dir/product_syrk.cpp.o"
+  "CMakeFiles/product_syrk_2.dir/product_syrk.cpp.o.d"
+  "product_syrk_2"
+  "product_syrk_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/product_syrk_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
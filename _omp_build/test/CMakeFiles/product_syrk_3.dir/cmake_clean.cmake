@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/product_syrk_3.dir/product_syrk.cpp.o"
+  "CMakeFiles/product_syrk_3.dir/product_syrk.cpp.o.d"
+  "product_syrk_3"
+  "product_syrk_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/product_syrk_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/product_syrk_4.dir/product_syrk.cpp.o"
+  "CMakeFiles/product_syrk_4.dir/product_syrk.cpp.o.d"
+  "product_syrk_4"
+  "product_syrk_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/product_syrk_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/product_trmm_112.dir/product_trmm.cpp.o"
+  "CMakeFiles/product_trmm_112.dir/product_trmm.cpp.o.d"
+  "product_trmm_112"
+  "product_trmm_112.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/product_trmm_112.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/product_trmv_5.dir/product_trmv.cpp.o"
+  "CMakeFiles/product_trmv_5.dir/product_trmv.cpp.o.d"
+  "product_trmv_5"
+  "product_trmv_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/product_trmv_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
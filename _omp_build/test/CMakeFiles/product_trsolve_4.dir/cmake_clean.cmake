@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/product_trsolve_4.dir/product_trsolve.cpp.o"
+  "CMakeFiles/product_trsolve_4.dir/product_trsolve.cpp.o.d"
+  "product_trsolve_4"
+  "product_trsolve_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/product_trsolve_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
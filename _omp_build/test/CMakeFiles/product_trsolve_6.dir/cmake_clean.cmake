@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/product_trsolve_6.dir/product_trsolve.cpp.o"
+  "CMakeFiles/product_trsolve_6.dir/product_trsolve.cpp.o.d"
+  "product_trsolve_6"
+  "product_trsolve_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/product_trsolve_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/product_workspace_1.dir/product_workspace.cpp.o"
+  "CMakeFiles/product_workspace_1.dir/product_workspace.cpp.o.d"
+  "product_workspace_1"
+  "product_workspace_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/product_workspace_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/product_workspace_3.dir/product_workspace.cpp.o"
+  "CMakeFiles/product_workspace_3.dir/product_workspace.cpp.o.d"
+  "product_workspace_3"
+  "product_workspace_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/product_workspace_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
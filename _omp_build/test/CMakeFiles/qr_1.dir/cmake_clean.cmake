@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/qr_1.dir/qr.cpp.o"
+  "CMakeFiles/qr_1.dir/qr.cpp.o.d"
+  "qr_1"
+  "qr_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qr_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
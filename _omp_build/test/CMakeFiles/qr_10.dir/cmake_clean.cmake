@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/qr_10.dir/qr.cpp.o"
+  "CMakeFiles/qr_10.dir/qr.cpp.o.d"
+  "qr_10"
+  "qr_10.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qr_10.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/qr_11.dir/qr.cpp.o"
+  "CMakeFiles/qr_11.dir/qr.cpp.o.d"
+  "qr_11"
+  "qr_11.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qr_11.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
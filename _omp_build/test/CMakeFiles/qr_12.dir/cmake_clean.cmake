@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/qr_12.dir/qr.cpp.o"
+  "CMakeFiles/qr_12.dir/qr.cpp.o.d"
+  "qr_12"
+  "qr_12.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qr_12.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
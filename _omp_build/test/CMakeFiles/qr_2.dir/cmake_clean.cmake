@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/qr_2.dir/qr.cpp.o"
+  "CMakeFiles/qr_2.dir/qr.cpp.o.d"
+  "qr_2"
+  "qr_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qr_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
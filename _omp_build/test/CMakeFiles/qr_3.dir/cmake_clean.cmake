@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/qr_3.dir/qr.cpp.o"
+  "CMakeFiles/qr_3.dir/qr.cpp.o.d"
+  "qr_3"
+  "qr_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qr_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
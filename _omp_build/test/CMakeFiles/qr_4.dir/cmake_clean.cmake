@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/qr_4.dir/qr.cpp.o"
+  "CMakeFiles/qr_4.dir/qr.cpp.o.d"
+  "qr_4"
+  "qr_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qr_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
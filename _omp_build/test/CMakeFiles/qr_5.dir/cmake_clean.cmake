@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/qr_5.dir/qr.cpp.o"
+  "CMakeFiles/qr_5.dir/qr.cpp.o.d"
+  "qr_5"
+  "qr_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qr_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/qr_6.dir/qr.cpp.o"
+  "CMakeFiles/qr_6.dir/qr.cpp.o.d"
+  "qr_6"
+  "qr_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qr_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/qr_7.dir/qr.cpp.o"
+  "CMakeFiles/qr_7.dir/qr.cpp.o.d"
+  "qr_7"
+  "qr_7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qr_7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/qr_8.dir/qr.cpp.o"
+  "CMakeFiles/qr_8.dir/qr.cpp.o.d"
+  "qr_8"
+  "qr_8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qr_8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/qr_9.dir/qr.cpp.o"
+  "CMakeFiles/qr_9.dir/qr.cpp.o.d"
+  "qr_9"
+  "qr_9.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qr_9.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
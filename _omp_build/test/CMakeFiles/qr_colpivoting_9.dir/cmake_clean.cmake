@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/qr_colpivoting_9.dir/qr_colpivoting.cpp.o"
+  "CMakeFiles/qr_colpivoting_9.dir/qr_colpivoting.cpp.o.d"
+  "qr_colpivoting_9"
+  "qr_colpivoting_9.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qr_colpivoting_9.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/qr_fullpivoting_1.dir/qr_fullpivoting.cpp.o"
+  "CMakeFiles/qr_fullpivoting_1.dir/qr_fullpivoting.cpp.o.d"
+  "qr_fullpivoting_1"
+  "qr_fullpivoting_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qr_fullpivoting_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/redux_1.dir/redux.cpp.o"
+  "CMakeFiles/redux_1.dir/redux.cpp.o.d"
+  "redux_1"
+  "redux_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/redux_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/redux_2.dir/redux.cpp.o"
+  "CMakeFiles/redux_2.dir/redux.cpp.o.d"
+  "redux_2"
+  "redux_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/redux_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/redux_3.dir/redux.cpp.o"
+  "CMakeFiles/redux_3.dir/redux.cpp.o.d"
+  "redux_3"
+  "redux_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/redux_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/redux_4.dir/redux.cpp.o"
+  "CMakeFiles/redux_4.dir/redux.cpp.o.d"
+  "redux_4"
+  "redux_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/redux_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/redux_5.dir/redux.cpp.o"
+  "CMakeFiles/redux_5.dir/redux.cpp.o.d"
+  "redux_5"
+  "redux_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/redux_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
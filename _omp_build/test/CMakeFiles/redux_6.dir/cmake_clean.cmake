@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/redux_6.dir/redux.cpp.o"
+  "CMakeFiles/redux_6.dir/redux.cpp.o.d"
+  "redux_6"
+  "redux_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/redux_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/redux_7.dir/redux.cpp.o"
+  "CMakeFiles/redux_7.dir/redux.cpp.o.d"
+  "redux_7"
+  "redux_7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/redux_7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/redux_8.dir/redux.cpp.o"
+  "CMakeFiles/redux_8.dir/redux.cpp.o.d"
+  "redux_8"
+  "redux_8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/redux_8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,5 @@
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/reproducible_redux.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/reproducible_redux_3.dir/reproducible_redux.cpp.o"
+  "CMakeFiles/reproducible_redux_3.dir/reproducible_redux.cpp.o.d"
+  "reproducible_redux_3"
+  "reproducible_redux_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reproducible_redux_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
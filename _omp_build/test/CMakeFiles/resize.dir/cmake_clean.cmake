@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/resize.dir/resize.cpp.o"
+  "CMakeFiles/resize.dir/resize.cpp.o.d"
+  "resize"
+  "resize.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/resize.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/schur_complex_1.dir/schur_complex.cpp.o"
+  "CMakeFiles/schur_complex_1.dir/schur_complex.cpp.o.d"
+  "schur_complex_1"
+  "schur_complex_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/schur_complex_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
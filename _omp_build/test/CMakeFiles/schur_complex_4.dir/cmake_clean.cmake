@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/schur_complex_4.dir/schur_complex.cpp.o"
+  "CMakeFiles/schur_complex_4.dir/schur_complex.cpp.o.d"
+  "schur_complex_4"
+  "schur_complex_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/schur_complex_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
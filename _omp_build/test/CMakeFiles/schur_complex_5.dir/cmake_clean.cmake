@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/schur_complex_5.dir/schur_complex.cpp.o"
+  "CMakeFiles/schur_complex_5.dir/schur_complex.cpp.o.d"
+  "schur_complex_5"
+  "schur_complex_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/schur_complex_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
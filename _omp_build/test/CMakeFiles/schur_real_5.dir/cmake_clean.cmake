@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/schur_real_5.dir/schur_real.cpp.o"
+  "CMakeFiles/schur_real_5.dir/schur_real.cpp.o.d"
+  "schur_real_5"
+  "schur_real_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/schur_real_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/selfadjoint_1.dir/selfadjoint.cpp.o"
+  "CMakeFiles/selfadjoint_1.dir/selfadjoint.cpp.o.d"
+  "selfadjoint_1"
+  "selfadjoint_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/selfadjoint_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
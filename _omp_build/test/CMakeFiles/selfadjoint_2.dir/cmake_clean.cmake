@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/selfadjoint_2.dir/selfadjoint.cpp.o"
+  "CMakeFiles/selfadjoint_2.dir/selfadjoint.cpp.o.d"
+  "selfadjoint_2"
+  "selfadjoint_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/selfadjoint_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/selfadjoint_3.dir/selfadjoint.cpp.o"
+  "CMakeFiles/selfadjoint_3.dir/selfadjoint.cpp.o.d"
+  "selfadjoint_3"
+  "selfadjoint_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/selfadjoint_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
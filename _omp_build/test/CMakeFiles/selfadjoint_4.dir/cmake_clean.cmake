@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/selfadjoint_4.dir/selfadjoint.cpp.o"
+  "CMakeFiles/selfadjoint_4.dir/selfadjoint.cpp.o.d"
+  "selfadjoint_4"
+  "selfadjoint_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/selfadjoint_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/selfadjoint_5.dir/selfadjoint.cpp.o"
+  "CMakeFiles/selfadjoint_5.dir/selfadjoint.cpp.o.d"
+  "selfadjoint_5"
+  "selfadjoint_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/selfadjoint_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simplicial_cholesky_1.dir/simplicial_cholesky.cpp.o"
+  "CMakeFiles/simplicial_cholesky_1.dir/simplicial_cholesky.cpp.o.d"
+  "simplicial_cholesky_1"
+  "simplicial_cholesky_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simplicial_cholesky_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
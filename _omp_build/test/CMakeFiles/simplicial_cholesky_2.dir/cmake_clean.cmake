@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simplicial_cholesky_2.dir/simplicial_cholesky.cpp.o"
+  "CMakeFiles/simplicial_cholesky_2.dir/simplicial_cholesky.cpp.o.d"
+  "simplicial_cholesky_2"
+  "simplicial_cholesky_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simplicial_cholesky_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sizeof.dir/sizeof.cpp.o"
+  "CMakeFiles/sizeof.dir/sizeof.cpp.o.d"
+  "sizeof"
+  "sizeof.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sizeof.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sizeoverflow.dir/sizeoverflow.cpp.o"
+  "CMakeFiles/sizeoverflow.dir/sizeoverflow.cpp.o.d"
+  "sizeoverflow"
+  "sizeoverflow.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sizeoverflow.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
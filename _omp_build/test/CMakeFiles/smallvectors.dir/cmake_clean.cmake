@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/smallvectors.dir/smallvectors.cpp.o"
+  "CMakeFiles/smallvectors.dir/smallvectors.cpp.o.d"
+  "smallvectors"
+  "smallvectors.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/smallvectors.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sparse_basic_1.dir/sparse_basic.cpp.o"
+  "CMakeFiles/sparse_basic_1.dir/sparse_basic.cpp.o.d"
+  "sparse_basic_1"
+  "sparse_basic_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sparse_basic_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
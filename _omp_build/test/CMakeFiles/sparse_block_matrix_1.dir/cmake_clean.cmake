@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sparse_block_matrix_1.dir/sparse_block_matrix.cpp.o"
+  "CMakeFiles/sparse_block_matrix_1.dir/sparse_block_matrix.cpp.o.d"
+  "sparse_block_matrix_1"
+  "sparse_block_matrix_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sparse_block_matrix_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
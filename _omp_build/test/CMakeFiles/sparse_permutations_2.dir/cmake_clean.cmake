@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sparse_permutations_2.dir/sparse_permutations.cpp.o"
+  "CMakeFiles/sparse_permutations_2.dir/sparse_permutations.cpp.o.d"
+  "sparse_permutations_2"
+  "sparse_permutations_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sparse_permutations_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sparse_product_4.dir/sparse_product.cpp.o"
+  "CMakeFiles/sparse_product_4.dir/sparse_product.cpp.o.d"
+  "sparse_product_4"
+  "sparse_product_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sparse_product_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sparse_sliced_ell_3.dir/sparse_sliced_ell.cpp.o"
+  "CMakeFiles/sparse_sliced_ell_3.dir/sparse_sliced_ell.cpp.o.d"
+  "sparse_sliced_ell_3"
+  "sparse_sliced_ell_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sparse_sliced_ell_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
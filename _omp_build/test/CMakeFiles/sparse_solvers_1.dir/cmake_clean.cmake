@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sparse_solvers_1.dir/sparse_solvers.cpp.o"
+  "CMakeFiles/sparse_solvers_1.dir/sparse_solvers.cpp.o.d"
+  "sparse_solvers_1"
+  "sparse_solvers_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sparse_solvers_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sparse_vector_1.dir/sparse_vector.cpp.o"
+  "CMakeFiles/sparse_vector_1.dir/sparse_vector.cpp.o.d"
+  "sparse_vector_1"
+  "sparse_vector_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sparse_vector_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
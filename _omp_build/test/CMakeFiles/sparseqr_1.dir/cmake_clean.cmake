@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sparseqr_1.dir/sparseqr.cpp.o"
+  "CMakeFiles/sparseqr_1.dir/sparseqr.cpp.o.d"
+  "sparseqr_1"
+  "sparseqr_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sparseqr_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
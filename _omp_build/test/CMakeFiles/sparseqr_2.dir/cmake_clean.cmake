@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sparseqr_2.dir/sparseqr.cpp.o"
+  "CMakeFiles/sparseqr_2.dir/sparseqr.cpp.o.d"
+  "sparseqr_2"
+  "sparseqr_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sparseqr_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
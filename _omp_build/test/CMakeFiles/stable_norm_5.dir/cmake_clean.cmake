@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stable_norm_5.dir/stable_norm.cpp.o"
+  "CMakeFiles/stable_norm_5.dir/stable_norm.cpp.o.d"
+  "stable_norm_5"
+  "stable_norm_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stable_norm_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
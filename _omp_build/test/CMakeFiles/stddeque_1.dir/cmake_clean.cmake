@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stddeque_1.dir/stddeque.cpp.o"
+  "CMakeFiles/stddeque_1.dir/stddeque.cpp.o.d"
+  "stddeque_1"
+  "stddeque_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stddeque_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stddeque_2.dir/stddeque.cpp.o"
+  "CMakeFiles/stddeque_2.dir/stddeque.cpp.o.d"
+  "stddeque_2"
+  "stddeque_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stddeque_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
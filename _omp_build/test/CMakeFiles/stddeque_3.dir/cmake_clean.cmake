@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stddeque_3.dir/stddeque.cpp.o"
+  "CMakeFiles/stddeque_3.dir/stddeque.cpp.o.d"
+  "stddeque_3"
+  "stddeque_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stddeque_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stddeque_4.dir/stddeque.cpp.o"
+  "CMakeFiles/stddeque_4.dir/stddeque.cpp.o.d"
+  "stddeque_4"
+  "stddeque_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stddeque_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
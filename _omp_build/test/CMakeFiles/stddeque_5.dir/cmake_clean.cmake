@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stddeque_5.dir/stddeque.cpp.o"
+  "CMakeFiles/stddeque_5.dir/stddeque.cpp.o.d"
+  "stddeque_5"
+  "stddeque_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stddeque_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
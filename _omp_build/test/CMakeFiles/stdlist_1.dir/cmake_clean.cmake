@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stdlist_1.dir/stdlist.cpp.o"
+  "CMakeFiles/stdlist_1.dir/stdlist.cpp.o.d"
+  "stdlist_1"
+  "stdlist_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stdlist_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stdlist_2.dir/stdlist.cpp.o"
+  "CMakeFiles/stdlist_2.dir/stdlist.cpp.o.d"
+  "stdlist_2"
+  "stdlist_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stdlist_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stdlist_3.dir/stdlist.cpp.o"
+  "CMakeFiles/stdlist_3.dir/stdlist.cpp.o.d"
+  "stdlist_3"
+  "stdlist_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stdlist_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
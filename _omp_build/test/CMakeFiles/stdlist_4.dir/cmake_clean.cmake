@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stdlist_4.dir/stdlist.cpp.o"
+  "CMakeFiles/stdlist_4.dir/stdlist.cpp.o.d"
+  "stdlist_4"
+  "stdlist_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stdlist_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stdlist_5.dir/stdlist.cpp.o"
+  "CMakeFiles/stdlist_5.dir/stdlist.cpp.o.d"
+  "stdlist_5"
+  "stdlist_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stdlist_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stdvector_1.dir/stdvector.cpp.o"
+  "CMakeFiles/stdvector_1.dir/stdvector.cpp.o.d"
+  "stdvector_1"
+  "stdvector_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stdvector_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
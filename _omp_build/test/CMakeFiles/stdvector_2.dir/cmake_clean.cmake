@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stdvector_2.dir/stdvector.cpp.o"
+  "CMakeFiles/stdvector_2.dir/stdvector.cpp.o.d"
+  "stdvector_2"
+  "stdvector_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stdvector_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stdvector_3.dir/stdvector.cpp.o"
+  "CMakeFiles/stdvector_3.dir/stdvector.cpp.o.d"
+  "stdvector_3"
+  "stdvector_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stdvector_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
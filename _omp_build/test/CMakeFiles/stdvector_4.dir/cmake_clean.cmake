@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stdvector_4.dir/stdvector.cpp.o"
+  "CMakeFiles/stdvector_4.dir/stdvector.cpp.o.d"
+  "stdvector_4"
+  "stdvector_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stdvector_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stdvector_5.dir/stdvector.cpp.o"
+  "CMakeFiles/stdvector_5.dir/stdvector.cpp.o.d"
+  "stdvector_5"
+  "stdvector_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stdvector_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stdvector_overload_3.dir/stdvector_overload.cpp.o"
+  "CMakeFiles/stdvector_overload_3.dir/stdvector_overload.cpp.o.d"
+  "stdvector_overload_3"
+  "stdvector_overload_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stdvector_overload_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/swap_1.dir/swap.cpp.o"
+  "CMakeFiles/swap_1.dir/swap.cpp.o.d"
+  "swap_1"
+  "swap_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/swap_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/swap_2.dir/swap.cpp.o"
+  "CMakeFiles/swap_2.dir/swap.cpp.o.d"
+  "swap_2"
+  "swap_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/swap_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/swap_3.dir/swap.cpp.o"
+  "CMakeFiles/swap_3.dir/swap.cpp.o.d"
+  "swap_3"
+  "swap_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/swap_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
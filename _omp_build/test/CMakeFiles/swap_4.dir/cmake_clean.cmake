@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/swap_4.dir/swap.cpp.o"
+  "CMakeFiles/swap_4.dir/swap.cpp.o.d"
+  "swap_4"
+  "swap_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/swap_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/triangular_1.dir/triangular.cpp.o"
+  "CMakeFiles/triangular_1.dir/triangular.cpp.o.d"
+  "triangular_1"
+  "triangular_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/triangular_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/triangular_2.dir/triangular.cpp.o"
+  "CMakeFiles/triangular_2.dir/triangular.cpp.o.d"
+  "triangular_2"
+  "triangular_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/triangular_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
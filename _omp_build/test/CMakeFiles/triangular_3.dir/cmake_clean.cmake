@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/triangular_3.dir/triangular.cpp.o"
+  "CMakeFiles/triangular_3.dir/triangular.cpp.o.d"
+  "triangular_3"
+  "triangular_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/triangular_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
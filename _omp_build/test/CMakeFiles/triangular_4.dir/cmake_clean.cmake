@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/triangular_4.dir/triangular.cpp.o"
+  "CMakeFiles/triangular_4.dir/triangular.cpp.o.d"
+  "triangular_4"
+  "triangular_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/triangular_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
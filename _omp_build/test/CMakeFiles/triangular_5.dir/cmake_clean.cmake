@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/triangular_5.dir/triangular.cpp.o"
+  "CMakeFiles/triangular_5.dir/triangular.cpp.o.d"
+  "triangular_5"
+  "triangular_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/triangular_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
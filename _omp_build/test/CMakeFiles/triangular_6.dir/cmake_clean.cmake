@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/triangular_6.dir/triangular.cpp.o"
+  "CMakeFiles/triangular_6.dir/triangular.cpp.o.d"
+  "triangular_6"
+  "triangular_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/triangular_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
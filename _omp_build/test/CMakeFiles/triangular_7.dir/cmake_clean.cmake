@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/triangular_7.dir/triangular.cpp.o"
+  "CMakeFiles/triangular_7.dir/triangular.cpp.o.d"
+  "triangular_7"
+  "triangular_7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/triangular_7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/triangular_8.dir/triangular.cpp.o"
+  "CMakeFiles/triangular_8.dir/triangular.cpp.o.d"
+  "triangular_8"
+  "triangular_8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/triangular_8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
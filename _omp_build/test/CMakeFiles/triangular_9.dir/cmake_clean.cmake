@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/triangular_9.dir/triangular.cpp.o"
+  "CMakeFiles/triangular_9.dir/triangular.cpp.o.d"
+  "triangular_9"
+  "triangular_9.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/triangular_9.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/umeyama_1.dir/umeyama.cpp.o"
+  "CMakeFiles/umeyama_1.dir/umeyama.cpp.o.d"
+  "umeyama_1"
+  "umeyama_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/umeyama_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
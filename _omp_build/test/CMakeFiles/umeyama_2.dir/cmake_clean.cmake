@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/umeyama_2.dir/umeyama.cpp.o"
+  "CMakeFiles/umeyama_2.dir/umeyama.cpp.o.d"
+  "umeyama_2"
+  "umeyama_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/umeyama_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
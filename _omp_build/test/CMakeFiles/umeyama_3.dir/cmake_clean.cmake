@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/umeyama_3.dir/umeyama.cpp.o"
+  "CMakeFiles/umeyama_3.dir/umeyama.cpp.o.d"
+  "umeyama_3"
+  "umeyama_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/umeyama_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
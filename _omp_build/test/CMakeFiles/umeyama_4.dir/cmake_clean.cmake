@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/umeyama_4.dir/umeyama.cpp.o"
+  "CMakeFiles/umeyama_4.dir/umeyama.cpp.o.d"
+  "umeyama_4"
+  "umeyama_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/umeyama_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/umeyama_5.dir/umeyama.cpp.o"
+  "CMakeFiles/umeyama_5.dir/umeyama.cpp.o.d"
+  "umeyama_5"
+  "umeyama_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/umeyama_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
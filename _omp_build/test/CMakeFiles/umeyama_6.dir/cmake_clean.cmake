@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/umeyama_6.dir/umeyama.cpp.o"
+  "CMakeFiles/umeyama_6.dir/umeyama.cpp.o.d"
+  "umeyama_6"
+  "umeyama_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/umeyama_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/umeyama_7.dir/umeyama.cpp.o"
+  "CMakeFiles/umeyama_7.dir/umeyama.cpp.o.d"
+  "umeyama_7"
+  "umeyama_7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/umeyama_7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/umeyama_8.dir/umeyama.cpp.o"
+  "CMakeFiles/umeyama_8.dir/umeyama.cpp.o.d"
+  "umeyama_8"
+  "umeyama_8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/umeyama_8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
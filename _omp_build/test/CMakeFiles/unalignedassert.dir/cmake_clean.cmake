@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unalignedassert.dir/unalignedassert.cpp.o"
+  "CMakeFiles/unalignedassert.dir/unalignedassert.cpp.o.d"
+  "unalignedassert"
+  "unalignedassert.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unalignedassert.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
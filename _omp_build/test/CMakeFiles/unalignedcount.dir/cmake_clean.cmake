@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unalignedcount.dir/unalignedcount.cpp.o"
+  "CMakeFiles/unalignedcount.dir/unalignedcount.cpp.o.d"
+  "unalignedcount"
+  "unalignedcount.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unalignedcount.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/upperbidiagonalization_1.dir/upperbidiagonalization.cpp.o"
+  "CMakeFiles/upperbidiagonalization_1.dir/upperbidiagonalization.cpp.o.d"
+  "upperbidiagonalization_1"
+  "upperbidiagonalization_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/upperbidiagonalization_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/upperbidiagonalization_2.dir/upperbidiagonalization.cpp.o"
+  "CMakeFiles/upperbidiagonalization_2.dir/upperbidiagonalization.cpp.o.d"
+  "upperbidiagonalization_2"
+  "upperbidiagonalization_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/upperbidiagonalization_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
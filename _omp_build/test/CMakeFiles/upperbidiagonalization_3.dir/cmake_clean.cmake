@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/upperbidiagonalization_3.dir/upperbidiagonalization.cpp.o"
+  "CMakeFiles/upperbidiagonalization_3.dir/upperbidiagonalization.cpp.o.d"
+  "upperbidiagonalization_3"
+  "upperbidiagonalization_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/upperbidiagonalization_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
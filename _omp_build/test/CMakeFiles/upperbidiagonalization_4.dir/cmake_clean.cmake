@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/upperbidiagonalization_4.dir/upperbidiagonalization.cpp.o"
+  "CMakeFiles/upperbidiagonalization_4.dir/upperbidiagonalization.cpp.o.d"
+  "upperbidiagonalization_4"
+  "upperbidiagonalization_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/upperbidiagonalization_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/upperbidiagonalization_5.dir/upperbidiagonalization.cpp.o"
+  "CMakeFiles/upperbidiagonalization_5.dir/upperbidiagonalization.cpp.o.d"
+  "upperbidiagonalization_5"
+  "upperbidiagonalization_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/upperbidiagonalization_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
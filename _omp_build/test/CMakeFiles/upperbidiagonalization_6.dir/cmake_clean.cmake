@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/upperbidiagonalization_6.dir/upperbidiagonalization.cpp.o"
+  "CMakeFiles/upperbidiagonalization_6.dir/upperbidiagonalization.cpp.o.d"
+  "upperbidiagonalization_6"
+  "upperbidiagonalization_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/upperbidiagonalization_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
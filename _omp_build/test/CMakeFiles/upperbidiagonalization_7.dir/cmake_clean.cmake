@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/upperbidiagonalization_7.dir/upperbidiagonalization.cpp.o"
+  "CMakeFiles/upperbidiagonalization_7.dir/upperbidiagonalization.cpp.o.d"
+  "upperbidiagonalization_7"
+  "upperbidiagonalization_7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/upperbidiagonalization_7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
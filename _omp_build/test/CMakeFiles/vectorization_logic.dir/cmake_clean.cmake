@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vectorization_logic.dir/vectorization_logic.cpp.o"
+  "CMakeFiles/vectorization_logic.dir/vectorization_logic.cpp.o.d"
+  "vectorization_logic"
+  "vectorization_logic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vectorization_logic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vectorwiseop_1.dir/vectorwiseop.cpp.o"
+  "CMakeFiles/vectorwiseop_1.dir/vectorwiseop.cpp.o.d"
+  "vectorwiseop_1"
+  "vectorwiseop_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vectorwiseop_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vectorwiseop_2.dir/vectorwiseop.cpp.o"
+  "CMakeFiles/vectorwiseop_2.dir/vectorwiseop.cpp.o.d"
+  "vectorwiseop_2"
+  "vectorwiseop_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vectorwiseop_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
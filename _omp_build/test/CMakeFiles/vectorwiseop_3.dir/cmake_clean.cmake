@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vectorwiseop_3.dir/vectorwiseop.cpp.o"
+  "CMakeFiles/vectorwiseop_3.dir/vectorwiseop.cpp.o.d"
+  "vectorwiseop_3"
+  "vectorwiseop_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vectorwiseop_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
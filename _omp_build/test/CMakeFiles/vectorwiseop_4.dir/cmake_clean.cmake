@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vectorwiseop_4.dir/vectorwiseop.cpp.o"
+  "CMakeFiles/vectorwiseop_4.dir/vectorwiseop.cpp.o.d"
+  "vectorwiseop_4"
+  "vectorwiseop_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vectorwiseop_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
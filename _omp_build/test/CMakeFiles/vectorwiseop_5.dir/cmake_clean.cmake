@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vectorwiseop_5.dir/vectorwiseop.cpp.o"
+  "CMakeFiles/vectorwiseop_5.dir/vectorwiseop.cpp.o.d"
+  "vectorwiseop_5"
+  "vectorwiseop_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vectorwiseop_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vectorwiseop_6.dir/vectorwiseop.cpp.o"
+  "CMakeFiles/vectorwiseop_6.dir/vectorwiseop.cpp.o.d"
+  "vectorwiseop_6"
+  "vectorwiseop_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vectorwiseop_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vectorwiseop_7.dir/vectorwiseop.cpp.o"
+  "CMakeFiles/vectorwiseop_7.dir/vectorwiseop.cpp.o.d"
+  "vectorwiseop_7"
+  "vectorwiseop_7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vectorwiseop_7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vectorwiseop_8.dir/vectorwiseop.cpp.o"
+  "CMakeFiles/vectorwiseop_8.dir/vectorwiseop.cpp.o.d"
+  "vectorwiseop_8"
+  "vectorwiseop_8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vectorwiseop_8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
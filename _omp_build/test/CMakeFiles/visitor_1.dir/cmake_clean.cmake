@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/visitor_1.dir/visitor.cpp.o"
+  "CMakeFiles/visitor_1.dir/visitor.cpp.o.d"
+  "visitor_1"
+  "visitor_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/visitor_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
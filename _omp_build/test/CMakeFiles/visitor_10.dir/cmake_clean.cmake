@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/visitor_10.dir/visitor.cpp.o"
+  "CMakeFiles/visitor_10.dir/visitor.cpp.o.d"
+  "visitor_10"
+  "visitor_10.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/visitor_10.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
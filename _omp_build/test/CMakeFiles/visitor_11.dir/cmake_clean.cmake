@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/visitor_11.dir/visitor.cpp.o"
+  "CMakeFiles/visitor_11.dir/visitor.cpp.o.d"
+  "visitor_11"
+  "visitor_11.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/visitor_11.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
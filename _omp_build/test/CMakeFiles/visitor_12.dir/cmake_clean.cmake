@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/visitor_12.dir/visitor.cpp.o"
+  "CMakeFiles/visitor_12.dir/visitor.cpp.o.d"
+  "visitor_12"
+  "visitor_12.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/visitor_12.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/visitor_13.dir/visitor.cpp.o"
+  "CMakeFiles/visitor_13.dir/visitor.cpp.o.d"
+  "visitor_13"
+  "visitor_13.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/visitor_13.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/visitor_2.dir/visitor.cpp.o"
+  "CMakeFiles/visitor_2.dir/visitor.cpp.o.d"
+  "visitor_2"
+  "visitor_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/visitor_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
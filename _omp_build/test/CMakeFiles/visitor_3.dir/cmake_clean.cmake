@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/visitor_3.dir/visitor.cpp.o"
+  "CMakeFiles/visitor_3.dir/visitor.cpp.o.d"
+  "visitor_3"
+  "visitor_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/visitor_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/visitor_4.dir/visitor.cpp.o"
+  "CMakeFiles/visitor_4.dir/visitor.cpp.o.d"
+  "visitor_4"
+  "visitor_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/visitor_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
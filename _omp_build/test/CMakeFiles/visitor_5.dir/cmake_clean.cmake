@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/visitor_5.dir/visitor.cpp.o"
+  "CMakeFiles/visitor_5.dir/visitor.cpp.o.d"
+  "visitor_5"
+  "visitor_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/visitor_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/visitor_6.dir/visitor.cpp.o"
+  "CMakeFiles/visitor_6.dir/visitor.cpp.o.d"
+  "visitor_6"
+  "visitor_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/visitor_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/visitor_7.dir/visitor.cpp.o"
+  "CMakeFiles/visitor_7.dir/visitor.cpp.o.d"
+  "visitor_7"
+  "visitor_7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/visitor_7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
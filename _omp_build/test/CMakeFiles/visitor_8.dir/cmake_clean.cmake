@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/visitor_8.dir/visitor.cpp.o"
+  "CMakeFiles/visitor_8.dir/visitor.cpp.o.d"
+  "visitor_8"
+  "visitor_8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/visitor_8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
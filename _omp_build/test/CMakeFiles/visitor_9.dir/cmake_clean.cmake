@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/visitor_9.dir/visitor.cpp.o"
+  "CMakeFiles/visitor_9.dir/visitor.cpp.o.d"
+  "visitor_9"
+  "visitor_9.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/visitor_9.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zerosized.dir/zerosized.cpp.o"
+  "CMakeFiles/zerosized.dir/zerosized.cpp.o.d"
+  "zerosized"
+  "zerosized.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zerosized.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
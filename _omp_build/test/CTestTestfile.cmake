@@ -0,0 +1,1154 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_omp_build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(meta "/root/repo/test/runtest.sh" "meta")
+set_tests_properties(meta PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;145;ei_add_test_internal;/root/repo/test/CMakeLists.txt;71;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sizeof "/root/repo/test/runtest.sh" "sizeof")
+set_tests_properties(sizeof PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;145;ei_add_test_internal;/root/repo/test/CMakeLists.txt;72;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(dynalloc "/root/repo/test/runtest.sh" "dynalloc")
+set_tests_properties(dynalloc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;145;ei_add_test_internal;/root/repo/test/CMakeLists.txt;73;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(nomalloc_1 "/root/repo/test/runtest.sh" "nomalloc_1")
+set_tests_properties(nomalloc_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;74;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(nomalloc_2 "/root/repo/test/runtest.sh" "nomalloc_2")
+set_tests_properties(nomalloc_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;74;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(nomalloc_3 "/root/repo/test/runtest.sh" "nomalloc_3")
+set_tests_properties(nomalloc_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;74;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(nomalloc_4 "/root/repo/test/runtest.sh" "nomalloc_4")
+set_tests_properties(nomalloc_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;74;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(memory_arena_1 "/root/repo/test/runtest.sh" "memory_arena_1")
+set_tests_properties(memory_arena_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;75;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(memory_arena_2 "/root/repo/test/runtest.sh" "memory_arena_2")
+set_tests_properties(memory_arena_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;75;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(memory_arena_3 "/root/repo/test/runtest.sh" "memory_arena_3")
+set_tests_properties(memory_arena_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;75;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_workspace_1 "/root/repo/test/runtest.sh" "product_workspace_1")
+set_tests_properties(product_workspace_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;76;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_workspace_2 "/root/repo/test/runtest.sh" "product_workspace_2")
+set_tests_properties(product_workspace_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;76;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_workspace_3 "/root/repo/test/runtest.sh" "product_workspace_3")
+set_tests_properties(product_workspace_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;76;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_workspace_4 "/root/repo/test/runtest.sh" "product_workspace_4")
+set_tests_properties(product_workspace_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;76;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(parallel_eval_1 "/root/repo/test/runtest.sh" "parallel_eval_1")
+set_tests_properties(parallel_eval_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;77;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(parallel_eval_2 "/root/repo/test/runtest.sh" "parallel_eval_2")
+set_tests_properties(parallel_eval_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;77;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(parallel_eval_3 "/root/repo/test/runtest.sh" "parallel_eval_3")
+set_tests_properties(parallel_eval_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;77;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(parallel_eval_4 "/root/repo/test/runtest.sh" "parallel_eval_4")
+set_tests_properties(parallel_eval_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;77;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(parallel_eval_5 "/root/repo/test/runtest.sh" "parallel_eval_5")
+set_tests_properties(parallel_eval_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;77;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(parallel_eval_6 "/root/repo/test/runtest.sh" "parallel_eval_6")
+set_tests_properties(parallel_eval_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;77;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(parallel_eval_7 "/root/repo/test/runtest.sh" "parallel_eval_7")
+set_tests_properties(parallel_eval_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;77;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(parallel_eval_8 "/root/repo/test/runtest.sh" "parallel_eval_8")
+set_tests_properties(parallel_eval_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;77;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(fused_evaluation_1 "/root/repo/test/runtest.sh" "fused_evaluation_1")
+set_tests_properties(fused_evaluation_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;78;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(fused_evaluation_2 "/root/repo/test/runtest.sh" "fused_evaluation_2")
+set_tests_properties(fused_evaluation_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;78;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(fused_evaluation_3 "/root/repo/test/runtest.sh" "fused_evaluation_3")
+set_tests_properties(fused_evaluation_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;78;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(fused_evaluation_4 "/root/repo/test/runtest.sh" "fused_evaluation_4")
+set_tests_properties(fused_evaluation_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;78;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(fused_evaluation_5 "/root/repo/test/runtest.sh" "fused_evaluation_5")
+set_tests_properties(fused_evaluation_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;78;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(reproducible_redux_4 "/root/repo/test/runtest.sh" "reproducible_redux_4")
+set_tests_properties(reproducible_redux_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;79;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(reproducible_redux_5 "/root/repo/test/runtest.sh" "reproducible_redux_5")
+set_tests_properties(reproducible_redux_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;79;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(reproducible_redux_1 "/root/repo/test/runtest.sh" "reproducible_redux_1")
+set_tests_properties(reproducible_redux_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;79;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(reproducible_redux_2 "/root/repo/test/runtest.sh" "reproducible_redux_2")
+set_tests_properties(reproducible_redux_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;79;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(reproducible_redux_3 "/root/repo/test/runtest.sh" "reproducible_redux_3")
+set_tests_properties(reproducible_redux_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;79;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(first_aligned "/root/repo/test/runtest.sh" "first_aligned")
+set_tests_properties(first_aligned PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;145;ei_add_test_internal;/root/repo/test/CMakeLists.txt;80;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(mixingtypes_1 "/root/repo/test/runtest.sh" "mixingtypes_1")
+set_tests_properties(mixingtypes_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;81;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(mixingtypes_2 "/root/repo/test/runtest.sh" "mixingtypes_2")
+set_tests_properties(mixingtypes_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;81;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(mixingtypes_3 "/root/repo/test/runtest.sh" "mixingtypes_3")
+set_tests_properties(mixingtypes_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;81;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(packetmath_1 "/root/repo/test/runtest.sh" "packetmath_1")
+set_tests_properties(packetmath_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;82;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(packetmath_2 "/root/repo/test/runtest.sh" "packetmath_2")
+set_tests_properties(packetmath_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;82;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(packetmath_3 "/root/repo/test/runtest.sh" "packetmath_3")
+set_tests_properties(packetmath_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;82;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(unalignedassert "/root/repo/test/runtest.sh" "unalignedassert")
+set_tests_properties(unalignedassert PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;145;ei_add_test_internal;/root/repo/test/CMakeLists.txt;83;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(vectorization_logic "/root/repo/test/runtest.sh" "vectorization_logic")
+set_tests_properties(vectorization_logic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;145;ei_add_test_internal;/root/repo/test/CMakeLists.txt;84;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(basicstuff_2 "/root/repo/test/runtest.sh" "basicstuff_2")
+set_tests_properties(basicstuff_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;85;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(basicstuff_1 "/root/repo/test/runtest.sh" "basicstuff_1")
+set_tests_properties(basicstuff_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;85;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(basicstuff_3 "/root/repo/test/runtest.sh" "basicstuff_3")
+set_tests_properties(basicstuff_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;85;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(basicstuff_4 "/root/repo/test/runtest.sh" "basicstuff_4")
+set_tests_properties(basicstuff_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;85;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(basicstuff_5 "/root/repo/test/runtest.sh" "basicstuff_5")
+set_tests_properties(basicstuff_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;85;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(basicstuff_6 "/root/repo/test/runtest.sh" "basicstuff_6")
+set_tests_properties(basicstuff_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;85;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(basicstuff_7 "/root/repo/test/runtest.sh" "basicstuff_7")
+set_tests_properties(basicstuff_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;85;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(linearstructure_1 "/root/repo/test/runtest.sh" "linearstructure_1")
+set_tests_properties(linearstructure_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;86;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(linearstructure_2 "/root/repo/test/runtest.sh" "linearstructure_2")
+set_tests_properties(linearstructure_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;86;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(linearstructure_3 "/root/repo/test/runtest.sh" "linearstructure_3")
+set_tests_properties(linearstructure_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;86;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(linearstructure_4 "/root/repo/test/runtest.sh" "linearstructure_4")
+set_tests_properties(linearstructure_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;86;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(linearstructure_5 "/root/repo/test/runtest.sh" "linearstructure_5")
+set_tests_properties(linearstructure_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;86;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(linearstructure_6 "/root/repo/test/runtest.sh" "linearstructure_6")
+set_tests_properties(linearstructure_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;86;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(linearstructure_7 "/root/repo/test/runtest.sh" "linearstructure_7")
+set_tests_properties(linearstructure_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;86;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(linearstructure_8 "/root/repo/test/runtest.sh" "linearstructure_8")
+set_tests_properties(linearstructure_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;86;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(linearstructure_9 "/root/repo/test/runtest.sh" "linearstructure_9")
+set_tests_properties(linearstructure_9 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;86;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(integer_types_1 "/root/repo/test/runtest.sh" "integer_types_1")
+set_tests_properties(integer_types_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;87;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(integer_types_2 "/root/repo/test/runtest.sh" "integer_types_2")
+set_tests_properties(integer_types_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;87;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(integer_types_3 "/root/repo/test/runtest.sh" "integer_types_3")
+set_tests_properties(integer_types_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;87;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(integer_types_4 "/root/repo/test/runtest.sh" "integer_types_4")
+set_tests_properties(integer_types_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;87;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(integer_types_5 "/root/repo/test/runtest.sh" "integer_types_5")
+set_tests_properties(integer_types_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;87;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(integer_types_6 "/root/repo/test/runtest.sh" "integer_types_6")
+set_tests_properties(integer_types_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;87;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(integer_types_7 "/root/repo/test/runtest.sh" "integer_types_7")
+set_tests_properties(integer_types_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;87;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(integer_types_8 "/root/repo/test/runtest.sh" "integer_types_8")
+set_tests_properties(integer_types_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;87;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(cwiseop_1 "/root/repo/test/runtest.sh" "cwiseop_1")
+set_tests_properties(cwiseop_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;88;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(cwiseop_2 "/root/repo/test/runtest.sh" "cwiseop_2")
+set_tests_properties(cwiseop_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;88;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(cwiseop_3 "/root/repo/test/runtest.sh" "cwiseop_3")
+set_tests_properties(cwiseop_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;88;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(cwiseop_4 "/root/repo/test/runtest.sh" "cwiseop_4")
+set_tests_properties(cwiseop_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;88;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(cwiseop_5 "/root/repo/test/runtest.sh" "cwiseop_5")
+set_tests_properties(cwiseop_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;88;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(cwiseop_6 "/root/repo/test/runtest.sh" "cwiseop_6")
+set_tests_properties(cwiseop_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;88;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(unalignedcount "/root/repo/test/runtest.sh" "unalignedcount")
+set_tests_properties(unalignedcount PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;145;ei_add_test_internal;/root/repo/test/CMakeLists.txt;89;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(exceptions "/root/repo/test/runtest.sh" "exceptions")
+set_tests_properties(exceptions PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;145;ei_add_test_internal;/root/repo/test/CMakeLists.txt;90;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(redux_1 "/root/repo/test/runtest.sh" "redux_1")
+set_tests_properties(redux_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;91;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(redux_2 "/root/repo/test/runtest.sh" "redux_2")
+set_tests_properties(redux_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;91;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(redux_3 "/root/repo/test/runtest.sh" "redux_3")
+set_tests_properties(redux_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;91;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(redux_4 "/root/repo/test/runtest.sh" "redux_4")
+set_tests_properties(redux_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;91;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(redux_5 "/root/repo/test/runtest.sh" "redux_5")
+set_tests_properties(redux_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;91;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(redux_6 "/root/repo/test/runtest.sh" "redux_6")
+set_tests_properties(redux_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;91;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(redux_7 "/root/repo/test/runtest.sh" "redux_7")
+set_tests_properties(redux_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;91;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(redux_8 "/root/repo/test/runtest.sh" "redux_8")
+set_tests_properties(redux_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;91;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(visitor_1 "/root/repo/test/runtest.sh" "visitor_1")
+set_tests_properties(visitor_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;92;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(visitor_2 "/root/repo/test/runtest.sh" "visitor_2")
+set_tests_properties(visitor_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;92;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(visitor_3 "/root/repo/test/runtest.sh" "visitor_3")
+set_tests_properties(visitor_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;92;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(visitor_4 "/root/repo/test/runtest.sh" "visitor_4")
+set_tests_properties(visitor_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;92;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(visitor_5 "/root/repo/test/runtest.sh" "visitor_5")
+set_tests_properties(visitor_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;92;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(visitor_6 "/root/repo/test/runtest.sh" "visitor_6")
+set_tests_properties(visitor_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;92;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(visitor_7 "/root/repo/test/runtest.sh" "visitor_7")
+set_tests_properties(visitor_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;92;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(visitor_8 "/root/repo/test/runtest.sh" "visitor_8")
+set_tests_properties(visitor_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;92;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(visitor_9 "/root/repo/test/runtest.sh" "visitor_9")
+set_tests_properties(visitor_9 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;92;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(visitor_10 "/root/repo/test/runtest.sh" "visitor_10")
+set_tests_properties(visitor_10 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;92;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(visitor_11 "/root/repo/test/runtest.sh" "visitor_11")
+set_tests_properties(visitor_11 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;92;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(visitor_12 "/root/repo/test/runtest.sh" "visitor_12")
+set_tests_properties(visitor_12 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;92;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(visitor_13 "/root/repo/test/runtest.sh" "visitor_13")
+set_tests_properties(visitor_13 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;92;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(block_1 "/root/repo/test/runtest.sh" "block_1")
+set_tests_properties(block_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;93;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(block_2 "/root/repo/test/runtest.sh" "block_2")
+set_tests_properties(block_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;93;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(block_3 "/root/repo/test/runtest.sh" "block_3")
+set_tests_properties(block_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;93;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(block_4 "/root/repo/test/runtest.sh" "block_4")
+set_tests_properties(block_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;93;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(block_5 "/root/repo/test/runtest.sh" "block_5")
+set_tests_properties(block_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;93;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(block_6 "/root/repo/test/runtest.sh" "block_6")
+set_tests_properties(block_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;93;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(block_8 "/root/repo/test/runtest.sh" "block_8")
+set_tests_properties(block_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;93;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(block_7 "/root/repo/test/runtest.sh" "block_7")
+set_tests_properties(block_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;93;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(corners_1 "/root/repo/test/runtest.sh" "corners_1")
+set_tests_properties(corners_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;94;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(corners_2 "/root/repo/test/runtest.sh" "corners_2")
+set_tests_properties(corners_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;94;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(corners_3 "/root/repo/test/runtest.sh" "corners_3")
+set_tests_properties(corners_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;94;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(corners_4 "/root/repo/test/runtest.sh" "corners_4")
+set_tests_properties(corners_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;94;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(corners_5 "/root/repo/test/runtest.sh" "corners_5")
+set_tests_properties(corners_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;94;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_small_1 "/root/repo/test/runtest.sh" "product_small_1")
+set_tests_properties(product_small_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;95;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_small_2 "/root/repo/test/runtest.sh" "product_small_2")
+set_tests_properties(product_small_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;95;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_small_3 "/root/repo/test/runtest.sh" "product_small_3")
+set_tests_properties(product_small_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;95;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_small_4 "/root/repo/test/runtest.sh" "product_small_4")
+set_tests_properties(product_small_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;95;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_small_5 "/root/repo/test/runtest.sh" "product_small_5")
+set_tests_properties(product_small_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;95;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_small_6 "/root/repo/test/runtest.sh" "product_small_6")
+set_tests_properties(product_small_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;95;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_large_1 "/root/repo/test/runtest.sh" "product_large_1")
+set_tests_properties(product_large_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;96;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_large_2 "/root/repo/test/runtest.sh" "product_large_2")
+set_tests_properties(product_large_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;96;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_large_3 "/root/repo/test/runtest.sh" "product_large_3")
+set_tests_properties(product_large_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;96;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_large_4 "/root/repo/test/runtest.sh" "product_large_4")
+set_tests_properties(product_large_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;96;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_large_5 "/root/repo/test/runtest.sh" "product_large_5")
+set_tests_properties(product_large_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;96;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_large_6 "/root/repo/test/runtest.sh" "product_large_6")
+set_tests_properties(product_large_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;96;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_extra_1 "/root/repo/test/runtest.sh" "product_extra_1")
+set_tests_properties(product_extra_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;97;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_extra_2 "/root/repo/test/runtest.sh" "product_extra_2")
+set_tests_properties(product_extra_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;97;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_extra_3 "/root/repo/test/runtest.sh" "product_extra_3")
+set_tests_properties(product_extra_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;97;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_extra_4 "/root/repo/test/runtest.sh" "product_extra_4")
+set_tests_properties(product_extra_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;97;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_extra_5 "/root/repo/test/runtest.sh" "product_extra_5")
+set_tests_properties(product_extra_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;97;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(diagonalmatrices_1 "/root/repo/test/runtest.sh" "diagonalmatrices_1")
+set_tests_properties(diagonalmatrices_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;98;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(diagonalmatrices_2 "/root/repo/test/runtest.sh" "diagonalmatrices_2")
+set_tests_properties(diagonalmatrices_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;98;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(diagonalmatrices_3 "/root/repo/test/runtest.sh" "diagonalmatrices_3")
+set_tests_properties(diagonalmatrices_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;98;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(diagonalmatrices_4 "/root/repo/test/runtest.sh" "diagonalmatrices_4")
+set_tests_properties(diagonalmatrices_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;98;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(diagonalmatrices_5 "/root/repo/test/runtest.sh" "diagonalmatrices_5")
+set_tests_properties(diagonalmatrices_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;98;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(diagonalmatrices_6 "/root/repo/test/runtest.sh" "diagonalmatrices_6")
+set_tests_properties(diagonalmatrices_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;98;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(diagonalmatrices_7 "/root/repo/test/runtest.sh" "diagonalmatrices_7")
+set_tests_properties(diagonalmatrices_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;98;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(diagonalmatrices_8 "/root/repo/test/runtest.sh" "diagonalmatrices_8")
+set_tests_properties(diagonalmatrices_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;98;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(diagonalmatrices_9 "/root/repo/test/runtest.sh" "diagonalmatrices_9")
+set_tests_properties(diagonalmatrices_9 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;98;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(adjoint_1 "/root/repo/test/runtest.sh" "adjoint_1")
+set_tests_properties(adjoint_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;99;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(adjoint_2 "/root/repo/test/runtest.sh" "adjoint_2")
+set_tests_properties(adjoint_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;99;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(adjoint_3 "/root/repo/test/runtest.sh" "adjoint_3")
+set_tests_properties(adjoint_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;99;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(adjoint_4 "/root/repo/test/runtest.sh" "adjoint_4")
+set_tests_properties(adjoint_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;99;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(adjoint_5 "/root/repo/test/runtest.sh" "adjoint_5")
+set_tests_properties(adjoint_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;99;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(adjoint_6 "/root/repo/test/runtest.sh" "adjoint_6")
+set_tests_properties(adjoint_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;99;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(adjoint_7 "/root/repo/test/runtest.sh" "adjoint_7")
+set_tests_properties(adjoint_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;99;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(adjoint_8 "/root/repo/test/runtest.sh" "adjoint_8")
+set_tests_properties(adjoint_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;99;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(adjoint_9 "/root/repo/test/runtest.sh" "adjoint_9")
+set_tests_properties(adjoint_9 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;99;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(adjoint_10 "/root/repo/test/runtest.sh" "adjoint_10")
+set_tests_properties(adjoint_10 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;99;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(diagonal_1 "/root/repo/test/runtest.sh" "diagonal_1")
+set_tests_properties(diagonal_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;100;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(diagonal_2 "/root/repo/test/runtest.sh" "diagonal_2")
+set_tests_properties(diagonal_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;100;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(miscmatrices_1 "/root/repo/test/runtest.sh" "miscmatrices_1")
+set_tests_properties(miscmatrices_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;101;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(miscmatrices_2 "/root/repo/test/runtest.sh" "miscmatrices_2")
+set_tests_properties(miscmatrices_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;101;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(miscmatrices_3 "/root/repo/test/runtest.sh" "miscmatrices_3")
+set_tests_properties(miscmatrices_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;101;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(miscmatrices_4 "/root/repo/test/runtest.sh" "miscmatrices_4")
+set_tests_properties(miscmatrices_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;101;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(miscmatrices_5 "/root/repo/test/runtest.sh" "miscmatrices_5")
+set_tests_properties(miscmatrices_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;101;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(commainitializer "/root/repo/test/runtest.sh" "commainitializer")
+set_tests_properties(commainitializer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;145;ei_add_test_internal;/root/repo/test/CMakeLists.txt;102;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(smallvectors "/root/repo/test/runtest.sh" "smallvectors")
+set_tests_properties(smallvectors PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;145;ei_add_test_internal;/root/repo/test/CMakeLists.txt;103;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(map_1 "/root/repo/test/runtest.sh" "map_1")
+set_tests_properties(map_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;104;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(map_2 "/root/repo/test/runtest.sh" "map_2")
+set_tests_properties(map_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;104;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(map_3 "/root/repo/test/runtest.sh" "map_3")
+set_tests_properties(map_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;104;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(map_4 "/root/repo/test/runtest.sh" "map_4")
+set_tests_properties(map_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;104;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(map_5 "/root/repo/test/runtest.sh" "map_5")
+set_tests_properties(map_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;104;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(map_11 "/root/repo/test/runtest.sh" "map_11")
+set_tests_properties(map_11 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;104;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(map_6 "/root/repo/test/runtest.sh" "map_6")
+set_tests_properties(map_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;104;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(map_7 "/root/repo/test/runtest.sh" "map_7")
+set_tests_properties(map_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;104;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(map_8 "/root/repo/test/runtest.sh" "map_8")
+set_tests_properties(map_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;104;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(map_9 "/root/repo/test/runtest.sh" "map_9")
+set_tests_properties(map_9 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;104;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(map_10 "/root/repo/test/runtest.sh" "map_10")
+set_tests_properties(map_10 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;104;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(mapstride_1 "/root/repo/test/runtest.sh" "mapstride_1")
+set_tests_properties(mapstride_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;105;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(mapstride_2 "/root/repo/test/runtest.sh" "mapstride_2")
+set_tests_properties(mapstride_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;105;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(mapstride_3 "/root/repo/test/runtest.sh" "mapstride_3")
+set_tests_properties(mapstride_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;105;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(mapstride_4 "/root/repo/test/runtest.sh" "mapstride_4")
+set_tests_properties(mapstride_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;105;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(mapstride_5 "/root/repo/test/runtest.sh" "mapstride_5")
+set_tests_properties(mapstride_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;105;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(mapstride_6 "/root/repo/test/runtest.sh" "mapstride_6")
+set_tests_properties(mapstride_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;105;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(mapstaticmethods_1 "/root/repo/test/runtest.sh" "mapstaticmethods_1")
+set_tests_properties(mapstaticmethods_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;106;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(mapstaticmethods_2 "/root/repo/test/runtest.sh" "mapstaticmethods_2")
+set_tests_properties(mapstaticmethods_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;106;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(mapstaticmethods_3 "/root/repo/test/runtest.sh" "mapstaticmethods_3")
+set_tests_properties(mapstaticmethods_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;106;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(mapstaticmethods_4 "/root/repo/test/runtest.sh" "mapstaticmethods_4")
+set_tests_properties(mapstaticmethods_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;106;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(mapstaticmethods_5 "/root/repo/test/runtest.sh" "mapstaticmethods_5")
+set_tests_properties(mapstaticmethods_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;106;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(mapstaticmethods_6 "/root/repo/test/runtest.sh" "mapstaticmethods_6")
+set_tests_properties(mapstaticmethods_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;106;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(mapstaticmethods_7 "/root/repo/test/runtest.sh" "mapstaticmethods_7")
+set_tests_properties(mapstaticmethods_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;106;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(mapstaticmethods_8 "/root/repo/test/runtest.sh" "mapstaticmethods_8")
+set_tests_properties(mapstaticmethods_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;106;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_1 "/root/repo/test/runtest.sh" "array_1")
+set_tests_properties(array_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;107;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_2 "/root/repo/test/runtest.sh" "array_2")
+set_tests_properties(array_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;107;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_3 "/root/repo/test/runtest.sh" "array_3")
+set_tests_properties(array_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;107;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_4 "/root/repo/test/runtest.sh" "array_4")
+set_tests_properties(array_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;107;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_5 "/root/repo/test/runtest.sh" "array_5")
+set_tests_properties(array_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;107;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_6 "/root/repo/test/runtest.sh" "array_6")
+set_tests_properties(array_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;107;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_for_matrix_1 "/root/repo/test/runtest.sh" "array_for_matrix_1")
+set_tests_properties(array_for_matrix_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;108;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_for_matrix_2 "/root/repo/test/runtest.sh" "array_for_matrix_2")
+set_tests_properties(array_for_matrix_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;108;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_for_matrix_3 "/root/repo/test/runtest.sh" "array_for_matrix_3")
+set_tests_properties(array_for_matrix_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;108;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_for_matrix_4 "/root/repo/test/runtest.sh" "array_for_matrix_4")
+set_tests_properties(array_for_matrix_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;108;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_for_matrix_5 "/root/repo/test/runtest.sh" "array_for_matrix_5")
+set_tests_properties(array_for_matrix_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;108;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_for_matrix_6 "/root/repo/test/runtest.sh" "array_for_matrix_6")
+set_tests_properties(array_for_matrix_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;108;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_for_matrix_7 "/root/repo/test/runtest.sh" "array_for_matrix_7")
+set_tests_properties(array_for_matrix_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;108;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_for_matrix_8 "/root/repo/test/runtest.sh" "array_for_matrix_8")
+set_tests_properties(array_for_matrix_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;108;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_replicate_1 "/root/repo/test/runtest.sh" "array_replicate_1")
+set_tests_properties(array_replicate_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;109;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_replicate_2 "/root/repo/test/runtest.sh" "array_replicate_2")
+set_tests_properties(array_replicate_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;109;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_replicate_3 "/root/repo/test/runtest.sh" "array_replicate_3")
+set_tests_properties(array_replicate_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;109;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_replicate_4 "/root/repo/test/runtest.sh" "array_replicate_4")
+set_tests_properties(array_replicate_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;109;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_replicate_5 "/root/repo/test/runtest.sh" "array_replicate_5")
+set_tests_properties(array_replicate_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;109;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_replicate_6 "/root/repo/test/runtest.sh" "array_replicate_6")
+set_tests_properties(array_replicate_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;109;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_reverse_1 "/root/repo/test/runtest.sh" "array_reverse_1")
+set_tests_properties(array_reverse_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;110;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_reverse_2 "/root/repo/test/runtest.sh" "array_reverse_2")
+set_tests_properties(array_reverse_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;110;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_reverse_3 "/root/repo/test/runtest.sh" "array_reverse_3")
+set_tests_properties(array_reverse_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;110;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_reverse_4 "/root/repo/test/runtest.sh" "array_reverse_4")
+set_tests_properties(array_reverse_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;110;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_reverse_5 "/root/repo/test/runtest.sh" "array_reverse_5")
+set_tests_properties(array_reverse_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;110;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_reverse_6 "/root/repo/test/runtest.sh" "array_reverse_6")
+set_tests_properties(array_reverse_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;110;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_reverse_7 "/root/repo/test/runtest.sh" "array_reverse_7")
+set_tests_properties(array_reverse_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;110;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_reverse_8 "/root/repo/test/runtest.sh" "array_reverse_8")
+set_tests_properties(array_reverse_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;110;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(array_reverse_9 "/root/repo/test/runtest.sh" "array_reverse_9")
+set_tests_properties(array_reverse_9 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;110;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(triangular_1 "/root/repo/test/runtest.sh" "triangular_1")
+set_tests_properties(triangular_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;111;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(triangular_2 "/root/repo/test/runtest.sh" "triangular_2")
+set_tests_properties(triangular_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;111;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(triangular_3 "/root/repo/test/runtest.sh" "triangular_3")
+set_tests_properties(triangular_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;111;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(triangular_4 "/root/repo/test/runtest.sh" "triangular_4")
+set_tests_properties(triangular_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;111;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(triangular_5 "/root/repo/test/runtest.sh" "triangular_5")
+set_tests_properties(triangular_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;111;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(triangular_6 "/root/repo/test/runtest.sh" "triangular_6")
+set_tests_properties(triangular_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;111;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(triangular_7 "/root/repo/test/runtest.sh" "triangular_7")
+set_tests_properties(triangular_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;111;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(triangular_8 "/root/repo/test/runtest.sh" "triangular_8")
+set_tests_properties(triangular_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;111;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(triangular_9 "/root/repo/test/runtest.sh" "triangular_9")
+set_tests_properties(triangular_9 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;111;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(selfadjoint_1 "/root/repo/test/runtest.sh" "selfadjoint_1")
+set_tests_properties(selfadjoint_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;112;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(selfadjoint_2 "/root/repo/test/runtest.sh" "selfadjoint_2")
+set_tests_properties(selfadjoint_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;112;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(selfadjoint_3 "/root/repo/test/runtest.sh" "selfadjoint_3")
+set_tests_properties(selfadjoint_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;112;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(selfadjoint_4 "/root/repo/test/runtest.sh" "selfadjoint_4")
+set_tests_properties(selfadjoint_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;112;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(selfadjoint_5 "/root/repo/test/runtest.sh" "selfadjoint_5")
+set_tests_properties(selfadjoint_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;112;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_selfadjoint_1 "/root/repo/test/runtest.sh" "product_selfadjoint_1")
+set_tests_properties(product_selfadjoint_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;113;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_selfadjoint_2 "/root/repo/test/runtest.sh" "product_selfadjoint_2")
+set_tests_properties(product_selfadjoint_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;113;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_selfadjoint_3 "/root/repo/test/runtest.sh" "product_selfadjoint_3")
+set_tests_properties(product_selfadjoint_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;113;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_selfadjoint_4 "/root/repo/test/runtest.sh" "product_selfadjoint_4")
+set_tests_properties(product_selfadjoint_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;113;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_selfadjoint_5 "/root/repo/test/runtest.sh" "product_selfadjoint_5")
+set_tests_properties(product_selfadjoint_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;113;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_selfadjoint_6 "/root/repo/test/runtest.sh" "product_selfadjoint_6")
+set_tests_properties(product_selfadjoint_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;113;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_selfadjoint_7 "/root/repo/test/runtest.sh" "product_selfadjoint_7")
+set_tests_properties(product_selfadjoint_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;113;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_symm_1 "/root/repo/test/runtest.sh" "product_symm_1")
+set_tests_properties(product_symm_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;114;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_symm_2 "/root/repo/test/runtest.sh" "product_symm_2")
+set_tests_properties(product_symm_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;114;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_symm_3 "/root/repo/test/runtest.sh" "product_symm_3")
+set_tests_properties(product_symm_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;114;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_symm_4 "/root/repo/test/runtest.sh" "product_symm_4")
+set_tests_properties(product_symm_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;114;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_symm_5 "/root/repo/test/runtest.sh" "product_symm_5")
+set_tests_properties(product_symm_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;114;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_symm_6 "/root/repo/test/runtest.sh" "product_symm_6")
+set_tests_properties(product_symm_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;114;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_symm_7 "/root/repo/test/runtest.sh" "product_symm_7")
+set_tests_properties(product_symm_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;114;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_symm_8 "/root/repo/test/runtest.sh" "product_symm_8")
+set_tests_properties(product_symm_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;114;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_syrk_1 "/root/repo/test/runtest.sh" "product_syrk_1")
+set_tests_properties(product_syrk_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;115;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_syrk_2 "/root/repo/test/runtest.sh" "product_syrk_2")
+set_tests_properties(product_syrk_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;115;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_syrk_3 "/root/repo/test/runtest.sh" "product_syrk_3")
+set_tests_properties(product_syrk_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;115;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_syrk_4 "/root/repo/test/runtest.sh" "product_syrk_4")
+set_tests_properties(product_syrk_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;115;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmv_1 "/root/repo/test/runtest.sh" "product_trmv_1")
+set_tests_properties(product_trmv_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;116;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmv_2 "/root/repo/test/runtest.sh" "product_trmv_2")
+set_tests_properties(product_trmv_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;116;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmv_3 "/root/repo/test/runtest.sh" "product_trmv_3")
+set_tests_properties(product_trmv_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;116;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmv_4 "/root/repo/test/runtest.sh" "product_trmv_4")
+set_tests_properties(product_trmv_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;116;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmv_5 "/root/repo/test/runtest.sh" "product_trmv_5")
+set_tests_properties(product_trmv_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;116;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmv_6 "/root/repo/test/runtest.sh" "product_trmv_6")
+set_tests_properties(product_trmv_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;116;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmm_1 "/root/repo/test/runtest.sh" "product_trmm_1")
+set_tests_properties(product_trmm_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;117;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmm_11 "/root/repo/test/runtest.sh" "product_trmm_11")
+set_tests_properties(product_trmm_11 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;117;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmm_111 "/root/repo/test/runtest.sh" "product_trmm_111")
+set_tests_properties(product_trmm_111 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;117;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmm_21 "/root/repo/test/runtest.sh" "product_trmm_21")
+set_tests_properties(product_trmm_21 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;117;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmm_121 "/root/repo/test/runtest.sh" "product_trmm_121")
+set_tests_properties(product_trmm_121 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;117;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmm_31 "/root/repo/test/runtest.sh" "product_trmm_31")
+set_tests_properties(product_trmm_31 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;117;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmm_131 "/root/repo/test/runtest.sh" "product_trmm_131")
+set_tests_properties(product_trmm_131 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;117;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmm_12 "/root/repo/test/runtest.sh" "product_trmm_12")
+set_tests_properties(product_trmm_12 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;117;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmm_112 "/root/repo/test/runtest.sh" "product_trmm_112")
+set_tests_properties(product_trmm_112 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;117;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmm_22 "/root/repo/test/runtest.sh" "product_trmm_22")
+set_tests_properties(product_trmm_22 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;117;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmm_122 "/root/repo/test/runtest.sh" "product_trmm_122")
+set_tests_properties(product_trmm_122 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;117;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmm_32 "/root/repo/test/runtest.sh" "product_trmm_32")
+set_tests_properties(product_trmm_32 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;117;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmm_132 "/root/repo/test/runtest.sh" "product_trmm_132")
+set_tests_properties(product_trmm_132 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;117;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmm_13 "/root/repo/test/runtest.sh" "product_trmm_13")
+set_tests_properties(product_trmm_13 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;117;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmm_113 "/root/repo/test/runtest.sh" "product_trmm_113")
+set_tests_properties(product_trmm_113 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;117;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmm_23 "/root/repo/test/runtest.sh" "product_trmm_23")
+set_tests_properties(product_trmm_23 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;117;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmm_123 "/root/repo/test/runtest.sh" "product_trmm_123")
+set_tests_properties(product_trmm_123 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;117;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmm_33 "/root/repo/test/runtest.sh" "product_trmm_33")
+set_tests_properties(product_trmm_33 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;117;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmm_133 "/root/repo/test/runtest.sh" "product_trmm_133")
+set_tests_properties(product_trmm_133 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;117;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmm_14 "/root/repo/test/runtest.sh" "product_trmm_14")
+set_tests_properties(product_trmm_14 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;117;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmm_114 "/root/repo/test/runtest.sh" "product_trmm_114")
+set_tests_properties(product_trmm_114 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;117;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmm_24 "/root/repo/test/runtest.sh" "product_trmm_24")
+set_tests_properties(product_trmm_24 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;117;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmm_124 "/root/repo/test/runtest.sh" "product_trmm_124")
+set_tests_properties(product_trmm_124 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;117;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmm_34 "/root/repo/test/runtest.sh" "product_trmm_34")
+set_tests_properties(product_trmm_34 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;117;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trmm_134 "/root/repo/test/runtest.sh" "product_trmm_134")
+set_tests_properties(product_trmm_134 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;117;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trsolve_1 "/root/repo/test/runtest.sh" "product_trsolve_1")
+set_tests_properties(product_trsolve_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;118;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trsolve_2 "/root/repo/test/runtest.sh" "product_trsolve_2")
+set_tests_properties(product_trsolve_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;118;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trsolve_3 "/root/repo/test/runtest.sh" "product_trsolve_3")
+set_tests_properties(product_trsolve_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;118;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trsolve_4 "/root/repo/test/runtest.sh" "product_trsolve_4")
+set_tests_properties(product_trsolve_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;118;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trsolve_5 "/root/repo/test/runtest.sh" "product_trsolve_5")
+set_tests_properties(product_trsolve_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;118;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trsolve_6 "/root/repo/test/runtest.sh" "product_trsolve_6")
+set_tests_properties(product_trsolve_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;118;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trsolve_7 "/root/repo/test/runtest.sh" "product_trsolve_7")
+set_tests_properties(product_trsolve_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;118;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_trsolve_8 "/root/repo/test/runtest.sh" "product_trsolve_8")
+set_tests_properties(product_trsolve_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;118;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_mmtr_1 "/root/repo/test/runtest.sh" "product_mmtr_1")
+set_tests_properties(product_mmtr_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;119;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_mmtr_2 "/root/repo/test/runtest.sh" "product_mmtr_2")
+set_tests_properties(product_mmtr_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;119;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_mmtr_3 "/root/repo/test/runtest.sh" "product_mmtr_3")
+set_tests_properties(product_mmtr_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;119;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_mmtr_4 "/root/repo/test/runtest.sh" "product_mmtr_4")
+set_tests_properties(product_mmtr_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;119;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_notemporary_1 "/root/repo/test/runtest.sh" "product_notemporary_1")
+set_tests_properties(product_notemporary_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;120;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_notemporary_2 "/root/repo/test/runtest.sh" "product_notemporary_2")
+set_tests_properties(product_notemporary_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;120;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_notemporary_3 "/root/repo/test/runtest.sh" "product_notemporary_3")
+set_tests_properties(product_notemporary_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;120;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(product_notemporary_4 "/root/repo/test/runtest.sh" "product_notemporary_4")
+set_tests_properties(product_notemporary_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;120;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stable_norm_1 "/root/repo/test/runtest.sh" "stable_norm_1")
+set_tests_properties(stable_norm_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;121;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stable_norm_2 "/root/repo/test/runtest.sh" "stable_norm_2")
+set_tests_properties(stable_norm_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;121;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stable_norm_3 "/root/repo/test/runtest.sh" "stable_norm_3")
+set_tests_properties(stable_norm_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;121;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stable_norm_4 "/root/repo/test/runtest.sh" "stable_norm_4")
+set_tests_properties(stable_norm_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;121;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stable_norm_5 "/root/repo/test/runtest.sh" "stable_norm_5")
+set_tests_properties(stable_norm_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;121;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(bandmatrix "/root/repo/test/runtest.sh" "bandmatrix")
+set_tests_properties(bandmatrix PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;145;ei_add_test_internal;/root/repo/test/CMakeLists.txt;122;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(cholesky_1 "/root/repo/test/runtest.sh" "cholesky_1")
+set_tests_properties(cholesky_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;123;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(cholesky_3 "/root/repo/test/runtest.sh" "cholesky_3")
+set_tests_properties(cholesky_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;123;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(cholesky_4 "/root/repo/test/runtest.sh" "cholesky_4")
+set_tests_properties(cholesky_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;123;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(cholesky_5 "/root/repo/test/runtest.sh" "cholesky_5")
+set_tests_properties(cholesky_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;123;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(cholesky_2 "/root/repo/test/runtest.sh" "cholesky_2")
+set_tests_properties(cholesky_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;123;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(cholesky_6 "/root/repo/test/runtest.sh" "cholesky_6")
+set_tests_properties(cholesky_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;123;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(cholesky_7 "/root/repo/test/runtest.sh" "cholesky_7")
+set_tests_properties(cholesky_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;123;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(cholesky_8 "/root/repo/test/runtest.sh" "cholesky_8")
+set_tests_properties(cholesky_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;123;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(cholesky_9 "/root/repo/test/runtest.sh" "cholesky_9")
+set_tests_properties(cholesky_9 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;123;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(lu_1 "/root/repo/test/runtest.sh" "lu_1")
+set_tests_properties(lu_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;124;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(lu_2 "/root/repo/test/runtest.sh" "lu_2")
+set_tests_properties(lu_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;124;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(lu_3 "/root/repo/test/runtest.sh" "lu_3")
+set_tests_properties(lu_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;124;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(lu_4 "/root/repo/test/runtest.sh" "lu_4")
+set_tests_properties(lu_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;124;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(lu_5 "/root/repo/test/runtest.sh" "lu_5")
+set_tests_properties(lu_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;124;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(lu_6 "/root/repo/test/runtest.sh" "lu_6")
+set_tests_properties(lu_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;124;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(lu_7 "/root/repo/test/runtest.sh" "lu_7")
+set_tests_properties(lu_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;124;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(lu_9 "/root/repo/test/runtest.sh" "lu_9")
+set_tests_properties(lu_9 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;124;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(determinant_1 "/root/repo/test/runtest.sh" "determinant_1")
+set_tests_properties(determinant_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;125;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(determinant_2 "/root/repo/test/runtest.sh" "determinant_2")
+set_tests_properties(determinant_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;125;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(determinant_3 "/root/repo/test/runtest.sh" "determinant_3")
+set_tests_properties(determinant_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;125;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(determinant_4 "/root/repo/test/runtest.sh" "determinant_4")
+set_tests_properties(determinant_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;125;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(determinant_5 "/root/repo/test/runtest.sh" "determinant_5")
+set_tests_properties(determinant_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;125;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(determinant_6 "/root/repo/test/runtest.sh" "determinant_6")
+set_tests_properties(determinant_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;125;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(inverse_5 "/root/repo/test/runtest.sh" "inverse_5")
+set_tests_properties(inverse_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;126;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(inverse_6 "/root/repo/test/runtest.sh" "inverse_6")
+set_tests_properties(inverse_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;126;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(inverse_1 "/root/repo/test/runtest.sh" "inverse_1")
+set_tests_properties(inverse_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;126;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(inverse_2 "/root/repo/test/runtest.sh" "inverse_2")
+set_tests_properties(inverse_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;126;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(inverse_3 "/root/repo/test/runtest.sh" "inverse_3")
+set_tests_properties(inverse_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;126;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(inverse_4 "/root/repo/test/runtest.sh" "inverse_4")
+set_tests_properties(inverse_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;126;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(inverse_7 "/root/repo/test/runtest.sh" "inverse_7")
+set_tests_properties(inverse_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;126;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_1 "/root/repo/test/runtest.sh" "qr_1")
+set_tests_properties(qr_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;127;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_2 "/root/repo/test/runtest.sh" "qr_2")
+set_tests_properties(qr_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;127;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_3 "/root/repo/test/runtest.sh" "qr_3")
+set_tests_properties(qr_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;127;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_4 "/root/repo/test/runtest.sh" "qr_4")
+set_tests_properties(qr_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;127;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_5 "/root/repo/test/runtest.sh" "qr_5")
+set_tests_properties(qr_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;127;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_11 "/root/repo/test/runtest.sh" "qr_11")
+set_tests_properties(qr_11 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;127;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_6 "/root/repo/test/runtest.sh" "qr_6")
+set_tests_properties(qr_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;127;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_7 "/root/repo/test/runtest.sh" "qr_7")
+set_tests_properties(qr_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;127;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_8 "/root/repo/test/runtest.sh" "qr_8")
+set_tests_properties(qr_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;127;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_9 "/root/repo/test/runtest.sh" "qr_9")
+set_tests_properties(qr_9 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;127;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_10 "/root/repo/test/runtest.sh" "qr_10")
+set_tests_properties(qr_10 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;127;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_12 "/root/repo/test/runtest.sh" "qr_12")
+set_tests_properties(qr_12 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;127;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_colpivoting_1 "/root/repo/test/runtest.sh" "qr_colpivoting_1")
+set_tests_properties(qr_colpivoting_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;128;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_colpivoting_2 "/root/repo/test/runtest.sh" "qr_colpivoting_2")
+set_tests_properties(qr_colpivoting_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;128;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_colpivoting_3 "/root/repo/test/runtest.sh" "qr_colpivoting_3")
+set_tests_properties(qr_colpivoting_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;128;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_colpivoting_4 "/root/repo/test/runtest.sh" "qr_colpivoting_4")
+set_tests_properties(qr_colpivoting_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;128;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_colpivoting_5 "/root/repo/test/runtest.sh" "qr_colpivoting_5")
+set_tests_properties(qr_colpivoting_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;128;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_colpivoting_6 "/root/repo/test/runtest.sh" "qr_colpivoting_6")
+set_tests_properties(qr_colpivoting_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;128;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_colpivoting_7 "/root/repo/test/runtest.sh" "qr_colpivoting_7")
+set_tests_properties(qr_colpivoting_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;128;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_colpivoting_8 "/root/repo/test/runtest.sh" "qr_colpivoting_8")
+set_tests_properties(qr_colpivoting_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;128;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_colpivoting_9 "/root/repo/test/runtest.sh" "qr_colpivoting_9")
+set_tests_properties(qr_colpivoting_9 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;128;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_fullpivoting_1 "/root/repo/test/runtest.sh" "qr_fullpivoting_1")
+set_tests_properties(qr_fullpivoting_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;129;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_fullpivoting_2 "/root/repo/test/runtest.sh" "qr_fullpivoting_2")
+set_tests_properties(qr_fullpivoting_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;129;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_fullpivoting_3 "/root/repo/test/runtest.sh" "qr_fullpivoting_3")
+set_tests_properties(qr_fullpivoting_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;129;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_fullpivoting_4 "/root/repo/test/runtest.sh" "qr_fullpivoting_4")
+set_tests_properties(qr_fullpivoting_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;129;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_fullpivoting_5 "/root/repo/test/runtest.sh" "qr_fullpivoting_5")
+set_tests_properties(qr_fullpivoting_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;129;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_fullpivoting_6 "/root/repo/test/runtest.sh" "qr_fullpivoting_6")
+set_tests_properties(qr_fullpivoting_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;129;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(qr_fullpivoting_7 "/root/repo/test/runtest.sh" "qr_fullpivoting_7")
+set_tests_properties(qr_fullpivoting_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;129;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(upperbidiagonalization_1 "/root/repo/test/runtest.sh" "upperbidiagonalization_1")
+set_tests_properties(upperbidiagonalization_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;130;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(upperbidiagonalization_2 "/root/repo/test/runtest.sh" "upperbidiagonalization_2")
+set_tests_properties(upperbidiagonalization_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;130;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(upperbidiagonalization_3 "/root/repo/test/runtest.sh" "upperbidiagonalization_3")
+set_tests_properties(upperbidiagonalization_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;130;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(upperbidiagonalization_4 "/root/repo/test/runtest.sh" "upperbidiagonalization_4")
+set_tests_properties(upperbidiagonalization_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;130;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(upperbidiagonalization_5 "/root/repo/test/runtest.sh" "upperbidiagonalization_5")
+set_tests_properties(upperbidiagonalization_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;130;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(upperbidiagonalization_6 "/root/repo/test/runtest.sh" "upperbidiagonalization_6")
+set_tests_properties(upperbidiagonalization_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;130;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(upperbidiagonalization_7 "/root/repo/test/runtest.sh" "upperbidiagonalization_7")
+set_tests_properties(upperbidiagonalization_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;130;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(hessenberg_1 "/root/repo/test/runtest.sh" "hessenberg_1")
+set_tests_properties(hessenberg_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;131;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(hessenberg_2 "/root/repo/test/runtest.sh" "hessenberg_2")
+set_tests_properties(hessenberg_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;131;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(hessenberg_3 "/root/repo/test/runtest.sh" "hessenberg_3")
+set_tests_properties(hessenberg_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;131;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(hessenberg_4 "/root/repo/test/runtest.sh" "hessenberg_4")
+set_tests_properties(hessenberg_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;131;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(hessenberg_5 "/root/repo/test/runtest.sh" "hessenberg_5")
+set_tests_properties(hessenberg_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;131;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(hessenberg_6 "/root/repo/test/runtest.sh" "hessenberg_6")
+set_tests_properties(hessenberg_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;131;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(schur_real_1 "/root/repo/test/runtest.sh" "schur_real_1")
+set_tests_properties(schur_real_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;132;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(schur_real_2 "/root/repo/test/runtest.sh" "schur_real_2")
+set_tests_properties(schur_real_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;132;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(schur_real_3 "/root/repo/test/runtest.sh" "schur_real_3")
+set_tests_properties(schur_real_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;132;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(schur_real_4 "/root/repo/test/runtest.sh" "schur_real_4")
+set_tests_properties(schur_real_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;132;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(schur_real_5 "/root/repo/test/runtest.sh" "schur_real_5")
+set_tests_properties(schur_real_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;132;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(schur_complex_1 "/root/repo/test/runtest.sh" "schur_complex_1")
+set_tests_properties(schur_complex_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;133;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(schur_complex_2 "/root/repo/test/runtest.sh" "schur_complex_2")
+set_tests_properties(schur_complex_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;133;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(schur_complex_3 "/root/repo/test/runtest.sh" "schur_complex_3")
+set_tests_properties(schur_complex_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;133;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(schur_complex_4 "/root/repo/test/runtest.sh" "schur_complex_4")
+set_tests_properties(schur_complex_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;133;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(schur_complex_5 "/root/repo/test/runtest.sh" "schur_complex_5")
+set_tests_properties(schur_complex_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;133;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(eigensolver_selfadjoint_1 "/root/repo/test/runtest.sh" "eigensolver_selfadjoint_1")
+set_tests_properties(eigensolver_selfadjoint_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;134;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(eigensolver_selfadjoint_2 "/root/repo/test/runtest.sh" "eigensolver_selfadjoint_2")
+set_tests_properties(eigensolver_selfadjoint_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;134;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(eigensolver_selfadjoint_3 "/root/repo/test/runtest.sh" "eigensolver_selfadjoint_3")
+set_tests_properties(eigensolver_selfadjoint_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;134;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(eigensolver_selfadjoint_4 "/root/repo/test/runtest.sh" "eigensolver_selfadjoint_4")
+set_tests_properties(eigensolver_selfadjoint_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;134;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(eigensolver_selfadjoint_5 "/root/repo/test/runtest.sh" "eigensolver_selfadjoint_5")
+set_tests_properties(eigensolver_selfadjoint_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;134;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(eigensolver_selfadjoint_9 "/root/repo/test/runtest.sh" "eigensolver_selfadjoint_9")
+set_tests_properties(eigensolver_selfadjoint_9 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;134;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(eigensolver_selfadjoint_6 "/root/repo/test/runtest.sh" "eigensolver_selfadjoint_6")
+set_tests_properties(eigensolver_selfadjoint_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;134;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(eigensolver_selfadjoint_7 "/root/repo/test/runtest.sh" "eigensolver_selfadjoint_7")
+set_tests_properties(eigensolver_selfadjoint_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;134;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(eigensolver_selfadjoint_8 "/root/repo/test/runtest.sh" "eigensolver_selfadjoint_8")
+set_tests_properties(eigensolver_selfadjoint_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;134;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(eigensolver_generic_1 "/root/repo/test/runtest.sh" "eigensolver_generic_1")
+set_tests_properties(eigensolver_generic_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;135;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(eigensolver_generic_2 "/root/repo/test/runtest.sh" "eigensolver_generic_2")
+set_tests_properties(eigensolver_generic_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;135;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(eigensolver_generic_3 "/root/repo/test/runtest.sh" "eigensolver_generic_3")
+set_tests_properties(eigensolver_generic_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;135;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(eigensolver_generic_4 "/root/repo/test/runtest.sh" "eigensolver_generic_4")
+set_tests_properties(eigensolver_generic_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;135;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(eigensolver_generic_5 "/root/repo/test/runtest.sh" "eigensolver_generic_5")
+set_tests_properties(eigensolver_generic_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;135;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(eigensolver_complex_1 "/root/repo/test/runtest.sh" "eigensolver_complex_1")
+set_tests_properties(eigensolver_complex_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;136;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(eigensolver_complex_2 "/root/repo/test/runtest.sh" "eigensolver_complex_2")
+set_tests_properties(eigensolver_complex_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;136;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(eigensolver_complex_3 "/root/repo/test/runtest.sh" "eigensolver_complex_3")
+set_tests_properties(eigensolver_complex_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;136;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(eigensolver_complex_4 "/root/repo/test/runtest.sh" "eigensolver_complex_4")
+set_tests_properties(eigensolver_complex_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;136;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(eigensolver_complex_5 "/root/repo/test/runtest.sh" "eigensolver_complex_5")
+set_tests_properties(eigensolver_complex_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;136;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(jacobi_1 "/root/repo/test/runtest.sh" "jacobi_1")
+set_tests_properties(jacobi_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;137;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(jacobi_2 "/root/repo/test/runtest.sh" "jacobi_2")
+set_tests_properties(jacobi_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;137;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(jacobi_3 "/root/repo/test/runtest.sh" "jacobi_3")
+set_tests_properties(jacobi_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;137;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(jacobi_4 "/root/repo/test/runtest.sh" "jacobi_4")
+set_tests_properties(jacobi_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;137;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(jacobi_5 "/root/repo/test/runtest.sh" "jacobi_5")
+set_tests_properties(jacobi_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;137;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(jacobi_6 "/root/repo/test/runtest.sh" "jacobi_6")
+set_tests_properties(jacobi_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;137;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(jacobisvd_3 "/root/repo/test/runtest.sh" "jacobisvd_3")
+set_tests_properties(jacobisvd_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;138;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(jacobisvd_4 "/root/repo/test/runtest.sh" "jacobisvd_4")
+set_tests_properties(jacobisvd_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;138;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(jacobisvd_7 "/root/repo/test/runtest.sh" "jacobisvd_7")
+set_tests_properties(jacobisvd_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;138;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(jacobisvd_8 "/root/repo/test/runtest.sh" "jacobisvd_8")
+set_tests_properties(jacobisvd_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;138;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(jacobisvd_1 "/root/repo/test/runtest.sh" "jacobisvd_1")
+set_tests_properties(jacobisvd_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;138;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(jacobisvd_2 "/root/repo/test/runtest.sh" "jacobisvd_2")
+set_tests_properties(jacobisvd_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;138;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(jacobisvd_5 "/root/repo/test/runtest.sh" "jacobisvd_5")
+set_tests_properties(jacobisvd_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;138;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(jacobisvd_6 "/root/repo/test/runtest.sh" "jacobisvd_6")
+set_tests_properties(jacobisvd_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;138;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(jacobisvd_9 "/root/repo/test/runtest.sh" "jacobisvd_9")
+set_tests_properties(jacobisvd_9 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;138;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_orthomethods_1 "/root/repo/test/runtest.sh" "geo_orthomethods_1")
+set_tests_properties(geo_orthomethods_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;139;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_orthomethods_2 "/root/repo/test/runtest.sh" "geo_orthomethods_2")
+set_tests_properties(geo_orthomethods_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;139;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_orthomethods_4 "/root/repo/test/runtest.sh" "geo_orthomethods_4")
+set_tests_properties(geo_orthomethods_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;139;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_orthomethods_3 "/root/repo/test/runtest.sh" "geo_orthomethods_3")
+set_tests_properties(geo_orthomethods_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;139;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_orthomethods_5 "/root/repo/test/runtest.sh" "geo_orthomethods_5")
+set_tests_properties(geo_orthomethods_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;139;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_orthomethods_6 "/root/repo/test/runtest.sh" "geo_orthomethods_6")
+set_tests_properties(geo_orthomethods_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;139;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_homogeneous_1 "/root/repo/test/runtest.sh" "geo_homogeneous_1")
+set_tests_properties(geo_homogeneous_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;140;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_homogeneous_2 "/root/repo/test/runtest.sh" "geo_homogeneous_2")
+set_tests_properties(geo_homogeneous_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;140;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_homogeneous_3 "/root/repo/test/runtest.sh" "geo_homogeneous_3")
+set_tests_properties(geo_homogeneous_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;140;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_quaternion_1 "/root/repo/test/runtest.sh" "geo_quaternion_1")
+set_tests_properties(geo_quaternion_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;141;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_quaternion_2 "/root/repo/test/runtest.sh" "geo_quaternion_2")
+set_tests_properties(geo_quaternion_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;141;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_quaternion_3 "/root/repo/test/runtest.sh" "geo_quaternion_3")
+set_tests_properties(geo_quaternion_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;141;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_quaternion_4 "/root/repo/test/runtest.sh" "geo_quaternion_4")
+set_tests_properties(geo_quaternion_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;141;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_quaternion_5 "/root/repo/test/runtest.sh" "geo_quaternion_5")
+set_tests_properties(geo_quaternion_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;141;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_quaternion_6 "/root/repo/test/runtest.sh" "geo_quaternion_6")
+set_tests_properties(geo_quaternion_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;141;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_transformations_1 "/root/repo/test/runtest.sh" "geo_transformations_1")
+set_tests_properties(geo_transformations_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;142;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_transformations_2 "/root/repo/test/runtest.sh" "geo_transformations_2")
+set_tests_properties(geo_transformations_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;142;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_transformations_3 "/root/repo/test/runtest.sh" "geo_transformations_3")
+set_tests_properties(geo_transformations_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;142;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_transformations_4 "/root/repo/test/runtest.sh" "geo_transformations_4")
+set_tests_properties(geo_transformations_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;142;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_transformations_5 "/root/repo/test/runtest.sh" "geo_transformations_5")
+set_tests_properties(geo_transformations_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;142;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_transformations_6 "/root/repo/test/runtest.sh" "geo_transformations_6")
+set_tests_properties(geo_transformations_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;142;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_eulerangles_1 "/root/repo/test/runtest.sh" "geo_eulerangles_1")
+set_tests_properties(geo_eulerangles_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;143;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_eulerangles_2 "/root/repo/test/runtest.sh" "geo_eulerangles_2")
+set_tests_properties(geo_eulerangles_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;143;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_hyperplane_1 "/root/repo/test/runtest.sh" "geo_hyperplane_1")
+set_tests_properties(geo_hyperplane_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;144;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_hyperplane_2 "/root/repo/test/runtest.sh" "geo_hyperplane_2")
+set_tests_properties(geo_hyperplane_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;144;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_hyperplane_3 "/root/repo/test/runtest.sh" "geo_hyperplane_3")
+set_tests_properties(geo_hyperplane_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;144;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_hyperplane_4 "/root/repo/test/runtest.sh" "geo_hyperplane_4")
+set_tests_properties(geo_hyperplane_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;144;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_parametrizedline_1 "/root/repo/test/runtest.sh" "geo_parametrizedline_1")
+set_tests_properties(geo_parametrizedline_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;145;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_parametrizedline_2 "/root/repo/test/runtest.sh" "geo_parametrizedline_2")
+set_tests_properties(geo_parametrizedline_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;145;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_parametrizedline_3 "/root/repo/test/runtest.sh" "geo_parametrizedline_3")
+set_tests_properties(geo_parametrizedline_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;145;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_parametrizedline_4 "/root/repo/test/runtest.sh" "geo_parametrizedline_4")
+set_tests_properties(geo_parametrizedline_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;145;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_alignedbox_1 "/root/repo/test/runtest.sh" "geo_alignedbox_1")
+set_tests_properties(geo_alignedbox_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;146;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_alignedbox_2 "/root/repo/test/runtest.sh" "geo_alignedbox_2")
+set_tests_properties(geo_alignedbox_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;146;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_alignedbox_3 "/root/repo/test/runtest.sh" "geo_alignedbox_3")
+set_tests_properties(geo_alignedbox_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;146;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_alignedbox_4 "/root/repo/test/runtest.sh" "geo_alignedbox_4")
+set_tests_properties(geo_alignedbox_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;146;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_alignedbox_5 "/root/repo/test/runtest.sh" "geo_alignedbox_5")
+set_tests_properties(geo_alignedbox_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;146;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_alignedbox_6 "/root/repo/test/runtest.sh" "geo_alignedbox_6")
+set_tests_properties(geo_alignedbox_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;146;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_alignedbox_7 "/root/repo/test/runtest.sh" "geo_alignedbox_7")
+set_tests_properties(geo_alignedbox_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;146;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_alignedbox_8 "/root/repo/test/runtest.sh" "geo_alignedbox_8")
+set_tests_properties(geo_alignedbox_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;146;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_alignedbox_9 "/root/repo/test/runtest.sh" "geo_alignedbox_9")
+set_tests_properties(geo_alignedbox_9 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;146;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_alignedbox_10 "/root/repo/test/runtest.sh" "geo_alignedbox_10")
+set_tests_properties(geo_alignedbox_10 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;146;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_alignedbox_11 "/root/repo/test/runtest.sh" "geo_alignedbox_11")
+set_tests_properties(geo_alignedbox_11 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;146;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_alignedbox_12 "/root/repo/test/runtest.sh" "geo_alignedbox_12")
+set_tests_properties(geo_alignedbox_12 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;146;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(geo_alignedbox_13 "/root/repo/test/runtest.sh" "geo_alignedbox_13")
+set_tests_properties(geo_alignedbox_13 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;146;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stdvector_1 "/root/repo/test/runtest.sh" "stdvector_1")
+set_tests_properties(stdvector_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;147;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stdvector_2 "/root/repo/test/runtest.sh" "stdvector_2")
+set_tests_properties(stdvector_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;147;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stdvector_3 "/root/repo/test/runtest.sh" "stdvector_3")
+set_tests_properties(stdvector_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;147;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stdvector_4 "/root/repo/test/runtest.sh" "stdvector_4")
+set_tests_properties(stdvector_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;147;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stdvector_5 "/root/repo/test/runtest.sh" "stdvector_5")
+set_tests_properties(stdvector_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;147;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stdvector_overload_1 "/root/repo/test/runtest.sh" "stdvector_overload_1")
+set_tests_properties(stdvector_overload_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;148;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stdvector_overload_2 "/root/repo/test/runtest.sh" "stdvector_overload_2")
+set_tests_properties(stdvector_overload_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;148;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stdvector_overload_3 "/root/repo/test/runtest.sh" "stdvector_overload_3")
+set_tests_properties(stdvector_overload_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;148;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stdvector_overload_4 "/root/repo/test/runtest.sh" "stdvector_overload_4")
+set_tests_properties(stdvector_overload_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;148;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stdvector_overload_5 "/root/repo/test/runtest.sh" "stdvector_overload_5")
+set_tests_properties(stdvector_overload_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;148;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stdlist_1 "/root/repo/test/runtest.sh" "stdlist_1")
+set_tests_properties(stdlist_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;149;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stdlist_2 "/root/repo/test/runtest.sh" "stdlist_2")
+set_tests_properties(stdlist_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;149;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stdlist_3 "/root/repo/test/runtest.sh" "stdlist_3")
+set_tests_properties(stdlist_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;149;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stdlist_4 "/root/repo/test/runtest.sh" "stdlist_4")
+set_tests_properties(stdlist_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;149;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stdlist_5 "/root/repo/test/runtest.sh" "stdlist_5")
+set_tests_properties(stdlist_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;149;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stddeque_1 "/root/repo/test/runtest.sh" "stddeque_1")
+set_tests_properties(stddeque_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;150;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stddeque_2 "/root/repo/test/runtest.sh" "stddeque_2")
+set_tests_properties(stddeque_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;150;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stddeque_3 "/root/repo/test/runtest.sh" "stddeque_3")
+set_tests_properties(stddeque_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;150;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stddeque_4 "/root/repo/test/runtest.sh" "stddeque_4")
+set_tests_properties(stddeque_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;150;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stddeque_5 "/root/repo/test/runtest.sh" "stddeque_5")
+set_tests_properties(stddeque_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;150;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(resize "/root/repo/test/runtest.sh" "resize")
+set_tests_properties(resize PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;145;ei_add_test_internal;/root/repo/test/CMakeLists.txt;151;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sparse_vector_1 "/root/repo/test/runtest.sh" "sparse_vector_1")
+set_tests_properties(sparse_vector_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;155;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sparse_vector_2 "/root/repo/test/runtest.sh" "sparse_vector_2")
+set_tests_properties(sparse_vector_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;155;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sparse_basic_1 "/root/repo/test/runtest.sh" "sparse_basic_1")
+set_tests_properties(sparse_basic_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;156;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sparse_basic_2 "/root/repo/test/runtest.sh" "sparse_basic_2")
+set_tests_properties(sparse_basic_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;156;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sparse_product_1 "/root/repo/test/runtest.sh" "sparse_product_1")
+set_tests_properties(sparse_product_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;157;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sparse_product_2 "/root/repo/test/runtest.sh" "sparse_product_2")
+set_tests_properties(sparse_product_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;157;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sparse_product_3 "/root/repo/test/runtest.sh" "sparse_product_3")
+set_tests_properties(sparse_product_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;157;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sparse_product_4 "/root/repo/test/runtest.sh" "sparse_product_4")
+set_tests_properties(sparse_product_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;157;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sparse_product_5 "/root/repo/test/runtest.sh" "sparse_product_5")
+set_tests_properties(sparse_product_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;157;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sparse_product_6 "/root/repo/test/runtest.sh" "sparse_product_6")
+set_tests_properties(sparse_product_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;157;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sparse_block_matrix_1 "/root/repo/test/runtest.sh" "sparse_block_matrix_1")
+set_tests_properties(sparse_block_matrix_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;158;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sparse_block_matrix_2 "/root/repo/test/runtest.sh" "sparse_block_matrix_2")
+set_tests_properties(sparse_block_matrix_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;158;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sparse_sliced_ell_1 "/root/repo/test/runtest.sh" "sparse_sliced_ell_1")
+set_tests_properties(sparse_sliced_ell_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;159;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sparse_sliced_ell_2 "/root/repo/test/runtest.sh" "sparse_sliced_ell_2")
+set_tests_properties(sparse_sliced_ell_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;159;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sparse_sliced_ell_3 "/root/repo/test/runtest.sh" "sparse_sliced_ell_3")
+set_tests_properties(sparse_sliced_ell_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;159;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sparse_solvers_1 "/root/repo/test/runtest.sh" "sparse_solvers_1")
+set_tests_properties(sparse_solvers_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;160;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sparse_solvers_2 "/root/repo/test/runtest.sh" "sparse_solvers_2")
+set_tests_properties(sparse_solvers_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;160;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sparseqr_1 "/root/repo/test/runtest.sh" "sparseqr_1")
+set_tests_properties(sparseqr_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;161;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sparseqr_2 "/root/repo/test/runtest.sh" "sparseqr_2")
+set_tests_properties(sparseqr_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;161;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(umeyama_1 "/root/repo/test/runtest.sh" "umeyama_1")
+set_tests_properties(umeyama_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;162;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(umeyama_2 "/root/repo/test/runtest.sh" "umeyama_2")
+set_tests_properties(umeyama_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;162;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(umeyama_3 "/root/repo/test/runtest.sh" "umeyama_3")
+set_tests_properties(umeyama_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;162;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(umeyama_4 "/root/repo/test/runtest.sh" "umeyama_4")
+set_tests_properties(umeyama_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;162;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(umeyama_5 "/root/repo/test/runtest.sh" "umeyama_5")
+set_tests_properties(umeyama_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;162;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(umeyama_6 "/root/repo/test/runtest.sh" "umeyama_6")
+set_tests_properties(umeyama_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;162;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(umeyama_7 "/root/repo/test/runtest.sh" "umeyama_7")
+set_tests_properties(umeyama_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;162;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(umeyama_8 "/root/repo/test/runtest.sh" "umeyama_8")
+set_tests_properties(umeyama_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;162;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(householder_1 "/root/repo/test/runtest.sh" "householder_1")
+set_tests_properties(householder_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;163;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(householder_2 "/root/repo/test/runtest.sh" "householder_2")
+set_tests_properties(householder_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;163;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(householder_3 "/root/repo/test/runtest.sh" "householder_3")
+set_tests_properties(householder_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;163;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(householder_4 "/root/repo/test/runtest.sh" "householder_4")
+set_tests_properties(householder_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;163;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(householder_5 "/root/repo/test/runtest.sh" "householder_5")
+set_tests_properties(householder_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;163;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(householder_6 "/root/repo/test/runtest.sh" "householder_6")
+set_tests_properties(householder_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;163;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(householder_7 "/root/repo/test/runtest.sh" "householder_7")
+set_tests_properties(householder_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;163;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(householder_8 "/root/repo/test/runtest.sh" "householder_8")
+set_tests_properties(householder_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;163;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(swap_1 "/root/repo/test/runtest.sh" "swap_1")
+set_tests_properties(swap_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;164;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(swap_2 "/root/repo/test/runtest.sh" "swap_2")
+set_tests_properties(swap_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;164;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(swap_3 "/root/repo/test/runtest.sh" "swap_3")
+set_tests_properties(swap_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;164;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(swap_4 "/root/repo/test/runtest.sh" "swap_4")
+set_tests_properties(swap_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;164;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(conservative_resize_1 "/root/repo/test/runtest.sh" "conservative_resize_1")
+set_tests_properties(conservative_resize_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;165;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(conservative_resize_2 "/root/repo/test/runtest.sh" "conservative_resize_2")
+set_tests_properties(conservative_resize_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;165;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(conservative_resize_3 "/root/repo/test/runtest.sh" "conservative_resize_3")
+set_tests_properties(conservative_resize_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;165;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(conservative_resize_4 "/root/repo/test/runtest.sh" "conservative_resize_4")
+set_tests_properties(conservative_resize_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;165;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(conservative_resize_5 "/root/repo/test/runtest.sh" "conservative_resize_5")
+set_tests_properties(conservative_resize_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;165;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(conservative_resize_6 "/root/repo/test/runtest.sh" "conservative_resize_6")
+set_tests_properties(conservative_resize_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;165;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(permutationmatrices_1 "/root/repo/test/runtest.sh" "permutationmatrices_1")
+set_tests_properties(permutationmatrices_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;166;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(permutationmatrices_2 "/root/repo/test/runtest.sh" "permutationmatrices_2")
+set_tests_properties(permutationmatrices_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;166;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(permutationmatrices_3 "/root/repo/test/runtest.sh" "permutationmatrices_3")
+set_tests_properties(permutationmatrices_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;166;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(permutationmatrices_4 "/root/repo/test/runtest.sh" "permutationmatrices_4")
+set_tests_properties(permutationmatrices_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;166;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(permutationmatrices_5 "/root/repo/test/runtest.sh" "permutationmatrices_5")
+set_tests_properties(permutationmatrices_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;166;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(permutationmatrices_6 "/root/repo/test/runtest.sh" "permutationmatrices_6")
+set_tests_properties(permutationmatrices_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;166;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(permutationmatrices_7 "/root/repo/test/runtest.sh" "permutationmatrices_7")
+set_tests_properties(permutationmatrices_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;166;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sparse_permutations_1 "/root/repo/test/runtest.sh" "sparse_permutations_1")
+set_tests_properties(sparse_permutations_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;167;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sparse_permutations_2 "/root/repo/test/runtest.sh" "sparse_permutations_2")
+set_tests_properties(sparse_permutations_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;167;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(eigen2support_1 "/root/repo/test/runtest.sh" "eigen2support_1")
+set_tests_properties(eigen2support_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;168;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(eigen2support_2 "/root/repo/test/runtest.sh" "eigen2support_2")
+set_tests_properties(eigen2support_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;168;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(eigen2support_4 "/root/repo/test/runtest.sh" "eigen2support_4")
+set_tests_properties(eigen2support_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;168;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(eigen2support_5 "/root/repo/test/runtest.sh" "eigen2support_5")
+set_tests_properties(eigen2support_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;168;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(eigen2support_6 "/root/repo/test/runtest.sh" "eigen2support_6")
+set_tests_properties(eigen2support_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;168;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(nullary_1 "/root/repo/test/runtest.sh" "nullary_1")
+set_tests_properties(nullary_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;169;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(nullary_2 "/root/repo/test/runtest.sh" "nullary_2")
+set_tests_properties(nullary_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;169;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(nullary_3 "/root/repo/test/runtest.sh" "nullary_3")
+set_tests_properties(nullary_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;169;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(nullary_4 "/root/repo/test/runtest.sh" "nullary_4")
+set_tests_properties(nullary_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;169;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(nullary_5 "/root/repo/test/runtest.sh" "nullary_5")
+set_tests_properties(nullary_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;169;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(nullary_6 "/root/repo/test/runtest.sh" "nullary_6")
+set_tests_properties(nullary_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;169;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(nullary_7 "/root/repo/test/runtest.sh" "nullary_7")
+set_tests_properties(nullary_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;169;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(nullary_8 "/root/repo/test/runtest.sh" "nullary_8")
+set_tests_properties(nullary_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;169;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(nesting_ops_1 "/root/repo/test/runtest.sh" "nesting_ops_1")
+set_tests_properties(nesting_ops_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;170;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(nesting_ops_2 "/root/repo/test/runtest.sh" "nesting_ops_2")
+set_tests_properties(nesting_ops_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;170;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(nesting_ops_3 "/root/repo/test/runtest.sh" "nesting_ops_3")
+set_tests_properties(nesting_ops_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;170;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(nesting_ops_4 "/root/repo/test/runtest.sh" "nesting_ops_4")
+set_tests_properties(nesting_ops_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;170;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(zerosized "/root/repo/test/runtest.sh" "zerosized")
+set_tests_properties(zerosized PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;145;ei_add_test_internal;/root/repo/test/CMakeLists.txt;171;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(dontalign_1 "/root/repo/test/runtest.sh" "dontalign_1")
+set_tests_properties(dontalign_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;172;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(dontalign_2 "/root/repo/test/runtest.sh" "dontalign_2")
+set_tests_properties(dontalign_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;172;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(dontalign_3 "/root/repo/test/runtest.sh" "dontalign_3")
+set_tests_properties(dontalign_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;172;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(dontalign_4 "/root/repo/test/runtest.sh" "dontalign_4")
+set_tests_properties(dontalign_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;172;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(dontalign_5 "/root/repo/test/runtest.sh" "dontalign_5")
+set_tests_properties(dontalign_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;172;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(dontalign_6 "/root/repo/test/runtest.sh" "dontalign_6")
+set_tests_properties(dontalign_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;172;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(dontalign_7 "/root/repo/test/runtest.sh" "dontalign_7")
+set_tests_properties(dontalign_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;172;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(dontalign_8 "/root/repo/test/runtest.sh" "dontalign_8")
+set_tests_properties(dontalign_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;172;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sizeoverflow "/root/repo/test/runtest.sh" "sizeoverflow")
+set_tests_properties(sizeoverflow PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;145;ei_add_test_internal;/root/repo/test/CMakeLists.txt;173;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(prec_inverse_4x4_1 "/root/repo/test/runtest.sh" "prec_inverse_4x4_1")
+set_tests_properties(prec_inverse_4x4_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;174;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(prec_inverse_4x4_2 "/root/repo/test/runtest.sh" "prec_inverse_4x4_2")
+set_tests_properties(prec_inverse_4x4_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;174;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(prec_inverse_4x4_3 "/root/repo/test/runtest.sh" "prec_inverse_4x4_3")
+set_tests_properties(prec_inverse_4x4_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;174;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(vectorwiseop_1 "/root/repo/test/runtest.sh" "vectorwiseop_1")
+set_tests_properties(vectorwiseop_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;175;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(vectorwiseop_2 "/root/repo/test/runtest.sh" "vectorwiseop_2")
+set_tests_properties(vectorwiseop_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;175;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(vectorwiseop_3 "/root/repo/test/runtest.sh" "vectorwiseop_3")
+set_tests_properties(vectorwiseop_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;175;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(vectorwiseop_4 "/root/repo/test/runtest.sh" "vectorwiseop_4")
+set_tests_properties(vectorwiseop_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;175;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(vectorwiseop_5 "/root/repo/test/runtest.sh" "vectorwiseop_5")
+set_tests_properties(vectorwiseop_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;175;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(vectorwiseop_6 "/root/repo/test/runtest.sh" "vectorwiseop_6")
+set_tests_properties(vectorwiseop_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;175;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(vectorwiseop_7 "/root/repo/test/runtest.sh" "vectorwiseop_7")
+set_tests_properties(vectorwiseop_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;175;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(vectorwiseop_8 "/root/repo/test/runtest.sh" "vectorwiseop_8")
+set_tests_properties(vectorwiseop_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;175;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(simplicial_cholesky_1 "/root/repo/test/runtest.sh" "simplicial_cholesky_1")
+set_tests_properties(simplicial_cholesky_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;177;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(simplicial_cholesky_2 "/root/repo/test/runtest.sh" "simplicial_cholesky_2")
+set_tests_properties(simplicial_cholesky_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;177;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(conjugate_gradient_1 "/root/repo/test/runtest.sh" "conjugate_gradient_1")
+set_tests_properties(conjugate_gradient_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;178;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(conjugate_gradient_2 "/root/repo/test/runtest.sh" "conjugate_gradient_2")
+set_tests_properties(conjugate_gradient_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;178;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(bicgstab_1 "/root/repo/test/runtest.sh" "bicgstab_1")
+set_tests_properties(bicgstab_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;179;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(bicgstab_2 "/root/repo/test/runtest.sh" "bicgstab_2")
+set_tests_properties(bicgstab_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;179;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(gmres_1 "/root/repo/test/runtest.sh" "gmres_1")
+set_tests_properties(gmres_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;180;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(gmres_2 "/root/repo/test/runtest.sh" "gmres_2")
+set_tests_properties(gmres_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;180;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(minres_1 "/root/repo/test/runtest.sh" "minres_1")
+set_tests_properties(minres_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;181;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(minres_2 "/root/repo/test/runtest.sh" "minres_2")
+set_tests_properties(minres_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/test/CMakeLists.txt;181;ei_add_test;/root/repo/test/CMakeLists.txt;0;")
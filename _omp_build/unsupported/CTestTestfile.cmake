@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/unsupported
+# Build directory: /root/repo/_omp_build/unsupported
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("Eigen")
+subdirs("doc")
+subdirs("test")
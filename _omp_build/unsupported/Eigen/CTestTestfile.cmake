@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/unsupported/Eigen
+# Build directory: /root/repo/_omp_build/unsupported/Eigen
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("src")
@@ -0,0 +1,19 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/unsupported/Eigen/src
+# Build directory: /root/repo/_omp_build/unsupported/Eigen/src
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("AutoDiff")
+subdirs("BVH")
+subdirs("FFT")
+subdirs("IterativeSolvers")
+subdirs("MatrixFunctions")
+subdirs("MoreVectorization")
+subdirs("NonLinearOptimization")
+subdirs("NumericalDiff")
+subdirs("Polynomials")
+subdirs("Skyline")
+subdirs("SparseExtra")
+subdirs("KroneckerProduct")
+subdirs("Splines")
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/unsupported/Eigen/src/FFT
+# Build directory: /root/repo/_omp_build/unsupported/Eigen/src/FFT
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
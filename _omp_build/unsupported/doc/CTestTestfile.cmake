@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/unsupported/doc
+# Build directory: /root/repo/_omp_build/unsupported/doc
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("examples")
+subdirs("snippets")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example_BVH_Example.dir/BVH_Example.cpp.o"
+  "CMakeFiles/example_BVH_Example.dir/BVH_Example.cpp.o.d"
+  "example_BVH_Example"
+  "example_BVH_Example.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_BVH_Example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
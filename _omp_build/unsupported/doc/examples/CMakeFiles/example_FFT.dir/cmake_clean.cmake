@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example_FFT.dir/FFT.cpp.o"
+  "CMakeFiles/example_FFT.dir/FFT.cpp.o.d"
+  "example_FFT"
+  "example_FFT.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_FFT.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example_MatrixExponential.dir/MatrixExponential.cpp.o"
+  "CMakeFiles/example_MatrixExponential.dir/MatrixExponential.cpp.o.d"
+  "example_MatrixExponential"
+  "example_MatrixExponential.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_MatrixExponential.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
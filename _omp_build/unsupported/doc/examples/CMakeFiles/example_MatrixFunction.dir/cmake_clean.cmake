@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example_MatrixFunction.dir/MatrixFunction.cpp.o"
+  "CMakeFiles/example_MatrixFunction.dir/MatrixFunction.cpp.o.d"
+  "example_MatrixFunction"
+  "example_MatrixFunction.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_MatrixFunction.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
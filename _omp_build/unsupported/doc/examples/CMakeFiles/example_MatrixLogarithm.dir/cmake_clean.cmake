@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example_MatrixLogarithm.dir/MatrixLogarithm.cpp.o"
+  "CMakeFiles/example_MatrixLogarithm.dir/MatrixLogarithm.cpp.o.d"
+  "example_MatrixLogarithm"
+  "example_MatrixLogarithm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_MatrixLogarithm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example_MatrixSine.dir/MatrixSine.cpp.o"
+  "CMakeFiles/example_MatrixSine.dir/MatrixSine.cpp.o.d"
+  "example_MatrixSine"
+  "example_MatrixSine.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_MatrixSine.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example_MatrixSinh.dir/MatrixSinh.cpp.o"
+  "CMakeFiles/example_MatrixSinh.dir/MatrixSinh.cpp.o.d"
+  "example_MatrixSinh"
+  "example_MatrixSinh.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_MatrixSinh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example_MatrixSquareRoot.dir/MatrixSquareRoot.cpp.o"
+  "CMakeFiles/example_MatrixSquareRoot.dir/MatrixSquareRoot.cpp.o.d"
+  "example_MatrixSquareRoot"
+  "example_MatrixSquareRoot.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_MatrixSquareRoot.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example_PolynomialSolver1.dir/PolynomialSolver1.cpp.o"
+  "CMakeFiles/example_PolynomialSolver1.dir/PolynomialSolver1.cpp.o.d"
+  "example_PolynomialSolver1"
+  "example_PolynomialSolver1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_PolynomialSolver1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
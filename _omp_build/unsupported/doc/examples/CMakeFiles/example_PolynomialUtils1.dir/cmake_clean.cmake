@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example_PolynomialUtils1.dir/PolynomialUtils1.cpp.o"
+  "CMakeFiles/example_PolynomialUtils1.dir/PolynomialUtils1.cpp.o.d"
+  "example_PolynomialUtils1"
+  "example_PolynomialUtils1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_PolynomialUtils1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BVH_1"
+  "BVH_1.pdb"
+  "CMakeFiles/BVH_1.dir/BVH.cpp.o"
+  "CMakeFiles/BVH_1.dir/BVH.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BVH_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
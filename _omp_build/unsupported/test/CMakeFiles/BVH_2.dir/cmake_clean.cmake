@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BVH_2"
+  "BVH_2.pdb"
+  "CMakeFiles/BVH_2.dir/BVH.cpp.o"
+  "CMakeFiles/BVH_2.dir/BVH.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BVH_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
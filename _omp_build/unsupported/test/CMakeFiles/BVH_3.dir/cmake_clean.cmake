@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BVH_3"
+  "BVH_3.pdb"
+  "CMakeFiles/BVH_3.dir/BVH.cpp.o"
+  "CMakeFiles/BVH_3.dir/BVH.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BVH_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
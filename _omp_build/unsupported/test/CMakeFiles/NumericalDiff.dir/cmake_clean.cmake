@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/NumericalDiff.dir/NumericalDiff.cpp.o"
+  "CMakeFiles/NumericalDiff.dir/NumericalDiff.cpp.o.d"
+  "NumericalDiff"
+  "NumericalDiff.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/NumericalDiff.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/alignedvector3.dir/alignedvector3.cpp.o"
+  "CMakeFiles/alignedvector3.dir/alignedvector3.cpp.o.d"
+  "alignedvector3"
+  "alignedvector3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/alignedvector3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/autodiff.dir/autodiff.cpp.o"
+  "CMakeFiles/autodiff.dir/autodiff.cpp.o.d"
+  "autodiff"
+  "autodiff.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/autodiff.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
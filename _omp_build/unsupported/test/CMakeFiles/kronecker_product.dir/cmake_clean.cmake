@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kronecker_product.dir/kronecker_product.cpp.o"
+  "CMakeFiles/kronecker_product.dir/kronecker_product.cpp.o.d"
+  "kronecker_product"
+  "kronecker_product.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kronecker_product.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
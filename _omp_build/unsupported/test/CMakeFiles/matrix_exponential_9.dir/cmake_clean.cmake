@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/matrix_exponential_9.dir/matrix_exponential.cpp.o"
+  "CMakeFiles/matrix_exponential_9.dir/matrix_exponential.cpp.o.d"
+  "matrix_exponential_9"
+  "matrix_exponential_9.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/matrix_exponential_9.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
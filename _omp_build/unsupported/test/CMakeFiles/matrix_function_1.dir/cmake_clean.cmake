@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/matrix_function_1.dir/matrix_function.cpp.o"
+  "CMakeFiles/matrix_function_1.dir/matrix_function.cpp.o.d"
+  "matrix_function_1"
+  "matrix_function_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/matrix_function_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/matrix_square_root_4.dir/matrix_square_root.cpp.o"
+  "CMakeFiles/matrix_square_root_4.dir/matrix_square_root.cpp.o.d"
+  "matrix_square_root_4"
+  "matrix_square_root_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/matrix_square_root_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/matrix_square_root_5.dir/matrix_square_root.cpp.o"
+  "CMakeFiles/matrix_square_root_5.dir/matrix_square_root.cpp.o.d"
+  "matrix_square_root_5"
+  "matrix_square_root_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/matrix_square_root_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
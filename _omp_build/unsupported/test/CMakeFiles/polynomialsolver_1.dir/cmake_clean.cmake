@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polynomialsolver_1.dir/polynomialsolver.cpp.o"
+  "CMakeFiles/polynomialsolver_1.dir/polynomialsolver.cpp.o.d"
+  "polynomialsolver_1"
+  "polynomialsolver_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polynomialsolver_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
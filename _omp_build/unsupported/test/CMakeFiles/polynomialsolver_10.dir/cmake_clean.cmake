@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polynomialsolver_10.dir/polynomialsolver.cpp.o"
+  "CMakeFiles/polynomialsolver_10.dir/polynomialsolver.cpp.o.d"
+  "polynomialsolver_10"
+  "polynomialsolver_10.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polynomialsolver_10.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polynomialsolver_2.dir/polynomialsolver.cpp.o"
+  "CMakeFiles/polynomialsolver_2.dir/polynomialsolver.cpp.o.d"
+  "polynomialsolver_2"
+  "polynomialsolver_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polynomialsolver_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
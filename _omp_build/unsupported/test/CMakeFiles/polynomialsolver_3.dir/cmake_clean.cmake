@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polynomialsolver_3.dir/polynomialsolver.cpp.o"
+  "CMakeFiles/polynomialsolver_3.dir/polynomialsolver.cpp.o.d"
+  "polynomialsolver_3"
+  "polynomialsolver_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polynomialsolver_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polynomialsolver_4.dir/polynomialsolver.cpp.o"
+  "CMakeFiles/polynomialsolver_4.dir/polynomialsolver.cpp.o.d"
+  "polynomialsolver_4"
+  "polynomialsolver_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polynomialsolver_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
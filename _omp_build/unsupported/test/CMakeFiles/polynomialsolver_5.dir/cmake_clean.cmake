@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polynomialsolver_5.dir/polynomialsolver.cpp.o"
+  "CMakeFiles/polynomialsolver_5.dir/polynomialsolver.cpp.o.d"
+  "polynomialsolver_5"
+  "polynomialsolver_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polynomialsolver_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
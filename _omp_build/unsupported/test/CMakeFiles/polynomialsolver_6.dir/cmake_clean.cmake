@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polynomialsolver_6.dir/polynomialsolver.cpp.o"
+  "CMakeFiles/polynomialsolver_6.dir/polynomialsolver.cpp.o.d"
+  "polynomialsolver_6"
+  "polynomialsolver_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polynomialsolver_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polynomialsolver_7.dir/polynomialsolver.cpp.o"
+  "CMakeFiles/polynomialsolver_7.dir/polynomialsolver.cpp.o.d"
+  "polynomialsolver_7"
+  "polynomialsolver_7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polynomialsolver_7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polynomialsolver_8.dir/polynomialsolver.cpp.o"
+  "CMakeFiles/polynomialsolver_8.dir/polynomialsolver.cpp.o.d"
+  "polynomialsolver_8"
+  "polynomialsolver_8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polynomialsolver_8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
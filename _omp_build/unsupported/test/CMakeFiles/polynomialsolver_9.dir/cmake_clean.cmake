@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polynomialsolver_9.dir/polynomialsolver.cpp.o"
+  "CMakeFiles/polynomialsolver_9.dir/polynomialsolver.cpp.o.d"
+  "polynomialsolver_9"
+  "polynomialsolver_9.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polynomialsolver_9.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polynomialutils_2.dir/polynomialutils.cpp.o"
+  "CMakeFiles/polynomialutils_2.dir/polynomialutils.cpp.o.d"
+  "polynomialutils_2"
+  "polynomialutils_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polynomialutils_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
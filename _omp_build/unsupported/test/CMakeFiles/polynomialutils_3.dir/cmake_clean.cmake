@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polynomialutils_3.dir/polynomialutils.cpp.o"
+  "CMakeFiles/polynomialutils_3.dir/polynomialutils.cpp.o.d"
+  "polynomialutils_3"
+  "polynomialutils_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polynomialutils_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
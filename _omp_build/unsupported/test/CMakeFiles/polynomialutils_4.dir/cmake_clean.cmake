@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polynomialutils_4.dir/polynomialutils.cpp.o"
+  "CMakeFiles/polynomialutils_4.dir/polynomialutils.cpp.o.d"
+  "polynomialutils_4"
+  "polynomialutils_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polynomialutils_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
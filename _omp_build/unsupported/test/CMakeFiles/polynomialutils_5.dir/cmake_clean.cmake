@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polynomialutils_5.dir/polynomialutils.cpp.o"
+  "CMakeFiles/polynomialutils_5.dir/polynomialutils.cpp.o.d"
+  "polynomialutils_5"
+  "polynomialutils_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polynomialutils_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polynomialutils_6.dir/polynomialutils.cpp.o"
+  "CMakeFiles/polynomialutils_6.dir/polynomialutils.cpp.o.d"
+  "polynomialutils_6"
+  "polynomialutils_6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polynomialutils_6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
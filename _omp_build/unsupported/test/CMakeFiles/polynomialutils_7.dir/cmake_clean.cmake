@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polynomialutils_7.dir/polynomialutils.cpp.o"
+  "CMakeFiles/polynomialutils_7.dir/polynomialutils.cpp.o.d"
+  "polynomialutils_7"
+  "polynomialutils_7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polynomialutils_7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polynomialutils_8.dir/polynomialutils.cpp.o"
+  "CMakeFiles/polynomialutils_8.dir/polynomialutils.cpp.o.d"
+  "polynomialutils_8"
+  "polynomialutils_8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polynomialutils_8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polynomialutils_9.dir/polynomialutils.cpp.o"
+  "CMakeFiles/polynomialutils_9.dir/polynomialutils.cpp.o.d"
+  "polynomialutils_9"
+  "polynomialutils_9.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polynomialutils_9.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
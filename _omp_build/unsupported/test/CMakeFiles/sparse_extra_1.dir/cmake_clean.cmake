@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sparse_extra_1.dir/sparse_extra.cpp.o"
+  "CMakeFiles/sparse_extra_1.dir/sparse_extra.cpp.o.d"
+  "sparse_extra_1"
+  "sparse_extra_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sparse_extra_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
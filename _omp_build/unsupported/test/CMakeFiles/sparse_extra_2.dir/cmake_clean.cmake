@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sparse_extra_2.dir/sparse_extra.cpp.o"
+  "CMakeFiles/sparse_extra_2.dir/sparse_extra.cpp.o.d"
+  "sparse_extra_2"
+  "sparse_extra_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sparse_extra_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/splines.dir/splines.cpp.o"
+  "CMakeFiles/splines.dir/splines.cpp.o.d"
+  "splines"
+  "splines.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/splines.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,108 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/unsupported/test
+# Build directory: /root/repo/_omp_build/unsupported/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(NumericalDiff "/root/repo/test/runtest.sh" "NumericalDiff")
+set_tests_properties(NumericalDiff PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;145;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;27;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(autodiff "/root/repo/test/runtest.sh" "autodiff")
+set_tests_properties(autodiff PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;145;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;28;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(BVH_1 "/root/repo/test/runtest.sh" "BVH_1")
+set_tests_properties(BVH_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;31;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(BVH_2 "/root/repo/test/runtest.sh" "BVH_2")
+set_tests_properties(BVH_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;31;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(BVH_3 "/root/repo/test/runtest.sh" "BVH_3")
+set_tests_properties(BVH_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;31;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(matrix_exponential_2 "/root/repo/test/runtest.sh" "matrix_exponential_2")
+set_tests_properties(matrix_exponential_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;34;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(matrix_exponential_1 "/root/repo/test/runtest.sh" "matrix_exponential_1")
+set_tests_properties(matrix_exponential_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;34;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(matrix_exponential_8 "/root/repo/test/runtest.sh" "matrix_exponential_8")
+set_tests_properties(matrix_exponential_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;34;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(matrix_exponential_6 "/root/repo/test/runtest.sh" "matrix_exponential_6")
+set_tests_properties(matrix_exponential_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;34;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(matrix_exponential_5 "/root/repo/test/runtest.sh" "matrix_exponential_5")
+set_tests_properties(matrix_exponential_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;34;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(matrix_exponential_7 "/root/repo/test/runtest.sh" "matrix_exponential_7")
+set_tests_properties(matrix_exponential_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;34;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(matrix_exponential_3 "/root/repo/test/runtest.sh" "matrix_exponential_3")
+set_tests_properties(matrix_exponential_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;34;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(matrix_exponential_4 "/root/repo/test/runtest.sh" "matrix_exponential_4")
+set_tests_properties(matrix_exponential_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;34;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(matrix_exponential_9 "/root/repo/test/runtest.sh" "matrix_exponential_9")
+set_tests_properties(matrix_exponential_9 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;34;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(matrix_function_1 "/root/repo/test/runtest.sh" "matrix_function_1")
+set_tests_properties(matrix_function_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;35;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(matrix_function_2 "/root/repo/test/runtest.sh" "matrix_function_2")
+set_tests_properties(matrix_function_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;35;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(matrix_function_3 "/root/repo/test/runtest.sh" "matrix_function_3")
+set_tests_properties(matrix_function_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;35;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(matrix_function_4 "/root/repo/test/runtest.sh" "matrix_function_4")
+set_tests_properties(matrix_function_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;35;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(matrix_function_5 "/root/repo/test/runtest.sh" "matrix_function_5")
+set_tests_properties(matrix_function_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;35;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(matrix_function_6 "/root/repo/test/runtest.sh" "matrix_function_6")
+set_tests_properties(matrix_function_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;35;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(matrix_function_7 "/root/repo/test/runtest.sh" "matrix_function_7")
+set_tests_properties(matrix_function_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;35;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(matrix_square_root_1 "/root/repo/test/runtest.sh" "matrix_square_root_1")
+set_tests_properties(matrix_square_root_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;36;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(matrix_square_root_2 "/root/repo/test/runtest.sh" "matrix_square_root_2")
+set_tests_properties(matrix_square_root_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;36;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(matrix_square_root_3 "/root/repo/test/runtest.sh" "matrix_square_root_3")
+set_tests_properties(matrix_square_root_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;36;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(matrix_square_root_4 "/root/repo/test/runtest.sh" "matrix_square_root_4")
+set_tests_properties(matrix_square_root_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;36;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(matrix_square_root_5 "/root/repo/test/runtest.sh" "matrix_square_root_5")
+set_tests_properties(matrix_square_root_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;36;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(alignedvector3 "/root/repo/test/runtest.sh" "alignedvector3")
+set_tests_properties(alignedvector3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;145;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;37;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(FFT "/root/repo/test/runtest.sh" "FFT")
+set_tests_properties(FFT PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;145;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;38;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(sparse_extra_1 "/root/repo/test/runtest.sh" "sparse_extra_1")
+set_tests_properties(sparse_extra_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;51;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(sparse_extra_2 "/root/repo/test/runtest.sh" "sparse_extra_2")
+set_tests_properties(sparse_extra_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;51;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(sparse_extra_3 "/root/repo/test/runtest.sh" "sparse_extra_3")
+set_tests_properties(sparse_extra_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;51;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(polynomialsolver_1 "/root/repo/test/runtest.sh" "polynomialsolver_1")
+set_tests_properties(polynomialsolver_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;94;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(polynomialsolver_2 "/root/repo/test/runtest.sh" "polynomialsolver_2")
+set_tests_properties(polynomialsolver_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;94;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(polynomialsolver_3 "/root/repo/test/runtest.sh" "polynomialsolver_3")
+set_tests_properties(polynomialsolver_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;94;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(polynomialsolver_4 "/root/repo/test/runtest.sh" "polynomialsolver_4")
+set_tests_properties(polynomialsolver_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;94;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(polynomialsolver_5 "/root/repo/test/runtest.sh" "polynomialsolver_5")
+set_tests_properties(polynomialsolver_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;94;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(polynomialsolver_6 "/root/repo/test/runtest.sh" "polynomialsolver_6")
+set_tests_properties(polynomialsolver_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;94;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(polynomialsolver_7 "/root/repo/test/runtest.sh" "polynomialsolver_7")
+set_tests_properties(polynomialsolver_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;94;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(polynomialsolver_8 "/root/repo/test/runtest.sh" "polynomialsolver_8")
+set_tests_properties(polynomialsolver_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;94;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(polynomialsolver_9 "/root/repo/test/runtest.sh" "polynomialsolver_9")
+set_tests_properties(polynomialsolver_9 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;94;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(polynomialsolver_10 "/root/repo/test/runtest.sh" "polynomialsolver_10")
+set_tests_properties(polynomialsolver_10 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;94;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(polynomialutils_2 "/root/repo/test/runtest.sh" "polynomialutils_2")
+set_tests_properties(polynomialutils_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;95;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(polynomialutils_3 "/root/repo/test/runtest.sh" "polynomialutils_3")
+set_tests_properties(polynomialutils_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;95;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(polynomialutils_4 "/root/repo/test/runtest.sh" "polynomialutils_4")
+set_tests_properties(polynomialutils_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;95;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(polynomialutils_5 "/root/repo/test/runtest.sh" "polynomialutils_5")
+set_tests_properties(polynomialutils_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;95;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(polynomialutils_6 "/root/repo/test/runtest.sh" "polynomialutils_6")
+set_tests_properties(polynomialutils_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;95;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(polynomialutils_7 "/root/repo/test/runtest.sh" "polynomialutils_7")
+set_tests_properties(polynomialutils_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;95;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(polynomialutils_8 "/root/repo/test/runtest.sh" "polynomialutils_8")
+set_tests_properties(polynomialutils_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;95;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(polynomialutils_9 "/root/repo/test/runtest.sh" "polynomialutils_9")
+set_tests_properties(polynomialutils_9 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;135;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;95;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(kronecker_product "/root/repo/test/runtest.sh" "kronecker_product")
+set_tests_properties(kronecker_product PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;145;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;96;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
+add_test(splines "/root/repo/test/runtest.sh" "splines")
+set_tests_properties(splines PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/EigenTesting.cmake;72;add_test;/root/repo/cmake/EigenTesting.cmake;145;ei_add_test_internal;/root/repo/unsupported/test/CMakeLists.txt;97;ei_add_test;/root/repo/unsupported/test/CMakeLists.txt;0;")
@@ -21,6 +21,10 @@
 #define MINDENSITY 0.0004
 #endif
 
+#ifndef NBRHS
+#define NBRHS 32
+#endif
+
 #ifndef NBTRIES
 #define NBTRIES 10
 #endif
@@ -99,6 +103,14 @@ int main(int argc, char *argv[])
       BENCH( { asm("#mya"); v2 = sm1.transpose() * v1; asm("#myb"); })
 
       std::cout << "   a' * v:\t" << timer.best()/REPEAT << endl;
+
+      // multiple right hand sides
+      DenseMatrix mv1 = DenseMatrix::Random(cols, NBRHS), mv2(rows, NBRHS);
+      BENCH(mv2.noalias() = sm1 * mv1;)
+      std::cout << "   a * V:\t" << timer.best()/REPEAT << endl;
+
+      BENCH(mv2.noalias() = sm1.transpose() * mv1;)
+      std::cout << "   a' * V:\t" << timer.best()/REPEAT << endl;
     }
 
 //     {
@@ -113,6 +113,28 @@ int main(int argc, char *argv[])
       std::cout << t.value()/repeats << endl;
     }
 
+    // strong scaling of the multithreaded sparse * dense products
+    #ifdef EIGEN_HAS_OPENMP
+    {
+      int maxThreads = Eigen::internal::nbThreads();
+      DenseVector rv(rows);
+      rv.setRandom();
+      for(int nt=1; nt<=maxThreads; ++nt)
+      {
+        Eigen::internal::setNbThreads(nt);
+        SPMV_BENCH(res.noalias() += sm * dv; )
+        std::cout << "Eigen " << nt << " thr  " << t.value()/repeats << "\t";
+
+        SPMV_BENCH(res.noalias() += sm.transpose() * dv; )
+        std::cout << t.value()/repeats << "\t";
+
+        SPMV_BENCH(dv.transpose().noalias() += rv.transpose() * sm; )
+        std::cout << t.value()/repeats << endl;
+      }
+      Eigen::internal::setNbThreads(maxThreads);
+    }
+    #endif
+
     // CSparse
     #ifdef CSPARSE
     {
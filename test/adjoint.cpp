@@ -119,6 +119,74 @@ template<typename MatrixType> void adjoint(const MatrixType& m)
   VERIFY_IS_APPROX(rv1.template cast<Scalar>().dot(v1), rv1.dot(v1));
 }
 
+template<typename MatrixType> void transposition(const MatrixType& m)
+{
+  typedef typename MatrixType::Index Index;
+  typedef typename MatrixType::Scalar Scalar;
+  typedef Matrix<Scalar, Dynamic, Dynamic, MatrixType::IsRowMajor ? ColMajor : RowMajor> OtherOrderType;
+  Index rows = m.rows();
+  Index cols = m.cols();
+
+  MatrixType m1 = MatrixType::Random(rows, cols), m2(cols, rows), m3;
+  MatrixType ref(cols, rows);
+  for(Index i = 0; i < rows; ++i)
+    for(Index j = 0; j < cols; ++j)
+      ref(j,i) = m1(i,j);
+
+  // copies between opposite storage orders use the tiled kernels
+  m2 = m1.transpose();
+  VERIFY_IS_EQUAL(m2, ref);
+  m2.setZero();
+  m2.noalias() = m1.transpose();
+  VERIFY_IS_EQUAL(m2, ref);
+  OtherOrderType m4 = m1;
+  VERIFY_IS_EQUAL(m4, m1);
+  m3 = m4;
+  VERIFY_IS_EQUAL(m3, m1);
+
+  // blocks, with outer strides
+  MatrixType big = MatrixType::Random(rows+cols+3, rows+cols+5), big2 = big;
+  Index r0 = internal::random<Index>(0,rows+3), c0 = internal::random<Index>(0,cols+5);
+  big.block(r0, c0, cols, rows) = m1.transpose();
+  big2.block(r0, c0, cols, rows) = ref;
+  VERIFY_IS_EQUAL(big, big2);
+  m3 = big.block(r0, c0, cols, rows).transpose();
+  VERIFY_IS_EQUAL(m3, m1);
+  m2.transpose() = m1;
+  VERIFY_IS_EQUAL(m2, ref);
+
+  // swap is not a copy
+  m2 = ref;
+  m3 = m1;
+  m2.swap(m3.transpose());
+  VERIFY_IS_EQUAL(m2, ref);
+  VERIFY_IS_EQUAL(m3, m1);
+
+  // in place, with and without changing the shape
+  m3 = m1;
+  m3.transposeInPlace();
+  VERIFY_IS_EQUAL(m3, ref);
+  m3.transposeInPlace();
+  VERIFY_IS_EQUAL(m3, m1);
+
+  // the cycle following kernel used above EIGEN_INPLACE_TRANSPOSE_COPY_LIMIT bytes
+  internal::rectangular_transpose_in_place(m3.data(), m3.innerSize(), m3.outerSize());
+  m3.resize(cols, rows);
+  VERIFY_IS_EQUAL(m3, ref);
+  internal::rectangular_transpose_in_place(m3.data(), m3.innerSize(), m3.outerSize());
+  m3.resize(rows, cols);
+  VERIFY_IS_EQUAL(m3, m1);
+
+  Index n = (std::min)(rows, cols);
+  MatrixType square = m1.topLeftCorner(n, n);
+  square.transposeInPlace();
+  VERIFY_IS_EQUAL(square, ref.topLeftCorner(n, n));
+  big2 = big;
+  big.block(r0, c0, n, n).transposeInPlace();
+  big2.block(r0, c0, n, n) = big2.block(r0, c0, n, n).transpose().eval();
+  VERIFY_IS_EQUAL(big, big2);
+}
+
 void test_adjoint()
 {
   for(int i = 0; i < g_repeat; i++) {
@@ -132,6 +200,15 @@ void test_adjoint()
   // test a large static matrix only once
   CALL_SUBTEST_7( adjoint(Matrix<float, 100, 100>()) );
 
+  for(int i = 0; i < g_repeat; i++) {
+    CALL_SUBTEST_8( transposition(MatrixXf(internal::random<int>(1,200), internal::random<int>(1,200))) );
+    CALL_SUBTEST_8( transposition(Matrix<float,Dynamic,Dynamic,RowMajor>(internal::random<int>(1,200), internal::random<int>(1,200))) );
+    CALL_SUBTEST_9( transposition(MatrixXd(internal::random<int>(1,200), internal::random<int>(1,200))) );
+    CALL_SUBTEST_9( transposition(MatrixXi(internal::random<int>(1,200), internal::random<int>(1,200))) );
+    CALL_SUBTEST_10( transposition(MatrixXcf(internal::random<int>(1,100), internal::random<int>(1,100))) );
+    CALL_SUBTEST_10( transposition(Matrix<std::complex<double>,Dynamic,Dynamic,RowMajor>(internal::random<int>(1,100), internal::random<int>(1,100))) );
+  }
+
 #ifdef EIGEN_TEST_PART_4
   {
     MatrixXcf a(10,10), b(10,10);
@@ -25,17 +25,48 @@
 #include "sparse_solver.h"
 #include <Eigen/IterativeLinearSolvers>
 
+// IncompleteLUT does not pivot, so that it is checked on strictly diagonally dominant problems,
+// on which the factorization cannot break down and the preconditioned iterations converge reliably.
+template<typename Solver> void check_diagonally_dominant_solving(Solver& solver)
+{
+  typedef typename Solver::MatrixType Mat;
+  typedef typename Mat::Scalar Scalar;
+  typedef typename NumTraits<Scalar>::Real RealScalar;
+  typedef Matrix<Scalar,Dynamic,Dynamic> DenseMatrix;
+  typedef Matrix<Scalar,Dynamic,1> DenseVector;
+
+  int size = internal::random<int>(1,300);
+  Mat A(size,size);
+  DenseMatrix dA(size,size);
+  initSparse<Scalar>((std::max)(8./(size*size), 0.01), dA, A, ForceNonZeroDiag);
+  for(int i=0; i<size; ++i)
+  {
+    RealScalar rowSum = dA.row(i).cwiseAbs().sum();
+    dA(i,i) += rowSum;
+    A.coeffRef(i,i) += rowSum;
+  }
+
+  DenseVector b = DenseVector::Random(size);
+  DenseMatrix dB = DenseMatrix::Random(size, internal::random<int>(1,16));
+  check_sparse_solving(solver, A, b,  dA, b);
+  check_sparse_solving(solver, A, dB, dA, dB);
+}
+
 template<typename T> void test_bicgstab_T()
 {
   BiCGSTAB<SparseMatrix<T>, DiagonalPreconditioner<T> > bicgstab_colmajor_diag;
   BiCGSTAB<SparseMatrix<T>, IdentityPreconditioner    > bicgstab_colmajor_I;
   BiCGSTAB<SparseMatrix<T>, IncompleteLUT<T> >           bicgstab_colmajor_ilut;
   //BiCGSTAB<SparseMatrix<T>, SSORPreconditioner<T> >     bicgstab_colmajor_ssor;
+  PipelinedBiCGSTAB<SparseMatrix<T>, DiagonalPreconditioner<T> > pbicgstab_colmajor_diag;
+  PipelinedBiCGSTAB<SparseMatrix<T>, IncompleteLUT<T> >          pbicgstab_colmajor_ilut;
 
   CALL_SUBTEST( check_sparse_square_solving(bicgstab_colmajor_diag)  );
 //   CALL_SUBTEST( check_sparse_square_solving(bicgstab_colmajor_I)     );
   CALL_SUBTEST( check_sparse_square_solving(bicgstab_colmajor_ilut)     );
   //CALL_SUBTEST( check_sparse_square_solving(bicgstab_colmajor_ssor)     );
+  CALL_SUBTEST( check_sparse_square_solving(pbicgstab_colmajor_diag)  );
+  CALL_SUBTEST( check_diagonally_dominant_solving(pbicgstab_colmajor_ilut)  );
 }
 
 void test_bicgstab()
@@ -25,17 +25,81 @@
 #include "sparse_solver.h"
 #include <Eigen/IterativeLinearSolvers>
 
+template<typename T> SparseMatrix<T> poisson_2d(int n)
+{
+  std::vector<Triplet<T> > triplets;
+  for(int i=0; i<n; ++i)
+    for(int j=0; j<n; ++j)
+    {
+      int k = i*n+j;
+      triplets.push_back(Triplet<T>(k,k,T(4)));
+      if(i>0)   triplets.push_back(Triplet<T>(k,k-n,T(-1)));
+      if(i<n-1) triplets.push_back(Triplet<T>(k,k+n,T(-1)));
+      if(j>0)   triplets.push_back(Triplet<T>(k,k-1,T(-1)));
+      if(j<n-1) triplets.push_back(Triplet<T>(k,k+1,T(-1)));
+    }
+  SparseMatrix<T> A(n*n,n*n);
+  A.setFromTriplets(triplets.begin(), triplets.end());
+  return A;
+}
+
+template<typename T> void check_amg_poisson()
+{
+  typedef Matrix<T,Dynamic,1> DenseVector;
+  typedef typename NumTraits<T>::Real RealScalar;
+
+  // the number of iterations must not grow with the size of the mesh
+  int iters[2];
+  for(int k=0; k<2; ++k)
+  {
+    SparseMatrix<T> A = poisson_2d<T>(k==0 ? 20 : 80);
+    DenseVector b = DenseVector::Random(A.rows());
+    ConjugateGradient<SparseMatrix<T>, Lower, SmoothedAggregationAMG<T, Lower> > cg;
+    cg.preconditioner().setCoarseSize(50);
+    cg.setTolerance(RealScalar(1e-8));
+    cg.compute(A);
+    VERIFY(cg.preconditioner().levels()>1);
+    DenseVector x = cg.solve(b);
+    VERIFY(cg.info()==Success);
+    VERIFY((A*x-b).norm() <= RealScalar(1e-6)*b.norm());
+    iters[k] = cg.iterations();
+  }
+  VERIFY(iters[1] <= 2*iters[0]);
+  VERIFY(iters[1] <= 30);
+}
+
 template<typename T> void test_conjugate_gradient_T()
 {
+  typedef typename NumTraits<T>::Real RealScalar;
   ConjugateGradient<SparseMatrix<T>, Lower> cg_colmajor_lower_diag;
   ConjugateGradient<SparseMatrix<T>, Upper> cg_colmajor_upper_diag;
   ConjugateGradient<SparseMatrix<T>, Lower, IdentityPreconditioner> cg_colmajor_lower_I;
   ConjugateGradient<SparseMatrix<T>, Upper, IdentityPreconditioner> cg_colmajor_upper_I;
+  PipelinedConjugateGradient<SparseMatrix<T>, Lower> pcg_colmajor_lower_diag;
+  PipelinedConjugateGradient<SparseMatrix<T>, Upper, IdentityPreconditioner> pcg_colmajor_upper_I;
+  BlockConjugateGradient<SparseMatrix<T>, Lower> bcg_colmajor_lower_diag;
+  BlockConjugateGradient<SparseMatrix<T>, Upper, IdentityPreconditioner> bcg_colmajor_upper_I;
+  ConjugateGradient<SparseMatrix<T>, Lower, SmoothedAggregationAMG<T, Lower> > cg_colmajor_lower_amg;
+  cg_colmajor_lower_amg.preconditioner().setCoarseSize(8);
+  ConjugateGradient<SparseMatrix<T>, Lower, IncompleteCholesky<T, Lower> > cg_colmajor_lower_ichol;
+  ConjugateGradient<SparseMatrix<T>, Upper, IncompleteCholesky<T, Upper> > cg_colmajor_upper_ichol;
+  cg_colmajor_upper_ichol.preconditioner().setDroptol(RealScalar(1e-2));
+  cg_colmajor_upper_ichol.preconditioner().setFillfactor(1);
+  ConjugateGradient<SparseMatrix<T,ColMajor,long int,int>, Lower> cg_colmajor_lower_mixed_index;
 
   CALL_SUBTEST( check_sparse_spd_solving(cg_colmajor_lower_diag)  );
   CALL_SUBTEST( check_sparse_spd_solving(cg_colmajor_upper_diag)  );
   CALL_SUBTEST( check_sparse_spd_solving(cg_colmajor_lower_I)     );
   CALL_SUBTEST( check_sparse_spd_solving(cg_colmajor_upper_I)     );
+  CALL_SUBTEST( check_sparse_spd_solving(pcg_colmajor_lower_diag) );
+  CALL_SUBTEST( check_sparse_spd_solving(pcg_colmajor_upper_I)    );
+  CALL_SUBTEST( check_sparse_spd_solving(bcg_colmajor_lower_diag) );
+  CALL_SUBTEST( check_sparse_spd_solving(bcg_colmajor_upper_I)    );
+  CALL_SUBTEST( check_sparse_spd_solving(cg_colmajor_lower_amg)   );
+  CALL_SUBTEST( check_sparse_spd_solving(cg_colmajor_lower_ichol) );
+  CALL_SUBTEST( check_sparse_spd_solving(cg_colmajor_upper_ichol) );
+  CALL_SUBTEST( check_sparse_spd_solving(cg_colmajor_lower_mixed_index) );
+  CALL_SUBTEST( check_amg_poisson<T>() );
 }
 
 void test_conjugate_gradient()
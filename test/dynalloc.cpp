@@ -54,6 +54,53 @@ void check_aligned_malloc()
   }
 }
 
+void check_alignment_policy()
+{
+#if EIGEN_ALIGN
+  // the heap blocks are aligned on EIGEN_MALLOC_ALIGNMENT bytes, and the large ones on a huge page
+  for(int i = 1; i < 1000; i++)
+  {
+    char *p = (char*)internal::handmade_aligned_malloc(i, EIGEN_MALLOC_ALIGNMENT);
+    VERIFY(size_t(p)%EIGEN_MALLOC_ALIGNMENT==0);
+    for(int j = 0; j < i; j++) p[j]=0;
+    internal::handmade_aligned_free(p);
+
+    p = (char*)internal::aligned_malloc(i);
+    VERIFY(size_t(p)%internal::malloc_alignment(i)==0);
+    internal::aligned_free(p);
+  }
+  if(EIGEN_HUGE_PAGE_THRESHOLD!=0)
+  {
+    size_t size = EIGEN_HUGE_PAGE_THRESHOLD;
+    char *p = (char*)internal::aligned_malloc(size);
+    VERIFY(size_t(p)%EIGEN_HUGE_PAGE_SIZE==0);
+    internal::aligned_free(p);
+  }
+
+  // the content survives the reallocations, including when the alignment changes
+  size_t sizes[] = { 100, 1000, size_t(EIGEN_HUGE_PAGE_THRESHOLD)+100, 10 };
+  size_t size = 0;
+  char *p = 0, *q = 0;
+  for(int k = 0; k < 4; k++)
+  {
+    p = (char*)internal::aligned_realloc(p, sizes[k], size);
+    q = (char*)internal::handmade_aligned_realloc(q, sizes[k], size, internal::malloc_alignment(sizes[k]));
+    VERIFY(size_t(p)%internal::malloc_alignment(sizes[k])==0);
+    VERIFY(size_t(q)%internal::malloc_alignment(sizes[k])==0);
+    for(size_t j = 0; j < (std::min)(size,sizes[k]); j++)
+    {
+      VERIFY_IS_EQUAL(int(p[j]), int(char(j%127)));
+      VERIFY_IS_EQUAL(int(q[j]), int(char(j%127)));
+    }
+    size = sizes[k];
+    for(size_t j = 0; j < size; j++)
+      p[j] = q[j] = char(j%127);
+  }
+  internal::aligned_free(p);
+  internal::handmade_aligned_free(q);
+#endif
+}
+
 void check_aligned_new()
 {
   for(int i = 1; i < 1000; i++)
@@ -106,6 +153,7 @@ void test_dynalloc()
   // low level dynamic memory allocation
   CALL_SUBTEST(check_handmade_aligned_malloc());
   CALL_SUBTEST(check_aligned_malloc());
+  CALL_SUBTEST(check_alignment_policy());
   CALL_SUBTEST(check_aligned_new());
   CALL_SUBTEST(check_aligned_stack_alloc());
 
@@ -0,0 +1,159 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#include "main.h"
+
+template<typename VectorType> void fused_vectors(const VectorType& p)
+{
+  typedef typename VectorType::Scalar Scalar;
+  typedef typename NumTraits<Scalar>::Real RealScalar;
+  typedef typename VectorType::Index Index;
+  Index size = p.size();
+
+  VectorType b = VectorType::Random(size), c = VectorType::Random(size), e = VectorType::Random(size);
+  VectorType a, d, a_ref, d_ref;
+  Scalar s;
+  RealScalar m;
+
+  FusedEvaluation fused;
+  fused.assign(a, b + c);
+  fused.assign(d, a.cwiseProduct(e) - Scalar(2) * b);
+  fused.sum(d, s);
+  fused.redux(a.cwiseAbs(), internal::scalar_max_op<RealScalar>(), m);
+  fused.evaluate();
+
+  a_ref = b + c;
+  d_ref = a_ref.cwiseProduct(e) - Scalar(2) * b;
+  VERIFY_IS_EQUAL(a, a_ref);
+  VERIFY_IS_EQUAL(d, d_ref);
+  VERIFY_IS_APPROX(s, d_ref.sum());
+  VERIFY_IS_EQUAL(m, a_ref.cwiseAbs().maxCoeff());
+
+  // the recorded statements can be evaluated again with new inputs
+  b.setRandom();
+  fused.evaluate();
+  a_ref = b + c;
+  d_ref = a_ref.cwiseProduct(e) - Scalar(2) * b;
+  VERIFY_IS_EQUAL(a, a_ref);
+  VERIFY_IS_EQUAL(d, d_ref);
+  VERIFY_IS_APPROX(s, d_ref.sum());
+
+  // updates in place, and reductions of vectors of the other orientation
+  Matrix<Scalar,1,Dynamic> r = Matrix<Scalar,1,Dynamic>::Random(size);
+  Scalar rs;
+  fused.clear();
+  fused.assign(a, a + c);
+  fused.assign(d, d.cwiseProduct(a));
+  fused.sum(r, rs);
+  fused.evaluate();
+  a_ref += c;
+  d_ref = d_ref.cwiseProduct(a_ref);
+  VERIFY_IS_EQUAL(a, a_ref);
+  VERIFY_IS_EQUAL(d, d_ref);
+  VERIFY_IS_APPROX(rs, r.sum());
+}
+
+template<typename MatrixType> void fused_matrices(const MatrixType& p)
+{
+  typedef typename MatrixType::Scalar Scalar;
+  typedef typename MatrixType::Index Index;
+  Index rows = p.rows(), cols = p.cols();
+
+  MatrixType b = MatrixType::Random(rows, cols), c = MatrixType::Random(rows, cols);
+  MatrixType big = MatrixType::Random(rows+3, cols+2);
+  MatrixType a, d, a_ref, d_ref, big_ref = big;
+  Scalar s;
+
+  // blocks have no linear access, and are evaluated on whole outer vectors
+  FusedEvaluation fused;
+  fused.assign(a, b - c);
+  fused.assign(big.block(1, 2, rows, cols), a.array().abs().matrix() + big.block(1, 2, rows, cols));
+  fused.assign(d, big.block(1, 2, rows, cols).cwiseProduct(b));
+  fused.sum(big.block(1, 2, rows, cols), s);
+  fused.evaluate();
+
+  a_ref = b - c;
+  big_ref.block(1, 2, rows, cols) += a_ref.array().abs().matrix();
+  d_ref = big_ref.block(1, 2, rows, cols).cwiseProduct(b);
+  VERIFY_IS_EQUAL(a, a_ref);
+  VERIFY_IS_EQUAL(big, big_ref);
+  VERIFY_IS_EQUAL(d, d_ref);
+  VERIFY_IS_APPROX(s, big_ref.block(1, 2, rows, cols).sum());
+
+  // a statement without linear access and of another shape forces a single tile
+  typedef Matrix<Scalar,Dynamic,1> VectorType;
+  VectorType w = VectorType::Random(rows*cols);
+  Scalar ws;
+  fused.clear();
+  fused.sum(w.replicate(1,1), ws);
+  fused.assign(big.block(1, 2, rows, cols), big.block(1, 2, rows, cols) + b);
+  fused.evaluate();
+  big_ref.block(1, 2, rows, cols) += b;
+  VERIFY_IS_APPROX(ws, w.sum());
+  VERIFY_IS_EQUAL(big, big_ref);
+}
+
+template<typename ArrayType> void fused_arrays(const ArrayType& p)
+{
+  typedef typename ArrayType::Scalar Scalar;
+  typedef typename ArrayType::Index Index;
+  Index rows = p.rows(), cols = p.cols();
+
+  ArrayType x = ArrayType::Random(rows, cols), y = ArrayType::Random(rows, cols);
+  ArrayType u(rows, cols), v(rows, cols);
+  Scalar s;
+
+  FusedEvaluation fused;
+  fused.assign(u, x * y + Scalar(1));
+  fused.assign(v, u.square() - x);
+  fused.sum(v * y, s);
+  fused.evaluate();
+
+  ArrayType u_ref = x * y + Scalar(1);
+  ArrayType v_ref = u_ref.square() - x;
+  VERIFY_IS_EQUAL(u.matrix(), u_ref.matrix());
+  VERIFY_IS_EQUAL(v.matrix(), v_ref.matrix());
+  VERIFY_IS_APPROX(s, (v_ref * y).sum());
+}
+
+void test_fused_evaluation()
+{
+  std::ptrdiff_t l1 = l1CacheSize(), l2 = l2CacheSize();
+  for(int i = 0; i < g_repeat; i++) {
+    CALL_SUBTEST_1( fused_vectors(VectorXf(internal::random<int>(1,20000))) );
+    CALL_SUBTEST_1( fused_vectors(VectorXd(internal::random<int>(1,20000))) );
+    CALL_SUBTEST_2( fused_vectors(VectorXcf(internal::random<int>(1,5000))) );
+    CALL_SUBTEST_2( fused_vectors(Vector4d()) );
+    CALL_SUBTEST_3( fused_matrices(MatrixXf(internal::random<int>(1,300), internal::random<int>(1,300))) );
+    CALL_SUBTEST_3( fused_matrices(Matrix<double,Dynamic,Dynamic,RowMajor>(internal::random<int>(1,300), internal::random<int>(1,300))) );
+    CALL_SUBTEST_4( fused_arrays(ArrayXXd(internal::random<int>(1,300), internal::random<int>(1,300))) );
+    CALL_SUBTEST_4( fused_arrays(ArrayXi(internal::random<int>(1,20000))) );
+
+    // many small tiles
+    setCpuCacheSizes(1024, l2);
+    CALL_SUBTEST_5( fused_vectors(VectorXf(internal::random<int>(1,5000))) );
+    CALL_SUBTEST_5( fused_matrices(MatrixXd(internal::random<int>(1,100), internal::random<int>(1,100))) );
+    CALL_SUBTEST_5( fused_matrices(MatrixXd(internal::random<int>(30,60), internal::random<int>(70,100))) );
+    CALL_SUBTEST_5( fused_arrays(ArrayXXf(internal::random<int>(1,100), internal::random<int>(1,100))) );
+    setCpuCacheSizes(l1, l2);
+  }
+}
@@ -0,0 +1,119 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+// heap allocations raise an assert when they are disabled at runtime
+#define EIGEN_RUNTIME_NO_MALLOC
+#include "main.h"
+
+template<typename Scalar> void memory_arena_products()
+{
+  typedef Matrix<Scalar,Dynamic,Dynamic> MatrixType;
+  typedef Matrix<Scalar,Dynamic,1> VectorType;
+  int size = internal::random<int>(10,100);
+  MatrixType a = MatrixType::Random(size,size), b = MatrixType::Random(size,size), c(size,size), ref(size,size);
+  VectorType x = VectorType::Random(size), y(size);
+  ref = (a * b + b) * a.adjoint();
+
+  // the worker threads of the products do not use the arena of the calling thread
+  int threads = internal::nbThreads();
+  internal::setNbThreads(1);
+  MemoryArena arena(16 * size * size * sizeof(Scalar) + (1<<20));
+  {
+    MemoryArenaScope scope(arena);
+    internal::set_is_malloc_allowed(false);
+    c.noalias() = (a * b + b) * a.adjoint();
+    y.noalias() = (a * b) * x;
+    internal::set_is_malloc_allowed(true);
+  }
+  internal::setNbThreads(threads);
+  VERIFY_IS_APPROX(c, ref);
+  VERIFY_IS_APPROX(y, (a * b) * x);
+  VERIFY(arena.allocations() > 0);
+  VERIFY(arena.bytesAllocated() >= size_t(size*size*sizeof(Scalar)));
+  VERIFY(arena.peak() >= arena.bytesAllocated() / arena.allocations());
+  VERIFY(arena.peak() <= arena.capacity());
+  VERIFY_IS_EQUAL(arena.heapAllocations(), size_t(0));
+  VERIFY_IS_EQUAL(arena.used(), size_t(0));
+}
+
+void memory_arena_stack()
+{
+  MemoryArena arena(1024);
+  MemoryArenaScope scope(arena);
+
+  // the memory is reused as soon as the blocks at the top of the stack are freed
+  void* p1 = internal::aligned_malloc(100);
+  void* p2 = internal::aligned_malloc(100);
+  void* p3 = internal::aligned_malloc(100);
+  VERIFY(arena.owns(p1) && arena.owns(p2) && arena.owns(p3));
+  VERIFY_IS_EQUAL(size_t(p1)%16, size_t(0));
+  VERIFY_IS_EQUAL(size_t(p2)%16, size_t(0));
+  size_t used = arena.used();
+  internal::aligned_free(p2);
+  VERIFY_IS_EQUAL(arena.used(), used);
+  internal::aligned_free(p3);
+  VERIFY(arena.used() < used);
+  void* p4 = internal::aligned_malloc(100);
+  VERIFY(p4 == p2);
+  internal::aligned_free(p4);
+  internal::aligned_free(p1);
+  VERIFY_IS_EQUAL(arena.used(), size_t(0));
+
+  // realloc moves the data
+  float* f = internal::conditional_aligned_new_auto<float,true>(10);
+  for(int i=0; i<10; ++i) f[i] = float(i);
+  f = internal::conditional_aligned_realloc_new_auto<float,true>(f, 50, 10);
+  VERIFY(arena.owns(f));
+  for(int i=0; i<10; ++i) VERIFY_IS_EQUAL(f[i], float(i));
+  internal::conditional_aligned_delete_auto<float,true>(f, 50);
+
+  // the allocations which do not fit go to the heap
+  VectorXd big(1000);
+  VERIFY(!arena.owns(big.data()));
+  VERIFY_IS_EQUAL(arena.heapAllocations(), size_t(1));
+  VERIFY_IS_EQUAL(arena.heapBytesAllocated(), size_t(1000*sizeof(double)));
+  big.resize(0);
+
+  // nested scopes
+  MemoryArena inner(1024);
+  void* outerBlock = internal::aligned_malloc(16);
+  {
+    MemoryArenaScope innerScope(inner);
+    void* innerBlock = internal::aligned_malloc(16);
+    VERIFY(inner.owns(innerBlock) && !arena.owns(innerBlock));
+    internal::aligned_free(outerBlock);
+    internal::aligned_free(innerBlock);
+  }
+  VERIFY_IS_EQUAL(arena.used(), size_t(0));
+  VERIFY_IS_EQUAL(inner.used(), size_t(0));
+  VERIFY_IS_EQUAL(inner.allocations(), size_t(1));
+}
+
+void test_memory_arena()
+{
+  for(int i = 0; i < g_repeat; i++) {
+    CALL_SUBTEST_1( memory_arena_products<double>() );
+    CALL_SUBTEST_2( memory_arena_products<std::complex<double> >() );
+    CALL_SUBTEST_3( memory_arena_stack() );
+  }
+}
@@ -0,0 +1,70 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#include "sparse_solver.h"
+#include <Eigen/IterativeLinearSolvers>
+
+template<typename T> void check_minres_indefinite()
+{
+  typedef Matrix<T,Dynamic,Dynamic> DenseMatrix;
+  typedef Matrix<T,Dynamic,1> DenseVector;
+  typedef typename NumTraits<T>::Real RealScalar;
+
+  // a selfadjoint matrix with eigenvalues of both signs
+  int size = internal::random<int>(1,200);
+  DenseMatrix dA(size,size);
+  SparseMatrix<T> A(size,size), M(size,size);
+  initSparse<T>((std::max)(8./(size*size), 0.01), dA, M);
+  M = RealScalar(0.1) * M;
+  A = M + SparseMatrix<T>(M.adjoint());
+  for(int i=0; i<size; ++i)
+    A.coeffRef(i,i) += (i%2==0 ? RealScalar(1) : RealScalar(-1)) * internal::random<RealScalar>(1,2);
+  dA = A;
+
+  DenseVector b = DenseVector::Random(size);
+  MINRES<SparseMatrix<T>, Lower|Upper> minres(A);
+  minres.setTolerance(RealScalar(1e-12));
+  DenseVector x = minres.solve(b);
+  VERIFY(minres.info() == Success);
+  VERIFY_IS_APPROX(x, dA.lu().solve(b));
+}
+
+template<typename T> void test_minres_T()
+{
+  MINRES<SparseMatrix<T>, Lower> minres_colmajor_lower_I;
+  MINRES<SparseMatrix<T>, Upper> minres_colmajor_upper_I;
+  MINRES<SparseMatrix<T>, Lower, DiagonalPreconditioner<T> > minres_colmajor_lower_diag;
+
+  CALL_SUBTEST( check_sparse_spd_solving(minres_colmajor_lower_I)    );
+  CALL_SUBTEST( check_sparse_spd_solving(minres_colmajor_upper_I)    );
+  CALL_SUBTEST( check_sparse_spd_solving(minres_colmajor_lower_diag) );
+  CALL_SUBTEST( check_minres_indefinite<T>() );
+}
+
+void test_minres()
+{
+  for(int i = 0; i < g_repeat; i++) {
+    CALL_SUBTEST_1(test_minres_T<double>());
+    CALL_SUBTEST_2(test_minres_T<std::complex<double> >());
+  }
+}
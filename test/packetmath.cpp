@@ -218,6 +218,17 @@ template<typename Scalar> void packetmath()
     ref[i] = data1[PacketSize-i-1];
   internal::pstore(data2, internal::preverse(internal::pload<Packet>(data1)));
   VERIFY(areApprox(ref, data2, PacketSize) && "internal::preverse");
+
+  for (int j=0; j<PacketSize; ++j)
+    packets[j] = internal::pload<Packet>(data1+j*PacketSize);
+  internal::ptranspose(packets);
+  for (int j=0; j<PacketSize; ++j)
+  {
+    internal::pstore(data2, packets[j]);
+    for (int i=0; i<PacketSize; ++i)
+      ref[i] = data1[j+i*PacketSize];
+    VERIFY(areApprox(ref, data2, PacketSize) && "internal::ptranspose");
+  }
 }
 
 template<typename Scalar> void packetmath_real()
@@ -0,0 +1,174 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#include "main.h"
+
+// Checks that noalias() assignments, which may be evaluated by several threads,
+// give exactly the same result as the sequential evaluation.
+template<typename MatrixType> void parallel_assign(const MatrixType& m)
+{
+  typedef typename MatrixType::Index Index;
+  typedef typename MatrixType::Scalar Scalar;
+  typedef Matrix<Scalar, MatrixType::RowsAtCompileTime, MatrixType::ColsAtCompileTime,
+                 MatrixType::IsRowMajor ? ColMajor : RowMajor> OtherMatrixType;
+  typedef Matrix<Scalar, Dynamic, Dynamic, MatrixType::IsRowMajor ? RowMajor : ColMajor> DynamicMatrixType;
+  Index rows = m.rows();
+  Index cols = m.cols();
+
+  MatrixType a = MatrixType::Random(rows, cols),
+             b = MatrixType::Random(rows, cols),
+             c(rows, cols), ref(rows, cols);
+  OtherMatrixType t = OtherMatrixType::Random(rows, cols);
+  Scalar s = internal::random<Scalar>();
+
+  const int initialThreads = internal::nbThreads();
+  const int threads[] = { 1, 2, 3, initialThreads };
+  for(int k = 0; k < 4; ++k)
+  {
+    internal::setNbThreads(threads[k]);
+
+    // linear traversal
+    ref.lazyAssign(a * s + b);
+    c.noalias() = a * s + b;
+    VERIFY_IS_EQUAL(c, ref);
+
+    ref.lazyAssign(ref + a);
+    c.noalias() += a;
+    VERIFY_IS_EQUAL(c, ref);
+
+    ref.lazyAssign(ref - b);
+    c.noalias() -= b;
+    VERIFY_IS_EQUAL(c, ref);
+
+    // the storage orders differ
+    ref.lazyAssign(t + a);
+    c.noalias() = t + a;
+    VERIFY_IS_EQUAL(c, ref);
+
+    // slices of unaligned outer vectors
+    Index r = rows - 3, co = cols - 2;
+    ref.block(1, 2, r, co).lazyAssign(a.block(2, 0, r, co) - b.block(0, 1, r, co));
+    c.block(1, 2, r, co).noalias() = a.block(2, 0, r, co) - b.block(0, 1, r, co);
+    VERIFY_IS_EQUAL(c, ref);
+
+    // a plain destination whose outer vectors are not all aligned
+    DynamicMatrixType e(r, co), eref(r, co);
+    eref.lazyAssign(a.block(2, 0, r, co) - b.block(0, 1, r, co));
+    e.noalias() = a.block(2, 0, r, co) - b.block(0, 1, r, co);
+    VERIFY_IS_EQUAL(e, eref);
+
+    // arrays
+    ref.array().lazyAssign(a.array() * b.array() + s);
+    c.array().noalias() = a.array() * b.array() + s;
+    VERIFY_IS_EQUAL(c, ref);
+  }
+  internal::setNbThreads(initialThreads);
+
+  // the destination is resized as usual
+  MatrixType d;
+  d.noalias() = a + b;
+  VERIFY_IS_EQUAL(d, (a + b).eval());
+}
+
+// Checks that large reductions do not depend on the number of threads once they are multithreaded,
+// and that the sequential ones are unchanged.
+template<typename MatrixType> void parallel_redux(const MatrixType& m)
+{
+  typedef typename MatrixType::Index Index;
+  typedef typename MatrixType::Scalar Scalar;
+  typedef typename NumTraits<Scalar>::Real RealScalar;
+  typedef internal::scalar_sum_op<Scalar> SumOp;
+  Index rows = m.rows();
+  Index cols = m.cols();
+
+  MatrixType a = MatrixType::Random(rows, cols);
+
+  const int initialThreads = internal::nbThreads();
+  internal::setNbThreads(1);
+  Scalar sum = a.sum();
+  Scalar maxc = a.real().maxCoeff();
+  VERIFY(sum == (internal::redux_impl<SumOp, MatrixType>::run(a, SumOp())));
+  internal::setNbThreads(2);
+  Scalar sum2 = a.sum();
+  RealScalar sqnorm = a.squaredNorm();
+  internal::setNbThreads(initialThreads > 3 ? initialThreads : 3);
+  VERIFY(a.sum() == sum2);
+  VERIFY(a.squaredNorm() == sqnorm);
+  VERIFY(a.real().maxCoeff() == maxc);
+  internal::setNbThreads(initialThreads);
+
+  Scalar ref(0);
+  RealScalar refSqnorm(0);
+  RealScalar refMax = internal::real(a(0,0));
+  for(Index j = 0; j < cols; ++j)
+  {
+    // sum the columns separately to keep the rounding errors of the reference small
+    Scalar colRef(0);
+    for(Index i = 0; i < rows; ++i)
+    {
+      colRef += a(i,j);
+      refSqnorm += internal::abs2(a(i,j));
+      refMax = (std::max)(refMax, internal::real(a(i,j)));
+    }
+    ref += colRef;
+  }
+  VERIFY_IS_APPROX(sum, ref);
+  VERIFY_IS_APPROX(sum2, ref);
+  VERIFY_IS_APPROX(sqnorm, refSqnorm);
+  VERIFY(maxc == refMax);
+  VERIFY_IS_APPROX(a.colwise().sum().sum(), sum);
+  VERIFY_IS_APPROX(a.block(1, 1, rows-2, cols-1).sum(), a.sum() - a.row(0).sum() - a.row(rows-1).sum() - a.col(0).segment(1,rows-2).sum());
+}
+
+template<typename Scalar> void parallel_redux_exact()
+{
+  // with integers the blocked reductions must be exact
+  typedef Matrix<Scalar,Dynamic,Dynamic> MatrixType;
+  typedef Matrix<Scalar,1,Dynamic> RowVectorType;
+  MatrixType a = MatrixType::Random(internal::random<int>(200,300), internal::random<int>(200,300));
+  Scalar ref(0);
+  for(int j = 0; j < a.cols(); ++j)
+    for(int i = 0; i < a.rows(); ++i)
+      ref += a(i,j);
+  VERIFY_IS_EQUAL(a.sum(), ref);
+  VERIFY_IS_EQUAL(a.transpose().sum(), ref);
+  VERIFY_IS_EQUAL(RowVectorType::Map(a.data(), a.size()).sum(), ref);
+}
+
+void test_parallel_eval()
+{
+  for(int i = 0; i < g_repeat; i++) {
+    CALL_SUBTEST_1( parallel_assign(MatrixXf(internal::random<int>(300,600), internal::random<int>(300,600))) );
+    CALL_SUBTEST_1( parallel_assign(Matrix<float,4,Dynamic>(4, internal::random<int>(50000,100000))) );
+    CALL_SUBTEST_2( parallel_assign(Matrix<double,Dynamic,Dynamic,RowMajor>(internal::random<int>(300,600), internal::random<int>(300,600))) );
+    CALL_SUBTEST_3( parallel_assign(MatrixXcd(internal::random<int>(200,400), internal::random<int>(200,400))) );
+    CALL_SUBTEST_4( parallel_assign(MatrixXi(internal::random<int>(300,600), internal::random<int>(300,600))) );
+
+    CALL_SUBTEST_5( parallel_redux(MatrixXf(internal::random<int>(300,600), internal::random<int>(300,600))) );
+    CALL_SUBTEST_5( parallel_redux(MatrixXf(internal::random<int>(40000,50000), 3)) );
+    CALL_SUBTEST_6( parallel_redux(MatrixXd(internal::random<int>(300,600), internal::random<int>(300,600))) );
+    CALL_SUBTEST_6( parallel_redux(Matrix<double,Dynamic,Dynamic,RowMajor>(internal::random<int>(3,40), internal::random<int>(10000,50000))) );
+    CALL_SUBTEST_7( parallel_redux(MatrixXcd(internal::random<int>(200,400), internal::random<int>(200,400))) );
+    CALL_SUBTEST_8( parallel_redux_exact<int>() );
+  }
+}
@@ -0,0 +1,123 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+// heap allocations raise an assert when they are disabled at runtime
+#define EIGEN_RUNTIME_NO_MALLOC
+#include "main.h"
+
+bool product_workspace_is_aligned()
+{
+  internal::product_workspace_slot* slots = internal::product_workspace();
+  for(int i=0; i<internal::ProductWorkspaceSlots; ++i)
+    if(std::size_t(slots[i].data) % EIGEN_PRODUCT_WORKSPACE_ALIGNMENT != 0)
+      return false;
+  return true;
+}
+
+template<typename Scalar> void product_workspace_level3()
+{
+  typedef Matrix<Scalar,Dynamic,Dynamic> MatrixType;
+  int rows = internal::random<int>(100,300), cols = internal::random<int>(100,300), depth = internal::random<int>(100,300);
+  MatrixType a = MatrixType::Random(rows,depth), b = MatrixType::Random(depth,cols), c(rows,cols), ref(rows,cols);
+  MatrixType s = MatrixType::Random(rows,rows), t = MatrixType::Random(rows,rows), x = MatrixType::Random(rows,cols);
+  t.diagonal().array() += Scalar(rows);
+  s.diagonal() = s.diagonal().real().template cast<Scalar>();
+
+  // the workspace is only used by the threads which reserved it
+  releaseProductWorkspace();
+  c.noalias() = a * b;
+  VERIFY_IS_APPROX(c, a.lazyProduct(b));
+  VERIFY_IS_EQUAL(productWorkspaceSize(), std::size_t(0));
+
+  // it then grows on demand, and is kept between the calls
+  reserveProductWorkspace<Scalar>(1, 1, 1);
+  std::size_t size = productWorkspaceSize();
+  c.noalias() = a * b;
+  VERIFY_IS_APPROX(c, a.lazyProduct(b));
+  VERIFY(productWorkspaceSize() > size);
+  size = productWorkspaceSize();
+  VERIFY(product_workspace_is_aligned());
+  c.noalias() = a * b;
+  VERIFY_IS_EQUAL(productWorkspaceSize(), size);
+
+  // once pre-sized, the level 3 kernels do not allocate
+  reserveProductWorkspace<Scalar>(rows, cols, (std::max)(rows,depth));
+  VERIFY(productWorkspaceSize() >= size);
+  VERIFY(product_workspace_is_aligned());
+  MatrixType symm(rows,cols), trmm(rows,cols), trsm = x;
+  int threads = internal::nbThreads();
+  internal::setNbThreads(1);
+  internal::set_is_malloc_allowed(false);
+  c.noalias() = a * b;
+  symm.noalias() = s.template selfadjointView<Lower>() * x;
+  trmm.noalias() = t.template triangularView<Upper>() * x;
+  t.template triangularView<Lower>().solveInPlace(trsm);
+  internal::set_is_malloc_allowed(true);
+  internal::setNbThreads(threads);
+  VERIFY_IS_APPROX(c, a.lazyProduct(b));
+  VERIFY_IS_APPROX(symm, MatrixType(s.template selfadjointView<Lower>()).lazyProduct(x));
+  VERIFY_IS_APPROX(trmm, MatrixType(t.template triangularView<Upper>()).lazyProduct(x));
+  VERIFY_IS_APPROX(MatrixType(t.template triangularView<Lower>()).lazyProduct(trsm), x);
+
+  releaseProductWorkspace();
+  VERIFY_IS_EQUAL(productWorkspaceSize(), std::size_t(0));
+}
+
+void product_workspace_fallback()
+{
+  MatrixXd a = MatrixXd::Random(200,150), b = MatrixXd::Random(150,250), c(200,250);
+  releaseProductWorkspace();
+
+  // a buffer in use is not shared
+  reserveProductWorkspace<double>(200,250,150);
+  void* buffer = internal::product_workspace_acquire(internal::ProductWorkspaceB, 16);
+  VERIFY(buffer != 0);
+  VERIFY(internal::product_workspace_acquire(internal::ProductWorkspaceB, 16) == 0);
+  c.noalias() = a * b;
+  VERIFY_IS_APPROX(c, a.lazyProduct(b));
+  internal::product_workspace_release(internal::ProductWorkspaceB);
+  releaseProductWorkspace();
+
+  // the workspace does not grow while a memory arena is active
+  reserveProductWorkspace<double>(1,1,1);
+  std::size_t size = productWorkspaceSize();
+  MemoryArena arena(1<<22);
+  {
+    MemoryArenaScope scope(arena);
+    c.noalias() = a * b;
+  }
+  VERIFY_IS_APPROX(c, a.lazyProduct(b));
+  VERIFY_IS_EQUAL(productWorkspaceSize(), size);
+  VERIFY(arena.allocations() > 0);
+  releaseProductWorkspace();
+}
+
+void test_product_workspace()
+{
+  for(int i = 0; i < g_repeat; i++) {
+    CALL_SUBTEST_1( product_workspace_level3<float>() );
+    CALL_SUBTEST_2( product_workspace_level3<double>() );
+    CALL_SUBTEST_3( product_workspace_level3<std::complex<double> >() );
+    CALL_SUBTEST_4( product_workspace_fallback() );
+  }
+}
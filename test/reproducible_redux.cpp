@@ -0,0 +1,170 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#if defined(EIGEN_TEST_PART_4) || defined(EIGEN_TEST_PART_5)
+#define EIGEN_REPRODUCIBLE_REDUX_COMPENSATED
+#else
+#define EIGEN_REPRODUCIBLE_REDUX
+#endif
+#include "main.h"
+
+// the summation order which EIGEN_REPRODUCIBLE_REDUX guarantees, whatever the vectorization
+template<typename MatrixType>
+typename MatrixType::Scalar reference_sum(const MatrixType& m)
+{
+  typedef typename MatrixType::Scalar Scalar;
+  typedef typename MatrixType::Index Index;
+  enum { Lanes = EIGEN_REPRODUCIBLE_REDUX_LANES };
+  Scalar sum[Lanes], comp[Lanes];
+  for(int l = 0; l < Lanes; ++l)
+    sum[l] = comp[l] = Scalar(0);
+  const Index alignedInnerSize = (m.innerSize() / Lanes) * Lanes;
+  for(int pass = 0; pass < 2; ++pass)
+    for(Index outer = 0; outer < m.outerSize(); ++outer)
+      for(Index inner = pass==0 ? 0 : alignedInnerSize; inner < (pass==0 ? alignedInnerSize : m.innerSize()); ++inner)
+      {
+        const int l = int(inner % Lanes);
+        const Scalar x = m.coeffByOuterInner(outer, inner);
+#ifdef EIGEN_REPRODUCIBLE_REDUX_COMPENSATED
+        const Scalar y = x - comp[l];
+        const Scalar t = sum[l] + y;
+        comp[l] = (t - sum[l]) - y;
+        sum[l] = t;
+#else
+        sum[l] += x;
+#endif
+      }
+  for(int l = 0; l < Lanes; ++l)
+    sum[l] -= comp[l];
+  for(int step = 1; step < Lanes; step *= 2)
+    for(int l = 0; l + step < Lanes; l += 2*step)
+      sum[l] += sum[l+step];
+  return sum[0];
+}
+
+template<typename VectorType> void reproducible_vector_redux(const VectorType& w)
+{
+  typedef typename VectorType::Scalar Scalar;
+  typedef typename VectorType::Index Index;
+  typedef typename NumTraits<Scalar>::Real RealScalar;
+  typedef Matrix<Scalar,Dynamic,1> PlainVectorType;
+  Index size = w.size();
+
+  // copies of the same vector starting at various offsets from an aligned address
+  Scalar* buffer = internal::aligned_new<Scalar>(2*size + 8);
+  Map<PlainVectorType> v(buffer, size);
+  PlainVectorType u = PlainVectorType::Random(size);
+  v = PlainVectorType::Random(size);
+  const Scalar sum = v.sum();
+  const Scalar dot = v.dot(u);
+  const RealScalar sqnorm = v.squaredNorm();
+  VERIFY(sum == reference_sum(v));
+  VERIFY(dot == reference_sum(v.conjugate().cwiseProduct(u).eval()));
+  VERIFY(sqnorm == reference_sum(v.cwiseAbs2().eval()));
+  VERIFY(v.norm() == internal::sqrt(sqnorm));
+  for(Index offset = 1; offset < 8; ++offset)
+  {
+    Map<PlainVectorType> v2(buffer + size + offset, size);
+    v2 = v;
+    VERIFY(v2.sum() == sum);
+    VERIFY(v2.dot(u) == dot);
+    VERIFY(v2.squaredNorm() == sqnorm);
+    VERIFY(v2.transpose().sum() == sum);
+  }
+  internal::aligned_delete(buffer, 2*size + 8);
+}
+
+template<typename MatrixType> void reproducible_matrix_redux(const MatrixType& m)
+{
+  typedef typename MatrixType::Index Index;
+  typedef typename MatrixType::Scalar Scalar;
+  typedef Matrix<Scalar,Dynamic,Dynamic,MatrixType::IsRowMajor ? RowMajor : ColMajor> BlockType;
+  Index rows = m.rows();
+  Index cols = m.cols();
+
+  MatrixType a = MatrixType::Random(rows, cols);
+  VERIFY(a.sum() == reference_sum(a));
+  VERIFY(a.cwiseAbs2().sum() == reference_sum(a.cwiseAbs2().eval()));
+
+  // blocks are not aligned, and are slice vectorized if vectorized at all
+  Index r = internal::random<Index>(1, rows), c = internal::random<Index>(1, cols);
+  Index i = internal::random<Index>(0, rows-r), j = internal::random<Index>(0, cols-c);
+  BlockType b = a.block(i, j, r, c);
+  const Scalar blockSum = b.sum();
+  VERIFY(a.block(i, j, r, c).sum() == blockSum);
+  VERIFY(blockSum == reference_sum(b));
+  VERIFY(a.block(i, j, r, c).squaredNorm() == b.squaredNorm());
+}
+
+template<typename Scalar> void reproducible_blocked_redux()
+{
+  typedef Matrix<Scalar,Dynamic,1> VectorType;
+  typedef typename VectorType::Index Index;
+  // large reductions are split into blocks of EIGEN_REDUX_BLOCK_SIZE coefficients
+  Index size = internal::random<Index>(2*EIGEN_REDUX_BLOCK_SIZE, 6*EIGEN_REDUX_BLOCK_SIZE);
+  Index blocks = (size + EIGEN_REDUX_BLOCK_SIZE - 1) / EIGEN_REDUX_BLOCK_SIZE;
+  VectorType v = VectorType::Random(size), v2(size+1);
+  std::vector<Scalar> partial(blocks);
+  for(Index k = 0; k < blocks; ++k)
+  {
+    Index start = k * EIGEN_REDUX_BLOCK_SIZE;
+    partial[k] = reference_sum(v.segment(start, (std::min)(size, start + EIGEN_REDUX_BLOCK_SIZE) - start).eval());
+  }
+  for(Index step = 1; step < blocks; step *= 2)
+    for(Index k = 0; k + step < blocks; k += 2*step)
+      partial[k] += partial[k+step];
+  VERIFY(v.sum() == partial[0]);
+  v2.tail(size) = v;
+  VERIFY(v2.tail(size).sum() == partial[0]);
+}
+
+template<typename Scalar> void compensated_redux()
+{
+  typedef Matrix<Scalar,Dynamic,1> VectorType;
+  // many numbers close to one: a naive summation loses most of the low bits
+  int size = internal::random<int>(5000,20000);
+  VectorType v = (VectorType::Ones(size) + VectorType::Random(size) * Scalar(1e-3));
+  double exact = v.template cast<double>().sum();
+  VERIFY(internal::abs(double(v.sum()) - exact) <= 4 * double(NumTraits<Scalar>::epsilon()) * exact);
+}
+
+void test_reproducible_redux()
+{
+  for(int i = 0; i < g_repeat; i++) {
+    CALL_SUBTEST_1( reproducible_vector_redux(VectorXf(internal::random<int>(1,1000))) );
+    CALL_SUBTEST_1( reproducible_matrix_redux(MatrixXf(internal::random<int>(1,100), internal::random<int>(1,100))) );
+    CALL_SUBTEST_1( reproducible_matrix_redux(Matrix4f()) );
+    CALL_SUBTEST_1( reproducible_blocked_redux<float>() );
+    CALL_SUBTEST_2( reproducible_vector_redux(VectorXd(internal::random<int>(1,1000))) );
+    CALL_SUBTEST_2( reproducible_matrix_redux(Matrix<double,Dynamic,Dynamic,RowMajor>(internal::random<int>(1,100), internal::random<int>(1,100))) );
+    CALL_SUBTEST_2( reproducible_blocked_redux<double>() );
+    CALL_SUBTEST_3( reproducible_vector_redux(VectorXcf(internal::random<int>(1,1000))) );
+    CALL_SUBTEST_3( reproducible_matrix_redux(MatrixXcd(internal::random<int>(1,100), internal::random<int>(1,100))) );
+    CALL_SUBTEST_4( reproducible_vector_redux(VectorXf(internal::random<int>(1,1000))) );
+    CALL_SUBTEST_4( reproducible_matrix_redux(MatrixXf(internal::random<int>(1,100), internal::random<int>(1,100))) );
+    CALL_SUBTEST_4( reproducible_blocked_redux<float>() );
+    CALL_SUBTEST_4( compensated_redux<float>() );
+    CALL_SUBTEST_5( reproducible_vector_redux(VectorXcd(internal::random<int>(1,1000))) );
+    CALL_SUBTEST_5( compensated_redux<double>() );
+  }
+}
@@ -25,6 +25,10 @@
 
 #include "sparse.h"
 
+template<typename T> struct keep_last_op {
+  T operator()(const T&, const T& b) const { return b; }
+};
+
 template<typename SparseMatrixType> void sparse_basic(const SparseMatrixType& ref)
 {
   typedef typename SparseMatrixType::Index Index;
@@ -344,6 +348,33 @@ template<typename SparseMatrixType> void sparse_basic(const SparseMatrixType& re
     SparseMatrixType m(rows,cols);
     m.setFromTriplets(triplets.begin(), triplets.end());
     VERIFY_IS_APPROX(m, refMat);
+
+    // with a custom functor for the duplicates
+    DenseMatrix refMatLast = DenseMatrix::Zero(rows,cols);
+    for(int i=0;i<ntriplets;++i)
+      refMatLast(triplets[i].row(), triplets[i].col()) = triplets[i].value();
+    m.setFromTriplets(triplets.begin(), triplets.end(), keep_last_op<Scalar>());
+    VERIFY_IS_APPROX(m, refMatLast);
+
+    // with an assembly plan
+    SparseMatrixType m2(rows,cols);
+    SparseAssemblyPlan<SparseMatrixType> plan;
+    plan.compute(triplets.begin(), triplets.end(), m2);
+    m.setFromTriplets(triplets.begin(), triplets.end());
+    VERIFY(m2.nonZeros()==m.nonZeros());
+    VERIFY_IS_APPROX(m2, refMat);
+    for(int i=0;i<ntriplets;++i)
+      triplets[i] = TripletType(triplets[i].row(), triplets[i].col(), internal::random<Scalar>());
+    refMat.setZero();
+    for(int i=0;i<ntriplets;++i)
+    {
+      refMat(triplets[i].row(), triplets[i].col()) += triplets[i].value();
+      refMatLast(triplets[i].row(), triplets[i].col()) = triplets[i].value();
+    }
+    plan.assemble(triplets.begin(), triplets.end(), m2);
+    VERIFY_IS_APPROX(m2, refMat);
+    plan.assemble(triplets.begin(), triplets.end(), m2, keep_last_op<Scalar>());
+    VERIFY_IS_APPROX(m2, refMatLast);
   }
 
   // test triangularView
@@ -406,5 +437,7 @@ void test_sparse_basic()
     CALL_SUBTEST_1(( sparse_basic(SparseMatrix<double>(s, s)) ));
     CALL_SUBTEST_1(( sparse_basic(SparseMatrix<double,ColMajor,long int>(s, s)) ));
     CALL_SUBTEST_1(( sparse_basic(SparseMatrix<double,RowMajor,long int>(s, s)) ));
+    CALL_SUBTEST_1(( sparse_basic(SparseMatrix<double,ColMajor,long int,int>(s, s)) ));
+    CALL_SUBTEST_1(( sparse_basic(SparseMatrix<double,RowMajor,int,short>(s, s)) ));
   }
 }
@@ -0,0 +1,164 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#include "sparse.h"
+#include <Eigen/IterativeLinearSolvers>
+
+template<typename Scalar, int BlockSize> void sparse_block_matrix()
+{
+  typedef Matrix<Scalar,Dynamic,Dynamic> DenseMatrix;
+  typedef Matrix<Scalar,Dynamic,1> DenseVector;
+  typedef BlockSparseMatrix<Scalar,BlockSize> BlockMatrix;
+
+  const int rows = BlockSize * internal::random<int>(1,40);
+  const int cols = BlockSize * internal::random<int>(1,40);
+  double density = (std::max)(8./(rows*cols), 0.01);
+
+  // conversion from column major and row major matrices
+  DenseMatrix refMat = DenseMatrix::Zero(rows, cols);
+  SparseMatrix<Scalar> m(rows, cols);
+  initSparse<Scalar>(density, refMat, m);
+  BlockMatrix bm(m);
+  VERIFY_IS_APPROX(DenseMatrix(bm), refMat);
+  VERIFY(bm.nonZeroBlocks() <= m.nonZeros());
+  SparseMatrix<Scalar,RowMajor> mr(m);
+  BlockMatrix bmr;
+  bmr = mr;
+  VERIFY_IS_APPROX(DenseMatrix(bmr), refMat);
+  for(int i=0; i<bm.blockRows(); ++i)
+    for(int k=bm.outerIndexPtr()[i]+1; k<bm.outerIndexPtr()[i+1]; ++k)
+      VERIFY(bm.innerIndexPtr()[k-1] < bm.innerIndexPtr()[k]);
+
+  // iterating over a row, blocks included
+  int r = internal::random<int>(0,rows-1);
+  DenseVector row = DenseVector::Zero(cols);
+  for(typename BlockMatrix::InnerIterator it(bm, r); it; ++it)
+  {
+    VERIFY_IS_EQUAL(it.row(), r);
+    row(it.index()) = it.value();
+  }
+  VERIFY_IS_APPROX(row, refMat.row(r).transpose());
+
+  // transposition
+  VERIFY_IS_APPROX(DenseMatrix(bm.transpose()), refMat.transpose());
+  VERIFY_IS_APPROX(DenseMatrix(bm.adjoint()), refMat.adjoint());
+
+  // products with dense vectors and matrices
+  Scalar s = internal::random<Scalar>();
+  DenseVector v = DenseVector::Random(cols), res = DenseVector::Random(rows);
+  DenseVector refRes = res;
+  VERIFY_IS_APPROX(DenseVector(bm * v), refMat * v);
+  res.noalias() += s * (bm * v);
+  refRes += s * (refMat * v);
+  VERIFY_IS_APPROX(res, refRes);
+  VERIFY_IS_APPROX(DenseVector(bm.adjoint() * res), refMat.adjoint() * res);
+  DenseMatrix B = DenseMatrix::Random(cols, internal::random<int>(1,20));
+  VERIFY_IS_APPROX(DenseMatrix(bm * B), refMat * B);
+  DenseMatrix X = DenseMatrix::Random(rows, B.cols());
+  DenseMatrix refX = X;
+  X.noalias() -= bm * B;
+  refX -= refMat * B;
+  VERIFY_IS_APPROX(X, refX);
+  VERIFY_IS_APPROX(DenseVector(bm * B.col(0)), refMat * B.col(0));
+
+  // selfadjoint products
+  DenseMatrix refSq = DenseMatrix::Zero(rows, rows);
+  SparseMatrix<Scalar> sq(rows, rows);
+  initSparse<Scalar>(density, refSq, sq);
+  BlockMatrix bsq(sq);
+  DenseMatrix B2 = DenseMatrix::Random(rows, internal::random<int>(1,5));
+  VERIFY_IS_APPROX(DenseMatrix(bsq.template selfadjointView<Lower>() * B2), refSq.template selfadjointView<Lower>() * B2);
+  VERIFY_IS_APPROX(DenseMatrix(bsq.template selfadjointView<Upper>() * B2), refSq.template selfadjointView<Upper>() * B2);
+  VERIFY_IS_APPROX(DenseMatrix(bsq.template selfadjointView<Lower|Upper>() * B2), refSq * B2);
+}
+
+// A block tridiagonal selfadjoint positive definite matrix, and a non symmetric one
+template<typename Scalar, int BlockSize> void sparse_block_solvers()
+{
+  typedef Matrix<Scalar,Dynamic,Dynamic> DenseMatrix;
+  typedef Matrix<Scalar,Dynamic,1> DenseVector;
+  typedef Matrix<Scalar,BlockSize,BlockSize> BlockType;
+  typedef BlockSparseMatrix<Scalar,BlockSize> BlockMatrix;
+
+  const int nodes = internal::random<int>(2,60);
+  const int n = nodes*BlockSize;
+  BlockType S = BlockType::Random();
+  S = S*S.adjoint() + BlockType::Identity();
+  BlockType C = BlockType::Random();
+  SparseMatrix<Scalar> spd(n, n), nonsym(n, n);
+  std::vector<Triplet<Scalar> > tspd, tnonsym;
+  for(int i=0; i<nodes; ++i)
+    for(int j=std::max(0,i-1); j<=std::min(nodes-1,i+1); ++j)
+    {
+      BlockType b = i==j ? BlockType(4*S) : BlockType(-S);
+      BlockType c = i==j ? BlockType(4*S) : j<i ? BlockType(-S) : C;
+      for(int p=0; p<BlockSize; ++p)
+        for(int q=0; q<BlockSize; ++q)
+        {
+          tspd.push_back(Triplet<Scalar>(i*BlockSize+p, j*BlockSize+q, b(p,q)));
+          tnonsym.push_back(Triplet<Scalar>(i*BlockSize+p, j*BlockSize+q, c(p,q)));
+        }
+    }
+  spd.setFromTriplets(tspd.begin(), tspd.end());
+  nonsym.setFromTriplets(tnonsym.begin(), tnonsym.end());
+
+  DenseVector b = DenseVector::Random(n);
+  BlockMatrix bspd(spd), bnonsym(nonsym);
+
+  ConjugateGradient<BlockMatrix, Lower> cg;
+  cg.setTolerance(1e-12);
+  cg.setMaxIterations(10*n);
+  cg.compute(bspd);
+  DenseVector x = cg.solve(b);
+  VERIFY(cg.info() == Success);
+  VERIFY_IS_APPROX(DenseMatrix(spd) * x, b);
+
+  ConjugateGradient<BlockMatrix, Lower|Upper, IdentityPreconditioner> cgFull;
+  cgFull.setTolerance(1e-12);
+  cgFull.setMaxIterations(10*n);
+  cgFull.compute(bspd);
+  x = cgFull.solve(b);
+  VERIFY(cgFull.info() == Success);
+  VERIFY_IS_APPROX(DenseMatrix(spd) * x, b);
+
+  BiCGSTAB<BlockMatrix> bicgstab;
+  bicgstab.setTolerance(1e-12);
+  bicgstab.setMaxIterations(10*n);
+  bicgstab.compute(bnonsym);
+  x = bicgstab.solve(b);
+  VERIFY(bicgstab.info() == Success);
+  VERIFY_IS_APPROX(DenseMatrix(nonsym) * x, b);
+}
+
+void test_sparse_block_matrix()
+{
+  for(int i = 0; i < g_repeat; i++) {
+    CALL_SUBTEST_1(( sparse_block_matrix<double,1>() ));
+    CALL_SUBTEST_1(( sparse_block_matrix<double,3>() ));
+    CALL_SUBTEST_1(( sparse_block_matrix<double,4>() ));
+    CALL_SUBTEST_1(( sparse_block_solvers<double,3>() ));
+    CALL_SUBTEST_1(( sparse_block_solvers<double,6>() ));
+    CALL_SUBTEST_2(( sparse_block_matrix<std::complex<double>,2>() ));
+    CALL_SUBTEST_2(( sparse_block_solvers<std::complex<double>,3>() ));
+  }
+}
@@ -28,8 +28,8 @@ template<typename SparseMatrixType, typename DenseMatrix, bool IsRowMajor=Sparse
 
 template<typename SparseMatrixType, typename DenseMatrix> struct test_outer<SparseMatrixType,DenseMatrix,false> {
   static void run(SparseMatrixType& m2, SparseMatrixType& m4, DenseMatrix& refMat2, DenseMatrix& refMat4) {
-    int c  = internal::random(0,m2.cols()-1);
-    int c1 = internal::random(0,m2.cols()-1);
+    int c  = internal::random<int>(0,int(m2.cols())-1);
+    int c1 = internal::random<int>(0,int(m2.cols())-1);
     VERIFY_IS_APPROX(m4=m2.col(c)*refMat2.col(c1).transpose(), refMat4=refMat2.col(c)*refMat2.col(c1).transpose());
     VERIFY_IS_APPROX(m4=refMat2.col(c1)*m2.col(c).transpose(), refMat4=refMat2.col(c1)*refMat2.col(c).transpose());
   }
@@ -37,8 +37,8 @@ template<typename SparseMatrixType, typename DenseMatrix> struct test_outer<Spar
 
 template<typename SparseMatrixType, typename DenseMatrix> struct test_outer<SparseMatrixType,DenseMatrix,true> {
   static void run(SparseMatrixType& m2, SparseMatrixType& m4, DenseMatrix& refMat2, DenseMatrix& refMat4) {
-    int r  = internal::random(0,m2.rows()-1);
-    int c1 = internal::random(0,m2.cols()-1);
+    int r  = internal::random<int>(0,int(m2.rows())-1);
+    int c1 = internal::random<int>(0,int(m2.cols())-1);
     VERIFY_IS_APPROX(m4=m2.row(r).transpose()*refMat2.col(c1).transpose(), refMat4=refMat2.row(r).transpose()*refMat2.col(c1).transpose());
     VERIFY_IS_APPROX(m4=refMat2.col(c1)*m2.row(r), refMat4=refMat2.col(c1)*refMat2.row(r));
   }
@@ -134,6 +134,34 @@ template<typename SparseMatrixType> void sparse_product()
     VERIFY_IS_APPROX(m6=m6*m6, refMat6=refMat6*refMat6);
   }
 
+  // test sparse * sparse with a reusable pattern
+  {
+    DenseMatrix refMat2 = DenseMatrix::Zero(rows, depth);
+    DenseMatrix refMat3 = DenseMatrix::Zero(depth, cols);
+    DenseMatrix refMat4 = DenseMatrix::Zero(rows, cols);
+    SparseMatrixType m2(rows, depth), m3(depth, cols), m4;
+    initSparse(density, refMat2, m2);
+    initSparse(density, refMat3, m3);
+    m2.makeCompressed();
+    m3.makeCompressed();
+
+    SparseProductPattern<SparseMatrixType> prod;
+    prod.compute(m2, m3, m4);
+    VERIFY_IS_APPROX(m4, refMat4=refMat2*refMat3);
+    Index nnz = m4.nonZeros();
+
+    // update the values only
+    m2 *= s1;
+    refMat2 *= s1;
+    for (Index k=0; k<m3.outerSize(); ++k)
+      for (typename SparseMatrixType::InnerIterator it(m3,k); it; ++it)
+        refMat3(it.row(),it.col()) = it.valueRef() = internal::random<Scalar>();
+    prod.evaluate(m2, m3, m4);
+    VERIFY(m4.nonZeros()==nnz);
+    VERIFY_IS_APPROX(m4, refMat4=refMat2*refMat3);
+    VERIFY_IS_APPROX(m4, SparseMatrixType(m2*m3));
+  }
+
   // test matrix - diagonal product
   {
     DenseMatrix refM2 = DenseMatrix::Zero(rows, rows);
@@ -185,6 +213,123 @@ template<typename SparseMatrixType> void sparse_product()
   }
 }
 
+// Checks the multithreaded sparse * dense and dense * sparse products against the dense ones.
+template<typename SparseMatrixType> void sparse_product_parallel()
+{
+  typedef typename SparseMatrixType::Index Index;
+  typedef typename SparseMatrixType::Scalar Scalar;
+  typedef Matrix<Scalar,Dynamic,Dynamic> DenseMatrix;
+  typedef Matrix<Scalar,Dynamic,1> DenseVector;
+  typedef Matrix<Scalar,1,Dynamic> DenseRowVector;
+
+  // large enough to go beyond EIGEN_SPARSE_PARALLEL_THRESHOLD
+  const Index rows = internal::random<int>(600,900);
+  const Index cols = internal::random<int>(600,900);
+  DenseMatrix refMat = DenseMatrix::Zero(rows, cols);
+  SparseMatrixType m(rows, cols);
+  initSparse(0.06, refMat, m);
+  m.makeCompressed();
+  // the threads are given ranges with the same number of nonzeros, whatever the index types
+  VERIFY(internal::sparse_outer_index_ptr<SparseMatrixType>::run(m) == m.outerIndexPtr());
+
+  DenseVector v = DenseVector::Random(cols), vt = DenseVector::Random(rows);
+  DenseVector r0 = DenseVector::Random(rows), rt0 = DenseVector::Random(cols);
+  DenseRowVector w = DenseRowVector::Random(rows);
+  Scalar s = internal::random<Scalar>();
+
+  // several right hand side columns go through the panel kernels, with some leftover columns
+  const Index nrhs = internal::random<int>(9,40);
+  DenseMatrix b = DenseMatrix::Random(cols, nrhs), bt = DenseMatrix::Random(rows, nrhs);
+  DenseMatrix c0 = DenseMatrix::Random(rows, nrhs), ct0 = DenseMatrix::Random(nrhs, cols);
+  Matrix<Scalar,Dynamic,16> b16 = Matrix<Scalar,Dynamic,16>::Random(cols, 16);
+
+  const int initialThreads = internal::nbThreads();
+  const int threads[] = { 1, 2, 3, initialThreads };
+  for(int k = 0; k < 4; ++k)
+  {
+    internal::setNbThreads(threads[k]);
+
+    DenseVector r = r0;
+    VERIFY_IS_APPROX(r = m*v, refMat*v);
+    VERIFY_IS_APPROX(r = m.transpose()*vt, refMat.transpose()*vt);
+
+    // the products accumulate into the destination
+    r = r0;
+    VERIFY_IS_APPROX(r += m*v, r0 + refMat*v);
+    r = r0;
+    VERIFY_IS_APPROX(r.noalias() -= s*(m*v), r0 - s*(refMat*v));
+    r = rt0;
+    VERIFY_IS_APPROX(r += m.transpose()*vt, rt0 + refMat.transpose()*vt);
+
+    // dense * sparse
+    DenseRowVector x = rt0.transpose();
+    VERIFY_IS_APPROX(x += w*m, rt0.transpose() + w*refMat);
+
+    // multiple right hand sides
+    DenseMatrix c = c0;
+    VERIFY_IS_APPROX(c = m*b, refMat*b);
+    c = c0;
+    VERIFY_IS_APPROX(c += s*(m*b), c0 + s*(refMat*b));
+    VERIFY_IS_APPROX(c = m.transpose()*bt, refMat.transpose()*bt);
+    VERIFY_IS_APPROX(c = m*b.leftCols(nrhs-3), refMat*b.leftCols(nrhs-3));
+    Matrix<Scalar,Dynamic,16> c16;
+    VERIFY_IS_APPROX(c16 = m*b16, refMat*b16);
+    c = ct0;
+    VERIFY_IS_APPROX(c += bt.transpose()*m, ct0 + bt.transpose()*refMat);
+  }
+  internal::setNbThreads(initialThreads);
+
+  // sparse * sparse: the columns of the result are split among the threads in both the symbolic and numeric passes
+  {
+    const Index n = internal::random<int>(150,250);
+    DenseMatrix refA = DenseMatrix::Zero(n, n), refB = DenseMatrix::Zero(n, n), refBt = DenseMatrix::Zero(n, n);
+    SparseMatrixType a(n, n), b(n, n), bt(n, n);
+    initSparse(0.1, refA, a);
+    initSparse(0.1, refB, b);
+    initSparse(0.1, refBt, bt);
+    const DenseMatrix refAB = refA*refB, refABt = refA*refBt.transpose(), refBtA = refBt.transpose()*refA;
+
+    internal::setNbThreads(1);
+    SparseMatrixType ref1 = a*b;
+    for(int k = 1; k < 4; ++k)
+    {
+      internal::setNbThreads(threads[k]);
+      SparseMatrixType p = a*b;
+      VERIFY(p.nonZeros() == ref1.nonZeros());
+      VERIFY_IS_APPROX(p, refAB);
+      VERIFY_IS_APPROX(p = a*bt.transpose(), refABt);
+      VERIFY_IS_APPROX(p = bt.transpose()*a, refBtA);
+      VERIFY_IS_APPROX(p = (a*b).pruned(), refAB);
+      SparseMatrix<Scalar,SparseMatrixType::IsRowMajor ? ColMajor : RowMajor> q;
+      VERIFY_IS_APPROX(q = a*b, refAB);
+    }
+    internal::setNbThreads(initialThreads);
+  }
+
+  // very sparse operands, whose columns are accumulated into hash tables
+  {
+    const Index n = internal::random<int>(3000,4000);
+    std::vector<Triplet<Scalar,Index> > entries;
+    for(Index k = 0; k < 5*n; ++k)
+      entries.push_back(Triplet<Scalar,Index>(internal::random<Index>(0,n-1), internal::random<Index>(0,n-1), internal::random<Scalar>()));
+    SparseMatrixType a(n, n);
+    a.setFromTriplets(entries.begin(), entries.end());
+    DenseVector x = DenseVector::Random(n);
+
+    internal::setNbThreads(1);
+    SparseMatrixType ref1 = a*a;
+    VERIFY_IS_APPROX(ref1*x, a*(a*x));
+    for(int k = 1; k < 4; ++k)
+    {
+      internal::setNbThreads(threads[k]);
+      SparseMatrixType p = a*a;
+      VERIFY(p.nonZeros() == ref1.nonZeros());
+      VERIFY_IS_APPROX(p, ref1);
+    }
+    internal::setNbThreads(initialThreads);
+  }
+}
+
 // New test for Bug in SparseTimeDenseProduct
 template<typename SparseMatrixType, typename DenseMatrixType> void sparse_product_regression_test()
 {
@@ -214,6 +359,12 @@ void test_sparse_product()
     CALL_SUBTEST_1( (sparse_product<SparseMatrix<double,RowMajor> >()) );
     CALL_SUBTEST_2( (sparse_product<SparseMatrix<std::complex<double>, ColMajor > >()) );
     CALL_SUBTEST_2( (sparse_product<SparseMatrix<std::complex<double>, RowMajor > >()) );
+    CALL_SUBTEST_3( (sparse_product<SparseMatrix<double,ColMajor,long int,int> >()) );
+    CALL_SUBTEST_3( (sparse_product<SparseMatrix<double,RowMajor,long int,int> >()) );
+    CALL_SUBTEST_3( (sparse_product_parallel<SparseMatrix<double,ColMajor,long int,int> >()) );
     CALL_SUBTEST_4( (sparse_product_regression_test<SparseMatrix<double,RowMajor>, Matrix<double, Dynamic, Dynamic, RowMajor> >()) );
+    CALL_SUBTEST_5( (sparse_product_parallel<SparseMatrix<double,ColMajor> >()) );
+    CALL_SUBTEST_5( (sparse_product_parallel<SparseMatrix<double,RowMajor> >()) );
+    CALL_SUBTEST_6( (sparse_product_parallel<SparseMatrix<std::complex<double>,RowMajor> >()) );
   }
 }
@@ -0,0 +1,137 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#include "sparse.h"
+#include <Eigen/IterativeLinearSolvers>
+
+template<typename Scalar> void sparse_sliced_ell()
+{
+  typedef Matrix<Scalar,Dynamic,Dynamic> DenseMatrix;
+  typedef Matrix<Scalar,Dynamic,Dynamic,RowMajor> RowMajorDenseMatrix;
+  typedef Matrix<Scalar,Dynamic,1> DenseVector;
+  typedef SlicedEllMatrix<Scalar> EllMatrix;
+
+  const int rows = internal::random<int>(1,200);
+  const int cols = internal::random<int>(1,200);
+  double density = (std::max)(8./(rows*cols), 0.01);
+
+  DenseMatrix refMat = DenseMatrix::Zero(rows, cols);
+  SparseMatrix<Scalar> m(rows, cols);
+  initSparse<Scalar>(density, refMat, m);
+  // a few dense rows make the lengths of the rows uneven
+  for(int k=0; k<3; ++k)
+  {
+    int r = internal::random<int>(0,rows-1);
+    refMat.row(r).setRandom();
+  }
+  m = refMat.sparseView();
+
+  for(int scope=1; scope<=512; scope*=8)
+  {
+    EllMatrix em(m, scope);
+    VERIFY_IS_EQUAL(em.sortingScope(), scope);
+    VERIFY_IS_EQUAL(em.nonZeros(), m.nonZeros());
+    VERIFY(em.storedCoefficients() >= em.nonZeros());
+    VERIFY_IS_APPROX(DenseMatrix(em), refMat);
+
+    int r = internal::random<int>(0,rows-1);
+    DenseVector row = DenseVector::Zero(cols);
+    for(typename EllMatrix::InnerIterator it(em, r); it; ++it)
+    {
+      VERIFY_IS_EQUAL(it.row(), r);
+      row(it.index()) = it.value();
+    }
+    VERIFY_IS_APPROX(row, refMat.row(r).transpose());
+  }
+
+  // conversion from a row major matrix
+  SparseMatrix<Scalar,RowMajor> mr(m);
+  EllMatrix em;
+  em.setSortingScope(32);
+  em = mr;
+  VERIFY_IS_APPROX(DenseMatrix(em), refMat);
+
+  // products with dense vectors and matrices
+  Scalar s = internal::random<Scalar>();
+  DenseVector v = DenseVector::Random(cols), res = DenseVector::Random(rows);
+  DenseVector refRes = res;
+  VERIFY_IS_APPROX(DenseVector(em * v), refMat * v);
+  res.noalias() += s * (em * v);
+  refRes += s * (refMat * v);
+  VERIFY_IS_APPROX(res, refRes);
+  DenseMatrix B = DenseMatrix::Random(cols, internal::random<int>(1,10));
+  VERIFY_IS_APPROX(DenseMatrix(em * B), refMat * B);
+  VERIFY_IS_APPROX(DenseMatrix(em * B.col(0)), refMat * B.col(0));
+  DenseMatrix Bt = B.transpose();
+  VERIFY_IS_APPROX(DenseVector(em * Bt.row(0).transpose()), refMat * B.col(0));
+  VERIFY_IS_APPROX(RowMajorDenseMatrix(em * B), refMat * B);
+  DenseMatrix X = DenseMatrix::Random(rows, B.cols());
+  DenseMatrix refX = X;
+  X.noalias() -= em * B;
+  refX -= refMat * B;
+  VERIFY_IS_APPROX(X, refX);
+}
+
+template<typename Scalar> void sparse_sliced_ell_solvers()
+{
+  typedef Matrix<Scalar,Dynamic,Dynamic> DenseMatrix;
+  typedef Matrix<Scalar,Dynamic,1> DenseVector;
+  typedef SlicedEllMatrix<Scalar> EllMatrix;
+
+  const int n = internal::random<int>(10,300);
+  double density = (std::max)(8./(n*n), 0.01);
+  DenseMatrix refMat = DenseMatrix::Zero(n, n);
+  SparseMatrix<Scalar> m(n, n);
+  initSparse<Scalar>(density, refMat, m, ForceNonZeroDiag);
+  DenseMatrix refSpd = refMat * refMat.adjoint();
+  refSpd.diagonal().array() += Scalar(n);
+  refMat.diagonal().array() += Scalar(n);
+  SparseMatrix<Scalar> spd = refSpd.sparseView(), nonsym = refMat.sparseView();
+  DenseVector b = DenseVector::Random(n);
+
+  EllMatrix espd(spd), enonsym(nonsym);
+  ConjugateGradient<EllMatrix, Lower|Upper> cg;
+  cg.setTolerance(1e-12);
+  cg.compute(espd);
+  DenseVector x = cg.solve(b);
+  VERIFY(cg.info() == Success);
+  VERIFY_IS_APPROX(refSpd * x, b);
+
+  BiCGSTAB<EllMatrix> bicgstab;
+  bicgstab.setTolerance(1e-12);
+  bicgstab.compute(enonsym);
+  x = bicgstab.solve(b);
+  VERIFY(bicgstab.info() == Success);
+  VERIFY_IS_APPROX(refMat * x, b);
+}
+
+void test_sparse_sliced_ell()
+{
+  for(int i = 0; i < g_repeat; i++) {
+    CALL_SUBTEST_1( sparse_sliced_ell<double>() );
+    CALL_SUBTEST_1( sparse_sliced_ell_solvers<double>() );
+    CALL_SUBTEST_2( sparse_sliced_ell<std::complex<double> >() );
+    CALL_SUBTEST_2( sparse_sliced_ell_solvers<std::complex<double> >() );
+    CALL_SUBTEST_3( sparse_sliced_ell<float>() );
+  }
+}
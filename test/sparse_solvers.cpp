@@ -109,6 +109,138 @@ template<typename Scalar> void sparse_solvers(int rows, int cols)
     m2.template triangularView<Upper>().solveInPlace(matB);
     VERIFY_IS_APPROX(matB, refMatB);
 
+    // level scheduled solves
+    {
+      DenseMatrix b = DenseMatrix::Random(rows, 3), x = b;
+      SparseTriangularSchedule<SparseMatrix<Scalar> > schedule;
+      initSparse<Scalar>(density, refMat2, m2, ForceNonZeroDiag|MakeLowerTriangular);
+      m2.makeCompressed();
+      schedule.template analyze<Lower>(m2);
+      schedule.solveInPlace(m2, x);
+      VERIFY_IS_APPROX(x, refMat2.template triangularView<Lower>().solve(b));
+      x = b;
+      schedule.template analyze<UnitLower>(m2);
+      schedule.solveInPlace(m2, x);
+      VERIFY_IS_APPROX(x, refMat2.template triangularView<UnitLower>().solve(b));
+      x = b;
+      schedule.template analyzeAdjoint<Upper>(m2);
+      schedule.solveInPlace(m2, x);
+      VERIFY_IS_APPROX(x, refMat2.adjoint().template triangularView<Upper>().solve(b));
+      VERIFY(schedule.levels()<=rows);
+
+      // the values can change, but not the pattern
+      m2 *= Scalar(2);
+      refMat2 *= Scalar(2);
+      x = b;
+      schedule.solveInPlace(m2, x);
+      VERIFY_IS_APPROX(x, refMat2.adjoint().template triangularView<Upper>().solve(b));
+
+      SparseMatrix<Scalar,RowMajor> m3(rows, cols);
+      SparseTriangularSchedule<SparseMatrix<Scalar,RowMajor> > scheduleRow;
+      initSparse<Scalar>(density, refMat2, m3, ForceNonZeroDiag|MakeUpperTriangular);
+      m3.makeCompressed();
+      x = b;
+      scheduleRow.template analyze<Upper>(m3);
+      scheduleRow.solveInPlace(m3, x);
+      VERIFY_IS_APPROX(x, refMat2.template triangularView<Upper>().solve(b));
+      x = b;
+      scheduleRow.template analyzeAdjoint<UnitLower>(m3);
+      scheduleRow.solveInPlace(m3, x);
+      VERIFY_IS_APPROX(x, refMat2.adjoint().template triangularView<UnitLower>().solve(b));
+    }
+
+    // blocked solves with many right hand sides, on sparse factors and on dense factors made of a single supernode
+    for(int k=0; k<2; ++k)
+    {
+      double d = k==0 ? density : 1;
+      DenseMatrix b = DenseMatrix::Random(rows, internal::random<int>(1,80)), x = b;
+      SparseSupernodalTriangularSolver<SparseMatrix<Scalar> > solver;
+      initSparse<Scalar>(d, refMat2, m2, ForceNonZeroDiag|MakeLowerTriangular);
+      m2.makeCompressed();
+      solver.template analyze<Lower>(m2);
+      solver.solveInPlace(m2, x);
+      VERIFY_IS_APPROX(x, refMat2.template triangularView<Lower>().solve(b));
+      VERIFY(solver.supernodes()<=rows);
+      x = b;
+      solver.template analyze<UnitLower>(m2);
+      solver.solveInPlace(m2, x);
+      VERIFY_IS_APPROX(x, refMat2.template triangularView<UnitLower>().solve(b));
+      x = b;
+      solver.template analyzeAdjoint<Upper>(m2);
+      solver.solveInPlace(m2, x);
+      VERIFY_IS_APPROX(x, refMat2.adjoint().template triangularView<Upper>().solve(b));
+
+      initSparse<Scalar>(d, refMat2, m2, ForceNonZeroDiag|MakeUpperTriangular);
+      m2.makeCompressed();
+      x = b;
+      solver.template analyze<Upper>(m2);
+      solver.solveInPlace(m2, x);
+      VERIFY_IS_APPROX(x, refMat2.template triangularView<Upper>().solve(b));
+      x = b;
+      solver.template analyzeAdjoint<UnitLower>(m2);
+      solver.solveInPlace(m2, x);
+      VERIFY_IS_APPROX(x, refMat2.adjoint().template triangularView<UnitLower>().solve(b));
+
+      // restriction to the top-left block
+      int size = internal::random<int>(1,rows);
+      x = b;
+      solver.template analyze<Upper>(m2, size);
+      solver.solveInPlace(m2, x);
+      VERIFY_IS_APPROX(x.topRows(size), refMat2.topLeftCorner(size,size).template triangularView<Upper>().solve(b.topRows(size)));
+      VERIFY_IS_EQUAL(x.bottomRows(rows-size), b.bottomRows(rows-size));
+    }
+
+    // direct solvers with many right hand sides
+    {
+      DenseMatrix refSpd(rows, rows), b = DenseMatrix::Random(rows, 20);
+      SparseMatrix<Scalar> spd(rows, rows);
+      initSPD(density, refSpd, spd);
+      SimplicialLLT<SparseMatrix<Scalar>, Lower> llt(spd);
+      VERIFY_IS_APPROX(DenseMatrix(llt.solve(b)), refSpd.llt().solve(b));
+      SimplicialLDLT<SparseMatrix<Scalar>, Lower> ldlt(spd);
+      VERIFY_IS_APPROX(DenseMatrix(ldlt.solve(b)), refSpd.llt().solve(b));
+
+      // other fill-in reducing orderings
+      SimplicialLLT<SparseMatrix<Scalar>, Lower, NestedDissectionOrdering<int> > lltNd(spd);
+      VERIFY_IS_APPROX(DenseMatrix(lltNd.solve(b)), refSpd.llt().solve(b));
+      SimplicialLDLT<SparseMatrix<Scalar>, Lower, NaturalOrdering<int> > ldltNatural(spd);
+      VERIFY_IS_APPROX(DenseMatrix(ldltNatural.solve(b)), refSpd.llt().solve(b));
+
+      // the level schedules are computed by the first multithreaded solve, and again after a new factorization
+      const int initialThreads = internal::nbThreads();
+      internal::setNbThreads(3);
+      DenseMatrix refSpd2(rows, rows);
+      SparseMatrix<Scalar> spd2(rows, rows);
+      initSPD(density, refSpd2, spd2);
+      SimplicialLDLT<SparseMatrix<Scalar>, Lower> ldltThreads(spd);
+      VERIFY_IS_APPROX(DenseMatrix(ldltThreads.solve(b.leftCols(4))), refSpd.llt().solve(b.leftCols(4)));
+      VERIFY_IS_APPROX(DenseMatrix(ldltThreads.solve(b.leftCols(4))), refSpd.llt().solve(b.leftCols(4)));
+      ldltThreads.compute(spd2);
+      VERIFY_IS_APPROX(DenseMatrix(ldltThreads.solve(b.leftCols(4))), refSpd2.llt().solve(b.leftCols(4)));
+      VERIFY_IS_APPROX(DenseMatrix(ldltThreads.solve(b)), refSpd2.llt().solve(b));
+      SimplicialLLT<SparseMatrix<Scalar>, Upper> lltThreads(spd2.adjoint());
+      VERIFY_IS_APPROX(DenseMatrix(lltThreads.solve(b.col(0))), refSpd2.llt().solve(b.col(0)));
+      internal::setNbThreads(initialThreads);
+
+      // 64 bits positions with 32 bits inner indices
+      typedef SparseMatrix<Scalar,ColMajor,long int,int> MixedSparseMatrix;
+      MixedSparseMatrix spdMixed(spd);
+      SimplicialLLT<MixedSparseMatrix, Lower> lltMixed(spdMixed);
+      VERIFY_IS_APPROX(DenseMatrix(lltMixed.solve(b)), refSpd.llt().solve(b));
+
+      // a small leaf size forces a few levels of dissection
+      SparseMatrix<Scalar> spdFull;
+      spdFull = spd.template selfadjointView<Lower>();
+      NestedDissectionOrdering<int> nd(4);
+      PermutationMatrix<Dynamic,Dynamic,int> perm;
+      nd(spdFull, perm);
+      VERIFY_IS_EQUAL(perm.size(), rows);
+      std::vector<int> sorted(perm.indices().data(), perm.indices().data()+rows);
+      std::sort(sorted.begin(), sorted.end());
+      for(int k=0; k<rows; ++k)
+        VERIFY_IS_EQUAL(sorted[k], k);
+    }
+
     // test deprecated API
     initSparse<Scalar>(density, refMat2, m2, ForceNonZeroDiag|MakeLowerTriangular, &zeroCoords, &nonzeroCoords);
     VERIFY_IS_APPROX(refMat2.template triangularView<Lower>().solve(vec2),
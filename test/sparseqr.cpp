@@ -0,0 +1,146 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+//
+// Eigen is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// Alternatively, you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 2 of
+// the License, or (at your option) any later version.
+//
+// Eigen is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License or the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License and a copy of the GNU General Public License along with
+// Eigen. If not, see <http://www.gnu.org/licenses/>.
+
+#include "sparse.h"
+#include <Eigen/SparseQR>
+
+template<typename MatrixType,typename DenseMat>
+int generate_sparse_rectangular_problem(MatrixType& A, DenseMat& dA, int maxRows = 300)
+{
+  typedef typename MatrixType::Scalar Scalar;
+  int rows = internal::random<int>(1,maxRows);
+  int cols = internal::random<int>(1,rows);
+  double density = (std::max)(8./(rows*cols), 0.01);
+
+  A.resize(rows,cols);
+  dA.resize(rows,cols);
+  initSparse<Scalar>(density, dA, A, ForceNonZeroDiag);
+  A.makeCompressed();
+  return rows;
+}
+
+template<typename Scalar> void test_sparseqr_scalar()
+{
+  typedef SparseMatrix<Scalar,ColMajor> MatrixType;
+  typedef Matrix<Scalar,Dynamic,Dynamic> DenseMat;
+  typedef Matrix<Scalar,Dynamic,1> DenseVector;
+  MatrixType A;
+  DenseMat dA;
+  DenseVector refX,x,b;
+  SparseQR<MatrixType> solver;
+  generate_sparse_rectangular_problem(A,dA);
+
+  int n = A.cols();
+  b = dA * DenseVector::Random(n);
+  solver.compute(A);
+  VERIFY(solver.info() == Success);
+  VERIFY_IS_EQUAL(solver.rank(), n);
+
+  // the factors reconstruct the permuted matrix
+  DenseMat R = DenseMat(solver.matrixR());
+  DenseMat fullR = DenseMat::Zero(A.rows(),n);
+  fullR.topRows(R.rows()) = R;
+  VERIFY_IS_APPROX(DenseMat(solver.matrixQ() * fullR), dA * solver.colsPermutation());
+
+  // least-squares solution
+  x = solver.solve(b);
+  refX = dA.colPivHouseholderQr().solve(b);
+  VERIFY_IS_APPROX(x, refX);
+  VERIFY_IS_APPROX(b, dA * x);
+
+  b = DenseVector::Random(A.rows());
+  x = solver.solve(b);
+  VERIFY((dA.adjoint()*(dA*x-b)).norm() <= test_precision<Scalar>() * dA.norm() * (b.norm()+dA.norm()*x.norm()));
+
+  // Q is unitary
+  VERIFY_IS_APPROX(DenseVector(solver.matrixQ().adjoint() * DenseVector(solver.matrixQ() * b)), b);
+
+  // multiple right hand sides
+  DenseMat B = DenseMat::Random(A.rows(),internal::random<int>(1,8));
+  DenseMat X = solver.solve(B);
+  VERIFY_IS_APPROX(X, dA.colPivHouseholderQr().solve(B));
+  B = DenseMat::Random(A.rows(),internal::random<int>(8,80));
+  X = solver.solve(B);
+  VERIFY_IS_APPROX(X, dA.colPivHouseholderQr().solve(B));
+
+  // reuse the symbolic analysis with different values
+  MatrixType A2 = A;
+  for(int k=0; k<A2.nonZeros(); ++k)
+    A2.valuePtr()[k] = internal::random<Scalar>();
+  DenseMat dA2 = DenseMat(A2);
+  solver.factorize(A2);
+  VERIFY(solver.info() == Success);
+  b = dA2 * DenseVector::Random(n);
+  if(solver.rank()==n)
+    VERIFY_IS_APPROX(DenseVector(dA2 * solver.solve(b)), b);
+  // the supernodes of the new factor are detected by the first solve with many right hand sides
+  B = dA2 * DenseMat::Random(n, 12);
+  if(solver.rank()==n)
+    VERIFY_IS_APPROX(DenseMat(dA2 * DenseMat(solver.solve(B))), B);
+
+  // rank deficient problem: duplicate some columns
+  if(n>2)
+  {
+    DenseMat dA3(dA.rows(), n+2);
+    dA3 << dA, dA.col(0), dA.col(n/2);
+    MatrixType A3 = dA3.sparseView();
+    solver.compute(A3);
+    VERIFY(solver.info() == Success);
+    VERIFY_IS_EQUAL(solver.rank(), n);
+    b = dA3 * DenseVector::Random(n+2);
+    x = solver.solve(b);
+    VERIFY_IS_APPROX(DenseVector(dA3 * x), b);
+    B = dA3 * DenseMat::Random(n+2, 12);
+    X = solver.solve(B);
+    VERIFY_IS_APPROX(DenseMat(dA3 * X), B);
+  }
+
+  // other column ordering policies
+  b = dA * DenseVector::Random(n);
+  refX = dA.colPivHouseholderQr().solve(b);
+  SparseQR<MatrixType, COLAMDOrdering<int> > colamdSolver(A);
+  VERIFY(colamdSolver.info() == Success);
+  VERIFY_IS_APPROX(colamdSolver.solve(b), refX);
+  SparseQR<MatrixType, NaturalOrdering<int> > naturalSolver(A);
+  VERIFY(naturalSolver.info() == Success);
+  VERIFY_IS_APPROX(naturalSolver.solve(b), refX);
+
+  // COLAMD on least-squares problems, and with the symbolic analysis reused
+  b = DenseVector::Random(A.rows());
+  x = colamdSolver.solve(b);
+  VERIFY((dA.adjoint()*(dA*x-b)).norm() <= test_precision<Scalar>() * dA.norm() * (b.norm()+dA.norm()*x.norm()));
+  colamdSolver.factorize(A2);
+  VERIFY(colamdSolver.info() == Success);
+  b = dA2 * DenseVector::Random(n);
+  if(colamdSolver.rank()==n)
+    VERIFY_IS_APPROX(DenseVector(dA2 * colamdSolver.solve(b)), b);
+}
+
+void test_sparseqr()
+{
+  for(int i=0; i<g_repeat; ++i)
+  {
+    CALL_SUBTEST_1(test_sparseqr_scalar<double>());
+    CALL_SUBTEST_2(test_sparseqr_scalar<std::complex<double> >());
+  }
+}
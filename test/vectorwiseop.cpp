@@ -176,6 +176,67 @@ template<typename MatrixType> void vectorwiseop_matrix(const MatrixType& m)
   VERIFY_RAISES_ASSERT(m1.rowwise() - rowvec.transpose());
 }
 
+template<typename MatrixType> void vectorwiseop_partial_redux(const MatrixType& m)
+{
+  typedef typename MatrixType::Index Index;
+  typedef typename MatrixType::Scalar Scalar;
+  typedef typename NumTraits<Scalar>::Real RealScalar;
+  typedef Matrix<Scalar, Dynamic, 1> VectorType;
+  typedef Matrix<RealScalar, Dynamic, 1> RealVectorType;
+
+  Index rows = m.rows();
+  Index cols = m.cols();
+  MatrixType m1 = MatrixType::Random(rows, cols);
+  VectorType rowSums(rows), colSums(cols), tmp;
+  RealVectorType rowSqNorms(rows);
+  for(Index i = 0; i < rows; ++i)
+  {
+    rowSums(i) = m1.row(i).sum();
+    rowSqNorms(i) = m1.row(i).squaredNorm();
+  }
+  for(Index j = 0; j < cols; ++j)
+    colSums(j) = m1.col(j).sum();
+
+  // the partial reductions give the same results as the reductions of the rows and columns
+  tmp = m1.rowwise().sum();
+  VERIFY(tmp == rowSums);
+  tmp = m1.colwise().sum().transpose();
+  VERIFY(tmp == colSums);
+  RealVectorType realTmp = m1.rowwise().squaredNorm();
+  VERIFY(realTmp == rowSqNorms);
+  realTmp = m1.rowwise().norm();
+  VERIFY(realTmp == rowSqNorms.cwiseSqrt());
+  tmp = m1.rowwise().mean();
+  for(Index i = 0; i < rows; ++i)
+    VERIFY(tmp(i) == m1.row(i).mean());
+  tmp = m1.rowwise().prod();
+  for(Index i = 0; i < rows; ++i)
+    VERIFY(tmp(i) == m1.row(i).prod());
+  tmp = m1.rowwise().redux(internal::scalar_sum_op<Scalar>());
+  VERIFY(tmp == rowSums);
+
+  // the destination and the nested expression can be blocks
+  Index r = internal::random<Index>(1, rows), c = internal::random<Index>(1, cols);
+  MatrixType m2 = MatrixType::Zero(rows, cols);
+  m2.col(c-1).head(r) = m1.topLeftCorner(r, c).rowwise().sum();
+  for(Index i = 0; i < r; ++i)
+    VERIFY(m2(i,c-1) == m1.row(i).head(c).sum());
+  m2.row(r-1).head(c) = (m1.topLeftCorner(r, c) * Scalar(2)).colwise().sum();
+  for(Index j = 0; j < c; ++j)
+    VERIFY_IS_APPROX(m2(r-1,j), (m1.col(j).head(r) * Scalar(2)).sum());
+  // dynamic blocks which are not vectors at compile time, and have no linear access
+  Matrix<Scalar, Dynamic, Dynamic, MatrixType::IsRowMajor ? ColMajor : RowMajor> m3(rows, cols);
+  m3.setZero();
+  m3.block(r-1, 0, 1, cols) = m1.colwise().sum();
+  VERIFY(VectorType(m3.row(r-1).transpose()) == colSums);
+  m3.block(0, c-1, rows, 1) = m1.rowwise().sum();
+  VERIFY(VectorType(m3.col(c-1)) == rowSums);
+
+  // arrays
+  tmp = m1.array().rowwise().sum();
+  VERIFY(tmp == rowSums);
+}
+
 void test_vectorwiseop()
 {
   CALL_SUBTEST_1(vectorwiseop_array(Array22cd()));
@@ -184,4 +245,10 @@ void test_vectorwiseop()
   CALL_SUBTEST_4(vectorwiseop_matrix(Matrix4cf()));
   CALL_SUBTEST_5(vectorwiseop_matrix(Matrix<float,4,5>()));
   CALL_SUBTEST_6(vectorwiseop_matrix(MatrixXd(7,2)));
+  for(int i = 0; i < g_repeat; i++) {
+    CALL_SUBTEST_7(vectorwiseop_partial_redux(MatrixXf(internal::random<int>(1,1500), internal::random<int>(1,50))));
+    CALL_SUBTEST_7(vectorwiseop_partial_redux(MatrixXd(internal::random<int>(1,50), internal::random<int>(1,1500))));
+    CALL_SUBTEST_8(vectorwiseop_partial_redux(Matrix<double,Dynamic,Dynamic,RowMajor>(internal::random<int>(1,1500), internal::random<int>(1,50))));
+    CALL_SUBTEST_8(vectorwiseop_partial_redux(MatrixXcf(internal::random<int>(1,700), internal::random<int>(1,30))));
+  }
 }
@@ -114,6 +114,71 @@ template<typename VectorType> void vectorVisitor(const VectorType& w)
   VERIFY_IS_APPROX(maxc, v.maxCoeff());
 }
 
+// the locations reported by the visitors of large expressions are the first ones in column-major order
+template<typename MatrixType, typename Xpr>
+void checkFirstMinMax(const MatrixType& m, const Xpr& xpr)
+{
+  typedef typename MatrixType::Index Index;
+  typedef typename MatrixType::Scalar Scalar;
+  Index minrow=0, mincol=0, maxrow=0, maxcol=0;
+  for(Index j = 0; j < m.cols(); j++)
+  for(Index i = 0; i < m.rows(); i++)
+  {
+    if(m(i,j) < m(minrow,mincol)) { minrow = i; mincol = j; }
+    if(m(i,j) > m(maxrow,maxcol)) { maxrow = i; maxcol = j; }
+  }
+  Index eigen_minrow, eigen_mincol, eigen_maxrow, eigen_maxcol;
+  Scalar eigen_minc = xpr.minCoeff(&eigen_minrow,&eigen_mincol);
+  Scalar eigen_maxc = xpr.maxCoeff(&eigen_maxrow,&eigen_maxcol);
+  VERIFY_IS_EQUAL(eigen_minc, m(minrow,mincol));
+  VERIFY_IS_EQUAL(eigen_maxc, m(maxrow,maxcol));
+  VERIFY(minrow == eigen_minrow && mincol == eigen_mincol);
+  VERIFY(maxrow == eigen_maxrow && maxcol == eigen_maxcol);
+}
+
+template<typename MatrixType> void largeVisitor(const MatrixType& p)
+{
+  typedef typename MatrixType::Index Index;
+  typedef typename MatrixType::Scalar Scalar;
+  typedef Matrix<Scalar,Dynamic,1> VectorType;
+  Index rows = p.rows(), cols = p.cols();
+
+  // few distinct values, so that the min and max are reached many times
+  MatrixType m(rows, cols);
+  for(Index k = 0; k < m.size(); ++k)
+    m(k) = Scalar(internal::random<int>(-20,20));
+  checkFirstMinMax(m, m);
+  checkFirstMinMax(m, m.array());
+
+  MatrixType m2 = MatrixType::Random(rows, cols);
+  MatrixType sum = m + m2;
+  checkFirstMinMax(sum, m + m2);
+
+  // unique extrema located at random places
+  Index r = internal::random<Index>(0,rows-1), c = internal::random<Index>(0,cols-1);
+  m.setZero();
+  m(r,c) = Scalar(-1);
+  m(rows-1-r,cols-1-c) = Scalar(1);
+  checkFirstMinMax(m, m);
+
+  // vectors, at unaligned offsets
+  VectorType v(m.size());
+  for(Index k = 0; k < v.size(); ++k)
+    v(k) = Scalar(internal::random<int>(-20,20));
+  Index start = internal::random<Index>(0,3);
+  Index size = v.size() - start - internal::random<Index>(0,3);
+  VectorType seg = v.segment(start,size);
+  checkFirstMinMax(seg, v.segment(start,size));
+  typename VectorType::Index minidx, maxidx;
+  VERIFY_IS_EQUAL(v.segment(start,size).minCoeff(&minidx), seg.minCoeff());
+  VERIFY_IS_EQUAL(v.segment(start,size).maxCoeff(&maxidx), seg.maxCoeff());
+  Index refidx;
+  seg.minCoeff(&refidx, (Index*)0);
+  VERIFY(minidx == refidx);
+  seg.maxCoeff(&refidx, (Index*)0);
+  VERIFY(maxidx == refidx);
+}
+
 void test_visitor()
 {
   for(int i = 0; i < g_repeat; i++) {
@@ -130,4 +195,11 @@ void test_visitor()
     CALL_SUBTEST_9( vectorVisitor(RowVectorXd(10)) );
     CALL_SUBTEST_10( vectorVisitor(VectorXf(33)) );
   }
+  for(int i = 0; i < g_repeat; i++) {
+    CALL_SUBTEST_11( largeVisitor(MatrixXf(internal::random<int>(1,200), internal::random<int>(100,400))) );
+    CALL_SUBTEST_11( largeVisitor(MatrixXf(1, internal::random<int>(5000,50000))) );
+    CALL_SUBTEST_12( largeVisitor(MatrixXd(internal::random<int>(100,300), internal::random<int>(1,300))) );
+    CALL_SUBTEST_12( largeVisitor(Matrix<double,Dynamic,Dynamic,RowMajor>(internal::random<int>(100,300), 100)) );
+    CALL_SUBTEST_13( largeVisitor(MatrixXi(internal::random<int>(100,300), internal::random<int>(100,300))) );
+  }
 }